@@ -0,0 +1,6 @@
+# 各性能测试程序共用的配置，不属于默认的构建，需要在顶层执行 qmake CONFIG+=ENABLE_BENCHMARKS
+include($$PWD/../common/common.pri)
+
+TEMPLATE = app
+CONFIG += c++11 console
+CONFIG -= app_bundle
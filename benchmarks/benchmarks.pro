@@ -0,0 +1,9 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    desktop-entries \
+    filename-index \
+    inotify-storm \
+    model-insert \
+    pinyin \
+    tag-database
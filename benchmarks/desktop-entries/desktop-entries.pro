@@ -0,0 +1,15 @@
+include(../benchmarks.pri)
+
+QT -= gui
+
+TARGET = benchmark-desktop-entries
+
+SOURCES += \
+    main.cpp
+
+INCLUDEPATH += $$PWD/../../dde-file-manager-lib \
+               $$PWD/../../dde-file-manager-lib/interfaces \
+               $$PWD/../../dde-file-manager-lib/shutil
+
+unix: LIBS += -L$$OUT_PWD/../../dde-file-manager-lib -ldde-file-manager
+unix: QMAKE_RPATHDIR += $$OUT_PWD/../../dde-file-manager-lib
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 统计 DesktopEntrySnapshot 在没有缓存时解析所有desktop文件的时间，以及有缓存时加载、
+// 检查更新和读取所有desktop文件的时间。缓存文件保存在临时目录中，不影响文件管理器的缓存
+//
+// benchmark-desktop-entries [--folders 目录1,目录2] [--repeat 10]
+
+#include "desktopentrysnapshot.h"
+#include "mimesappsmanager.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QElapsedTimer>
+
+#include <cstdio>
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("folders", "Comma separated application folders, the folders of the file manager by default.",
+                                        "folders", MimesAppsManager::getApplicationsFolders().join(',')));
+    parser.addOption(QCommandLineOption("repeat", "The count of loading the cache file.", "count", "10"));
+    parser.process(app);
+
+    const QStringList &folders = parser.value("folders").split(',', QString::SkipEmptyParts);
+    const QStringList dependencies {MimesAppsManager::getDDEMimeTypeFile(), MimesAppsManager::getMimeInfoCacheFilePath()};
+    const int repeat = qMax(parser.value("repeat").toInt(), 1);
+    QTemporaryDir temporary_dir;
+    const QString &cache_file = temporary_dir.path() + "/DesktopEntries.cache";
+    QElapsedTimer timer;
+
+    // 没有缓存时需要列出所有目录并解析所有文件
+    {
+        DesktopEntrySnapshot snapshot(cache_file);
+
+        timer.start();
+        snapshot.update(folders, dependencies);
+        const qint64 parse_time = timer.elapsed();
+
+        snapshot.setAssociationsUpdated();
+        timer.restart();
+
+        if (!snapshot.save()) {
+            fprintf(stderr, "Failed to save the cache file: %s\n", qPrintable(cache_file));
+
+            return 1;
+        }
+
+        printf("desktop files:             %d\n", snapshot.filePaths().size());
+        printf("parse without cache:       %lld ms\n", parse_time);
+        printf("save cache:                %lld ms\n", timer.elapsed());
+    }
+
+    qint64 min_load_time = -1;
+    qint64 min_update_time = -1;
+    qint64 min_read_time = -1;
+
+    for (int i = 0; i < repeat; ++i) {
+        DesktopEntrySnapshot snapshot(cache_file);
+
+        timer.restart();
+
+        if (!snapshot.load()) {
+            fprintf(stderr, "Failed to load the cache file: %s\n", qPrintable(cache_file));
+
+            return 1;
+        }
+
+        const qint64 load_time = timer.elapsed();
+
+        // 目录没有变化时只检查目录的修改时间
+        timer.restart();
+
+        if (snapshot.update(folders, dependencies)) {
+            fprintf(stderr, "The desktop files changed while running the benchmark\n");
+        }
+
+        const qint64 update_time = timer.elapsed();
+
+        // 打开“打开方式”对话框时才会读取所有文件
+        timer.restart();
+
+        for (const QString &path : snapshot.filePaths()) {
+            snapshot.desktopFile(path);
+        }
+
+        const qint64 read_time = timer.elapsed();
+
+        min_load_time = min_load_time < 0 ? load_time : qMin(min_load_time, load_time);
+        min_update_time = min_update_time < 0 ? update_time : qMin(min_update_time, update_time);
+        min_read_time = min_read_time < 0 ? read_time : qMin(min_read_time, read_time);
+    }
+
+    printf("load cache:                %lld ms\n", min_load_time);
+    printf("update without changes:    %lld ms\n", min_update_time);
+    printf("read all desktop files:    %lld ms\n", min_read_time);
+
+    return 0;
+}
@@ -0,0 +1,15 @@
+include(../benchmarks.pri)
+
+QT -= gui
+
+TARGET = benchmark-filename-index
+
+SOURCES += \
+    main.cpp
+
+INCLUDEPATH += $$PWD/../../dde-file-manager-lib \
+               $$PWD/../../dde-file-manager-lib/interfaces \
+               $$PWD/../../dde-file-manager-lib/io
+
+unix: LIBS += -L$$OUT_PWD/../../dde-file-manager-lib -ldde-file-manager
+unix: QMAKE_RPATHDIR += $$OUT_PWD/../../dde-file-manager-lib
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 统计 DFileNameIndex 建立索引的时间，以及按文件名搜索时返回第一页结果和全部结果的延迟，
+// 并和遍历目录搜索的延迟对比。索引建立在目录所在的整个挂载点上，保存在用户的缓存目录中
+//
+// benchmark-filename-index [--dir 目录] [--keywords a,doc,test,*.txt] [--page 100] [--no-walk]
+
+#include "dfilenameindex.h"
+#include "ddiriterator.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QDir>
+
+#include <cstdio>
+
+DFM_USE_NAMESPACE
+
+struct Result {
+    qint64 firstPageTime = -1;
+    qint64 totalTime = 0;
+    int count = 0;
+};
+
+static Result searchByIndex(DDirIterator *iterator, int pageSize)
+{
+    Result result;
+    QElapsedTimer timer;
+
+    timer.start();
+
+    while (iterator->hasNext()) {
+        iterator->next();
+
+        if (++result.count == pageSize)
+            result.firstPageTime = timer.elapsed();
+    }
+
+    result.totalTime = timer.elapsed();
+
+    if (result.firstPageTime < 0)
+        result.firstPageTime = result.totalTime;
+
+    return result;
+}
+
+static Result searchByWalk(const QString &directory, const QString &keyword, int pageSize)
+{
+    Result result;
+    QElapsedTimer timer;
+    const QStringList name_filters {keyword.contains('*') || keyword.contains('?') ? keyword : '*' + keyword + '*'};
+
+    timer.start();
+
+    QDirIterator iterator(directory, name_filters, QDir::AllEntries | QDir::NoDotAndDotDot | QDir::System,
+                          QDirIterator::Subdirectories);
+
+    while (iterator.hasNext()) {
+        iterator.next();
+
+        if (++result.count == pageSize)
+            result.firstPageTime = timer.elapsed();
+    }
+
+    result.totalTime = timer.elapsed();
+
+    if (result.firstPageTime < 0)
+        result.firstPageTime = result.totalTime;
+
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("dir", "The directory to search in, the home directory by default.", "path", QDir::homePath()));
+    parser.addOption(QCommandLineOption("keywords", "Comma separated keywords to search for.", "keywords", "a,doc,test,*.txt"));
+    parser.addOption(QCommandLineOption("page", "The count of the results in the first page.", "count", "100"));
+    parser.addOption(QCommandLineOption("timeout", "Seconds to wait for the index to be built.", "seconds", "3600"));
+    parser.addOption(QCommandLineOption("no-walk", "Do not compare with walking the directory."));
+    parser.process(app);
+
+    const QString &directory = QDir(parser.value("dir")).absolutePath();
+    const QStringList &keywords = parser.value("keywords").split(',', QString::SkipEmptyParts);
+    const int page_size = parser.value("page").toInt();
+    const qint64 timeout = parser.value("timeout").toLongLong() * 1000;
+
+    // 索引不可用时 createDirIterator 会在后台开始建立索引，等待建立完成
+    QElapsedTimer build_timer;
+    DDirIterator *iterator = nullptr;
+
+    build_timer.start();
+
+    while (!(iterator = DFileNameIndex::instance()->createDirIterator(directory, keywords.value(0), QDir::Hidden))) {
+        if (build_timer.elapsed() > timeout) {
+            fprintf(stderr, "The file name index of %s is not available\n", qPrintable(directory));
+
+            return 1;
+        }
+
+        QThread::msleep(100);
+    }
+
+    delete iterator;
+
+    printf("directory:              %s\n", qPrintable(directory));
+    printf("index ready in:         %lld ms\n", build_timer.elapsed());
+    printf("%-16s %12s %12s %10s %12s %12s\n", "keyword", "index page", "index total", "results",
+           "walk page", "walk total");
+
+    for (const QString &keyword : keywords) {
+        QElapsedTimer timer;
+
+        timer.start();
+
+        // 打开迭代器的时间也计入延迟
+        QScopedPointer<DDirIterator> index_iterator(DFileNameIndex::instance()->createDirIterator(directory, keyword, QDir::Hidden));
+        const qint64 create_time = timer.elapsed();
+
+        if (!index_iterator) {
+            fprintf(stderr, "Failed to create the iterator for: %s\n", qPrintable(keyword));
+            continue;
+        }
+
+        Result index_result = searchByIndex(index_iterator.data(), page_size);
+
+        index_result.firstPageTime += create_time;
+        index_result.totalTime += create_time;
+
+        if (parser.isSet("no-walk")) {
+            printf("%-16s %9lld ms %9lld ms %10d\n", qPrintable(keyword), index_result.firstPageTime,
+                   index_result.totalTime, index_result.count);
+            continue;
+        }
+
+        const Result &walk_result = searchByWalk(directory, keyword, page_size);
+
+        printf("%-16s %9lld ms %9lld ms %10d %9lld ms %9lld ms\n", qPrintable(keyword), index_result.firstPageTime,
+               index_result.totalTime, index_result.count, walk_result.firstPageTime, walk_result.totalTime);
+    }
+
+    return 0;
+}
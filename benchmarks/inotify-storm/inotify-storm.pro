@@ -0,0 +1,14 @@
+include(../benchmarks.pri)
+
+QT -= gui
+
+TARGET = benchmark-inotify-storm
+
+SOURCES += \
+    main.cpp
+
+INCLUDEPATH += $$PWD/../../dde-file-manager-lib \
+               $$PWD/../../dde-file-manager-lib/interfaces
+
+unix: LIBS += -L$$OUT_PWD/../../dde-file-manager-lib -ldde-file-manager
+unix: QMAKE_RPATHDIR += $$OUT_PWD/../../dde-file-manager-lib
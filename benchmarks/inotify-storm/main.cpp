@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 在被监视的目录中快速创建大量文件，统计 DFileSystemWatcher 发出的信号数量和主线程事件循环的延迟，
+// 用于检查 inotify 事件的批量处理和事件风暴时的回退
+//
+// benchmark-inotify-storm [--files 100000] [--rate 0] [--delete] [--dir 目录]
+
+#include "dfilesystemwatcher.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QElapsedTimer>
+#include <QTimer>
+#include <QFile>
+#include <QDir>
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+static void writeFiles(const QByteArray &directory, int count, int rate, bool remove, std::atomic<bool> *finished)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < count; ++i) {
+        const QByteArray &path = directory + "/storm-" + QByteArray::number(i);
+        int fd = ::open(path.constData(), O_CREAT | O_WRONLY | O_CLOEXEC, 0644);
+
+        if (fd >= 0) {
+            ::close(fd);
+        }
+
+        // 按指定的速率创建文件
+        if (rate > 0) {
+            std::this_thread::sleep_until(start + std::chrono::microseconds(static_cast<qint64>(i + 1) * 1000000 / rate));
+        }
+    }
+
+    if (remove) {
+        for (int i = 0; i < count; ++i) {
+            ::unlink((directory + "/storm-" + QByteArray::number(i)).constData());
+        }
+    }
+
+    finished->store(true);
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("files", "The count of the files to create.", "count", "100000"));
+    parser.addOption(QCommandLineOption("rate", "Files created per second, 0 means as fast as possible.", "rate", "0"));
+    parser.addOption(QCommandLineOption("delete", "Delete the files after creating them."));
+    parser.addOption(QCommandLineOption("dir", "The directory to create the files in, a temporary directory by default.", "path"));
+    parser.process(app);
+
+    QTemporaryDir temporary_dir;
+    const QString &directory = parser.isSet("dir") ? QDir(parser.value("dir")).absolutePath() : temporary_dir.path();
+    const int file_count = parser.value("files").toInt();
+    const int rate = parser.value("rate").toInt();
+
+    if (!QDir().mkpath(directory)) {
+        fprintf(stderr, "Failed to create the directory: %s\n", qPrintable(directory));
+
+        return 1;
+    }
+
+    DFileSystemWatcher watcher;
+    qint64 created_signals = 0;
+    qint64 deleted_signals = 0;
+    qint64 other_signals = 0;
+    qint64 rescan_signals = 0;
+    QTimer quiet_timer;
+
+    quiet_timer.setSingleShot(true);
+    quiet_timer.setInterval(2000);
+
+    auto on_signal = [&quiet_timer] (qint64 *counter) {
+        ++*counter;
+
+        if (quiet_timer.isActive()) {
+            quiet_timer.start();
+        }
+    };
+
+    QObject::connect(&watcher, &DFileSystemWatcher::fileCreated, [&] {
+        on_signal(&created_signals);
+    });
+    QObject::connect(&watcher, &DFileSystemWatcher::fileDeleted, [&] {
+        on_signal(&deleted_signals);
+    });
+    QObject::connect(&watcher, &DFileSystemWatcher::fileModified, [&] {
+        on_signal(&other_signals);
+    });
+    QObject::connect(&watcher, &DFileSystemWatcher::fileClosed, [&] {
+        on_signal(&other_signals);
+    });
+    QObject::connect(&watcher, &DFileSystemWatcher::fileAttributeChanged, [&] {
+        on_signal(&other_signals);
+    });
+    QObject::connect(&watcher, &DFileSystemWatcher::subfilesChanged, [&] {
+        on_signal(&rescan_signals);
+    });
+
+    if (!watcher.addPath(directory)) {
+        fprintf(stderr, "Failed to watch the directory: %s\n", qPrintable(directory));
+
+        return 1;
+    }
+
+    // 用固定间隔的定时器检测主线程被阻塞的时间
+    const int probe_interval = 10;
+    QTimer probe_timer;
+    QElapsedTimer probe_clock;
+    qint64 max_latency = 0;
+    qint64 total_latency = 0;
+    qint64 probe_count = 0;
+
+    std::atomic<bool> writer_finished{false};
+    QElapsedTimer total_clock;
+    qint64 write_time = -1;
+
+    probe_timer.setInterval(probe_interval);
+    QObject::connect(&probe_timer, &QTimer::timeout, [&] {
+        const qint64 latency = qMax(Q_INT64_C(0), probe_clock.restart() - probe_interval);
+
+        max_latency = qMax(max_latency, latency);
+        total_latency += latency;
+        ++probe_count;
+
+        // 写入结束后等待事件处理完毕
+        if (write_time < 0 && writer_finished.load()) {
+            write_time = total_clock.elapsed();
+            quiet_timer.start();
+        }
+    });
+
+    QObject::connect(&quiet_timer, &QTimer::timeout, &app, &QCoreApplication::quit);
+
+    total_clock.start();
+    probe_clock.start();
+    probe_timer.start();
+
+    std::thread writer(writeFiles, QFile::encodeName(directory), file_count, rate, parser.isSet("delete"), &writer_finished);
+
+    app.exec();
+    writer.join();
+
+    // 减去最后等待的静默时间
+    const qint64 total_time = total_clock.elapsed() - quiet_timer.interval();
+
+    printf("files:                  %d\n", file_count);
+    printf("write time:             %lld ms\n", write_time);
+    printf("events handled in:      %lld ms\n", total_time);
+    printf("fileCreated signals:    %lld\n", created_signals);
+    printf("fileDeleted signals:    %lld\n", deleted_signals);
+    printf("other file signals:     %lld\n", other_signals);
+    printf("subfilesChanged:        %lld\n", rescan_signals);
+    printf("max event loop latency: %lld ms\n", max_latency);
+    printf("avg event loop latency: %.2f ms\n", probe_count > 0 ? static_cast<double>(total_latency) / probe_count : 0.0);
+
+    if (!parser.isSet("delete")) {
+        for (int i = 0; i < file_count; ++i) {
+            QFile::remove(directory + "/storm-" + QString::number(i));
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 向已列出大量文件的目录视图发送大量 AddFile 事件，统计全部插入完成的时间和主线程事件循环的延迟，
+// 用于检查 DFileSystemModel 排序插入的性能。
+// 事件直接发给模型，不经过 inotify，避免事件风暴时的回退改为刷新整个目录。
+//
+// benchmark-model-insert -platform offscreen [--existing 100000] [--files 50000] [--append] [--dir 目录]
+
+#include "dfmglobal.h"
+#include "durl.h"
+#include "dfileview.h"
+#include "dfilesystemmodel.h"
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QFile>
+#include <QDir>
+
+#include <functional>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+// 运行事件循环直到 condition 成立，超时返回false
+static bool waitFor(const std::function<bool()> &condition, int timeout)
+{
+    QEventLoop loop;
+    QTimer poll_timer;
+    QElapsedTimer timer;
+
+    timer.start();
+    poll_timer.setInterval(10);
+    QObject::connect(&poll_timer, &QTimer::timeout, &loop, [&] {
+        if (condition() || timer.elapsed() > timeout)
+            loop.quit();
+    });
+    poll_timer.start();
+
+    if (!condition())
+        loop.exec();
+
+    return condition();
+}
+
+static bool createFile(const QString &path)
+{
+    int fd = ::open(QFile::encodeName(path).constData(), O_CREAT | O_WRONLY | O_CLOEXEC, 0644);
+
+    if (fd < 0)
+        return false;
+
+    ::close(fd);
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    QApplication app(argc, argv);
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("existing", "The count of the files already in the directory.", "count", "100000"));
+    parser.addOption(QCommandLineOption("files", "The count of the AddFile events.", "count", "50000"));
+    parser.addOption(QCommandLineOption("append", "Name the new files so that they are sorted after the existing files."));
+    parser.addOption(QCommandLineOption("timeout", "Seconds to wait for each step.", "seconds", "600"));
+    parser.addOption(QCommandLineOption("dir", "The directory to create the files in, a temporary directory by default.", "path"));
+    parser.process(app);
+
+    QTemporaryDir temporary_dir;
+    const QString &directory = parser.isSet("dir") ? QDir(parser.value("dir")).absolutePath() : temporary_dir.path();
+    const int existing_count = parser.value("existing").toInt();
+    const int file_count = parser.value("files").toInt();
+    const int timeout = parser.value("timeout").toInt() * 1000;
+
+    if (!QDir().mkpath(directory)) {
+        fprintf(stderr, "Failed to create the directory: %s\n", qPrintable(directory));
+
+        return 1;
+    }
+
+    // 默认新文件和已有文件按名称交替排列，每个新文件都插入到不同的位置
+    QList<DUrl> new_files;
+
+    for (int i = 0; i < existing_count; ++i) {
+        createFile(directory + QString("/file-%1").arg(i * 2, 8, 10, QChar('0')));
+    }
+
+    for (int i = 0; i < file_count; ++i) {
+        const QString &path = parser.isSet("append") ? directory + QString("/new-%1").arg(i, 8, 10, QChar('0'))
+                                                     : directory + QString("/file-%1").arg(i * 2 + 1, 8, 10, QChar('0'));
+
+        createFile(path);
+        new_files << DUrl::fromLocalFile(path);
+    }
+
+    DFMGlobal::initFileSiganlManager();
+    DFMGlobal::initAppcontroller();
+    DFMGlobal::initFileService();
+
+    DFileView view;
+    QElapsedTimer timer;
+
+    view.resize(800, 600);
+    view.show();
+
+    timer.start();
+    view.setRootUrl(DUrl::fromLocalFile(directory));
+
+    DFileSystemModel *model = view.model();
+    const int total_count = existing_count + file_count;
+
+    if (!waitFor([&] { return model->state() == DFileSystemModel::Idle && model->rowCount() == total_count; }, timeout)) {
+        fprintf(stderr, "Failed to list the directory, %d of %d files\n", model->rowCount(), total_count);
+
+        return 1;
+    }
+
+    const qint64 list_time = timer.elapsed();
+
+    // 先从模型中移除新文件，再发送它们的 AddFile 事件，磁盘上的文件不变
+    for (const DUrl &url : new_files) {
+        QMetaObject::invokeMethod(model, "_q_onFileDeleted", Q_ARG(DUrl, url));
+    }
+
+    if (!waitFor([&] { return model->rowCount() == existing_count; }, timeout)) {
+        fprintf(stderr, "Failed to remove the files from the model, %d rows left\n", model->rowCount());
+
+        return 1;
+    }
+
+    // 用固定间隔的定时器检测主线程被阻塞的时间
+    const int probe_interval = 10;
+    QTimer probe_timer;
+    QElapsedTimer probe_clock;
+    qint64 max_latency = 0;
+    qint64 total_latency = 0;
+    qint64 probe_count = 0;
+
+    probe_timer.setInterval(probe_interval);
+    QObject::connect(&probe_timer, &QTimer::timeout, [&] {
+        const qint64 latency = qMax(Q_INT64_C(0), probe_clock.restart() - probe_interval);
+
+        max_latency = qMax(max_latency, latency);
+        total_latency += latency;
+        ++probe_count;
+    });
+
+    timer.restart();
+    probe_clock.start();
+    probe_timer.start();
+
+    for (const DUrl &url : new_files) {
+        QMetaObject::invokeMethod(model, "_q_onFileCreated", Q_ARG(DUrl, url));
+    }
+
+    const bool finished = waitFor([&] { return model->rowCount() == total_count; }, timeout);
+    const qint64 insert_time = timer.elapsed();
+
+    probe_timer.stop();
+
+    printf("existing files:         %d\n", existing_count);
+    printf("AddFile events:         %d\n", file_count);
+    printf("directory listed in:    %lld ms\n", list_time);
+    printf("files inserted in:      %lld ms%s\n", insert_time, finished ? "" : " (timeout)");
+    printf("rows after insert:      %d\n", model->rowCount());
+    printf("max event loop latency: %lld ms\n", max_latency);
+    printf("avg event loop latency: %.2f ms\n", probe_count > 0 ? static_cast<double>(total_latency) / probe_count : 0.0);
+
+    if (parser.isSet("dir")) {
+        QDir(directory).removeRecursively();
+    }
+
+    return finished ? 0 : 1;
+}
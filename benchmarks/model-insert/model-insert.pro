@@ -0,0 +1,17 @@
+include(../benchmarks.pri)
+
+QT += widgets
+CONFIG += link_pkgconfig
+PKGCONFIG += dtkwidget
+
+TARGET = benchmark-model-insert
+
+SOURCES += \
+    main.cpp
+
+INCLUDEPATH += $$PWD/../../dde-file-manager-lib \
+               $$PWD/../../dde-file-manager-lib/interfaces \
+               $$PWD/../../dde-file-manager-lib/views
+
+unix: LIBS += -L$$OUT_PWD/../../dde-file-manager-lib -ldde-file-manager
+unix: QMAKE_RPATHDIR += $$OUT_PWD/../../dde-file-manager-lib
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 对随机生成的文件名调用 Pinyin::Chinese2Pinyin，统计单线程和多线程下的耗时，
+// 文件名中汉字与其它字符混合，按拼音排序时每个文件名都会转换一次
+//
+// benchmark-pinyin [--names 1000000] [--seed 1]
+
+#include "chinese2pinyin.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <QAtomicInteger>
+#include <QtConcurrent>
+
+#include <random>
+#include <cstdio>
+
+static QStringList createNames(int count, unsigned int seed)
+{
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<int> kind(0, 9);
+    std::uniform_int_distribution<int> han(0x4e00, 0x9fa5);
+    std::uniform_int_distribution<int> han_count(1, 8);
+    std::uniform_int_distribution<int> number(0, 99999);
+    static const char *const suffixes[] = {".txt", ".jpg", ".png", ".docx", ".mp4", ""};
+    std::uniform_int_distribution<int> suffix(0, 5);
+    QStringList names;
+
+    names.reserve(count);
+
+    for (int i = 0; i < count; ++i) {
+        QString name;
+
+        // 约三成的文件名不包含汉字
+        if (kind(engine) < 3) {
+            name = QString("IMG_%1").arg(number(engine), 5, 10, QChar('0'));
+        } else {
+            const int length = han_count(engine);
+
+            for (int j = 0; j < length; ++j) {
+                name.append(QChar(han(engine)));
+            }
+
+            if (kind(engine) < 5) {
+                name.append(QString::number(number(engine)));
+            }
+        }
+
+        names << name + suffixes[suffix(engine)];
+    }
+
+    return names;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("names", "The count of the file names.", "count", "1000000"));
+    parser.addOption(QCommandLineOption("seed", "The seed of the random file names.", "seed", "1"));
+    parser.process(app);
+
+    QStringList names = createNames(parser.value("names").toInt(), parser.value("seed").toUInt());
+    QElapsedTimer timer;
+    qint64 total_length = 0;
+
+    // 先转换一次，避免首次访问数据时的缺页影响结果
+    for (int i = 0; i < qMin(names.size(), 1000); ++i) {
+        total_length += Pinyin::Chinese2Pinyin(names.at(i)).size();
+    }
+
+    total_length = 0;
+    timer.start();
+
+    for (const QString &name : names) {
+        total_length += Pinyin::Chinese2Pinyin(name).size();
+    }
+
+    const qint64 single_thread_time = timer.nsecsElapsed();
+    QAtomicInteger<qint64> concurrent_length(0);
+
+    timer.restart();
+
+    // 转换函数没有全局状态，可以在多个线程中同时调用
+    QtConcurrent::blockingMap(names, [&concurrent_length] (const QString &name) {
+        concurrent_length.fetchAndAddRelaxed(Pinyin::Chinese2Pinyin(name).size());
+    });
+
+    const qint64 multi_thread_time = timer.nsecsElapsed();
+
+    if (concurrent_length.load() != total_length) {
+        fprintf(stderr, "The results of the single thread and the multiple threads are different\n");
+
+        return 1;
+    }
+
+    printf("names:               %d\n", names.size());
+    printf("output characters:   %lld\n", total_length);
+    printf("single thread:       %.2f ms, %.1f ns per name\n",
+           single_thread_time / 1e6, static_cast<double>(single_thread_time) / qMax(1, names.size()));
+    printf("%2d threads:          %.2f ms, %.1f ns per name\n", QThreadPool::globalInstance()->maxThreadCount(),
+           multi_thread_time / 1e6, static_cast<double>(multi_thread_time) / qMax(1, names.size()));
+
+    return 0;
+}
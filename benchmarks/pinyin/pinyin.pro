@@ -0,0 +1,11 @@
+include(../benchmarks.pri)
+
+QT -= gui
+QT += concurrent
+
+TARGET = benchmark-pinyin
+
+include(../../chinese2pinyin/chinese2pinyin.pri)
+
+SOURCES += \
+    main.cpp
@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// 统计 DSqliteHandle 为大量文件添加标记、查询标记、重命名、移除标记和删除文件记录的时间。
+// 和 dde-file-manager-daemon 一样直接调用 DSqliteHandle::disposeClientData，不经过 DBus。
+// 标记数据保存在 --dir 所在分区挂载点下的 .__deepin.db 中，需要有写入权限，
+// 请使用单独挂载的分区（如挂载的 loop 设备），不要在根分区或 /home 上运行。
+// 结束时会删除添加的记录和创建的文件
+//
+// benchmark-tag-database --dir 目录 [--files 100000] [--batch 0] [--tag benchmark]
+
+#include "durl.h"
+#include "dsqlitehandle.h"
+#include "tag/tagutil.h"
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QDir>
+
+#include <functional>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+typedef QMap<QString, QList<QString>> FilesAndTags;
+
+static bool createFile(const QString &path)
+{
+    int fd = ::open(QFile::encodeName(path).constData(), O_CREAT | O_WRONLY | O_CLOEXEC, 0644);
+
+    if (fd < 0)
+        return false;
+
+    ::close(fd);
+
+    return true;
+}
+
+// 和 TagManagerDaemon::disposeClientData 一样转义文件名和标记名
+static FilesAndTags escape(const FilesAndTags &filesAndTags)
+{
+    FilesAndTags result;
+
+    for (auto it = filesAndTags.cbegin(); it != filesAndTags.cend(); ++it) {
+        QList<QString> values;
+
+        for (const QString &value : it.value()) {
+            values << Tag::escaping_en_skim(value);
+        }
+
+        result[Tag::escaping_en_skim(it.key())] = values;
+    }
+
+    return result;
+}
+
+// 按 batchSize 拆分为多次调用，batchSize 为0时一次处理所有文件，返回耗时
+static qint64 dispose(const QStringList &files, const std::function<QList<QString>(int)> &valuesOf,
+                      Tag::ActionType type, int batchSize, bool *ok)
+{
+    QElapsedTimer timer;
+    const int batch_size = batchSize > 0 ? batchSize : qMax(files.size(), 1);
+    QList<FilesAndTags> batches;
+
+    // 参数的准备不计入耗时
+    for (int i = 0; i < files.size(); i += batch_size) {
+        FilesAndTags files_and_tags;
+
+        for (int j = i; j < qMin(i + batch_size, files.size()); ++j) {
+            files_and_tags[files.at(j)] = valuesOf(j);
+        }
+
+        batches << escape(files_and_tags);
+    }
+
+    *ok = true;
+    timer.start();
+
+    for (const FilesAndTags &files_and_tags : batches) {
+        const QVariant &result = DSqliteHandle::instance()->disposeClientData(files_and_tags, static_cast<unsigned long long>(type));
+
+        if (result.type() == QVariant::Bool && !result.toBool())
+            *ok = false;
+    }
+
+    return timer.elapsed();
+}
+
+static void printResult(const char *name, qint64 time, bool ok)
+{
+    printf("%-24s %9lld ms%s\n", name, time, ok ? "" : " (failed)");
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCommandLineParser parser;
+
+    parser.addHelpOption();
+    parser.addOption(QCommandLineOption("dir", "The directory to create the files in, it must be on a separate partition.", "path"));
+    parser.addOption(QCommandLineOption("files", "The count of the files.", "count", "100000"));
+    parser.addOption(QCommandLineOption("batch", "The count of the files in one request, 0 means all files.", "count", "0"));
+    parser.addOption(QCommandLineOption("tag", "The name of the tag.", "name", "benchmark"));
+    parser.process(app);
+
+    if (!parser.isSet("dir")) {
+        parser.showHelp(1);
+    }
+
+    const QString &directory = QDir(parser.value("dir")).absolutePath() + "/benchmark-tag-database";
+    const int file_count = parser.value("files").toInt();
+    const int batch_size = parser.value("batch").toInt();
+    const QString &tag_name = parser.value("tag");
+
+    if (!QDir().mkpath(directory)) {
+        fprintf(stderr, "Failed to create the directory: %s\n", qPrintable(directory));
+
+        return 1;
+    }
+
+    QStringList files;
+    QStringList renamed_files;
+
+    for (int i = 0; i < file_count; ++i) {
+        const QString &path = directory + QString("/file-%1").arg(i, 8, 10, QChar('0'));
+
+        if (!createFile(path)) {
+            fprintf(stderr, "Failed to create the file: %s\n", qPrintable(path));
+
+            return 1;
+        }
+
+        files << path;
+        renamed_files << directory + QString("/renamed-%1").arg(i, 8, 10, QChar('0'));
+    }
+
+    const auto tag = [&] (int) {
+        return QList<QString> {tag_name};
+    };
+    const auto no_value = [] (int) {
+        return QList<QString> {QString()};
+    };
+    bool ok = false;
+    qint64 time = 0;
+
+    printf("files:                   %d\n", file_count);
+    printf("files in one request:    %d\n", batch_size > 0 ? qMin(batch_size, file_count) : file_count);
+
+    time = dispose(files, tag, Tag::ActionType::MakeFilesTags, batch_size, &ok);
+    printResult("tag files:", time, ok);
+
+    time = dispose(files, no_value, Tag::ActionType::GetTagsThroughFile, batch_size, &ok);
+    printResult("get tags of files:", time, ok);
+
+    // 先重命名磁盘上的文件，和文件管理器中的顺序一致，这部分不计入耗时
+    for (int i = 0; i < file_count; ++i) {
+        if (::rename(QFile::encodeName(files.at(i)).constData(), QFile::encodeName(renamed_files.at(i)).constData()) != 0) {
+            fprintf(stderr, "Failed to rename the file: %s\n", qPrintable(files.at(i)));
+
+            return 1;
+        }
+    }
+
+    time = dispose(files, [&] (int index) {
+        return QList<QString> {renamed_files.at(index)};
+    }, Tag::ActionType::ChangeFilesName, batch_size, &ok);
+    printResult("rename files:", time, ok);
+
+    time = dispose(renamed_files, tag, Tag::ActionType::RemoveTagsOfFiles, batch_size, &ok);
+    printResult("untag files:", time, ok);
+
+    // 重新添加标记后再删除文件的记录
+    dispose(renamed_files, tag, Tag::ActionType::MakeFilesTags, batch_size, &ok);
+
+    for (const QString &file : renamed_files) {
+        QFile::remove(file);
+    }
+
+    time = dispose(renamed_files, no_value, Tag::ActionType::DeleteFiles, batch_size, &ok);
+    printResult("delete files:", time, ok);
+
+    QDir(directory).removeRecursively();
+
+    return 0;
+}
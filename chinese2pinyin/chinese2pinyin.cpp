@@ -27,58 +27,57 @@
 // in the LICENSE file.
 
 #include "chinese2pinyin.h"
-
-#include <QHash>
-#include <QTextStream>
-#include <QFile>
+#include "pinyin_table.h"
 
 namespace Pinyin {
 
-static QHash<uint, QString> dict = {};
-
-const char kDictFile[] = ":/misc/pinyin.dict";
-
-void InitDict() {
-    if (!dict.isEmpty()) {
-        return;
+// 返回字符对应的拼音，没有时返回nullptr
+static inline const char *lookup(ushort code, int *length)
+{
+    if (code < Table::kFirstCode || code > Table::kLastCode) {
+        return nullptr;
     }
 
-    dict.reserve(25333);
-
-    QFile file(kDictFile);
+    const ushort index = Table::kIndex[code - Table::kFirstCode];
 
-    if (!file.open(QIODevice::ReadOnly))
-        return;
-
-    QByteArray content = file.readAll();
+    if (index == 0) {
+        return nullptr;
+    }
 
-    file.close();
+    *length = Table::kOffsets[index] - Table::kOffsets[index - 1];
 
-    QTextStream stream(&content, QIODevice::ReadOnly);
+    return Table::kPool + Table::kOffsets[index - 1];
+}
 
-    while (!stream.atEnd()) {
-        const QString line = stream.readLine();
-        const QStringList items = line.split(QChar(':'));
+QString Chinese2Pinyin(const QString& words) {
+    const QChar *begin = words.constData();
+    const QChar *end = begin + words.size();
+    int resultLength = 0;
+    int length = 0;
+
+    // 先计算结果的长度，只分配一次内存
+    for (const QChar *c = begin; c != end; ++c) {
+        resultLength += lookup(c->unicode(), &length) ? length : 1;
+    }
 
-        if (items.size() == 2) {
-            dict.insert(items[0].toInt(nullptr, 16), items[1]);
-        }
+    // 拼音至少有两个字符，长度不变说明没有汉字，直接返回原字符串
+    if (resultLength == words.size()) {
+        return words;
     }
-}
 
-QString Chinese2Pinyin(const QString& words) {
-    InitDict();
+    QString result(resultLength, Qt::Uninitialized);
+    QChar *out = result.data();
 
-    QString result;
+    for (const QChar *c = begin; c != end; ++c) {
+        const char *pinyin = lookup(c->unicode(), &length);
 
-    for (int i = 0; i < words.length(); ++i) {
-        const uint key = words.at(i).unicode();
-        auto find_result = dict.find(key);
+        if (!pinyin) {
+            *out++ = *c;
+            continue;
+        }
 
-        if (find_result != dict.end()) {
-            result.append(find_result.value());
-        } else {
-            result.append(words.at(i));
+        for (int i = 0; i < length; ++i) {
+            *out++ = QLatin1Char(pinyin[i]);
         }
     }
 
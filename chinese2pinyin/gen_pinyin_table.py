@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# 根据 pinyin.dict 生成 pinyin_table.h，修改字典后需要重新运行:
+#     python3 gen_pinyin_table.py pinyin.dict pinyin_table.h
+
+import sys
+
+
+def main(dict_path, output_path):
+    entries = {}
+
+    with open(dict_path, encoding='utf-8') as f:
+        for line in f:
+            items = line.strip().split(':')
+
+            if len(items) == 2 and items[1]:
+                entries[int(items[0], 16)] = items[1]
+
+    first_code = min(entries)
+    last_code = max(entries)
+
+    # 相同的拼音只存放一次
+    syllables = sorted(set(entries.values()))
+    syllable_index = {s: i + 1 for i, s in enumerate(syllables)}
+    offsets = [0]
+
+    for s in syllables:
+        offsets.append(offsets[-1] + len(s))
+
+    assert offsets[-1] < 0xffff and len(syllables) < 0xffff
+
+    out = []
+    out.append('// 由 gen_pinyin_table.py 根据 pinyin.dict 生成，请勿手动修改')
+    out.append('')
+    out.append('#ifndef PINYIN_TABLE_H')
+    out.append('#define PINYIN_TABLE_H')
+    out.append('')
+    out.append('namespace Pinyin {')
+    out.append('namespace Table {')
+    out.append('')
+    out.append('constexpr unsigned short kFirstCode = 0x%x;' % first_code)
+    out.append('constexpr unsigned short kLastCode = 0x%x;' % last_code)
+    out.append('constexpr int kMaxLength = %d;' % max(len(s) for s in syllables))
+    out.append('')
+    out.append('// 所有拼音连续存放，第i个拼音为 [kOffsets[i - 1], kOffsets[i])')
+    out.append('constexpr char kPool[] =')
+
+    line = ''
+    for s in syllables:
+        if len(line) + len(s) > 100:
+            out.append('    "%s"' % line)
+            line = ''
+        line += s
+    out.append('    "%s";' % line)
+    out.append('')
+
+    def array(name, values, per_line):
+        out.append('constexpr unsigned short %s[] = {' % name)
+        for i in range(0, len(values), per_line):
+            out.append('    ' + ', '.join(str(v) for v in values[i:i + per_line]) + ',')
+        out.append('};')
+        out.append('')
+
+    array('kOffsets', offsets, 16)
+
+    out.append('// 以 code - kFirstCode 为下标，值为拼音的序号(从1开始)，0表示没有对应的拼音')
+    array('kIndex', [syllable_index[entries[c]] if c in entries else 0 for c in range(first_code, last_code + 1)], 20)
+
+    out.append('} // namespace Table')
+    out.append('} // namespace Pinyin')
+    out.append('')
+    out.append('#endif // PINYIN_TABLE_H')
+
+    with open(output_path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1] if len(sys.argv) > 1 else 'pinyin.dict',
+         sys.argv[2] if len(sys.argv) > 2 else 'pinyin_table.h')
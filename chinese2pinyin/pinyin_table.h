@@ -0,0 +1,2703 @@
+// 由 gen_pinyin_table.py 根据 pinyin.dict 生成，请勿手动修改
+
+#ifndef PINYIN_TABLE_H
+#define PINYIN_TABLE_H
+
+namespace Pinyin {
+namespace Table {
+
+constexpr unsigned short kFirstCode = 0x3400;
+constexpr unsigned short kLastCode = 0xfa2d;
+constexpr int kMaxLength = 7;
+
+// 所有拼音连续存放，第i个拼音为 [kOffsets[i - 1], kOffsets[i])
+constexpr char kPool[] =
+    "a1a2a5ai1ai2ai3ai4an1an2an3an4ang1ang2ang3ang4ao1ao2ao3ao4ba1ba2ba3ba4ba5bai1bai2bai3bai4ban1ban3"
+    "ban4bang1bang3bang4bao1bao2bao3bao4bei1bei3bei4ben1ben3ben4beng1beng2beng3beng4bi1bi2bi3bi4bian1"
+    "bian3bian4biao1biao3biao4bie1bie2bie3bie4bin1bin4bing1bing3bing4bo1bo2bo3bo4bo5bu1bu2bu3bu4ca1ca3ca4"
+    "cai1cai2cai3cai4can1can2can3can4cang1cang2cang4cao1cao2cao3cao4ce4cen1cen2ceng1ceng2ceng4cha1cha2"
+    "cha3cha4chai1chai2chai3chai4chan1chan2chan3chan4chang1chang2chang3chang4chao1chao2chao3chao4che1che3"
+    "che4chen1chen2chen3chen4cheng1cheng2cheng3cheng4chi1chi2chi3chi4chong1chong2chong3chong4chou1chou2"
+    "chou3chou4chu1chu2chu3chu4chua4chuai2chuai3chuai4chuan1chuan2chuan3chuan4chuang1chuang2chuang3"
+    "chuang4chui1chui2chui3chui4chun1chun2chun3chuo1chuo2chuo4ci1ci2ci3ci4cong1cong2cong4cou3cou4cu1cu2"
+    "cu4cuan1cuan2cuan4cui1cui2cui3cui4cun1cun2cun3cun4cuo1cuo2cuo3cuo4da1da2da3da4da5dai1dai3dai4dan1"
+    "dan3dan4dang1dang3dang4dao1dao3dao4de2de5deng1deng3deng4di1di2di3di4dia3dian1dian2dian3dian4diao1"
+    "diao3diao4die1die2die4ding1ding2ding3ding4diu1dong1dong3dong4dou1dou3dou4du1du2du3du4duan1duan3duan4"
+    "dui1dui3dui4dun1dun3dun4duo1duo2duo3duo4e1e2e3e4en1en3en4er2er3er4fa1fa2fa3fa4fan1fan2fan3fan4fang1"
+    "fang2fang3fang4fei1fei2fei3fei4fen1fen2fen3fen4feng1feng2feng3feng4fo2fou2fou3fou4fu1fu2fu3fu4ga1ga2"
+    "ga3ga4gai1gai3gai4gan1gan2gan3gan4gang1gang3gang4gao1gao3gao4ge1ge2ge3ge4gei3gen1gen3gen4geng1geng3"
+    "geng4gong1gong3gong4gou1gou3gou4gu1gu2gu3gu4gua1gua3gua4guai1guai3guai4guan1guan3guan4guang1guang3"
+    "guang4gui1gui2gui3gui4gun1gun3gun4guo1guo2guo3guo4guo5ha1ha2hai1hai2hai3hai4han1han2han3han4hang1"
+    "hang2hang3hang4hao1hao2hao3hao4he1he2he4hei1hen2hen3hen4heng1heng2heng4hong1hong2hong3hong4hou1hou2"
+    "hou3hou4hu1hu2hu3hu4hua1hua2hua3hua4huai1huai2huai4huan1huan2huan3huan4huang1huang2huang3huang4hui1"
+    "hui2hui3hui4hun1hun2hun3hun4huo1huo2huo3huo4ji1ji2ji3ji4jia1jia2jia3jia4jian1jian3jian4jiang1jiang3"
+    "jiang4jiao1jiao2jiao3jiao4jie1jie2jie3jie4jin1jin3jin4jing1jing3jing4jiong1jiong3jiong4jiu1jiu2jiu3"
+    "jiu4ju1ju2ju3ju4juan1juan3juan4jue1jue2jue3jue4jun1jun3jun4ka1ka3ka4kai1kai3kai4kan1kan3kan4kang1"
+    "kang2kang3kang4kao1kao3kao4ke1ke2ke3ke4ken3ken4keng1keng3kong1kong3kong4kou1kou3kou4ku1ku3ku4kua1"
+    "kua3kua4kuai1kuai3kuai4kuan1kuan3kuan4kuang1kuang2kuang3kuang4kui1kui2kui3kui4kun1kun3kun4kuo3kuo4"
+    "la1la2la3la4la5lai2lai3lai4lan2lan3lan4lang1lang2lang3lang4lao1lao2lao3lao4le4le5lei2lei3lei4lei5"
+    "leng2leng3leng4li1li2li3li4lia3lian2lian3lian4liang2liang3liang4liao1liao2liao3liao4lie1lie3lie4lin2"
+    "lin3lin4ling1ling2ling3ling4liu1liu2liu3liu4long2long3long4lou1lou2lou3lou4lou5lu1lu2lu3lu4luan2"
+    "luan3luan4lun1lun2lun3lun4luo1luo2luo3luo4lv2lv3lv4lve4ma1ma2ma3ma4ma5mai2mai3mai4man2man3man4mang2"
+    "mang3mao1mao2mao3mao4me5mei2mei3mei4men2men3men4men5meng2meng3meng4mi1mi2mi3mi4mian2mian3mian4miao1"
+    "miao2miao3miao4mie1mie4min2min3ming2ming3ming4miu4mo1mo2mo3mo4mo5mou1mou2mou3mou4mu2mu3mu4n3na2na3"
+    "na4nai2nai3nai4nan1nan2nan3nan4nang1nang2nang3nang4nao2nao3nao4ne4ne5nei3nei4nen1nen3nen4neng2neng4"
+    "ng4ni1ni2ni3ni4nian2nian3nian4niang2niang4niao3niao4nie1nie2nie4nin2nin3ning2ning3ning4niu1niu2niu3"
+    "niu4nong2nong3nong4nou2nou4nu2nu3nu4nuan3nuan4nuo2nuo3nuo4nv3nv4nve4o1ou1ou2ou3ou4pa1pa2pa4pai1pai2"
+    "pai3pai4pan1pan2pan3pan4pang1pang2pang3pang4pao1pao2pao3pao4pei1pei2pei3pei4pen1pen2pen3peng1peng2"
+    "peng3peng4pi1pi2pi3pi4pian1pian2pian3pian4piao1piao2piao3piao4pie1pie3pie4pin1pin2pin3pin4ping1ping2"
+    "po1po2po3po4pou1pou2pou3pou4pu1pu2pu3pu4qi1qi2qi3qi4qia1qia2qia3qia4qian1qian2qian3qian4qiang1qiang2"
+    "qiang3qiang4qiao1qiao2qiao3qiao4qie1qie2qie3qie4qin1qin2qin3qin4qing1qing2qing3qing4qiong1qiong2"
+    "qiong3qiu1qiu2qiu3qiu4qu1qu2qu3qu4quan1quan2quan3quan4que1que2que4qun1qun2qun3ran2ran3rang2rang3"
+    "rang4rao2rao3rao4re3re4ren2ren3ren4reng1reng2reng4ri4rong2rong3rong4rou2rou3rou4ru2ru3ru4ruan2ruan3"
+    "rui2rui3rui4run2run4ruo4sa1sa3sa4sai1sai3sai4sai5san1san3san4sang1sang3sao1sao3sao4se4sen1seng1sha1"
+    "sha3sha4shai1shai3shai4shan1shan3shan4shang1shang3shang4shao1shao2shao3shao4she1she2she3she4shen1"
+    "shen2shen3shen4sheng1sheng2sheng3sheng4shi1shi2shi3shi4shi5shou1shou3shou4shu1shu2shu3shu4shua1shua3"
+    "shua4shuai1shuai3shuai4shuan1shuan4shuang1shuang3shuang4shui2shui3shui4shun3shun4shuo1shuo4si1si3si4"
+    "song1song3song4sou1sou3sou4su1su2su4suan1suan3suan4sui1sui2sui3sui4sun1sun3sun4suo1suo3suo4ta1ta3ta4"
+    "tai1tai2tai4tan1tan2tan3tan4tang1tang2tang3tang4tao1tao2tao3tao4te4teng1teng2ti1ti2ti3ti4tian1tian2"
+    "tian3tian4tian5tiao1tiao2tiao3tiao4tie1tie3tie4ting1ting2ting3tong1tong2tong3tong4tou1tou2tou3tou4"
+    "tu1tu2tu3tu4tuan1tuan2tuan3tuan4tui1tui2tui3tui4tun1tun2tun3tun4tuo1tuo2tuo3tuo4wa1wa2wa3wa4wai1wai4"
+    "wan1wan2wan3wan4wang1wang2wang3wang4wei1wei2wei3wei4wen1wen2wen3wen4weng1weng3weng4wo1wo3wo4wu1wu2"
+    "wu3wu4xi1xi2xi3xi4xia1xia2xia3xia4xian1xian2xian3xian4xiang1xiang2xiang3xiang4xiao1xiao2xiao3xiao4"
+    "xie1xie2xie3xie4xin1xin2xin3xin4xing1xing2xing3xing4xiong1xiong2xiong4xiu1xiu3xiu4xu1xu2xu3xu4xuan1"
+    "xuan2xuan3xuan4xue1xue2xue3xue4xun1xun2xun4ya1ya2ya3ya4yai2yan1yan2yan3yan4yang1yang2yang3yang4yao1"
+    "yao2yao3yao4ye1ye2ye3ye4yi1yi2yi3yi4yin1yin2yin3yin4ying1ying2ying3ying4yo1yo5yong1yong2yong3yong4"
+    "you1you2you3you4yu1yu2yu3yu4yuan1yuan2yuan3yuan4yue1yue3yue4yun1yun2yun3yun4za1za2za3zai1zai3zai4"
+    "zan1zan2zan3zan4zang1zang3zang4zao1zao2zao3zao4ze2ze4zei2zen3zen4zeng1zeng3zeng4zha1zha2zha3zha4"
+    "zhai1zhai2zhai3zhai4zhan1zhan2zhan3zhan4zhang1zhang3zhang4zhao1zhao2zhao3zhao4zhe1zhe2zhe3zhe4zhen1"
+    "zhen3zhen4zheng1zheng3zheng4zhi1zhi2zhi3zhi4zhong1zhong3zhong4zhou1zhou2zhou3zhou4zhu1zhu2zhu3zhu4"
+    "zhua1zhua3zhuai3zhuan1zhuan3zhuan4zhuang1zhuang4zhui1zhui3zhui4zhun1zhun3zhun4zhuo1zhuo2zhuo3zhuo4"
+    "zi1zi3zi4zong1zong3zong4zou1zou3zou4zu1zu2zu3zuan1zuan3zuan4zui1zui3zui4zun1zun3zun4zuo1zuo2zuo3zuo4";
+
+constexpr unsigned short kOffsets[] = {
+    0, 2, 4, 6, 9, 12, 15, 18, 21, 24, 27, 30, 34, 38, 42, 46,
+    49, 52, 55, 58, 61, 64, 67, 70, 73, 77, 81, 85, 89, 93, 97, 101,
+    106, 111, 116, 120, 124, 128, 132, 136, 140, 144, 148, 152, 156, 161, 166, 171,
+    176, 179, 182, 185, 188, 193, 198, 203, 208, 213, 218, 222, 226, 230, 234, 238,
+    242, 247, 252, 257, 260, 263, 266, 269, 272, 275, 278, 281, 284, 287, 290, 293,
+    297, 301, 305, 309, 313, 317, 321, 325, 330, 335, 340, 344, 348, 352, 356, 359,
+    363, 367, 372, 377, 382, 386, 390, 394, 398, 403, 408, 413, 418, 423, 428, 433,
+    438, 444, 450, 456, 462, 467, 472, 477, 482, 486, 490, 494, 499, 504, 509, 514,
+    520, 526, 532, 538, 542, 546, 550, 554, 560, 566, 572, 578, 583, 588, 593, 598,
+    602, 606, 610, 614, 619, 625, 631, 637, 643, 649, 655, 661, 668, 675, 682, 689,
+    694, 699, 704, 709, 714, 719, 724, 729, 734, 739, 742, 745, 748, 751, 756, 761,
+    766, 770, 774, 777, 780, 783, 788, 793, 798, 802, 806, 810, 814, 818, 822, 826,
+    830, 834, 838, 842, 846, 849, 852, 855, 858, 861, 865, 869, 873, 877, 881, 885,
+    890, 895, 900, 904, 908, 912, 915, 918, 923, 928, 933, 936, 939, 942, 945, 949,
+    954, 959, 964, 969, 974, 979, 984, 988, 992, 996, 1001, 1006, 1011, 1016, 1020, 1025,
+    1030, 1035, 1039, 1043, 1047, 1050, 1053, 1056, 1059, 1064, 1069, 1074, 1078, 1082, 1086, 1090,
+    1094, 1098, 1102, 1106, 1110, 1114, 1116, 1118, 1120, 1122, 1125, 1128, 1131, 1134, 1137, 1140,
+    1143, 1146, 1149, 1152, 1156, 1160, 1164, 1168, 1173, 1178, 1183, 1188, 1192, 1196, 1200, 1204,
+    1208, 1212, 1216, 1220, 1225, 1230, 1235, 1240, 1243, 1247, 1251, 1255, 1258, 1261, 1264, 1267,
+    1270, 1273, 1276, 1279, 1283, 1287, 1291, 1295, 1299, 1303, 1307, 1312, 1317, 1322, 1326, 1330,
+    1334, 1337, 1340, 1343, 1346, 1350, 1354, 1358, 1362, 1367, 1372, 1377, 1382, 1387, 1392, 1396,
+    1400, 1404, 1407, 1410, 1413, 1416, 1420, 1424, 1428, 1433, 1438, 1443, 1448, 1453, 1458, 1464,
+    1470, 1476, 1480, 1484, 1488, 1492, 1496, 1500, 1504, 1508, 1512, 1516, 1520, 1524, 1527, 1530,
+    1534, 1538, 1542, 1546, 1550, 1554, 1558, 1562, 1567, 1572, 1577, 1582, 1586, 1590, 1594, 1598,
+    1601, 1604, 1607, 1611, 1615, 1619, 1623, 1628, 1633, 1638, 1643, 1648, 1653, 1658, 1662, 1666,
+    1670, 1674, 1677, 1680, 1683, 1686, 1690, 1694, 1698, 1702, 1707, 1712, 1717, 1722, 1727, 1732,
+    1737, 1743, 1749, 1755, 1761, 1765, 1769, 1773, 1777, 1781, 1785, 1789, 1793, 1797, 1801, 1805,
+    1809, 1812, 1815, 1818, 1821, 1825, 1829, 1833, 1837, 1842, 1847, 1852, 1858, 1864, 1870, 1875,
+    1880, 1885, 1890, 1894, 1898, 1902, 1906, 1910, 1914, 1918, 1923, 1928, 1933, 1939, 1945, 1951,
+    1955, 1959, 1963, 1967, 1970, 1973, 1976, 1979, 1984, 1989, 1994, 1998, 2002, 2006, 2010, 2014,
+    2018, 2022, 2025, 2028, 2031, 2035, 2039, 2043, 2047, 2051, 2055, 2060, 2065, 2070, 2075, 2079,
+    2083, 2087, 2090, 2093, 2096, 2099, 2103, 2107, 2112, 2117, 2122, 2127, 2132, 2136, 2140, 2144,
+    2147, 2150, 2153, 2157, 2161, 2165, 2170, 2175, 2180, 2185, 2190, 2195, 2201, 2207, 2213, 2219,
+    2223, 2227, 2231, 2235, 2239, 2243, 2247, 2251, 2255, 2258, 2261, 2264, 2267, 2270, 2274, 2278,
+    2282, 2286, 2290, 2294, 2299, 2304, 2309, 2314, 2318, 2322, 2326, 2330, 2333, 2336, 2340, 2344,
+    2348, 2352, 2357, 2362, 2367, 2370, 2373, 2376, 2379, 2383, 2388, 2393, 2398, 2404, 2410, 2416,
+    2421, 2426, 2431, 2436, 2440, 2444, 2448, 2452, 2456, 2460, 2465, 2470, 2475, 2480, 2484, 2488,
+    2492, 2496, 2501, 2506, 2511, 2515, 2519, 2523, 2527, 2531, 2534, 2537, 2540, 2543, 2548, 2553,
+    2558, 2562, 2566, 2570, 2574, 2578, 2582, 2586, 2590, 2593, 2596, 2599, 2603, 2606, 2609, 2612,
+    2615, 2618, 2622, 2626, 2630, 2634, 2638, 2642, 2647, 2652, 2656, 2660, 2664, 2668, 2671, 2675,
+    2679, 2683, 2687, 2691, 2695, 2699, 2704, 2709, 2714, 2717, 2720, 2723, 2726, 2731, 2736, 2741,
+    2746, 2751, 2756, 2761, 2765, 2769, 2773, 2777, 2782, 2787, 2792, 2796, 2799, 2802, 2805, 2808,
+    2811, 2815, 2819, 2823, 2827, 2830, 2833, 2836, 2838, 2841, 2844, 2847, 2851, 2855, 2859, 2863,
+    2867, 2871, 2875, 2880, 2885, 2890, 2895, 2899, 2903, 2907, 2910, 2913, 2917, 2921, 2925, 2929,
+    2933, 2938, 2943, 2946, 2949, 2952, 2955, 2958, 2963, 2968, 2973, 2979, 2985, 2990, 2995, 2999,
+    3003, 3007, 3011, 3015, 3020, 3025, 3030, 3034, 3038, 3042, 3046, 3051, 3056, 3061, 3065, 3069,
+    3072, 3075, 3078, 3083, 3088, 3092, 3096, 3100, 3103, 3106, 3110, 3112, 3115, 3118, 3121, 3124,
+    3127, 3130, 3133, 3137, 3141, 3145, 3149, 3153, 3157, 3161, 3165, 3170, 3175, 3180, 3185, 3189,
+    3193, 3197, 3201, 3205, 3209, 3213, 3217, 3221, 3225, 3229, 3234, 3239, 3244, 3249, 3252, 3255,
+    3258, 3261, 3266, 3271, 3276, 3281, 3286, 3291, 3296, 3301, 3305, 3309, 3313, 3317, 3321, 3325,
+    3329, 3334, 3339, 3342, 3345, 3348, 3351, 3355, 3359, 3363, 3367, 3370, 3373, 3376, 3379, 3382,
+    3385, 3388, 3391, 3395, 3399, 3403, 3407, 3412, 3417, 3422, 3427, 3433, 3439, 3445, 3451, 3456,
+    3461, 3466, 3471, 3475, 3479, 3483, 3487, 3491, 3495, 3499, 3503, 3508, 3513, 3518, 3523, 3529,
+    3535, 3541, 3545, 3549, 3553, 3557, 3560, 3563, 3566, 3569, 3574, 3579, 3584, 3589, 3593, 3597,
+    3601, 3605, 3609, 3613, 3617, 3621, 3626, 3631, 3636, 3640, 3644, 3648, 3651, 3654, 3658, 3662,
+    3666, 3671, 3676, 3681, 3684, 3689, 3694, 3699, 3703, 3707, 3711, 3714, 3717, 3720, 3725, 3730,
+    3734, 3738, 3742, 3746, 3750, 3754, 3757, 3760, 3763, 3767, 3771, 3775, 3779, 3783, 3787, 3791,
+    3796, 3801, 3805, 3809, 3813, 3816, 3820, 3825, 3829, 3833, 3837, 3842, 3847, 3852, 3857, 3862,
+    3867, 3873, 3879, 3885, 3890, 3895, 3900, 3905, 3909, 3913, 3917, 3921, 3926, 3931, 3936, 3941,
+    3947, 3953, 3959, 3965, 3969, 3973, 3977, 3981, 3985, 3990, 3995, 4000, 4004, 4008, 4012, 4016,
+    4021, 4026, 4031, 4037, 4043, 4049, 4055, 4061, 4068, 4075, 4082, 4087, 4092, 4097, 4102, 4107,
+    4112, 4117, 4120, 4123, 4126, 4131, 4136, 4141, 4145, 4149, 4153, 4156, 4159, 4162, 4167, 4172,
+    4177, 4181, 4185, 4189, 4193, 4197, 4201, 4205, 4209, 4213, 4217, 4220, 4223, 4226, 4230, 4234,
+    4238, 4242, 4246, 4250, 4254, 4259, 4264, 4269, 4274, 4278, 4282, 4286, 4290, 4293, 4298, 4303,
+    4306, 4309, 4312, 4315, 4320, 4325, 4330, 4335, 4340, 4345, 4350, 4355, 4360, 4364, 4368, 4372,
+    4377, 4382, 4387, 4392, 4397, 4402, 4407, 4411, 4415, 4419, 4423, 4426, 4429, 4432, 4435, 4440,
+    4445, 4450, 4455, 4459, 4463, 4467, 4471, 4475, 4479, 4483, 4487, 4491, 4495, 4499, 4503, 4506,
+    4509, 4512, 4515, 4519, 4523, 4527, 4531, 4535, 4539, 4544, 4549, 4554, 4559, 4563, 4567, 4571,
+    4575, 4579, 4583, 4587, 4591, 4596, 4601, 4606, 4609, 4612, 4615, 4618, 4621, 4624, 4627, 4630,
+    4633, 4636, 4639, 4643, 4647, 4651, 4655, 4660, 4665, 4670, 4675, 4681, 4687, 4693, 4699, 4704,
+    4709, 4714, 4719, 4723, 4727, 4731, 4735, 4739, 4743, 4747, 4751, 4756, 4761, 4766, 4771, 4777,
+    4783, 4789, 4793, 4797, 4801, 4804, 4807, 4810, 4813, 4818, 4823, 4828, 4833, 4837, 4841, 4845,
+    4849, 4853, 4857, 4861, 4864, 4867, 4870, 4873, 4877, 4881, 4885, 4889, 4893, 4898, 4903, 4908,
+    4913, 4917, 4921, 4925, 4929, 4932, 4935, 4938, 4941, 4944, 4947, 4950, 4953, 4957, 4961, 4965,
+    4969, 4974, 4979, 4984, 4989, 4992, 4995, 5000, 5005, 5010, 5015, 5019, 5023, 5027, 5031, 5034,
+    5037, 5040, 5043, 5048, 5053, 5058, 5063, 5067, 5071, 5075, 5079, 5083, 5087, 5091, 5094, 5097,
+    5100, 5104, 5108, 5112, 5116, 5120, 5124, 5128, 5133, 5138, 5143, 5147, 5151, 5155, 5159, 5162,
+    5165, 5169, 5173, 5177, 5182, 5187, 5192, 5196, 5200, 5204, 5208, 5213, 5218, 5223, 5228, 5233,
+    5238, 5243, 5248, 5254, 5260, 5266, 5271, 5276, 5281, 5286, 5290, 5294, 5298, 5302, 5307, 5312,
+    5317, 5323, 5329, 5335, 5339, 5343, 5347, 5351, 5357, 5363, 5369, 5374, 5379, 5384, 5389, 5393,
+    5397, 5401, 5405, 5410, 5415, 5421, 5427, 5433, 5439, 5446, 5453, 5458, 5463, 5468, 5473, 5478,
+    5483, 5488, 5493, 5498, 5503, 5506, 5509, 5512, 5517, 5522, 5527, 5531, 5535, 5539, 5542, 5545,
+    5548, 5553, 5558, 5563, 5567, 5571, 5575, 5579, 5583, 5587, 5591, 5595, 5599, 5603,
+};
+
+// 以 code - kFirstCode 为下标，值为拼音的序号(从1开始)，0表示没有对应的拼音
+constexpr unsigned short kIndex[] = {
+    850, 1030, 0, 0, 517, 1101, 1183, 0, 0, 0, 0, 0, 980, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1176, 0, 0, 0, 0, 0, 141, 0, 0, 0, 0, 743, 0, 0, 851, 0, 0, 0,
+    1144, 1132, 0, 1135, 591, 584, 1115, 1191, 1130, 1263, 204, 1102, 759, 0, 0, 623, 826, 1180, 1274, 680,
+    131, 0, 0, 0, 0, 1297, 282, 18, 1101, 1325, 0, 1278, 241, 989, 1180, 463, 1081, 559, 696, 1282,
+    0, 0, 0, 0, 1143, 0, 0, 0, 454, 232, 741, 989, 1180, 596, 1188, 47, 0, 0, 0, 545,
+    657, 1180, 568, 436, 1201, 614, 106, 0, 0, 0, 426, 1143, 424, 874, 0, 1278, 0, 375, 1106, 1008,
+    6, 424, 481, 624, 620, 1014, 1120, 1034, 1241, 1201, 514, 271, 694, 817, 135, 679, 375, 1015, 917, 0,
+    848, 558, 903, 0, 0, 424, 812, 1005, 958, 0, 750, 1007, 0, 653, 1091, 230, 1200, 661, 481, 717,
+    1126, 1196, 0, 0, 939, 0, 559, 568, 0, 615, 0, 436, 0, 0, 0, 0, 859, 0, 81, 574,
+    340, 637, 0, 343, 996, 0, 0, 637, 629, 0, 951, 566, 0, 1083, 511, 161, 1264, 0, 0, 0,
+    67, 416, 241, 334, 0, 0, 570, 462, 605, 1134, 0, 688, 1126, 0, 52, 452, 989, 0, 0, 0,
+    1198, 1132, 818, 0, 227, 302, 616, 822, 452, 0, 0, 1163, 171, 0, 550, 0, 0, 385, 0, 566,
+    409, 1048, 789, 0, 481, 265, 838, 1180, 476, 898, 443, 0, 135, 137, 133, 0, 620, 0, 583, 476,
+    989, 1122, 110, 0, 0, 1280, 206, 443, 1278, 260, 1126, 568, 0, 135, 1104, 442, 0, 434, 0, 287,
+    147, 33, 510, 0, 21, 574, 520, 0, 385, 0, 476, 558, 942, 783, 1167, 619, 41, 265, 604, 0,
+    0, 123, 741, 991, 392, 1201, 0, 356, 1180, 1114, 334, 600, 0, 556, 951, 0, 998, 1172, 452, 1309,
+    0, 864, 1182, 0, 1271, 439, 405, 538, 401, 501, 0, 460, 7, 0, 265, 145, 1125, 145, 1086, 0,
+    0, 416, 989, 1198, 0, 481, 1256, 1144, 950, 0, 0, 531, 0, 385, 310, 1163, 851, 1179, 409, 0,
+    279, 1253, 206, 282, 983, 19, 302, 701, 386, 1196, 407, 0, 125, 362, 707, 409, 568, 273, 381, 809,
+    0, 980, 0, 0, 556, 585, 1180, 400, 0, 1144, 855, 269, 0, 0, 0, 0, 0, 0, 0, 701,
+    1087, 1126, 1025, 395, 1065, 71, 721, 1182, 0, 0, 0, 0, 0, 0, 1075, 955, 23, 1176, 434, 1050,
+    373, 462, 240, 1091, 605, 985, 362, 587, 0, 1030, 610, 0, 0, 0, 0, 0, 0, 0, 1176, 949,
+    1150, 291, 166, 888, 260, 1231, 265, 1124, 0, 265, 946, 1091, 629, 403, 322, 1108, 631, 52, 434, 399,
+    1271, 0, 0, 0, 0, 28, 7, 0, 0, 337, 207, 27, 69, 683, 568, 1122, 1140, 0, 0, 0,
+    0, 0, 241, 1027, 181, 536, 553, 1271, 6, 1103, 0, 838, 0, 0, 0, 0, 147, 434, 432, 1004,
+    1162, 1144, 0, 906, 0, 0, 0, 0, 1176, 1117, 0, 1110, 1325, 1180, 171, 0, 0, 1112, 1007, 885,
+    1177, 1271, 1180, 1112, 471, 434, 374, 0, 770, 568, 0, 545, 86, 374, 1162, 0, 0, 1162, 374, 0,
+    134, 713, 432, 0, 52, 1108, 1094, 1146, 0, 1196, 840, 1144, 701, 52, 383, 459, 19, 19, 0, 0,
+    0, 0, 469, 0, 1325, 76, 452, 7, 1226, 171, 273, 0, 0, 0, 0, 721, 593, 633, 254, 0,
+    52, 37, 0, 147, 373, 1030, 114, 0, 0, 0, 0, 303, 260, 1201, 1175, 529, 373, 520, 0, 520,
+    0, 595, 0, 75, 133, 1124, 721, 550, 1180, 0, 629, 1253, 1110, 359, 0, 0, 436, 577, 1176, 434,
+    1182, 0, 197, 1180, 1126, 383, 1193, 374, 112, 1007, 1014, 1269, 38, 646, 357, 110, 559, 0, 1106, 0,
+    0, 832, 870, 1211, 0, 594, 303, 0, 0, 340, 0, 0, 409, 362, 0, 319, 1020, 0, 927, 542,
+    721, 301, 319, 836, 31, 0, 0, 1106, 1144, 529, 647, 169, 0, 435, 736, 1120, 1180, 1200, 1178, 1163,
+    0, 869, 383, 922, 0, 1196, 0, 1128, 51, 0, 226, 0, 76, 0, 980, 270, 0, 636, 1213, 0,
+    0, 833, 0, 768, 0, 0, 742, 452, 0, 271, 260, 0, 0, 0, 260, 0, 0, 838, 0, 751,
+    985, 87, 244, 0, 779, 1180, 0, 1325, 806, 838, 1045, 1130, 1196, 41, 596, 0, 0, 0, 0, 0,
+    0, 1005, 546, 630, 829, 1276, 1164, 0, 605, 0, 915, 654, 0, 898, 275, 104, 696, 0, 141, 0,
+    959, 787, 0, 530, 922, 0, 1112, 1271, 0, 0, 0, 572, 1154, 1144, 652, 424, 679, 0, 766, 1180,
+    337, 1014, 816, 1211, 959, 301, 1180, 198, 0, 570, 92, 86, 471, 605, 989, 704, 19, 10, 826, 0,
+    0, 0, 0, 868, 942, 626, 375, 1209, 269, 19, 1113, 624, 0, 0, 547, 0, 1209, 241, 1094, 411,
+    648, 717, 1079, 650, 721, 855, 1223, 572, 1269, 1302, 369, 1144, 383, 1154, 1271, 279, 165, 337, 0, 165,
+    606, 1282, 954, 577, 452, 1125, 237, 454, 885, 632, 0, 322, 1172, 724, 1178, 549, 1192, 1182, 0, 989,
+    0, 583, 1159, 635, 664, 1318, 1201, 1176, 337, 651, 481, 1091, 0, 0, 227, 594, 0, 1133, 188, 832,
+    653, 648, 841, 0, 1078, 214, 7, 0, 55, 734, 570, 456, 0, 161, 1324, 69, 0, 1172, 1061, 434,
+    0, 363, 435, 1087, 0, 0, 1144, 713, 1213, 0, 22, 1259, 468, 1087, 1106, 817, 1178, 1126, 173, 851,
+    1064, 718, 818, 435, 0, 0, 0, 227, 553, 1249, 0, 0, 1182, 97, 435, 424, 1218, 545, 695, 471,
+    842, 204, 0, 452, 1143, 0, 1194, 243, 133, 0, 663, 418, 996, 500, 1311, 383, 129, 1152, 709, 135,
+    570, 11, 134, 0, 1116, 1166, 407, 194, 851, 553, 301, 254, 632, 549, 1069, 373, 633, 69, 0, 816,
+    373, 0, 596, 0, 1034, 554, 816, 1223, 650, 772, 1250, 1118, 316, 0, 816, 0, 605, 0, 1213, 265,
+    859, 662, 1087, 859, 958, 662, 0, 0, 665, 1171, 476, 568, 520, 316, 1204, 201, 0, 553, 598, 826,
+    17, 57, 0, 632, 212, 0, 17, 0, 1104, 301, 0, 467, 900, 1044, 854, 265, 0, 434, 434, 407,
+    450, 1318, 57, 646, 28, 1087, 436, 19, 1201, 381, 254, 1098, 711, 183, 0, 566, 603, 717, 409, 544,
+    0, 619, 0, 650, 1202, 0, 471, 0, 0, 1249, 0, 1179, 0, 436, 51, 0, 880, 0, 277, 322,
+    514, 454, 657, 0, 0, 1044, 0, 172, 52, 486, 568, 0, 998, 742, 0, 434, 642, 1112, 822, 265,
+    637, 0, 0, 1048, 0, 833, 0, 0, 1102, 0, 157, 1025, 570, 52, 0, 632, 1151, 295, 559, 0,
+    1267, 145, 631, 594, 0, 1183, 0, 1267, 823, 606, 720, 1180, 0, 436, 434, 1244, 1201, 466, 414, 221,
+    0, 587, 436, 43, 1241, 173, 207, 579, 1180, 1257, 1114, 135, 173, 134, 1163, 549, 244, 596, 110, 0,
+    1060, 102, 6, 134, 0, 1186, 104, 1048, 0, 1060, 102, 1171, 1305, 0, 0, 834, 570, 840, 604, 1164,
+    0, 0, 1180, 111, 462, 445, 0, 460, 0, 241, 0, 474, 375, 222, 0, 0, 395, 0, 133, 662,
+    52, 0, 1155, 603, 0, 939, 52, 0, 52, 0, 1112, 1087, 62, 270, 474, 0, 1264, 41, 1180, 1201,
+    855, 1223, 650, 710, 980, 0, 0, 0, 928, 1007, 679, 460, 55, 885, 100, 87, 0, 0, 0, 0,
+    0, 220, 1044, 1005, 1132, 0, 259, 1106, 1044, 0, 1025, 927, 443, 1271, 0, 1184, 0, 0, 415, 1273,
+    818, 0, 0, 1126, 1126, 1231, 1086, 0, 0, 1005, 1247, 726, 0, 0, 0, 1180, 879, 959, 104, 1298,
+    0, 654, 434, 281, 774, 7, 279, 18, 842, 822, 1122, 0, 0, 833, 0, 1044, 0, 1198, 0, 44,
+    301, 147, 1282, 0, 147, 0, 377, 722, 476, 0, 104, 507, 582, 568, 1144, 0, 1200, 371, 568, 399,
+    333, 501, 1206, 214, 424, 0, 525, 462, 1222, 303, 838, 40, 1104, 171, 764, 0, 1106, 851, 419, 0,
+    0, 141, 911, 0, 214, 214, 1021, 644, 587, 955, 227, 85, 232, 123, 779, 0, 469, 436, 542, 1030,
+    1206, 0, 82, 817, 1200, 570, 0, 0, 0, 0, 1200, 434, 1088, 651, 188, 1124, 1143, 1106, 851, 424,
+    0, 1200, 838, 975, 161, 260, 598, 0, 764, 1008, 1278, 1183, 0, 286, 943, 1204, 1178, 428, 917, 1176,
+    663, 290, 385, 0, 1183, 95, 711, 19, 293, 570, 114, 111, 622, 222, 0, 605, 0, 1180, 407, 0,
+    1062, 265, 409, 998, 711, 571, 566, 1114, 1164, 594, 644, 443, 0, 0, 54, 1200, 432, 658, 141, 371,
+    0, 556, 452, 1088, 1180, 414, 386, 86, 545, 1183, 1126, 0, 615, 587, 824, 432, 0, 1097, 0, 0,
+    322, 0, 232, 1193, 435, 15, 892, 1104, 970, 1144, 1178, 405, 434, 857, 1029, 0, 825, 679, 0, 636,
+    1183, 310, 21, 1113, 637, 282, 1157, 0, 982, 1086, 1150, 0, 347, 467, 265, 1302, 188, 52, 1073, 0,
+    582, 0, 0, 519, 0, 371, 0, 1282, 139, 1113, 1148, 0, 851, 774, 356, 269, 333, 848, 0, 554,
+    568, 127, 910, 69, 1097, 808, 0, 261, 0, 1021, 1005, 1270, 58, 341, 0, 0, 66, 1269, 240, 129,
+    1257, 701, 584, 804, 435, 663, 1087, 122, 337, 0, 891, 0, 75, 0, 529, 553, 375, 1186, 1271, 452,
+    1133, 1124, 1154, 927, 824, 1126, 989, 369, 652, 426, 0, 0, 424, 683, 982, 44, 593, 452, 420, 546,
+    0, 405, 242, 432, 322, 1170, 95, 356, 443, 442, 141, 457, 624, 424, 642, 85, 620, 784, 1168, 471,
+    471, 864, 0, 0, 923, 0, 467, 409, 1114, 1124, 0, 989, 287, 95, 1176, 0, 0, 0, 840, 423,
+    1064, 0, 828, 1104, 1179, 0, 646, 1056, 546, 381, 173, 1246, 792, 615, 650, 0, 0, 0, 1124, 69,
+    424, 817, 1124, 0, 0, 69, 824, 30, 449, 476, 533, 982, 469, 265, 721, 0, 232, 232, 0, 356,
+    0, 816, 161, 0, 1200, 840, 0, 500, 301, 0, 221, 1114, 357, 385, 866, 375, 1045, 69, 927, 51,
+    605, 1176, 709, 149, 911, 230, 605, 1049, 571, 500, 911, 1263, 150, 572, 637, 0, 826, 500, 934, 834,
+    52, 0, 1184, 0, 928, 989, 904, 898, 1298, 603, 587, 102, 0, 416, 0, 0, 438, 31, 403, 243,
+    0, 599, 0, 474, 500, 1001, 322, 1259, 236, 251, 1282, 1163, 764, 102, 0, 0, 0, 0, 1179, 0,
+    0, 1196, 359, 1171, 1171, 949, 333, 817, 328, 0, 0, 401, 652, 301, 402, 353, 207, 0, 0, 1162,
+    0, 0, 857, 0, 115, 665, 0, 38, 0, 0, 0, 1113, 0, 0, 0, 637, 550, 689, 774, 125,
+    0, 0, 177, 0, 838, 204, 0, 534, 232, 605, 0, 0, 0, 0, 1200, 1007, 112, 631, 653, 416,
+    0, 739, 415, 399, 460, 69, 1113, 568, 456, 0, 633, 793, 381, 1166, 0, 1114, 989, 1087, 123, 0,
+    457, 99, 386, 0, 925, 587, 0, 254, 0, 814, 1209, 69, 0, 424, 232, 1164, 471, 450, 520, 582,
+    1200, 1027, 0, 1101, 396, 1120, 383, 0, 0, 0, 0, 419, 303, 0, 0, 257, 0, 882, 449, 0,
+    1130, 0, 0, 1206, 476, 407, 0, 34, 674, 0, 0, 1087, 0, 641, 980, 55, 603, 0, 0, 0,
+    385, 937, 618, 758, 885, 851, 582, 333, 1113, 1106, 0, 0, 717, 0, 0, 0, 1124, 560, 0, 183,
+    1298, 287, 1325, 232, 436, 385, 434, 0, 0, 0, 0, 0, 1052, 1112, 1163, 1014, 1005, 221, 476, 13,
+    373, 1170, 469, 896, 33, 0, 721, 1031, 686, 0, 0, 1197, 653, 0, 0, 686, 1133, 818, 0, 328,
+    1044, 269, 438, 840, 637, 265, 568, 133, 0, 385, 452, 434, 0, 350, 399, 310, 0, 291, 917, 0,
+    434, 0, 848, 385, 0, 1112, 452, 407, 50, 0, 0, 1264, 0, 0, 951, 0, 983, 1270, 43, 0,
+    0, 0, 550, 52, 1113, 34, 204, 0, 0, 783, 111, 52, 989, 432, 388, 1187, 153, 445, 704, 340,
+    282, 0, 0, 1005, 188, 0, 214, 869, 522, 123, 198, 403, 188, 605, 474, 605, 826, 770, 1264, 0,
+    568, 92, 816, 0, 0, 1027, 587, 855, 571, 604, 958, 334, 1259, 57, 457, 844, 0, 0, 1304, 812,
+    456, 57, 443, 359, 0, 0, 0, 582, 566, 615, 942, 653, 443, 220, 41, 0, 571, 0, 1154, 798,
+    864, 594, 1318, 0, 476, 0, 937, 0, 1126, 0, 546, 181, 1178, 741, 566, 1209, 0, 1179, 0, 436,
+    494, 1126, 0, 1303, 500, 424, 857, 0, 0, 0, 1072, 0, 1154, 0, 943, 511, 838, 922, 1144, 1159,
+    804, 1311, 1197, 1303, 571, 457, 1108, 1179, 838, 651, 450, 0, 134, 951, 0, 1183, 671, 1180, 0, 917,
+    457, 1176, 0, 864, 123, 606, 0, 1267, 0, 0, 0, 0, 0, 0, 188, 0, 11, 1139, 85, 154,
+    1240, 0, 434, 69, 0, 0, 549, 1061, 0, 587, 265, 1098, 572, 246, 644, 547, 1087, 251, 520, 5,
+    1218, 424, 1180, 671, 1303, 44, 48, 0, 52, 568, 603, 615, 0, 207, 0, 864, 125, 0, 129, 467,
+    511, 436, 587, 0, 933, 487, 898, 169, 706, 0, 598, 37, 0, 0, 38, 885, 0, 560, 0, 0,
+    855, 0, 0, 1270, 1010, 886, 1311, 1187, 635, 686, 55, 0, 0, 1014, 375, 1230, 885, 0, 0, 812,
+    0, 1011, 0, 868, 724, 582, 232, 232, 1274, 0, 619, 207, 0, 356, 434, 711, 1180, 714, 1201, 1083,
+    364, 1232, 1162, 188, 1112, 449, 958, 303, 774, 0, 0, 0, 0, 76, 55, 134, 904, 1180, 55, 0,
+    254, 545, 0, 108, 0, 1148, 1202, 1200, 0, 0, 0, 0, 1005, 0, 0, 0, 0, 471, 1126, 1104,
+    442, 0, 762, 1005, 1146, 1112, 718, 0, 0, 0, 0, 0, 652, 436, 337, 1091, 0, 1083, 1196, 1231,
+    52, 651, 0, 1126, 279, 1180, 0, 560, 1186, 0, 457, 939, 1184, 435, 0, 989, 0, 0, 0, 1083,
+    655, 989, 1180, 1218, 917, 434, 616, 0, 637, 1240, 996, 1271, 55, 566, 0, 0, 0, 0, 0, 0,
+    0, 834, 350, 0, 1264, 0, 721, 481, 1126, 1171, 1126, 0, 705, 0, 0, 595, 125, 652, 864, 0,
+    683, 0, 0, 0, 989, 1126, 69, 236, 184, 0, 158, 123, 375, 207, 383, 0, 0, 0, 942, 652,
+    112, 644, 374, 187, 476, 386, 287, 949, 122, 943, 745, 303, 631, 0, 0, 0, 0, 1180, 141, 0,
+    0, 36, 558, 500, 227, 52, 994, 322, 52, 1180, 1112, 710, 1186, 1281, 165, 293, 1144, 792, 1101, 577,
+    89, 1309, 0, 55, 1172, 414, 756, 986, 0, 254, 460, 1104, 0, 362, 0, 0, 1162, 1150, 145, 392,
+    1186, 0, 0, 0, 570, 1113, 414, 0, 0, 572, 927, 89, 41, 442, 959, 279, 227, 0, 23, 1200,
+    0, 0, 693, 559, 1180, 204, 0, 110, 119, 0, 457, 704, 0, 0, 0, 578, 639, 467, 0, 593,
+    373, 0, 1194, 457, 134, 880, 731, 0, 0, 397, 1031, 0, 0, 0, 0, 69, 848, 0, 959, 187,
+    424, 119, 244, 347, 265, 1088, 289, 1010, 0, 610, 386, 1193, 423, 0, 1200, 1305, 1164, 851, 1257, 462,
+    1007, 0, 0, 0, 0, 0, 0, 1062, 583, 462, 1241, 0, 386, 0, 1144, 0, 0, 0, 188, 845,
+    671, 0, 0, 48, 566, 0, 0, 1164, 322, 671, 41, 473, 232, 935, 0, 1100, 1164, 0, 476, 0,
+    1007, 374, 0, 226, 436, 452, 0, 0, 0, 1126, 540, 277, 432, 1106, 721, 650, 868, 184, 1182, 652,
+    0, 476, 0, 1044, 1080, 0, 567, 933, 508, 489, 30, 0, 1035, 0, 41, 1176, 789, 110, 405, 503,
+    0, 11, 165, 824, 41, 0, 289, 0, 1068, 1068, 1323, 587, 0, 356, 0, 951, 400, 582, 0, 980,
+    0, 41, 880, 246, 69, 573, 173, 52, 436, 1305, 0, 385, 566, 1204, 1209, 0, 111, 220, 558, 456,
+    137, 980, 813, 1180, 0, 0, 416, 1018, 891, 1186, 1186, 873, 1182, 951, 1182, 476, 1064, 1146, 0, 0,
+    838, 1282, 0, 0, 1198, 0, 0, 1106, 950, 1180, 671, 0, 0, 403, 1122, 1100, 0, 460, 1041, 950,
+    709, 0, 1005, 0, 146, 111, 792, 229, 695, 696, 313, 336, 1201, 399, 0, 0, 0, 405, 1168, 0,
+    1114, 0, 885, 598, 1256, 85, 579, 793, 371, 277, 374, 207, 1250, 0, 1004, 1282, 30, 443, 1200, 1298,
+    1198, 568, 0, 0, 0, 110, 570, 0, 0, 467, 812, 851, 333, 1302, 1200, 0, 0, 882, 729, 639,
+    0, 465, 0, 1144, 802, 55, 637, 0, 0, 0, 0, 1178, 1196, 0, 802, 0, 37, 424, 0, 0,
+    0, 76, 632, 540, 1052, 1100, 568, 587, 0, 436, 481, 0, 260, 476, 204, 41, 0, 0, 0, 0,
+    0, 540, 55, 994, 1052, 232, 0, 0, 0, 0, 0, 261, 0, 0, 996, 52, 1052, 917, 87, 1052,
+    654, 0, 618, 0, 0, 1250, 51, 434, 97, 0, 568, 0, 0, 996, 0, 958, 0, 0, 263, 0,
+    0, 0, 0, 848, 614, 1184, 1064, 340, 1201, 559, 41, 700, 787, 572, 852, 570, 0, 0, 568, 236,
+    1073, 1278, 0, 1132, 15, 279, 781, 26, 1068, 0, 264, 27, 818, 145, 333, 1044, 373, 129, 438, 416,
+    1134, 227, 626, 241, 263, 895, 582, 946, 750, 222, 1200, 153, 885, 0, 1014, 175, 791, 969, 605, 1044,
+    1267, 568, 904, 0, 0, 0, 0, 347, 1180, 374, 1126, 614, 593, 0, 206, 0, 0, 1010, 0, 0,
+    0, 1196, 688, 0, 316, 481, 135, 511, 1079, 568, 591, 582, 1108, 0, 10, 1202, 469, 888, 1154, 0,
+    194, 87, 1237, 1193, 303, 895, 0, 1104, 959, 449, 449, 375, 1253, 0, 0, 973, 125, 279, 434, 0,
+    0, 341, 1102, 0, 838, 959, 0, 1068, 246, 980, 868, 679, 303, 587, 434, 1140, 1147, 684, 0, 454,
+    568, 198, 436, 0, 618, 942, 567, 550, 330, 1183, 0, 841, 838, 123, 1197, 76, 418, 864, 544, 0,
+    0, 1144, 34, 501, 817, 0, 946, 0, 0, 1278, 418, 1060, 403, 41, 0, 0, 0, 436, 340, 0,
+    319, 106, 624, 1282, 1061, 1060, 570, 549, 0, 0, 0, 204, 7, 1113, 0, 1104, 0, 1060, 86, 916,
+    0, 454, 291, 866, 0, 1172, 212, 438, 559, 1162, 603, 1060, 1186, 785, 616, 566, 61, 0, 637, 26,
+    0, 0, 1172, 385, 166, 403, 726, 141, 568, 1015, 414, 52, 0, 123, 1168, 198, 17, 1150, 0, 0,
+    0, 869, 0, 1230, 1079, 1005, 36, 0, 1162, 0, 1282, 1158, 277, 1198, 0, 1060, 646, 939, 457, 340,
+    818, 832, 449, 1162, 0, 490, 654, 1114, 910, 683, 0, 416, 728, 131, 0, 476, 1104, 818, 13, 641,
+    340, 0, 0, 277, 855, 112, 975, 52, 637, 977, 340, 396, 416, 616, 377, 438, 859, 0, 632, 75,
+    340, 0, 679, 7, 1187, 975, 550, 452, 222, 452, 0, 800, 880, 1162, 247, 222, 0, 550, 1114, 0,
+    1134, 41, 10, 652, 818, 818, 1098, 937, 1202, 440, 129, 1171, 1188, 1166, 434, 454, 375, 662, 597, 486,
+    1171, 1163, 998, 356, 419, 1186, 946, 102, 570, 0, 1146, 153, 123, 711, 857, 657, 432, 1200, 689, 403,
+    99, 0, 824, 939, 445, 19, 626, 633, 1249, 54, 449, 476, 731, 52, 951, 568, 671, 582, 661, 671,
+    1103, 110, 855, 450, 432, 0, 1144, 692, 1044, 399, 1202, 0, 0, 69, 1314, 0, 169, 0, 452, 0,
+    1134, 424, 949, 0, 0, 0, 1170, 1200, 34, 452, 1261, 0, 937, 221, 240, 171, 303, 662, 1263, 1263,
+    0, 1164, 230, 395, 333, 0, 620, 347, 540, 188, 274, 195, 1162, 0, 452, 0, 362, 1001, 1079, 1267,
+    721, 230, 543, 1005, 188, 0, 359, 0, 0, 0, 0, 653, 0, 662, 470, 1200, 0, 1257, 1231, 0,
+    0, 760, 385, 337, 395, 553, 1102, 169, 0, 605, 181, 570, 0, 834, 957, 0, 0, 97, 0, 423,
+    989, 157, 0, 594, 0, 695, 1010, 206, 1087, 313, 198, 568, 0, 1114, 760, 540, 0, 717, 411, 1186,
+    1114, 547, 669, 23, 0, 301, 51, 0, 432, 1180, 593, 0, 0, 474, 430, 129, 244, 263, 0, 1163,
+    1293, 248, 817, 1200, 861, 430, 721, 392, 470, 939, 0, 0, 779, 664, 92, 598, 566, 166, 0, 188,
+    928, 0, 816, 0, 544, 587, 578, 882, 1200, 695, 169, 817, 1178, 712, 0, 442, 1157, 0, 161, 0,
+    0, 0, 52, 207, 806, 712, 1271, 118, 1030, 1030, 890, 1180, 582, 11, 385, 848, 568, 0, 1303, 989,
+    1206, 1159, 248, 1079, 0, 241, 1197, 424, 442, 896, 632, 470, 0, 0, 10, 996, 542, 428, 829, 0,
+    261, 0, 683, 86, 1025, 1143, 467, 418, 818, 452, 635, 1164, 0, 1270, 1060, 0, 7, 764, 90, 1014,
+    267, 428, 816, 145, 1001, 1298, 735, 1052, 1311, 598, 658, 566, 629, 340, 97, 407, 640, 0, 570, 212,
+    928, 171, 0, 0, 1271, 23, 188, 850, 0, 594, 0, 287, 362, 129, 467, 265, 0, 476, 395, 450,
+    183, 1170, 1044, 102, 1198, 959, 1171, 322, 416, 549, 476, 125, 0, 0, 943, 0, 664, 664, 0, 156,
+    1212, 0, 457, 169, 0, 1011, 0, 848, 0, 129, 0, 1202, 129, 1045, 0, 834, 0, 471, 545, 1180,
+    885, 0, 0, 980, 0, 273, 0, 646, 357, 0, 0, 371, 834, 169, 864, 254, 568, 23, 454, 0,
+    616, 0, 1212, 0, 405, 1183, 0, 1270, 571, 0, 313, 443, 1278, 1282, 513, 683, 254, 1231, 1167, 1282,
+    334, 1180, 0, 0, 158, 554, 880, 885, 0, 683, 95, 0, 0, 1178, 476, 51, 129, 481, 141, 424,
+    135, 1271, 1162, 0, 0, 610, 67, 1256, 373, 1202, 204, 1257, 285, 922, 587, 1005, 0, 632, 1176, 36,
+    531, 343, 689, 322, 0, 133, 0, 1001, 171, 1278, 1007, 520, 842, 0, 247, 95, 415, 0, 906, 1267,
+    824, 0, 0, 1087, 0, 0, 1106, 683, 812, 411, 470, 0, 0, 0, 760, 1005, 826, 0, 885, 616,
+    403, 985, 0, 812, 661, 0, 977, 628, 959, 587, 559, 445, 562, 1271, 229, 0, 910, 403, 279, 641,
+    996, 442, 1014, 1126, 0, 669, 277, 558, 0, 99, 587, 0, 175, 1211, 646, 1202, 1271, 817, 206, 432,
+    1086, 1010, 917, 1126, 985, 982, 0, 591, 1180, 0, 560, 566, 287, 582, 585, 1114, 1170, 0, 62, 1113,
+    870, 1288, 0, 207, 55, 587, 395, 816, 579, 30, 652, 403, 403, 0, 95, 774, 848, 664, 467, 76,
+    639, 910, 641, 0, 0, 566, 860, 0, 268, 1117, 0, 951, 0, 0, 546, 418, 467, 1162, 0, 903,
+    1056, 1126, 1259, 642, 1106, 629, 0, 418, 1010, 1122, 1157, 52, 614, 277, 568, 187, 104, 141, 220, 527,
+    146, 0, 111, 650, 826, 851, 1264, 0, 0, 0, 340, 1163, 134, 347, 679, 69, 517, 330, 1170, 637,
+    1083, 0, 0, 0, 891, 476, 0, 662, 445, 0, 1250, 1325, 1209, 66, 0, 1278, 52, 880, 1202, 0,
+    169, 270, 1180, 650, 846, 0, 1083, 436, 75, 0, 62, 277, 1172, 566, 277, 855, 302, 269, 0, 0,
+    0, 432, 457, 817, 469, 542, 122, 41, 730, 1180, 1144, 591, 1154, 301, 0, 722, 1042, 47, 1241, 0,
+    0, 0, 751, 977, 330, 1014, 357, 424, 1005, 0, 1170, 0, 818, 375, 620, 652, 652, 0, 605, 277,
+    751, 650, 452, 302, 650, 419, 989, 1170, 721, 457, 571, 52, 846, 1026, 587, 1314, 1270, 1183, 212, 141,
+    83, 652, 1162, 546, 137, 0, 0, 350, 939, 616, 0, 0, 616, 1280, 0, 141, 474, 462, 270, 1180,
+    898, 82, 878, 301, 545, 996, 1200, 1170, 226, 587, 1282, 1005, 802, 824, 476, 161, 76, 340, 192, 0,
+    374, 374, 675, 405, 395, 221, 301, 1148, 650, 639, 551, 341, 1257, 1005, 1202, 1306, 566, 579, 1100, 558,
+    435, 560, 566, 0, 69, 14, 531, 1068, 0, 0, 1257, 356, 0, 1142, 684, 169, 261, 0, 241, 357,
+    69, 0, 414, 1147, 85, 568, 1060, 418, 1152, 403, 37, 869, 1034, 303, 579, 0, 1180, 959, 806, 386,
+    181, 0, 683, 11, 119, 605, 1249, 1005, 0, 0, 0, 832, 989, 0, 350, 0, 0, 145, 0, 269,
+    269, 739, 817, 980, 145, 0, 1163, 34, 11, 0, 698, 159, 23, 0, 1027, 375, 1323, 23, 1259, 1074,
+    947, 52, 271, 1282, 1102, 1090, 1270, 1277, 605, 1090, 359, 851, 540, 1218, 985, 653, 1271, 818, 92, 793,
+    570, 0, 594, 989, 818, 1206, 293, 0, 476, 222, 789, 349, 729, 879, 1264, 310, 784, 1011, 119, 166,
+    0, 165, 671, 62, 818, 951, 51, 476, 980, 0, 407, 681, 423, 0, 271, 0, 674, 0, 1104, 1271,
+    879, 469, 232, 1261, 935, 647, 52, 375, 1200, 1114, 0, 705, 85, 76, 0, 817, 436, 717, 605, 462,
+    375, 1178, 82, 165, 1269, 1303, 198, 0, 1030, 1278, 0, 166, 0, 1259, 0, 888, 64, 434, 1178, 247,
+    476, 322, 434, 0, 0, 1001, 901, 1118, 419, 816, 1282, 196, 133, 1094, 0, 497, 340, 486, 279, 0,
+    92, 1271, 111, 558, 0, 0, 1259, 1200, 357, 418, 456, 0, 362, 916, 1012, 0, 1106, 629, 259, 17,
+    785, 1102, 6, 646, 785, 646, 1167, 1271, 69, 1186, 1086, 695, 545, 1164, 111, 859, 1263, 812, 0, 1007,
+    287, 958, 0, 210, 102, 868, 1029, 134, 1005, 439, 975, 418, 578, 0, 0, 0, 457, 265, 0, 301,
+    261, 0, 265, 0, 1172, 222, 0, 222, 76, 629, 123, 610, 816, 679, 85, 0, 0, 0, 0, 1196,
+    0, 198, 0, 989, 301, 436, 445, 94, 69, 1023, 123, 303, 75, 1101, 0, 1167, 666, 765, 633, 0,
+    646, 93, 1034, 486, 28, 1121, 1130, 818, 0, 0, 934, 392, 728, 1120, 125, 0, 278, 1183, 13, 869,
+    884, 275, 279, 857, 950, 385, 55, 204, 671, 217, 0, 0, 0, 0, 104, 260, 1197, 383, 0, 0,
+    1112, 560, 456, 817, 0, 639, 0, 0, 0, 0, 1162, 1180, 1182, 816, 1259, 1106, 1180, 1174, 265, 0,
+    1271, 374, 169, 0, 165, 66, 519, 141, 0, 1069, 848, 0, 467, 0, 180, 302, 0, 646, 568, 582,
+    1005, 0, 341, 574, 0, 540, 226, 173, 0, 0, 0, 436, 0, 104, 637, 246, 0, 106, 898, 389,
+    894, 0, 544, 1134, 0, 1180, 640, 0, 386, 436, 0, 374, 0, 568, 1302, 1312, 1170, 0, 566, 817,
+    313, 568, 0, 0, 0, 0, 989, 143, 0, 1124, 41, 1143, 460, 812, 587, 1116, 1325, 230, 165, 845,
+    688, 0, 619, 133, 934, 1200, 407, 566, 0, 0, 0, 566, 0, 0, 254, 0, 1180, 726, 0, 403,
+    301, 0, 129, 689, 95, 0, 1025, 840, 57, 996, 1086, 0, 917, 7, 265, 454, 522, 286, 0, 1184,
+    0, 915, 244, 424, 1126, 1231, 1010, 115, 1271, 1180, 301, 263, 0, 481, 0, 102, 1112, 631, 0, 52,
+    587, 452, 531, 438, 0, 0, 551, 0, 287, 604, 1241, 385, 0, 710, 1186, 1122, 1023, 554, 1231, 529,
+    0, 824, 469, 791, 31, 243, 584, 650, 1298, 1124, 405, 650, 0, 1215, 175, 322, 688, 1280, 1162, 375,
+    0, 1180, 606, 1209, 868, 587, 716, 1202, 746, 0, 1178, 746, 840, 824, 1108, 146, 457, 652, 0, 683,
+    375, 1312, 1108, 1162, 1052, 0, 0, 1001, 1182, 137, 1277, 633, 1204, 745, 657, 916, 1079, 566, 0, 683,
+    949, 52, 171, 34, 0, 474, 1117, 357, 758, 0, 1154, 1242, 1170, 0, 0, 0, 263, 1166, 1034, 1196,
+    476, 566, 0, 566, 0, 436, 404, 1250, 302, 114, 349, 469, 646, 0, 129, 674, 0, 567, 0, 0,
+    0, 1180, 67, 0, 399, 1079, 135, 0, 322, 373, 69, 0, 591, 85, 85, 1180, 1146, 1162, 1001, 319,
+    1192, 0, 0, 0, 1200, 0, 1261, 622, 0, 0, 969, 457, 350, 812, 585, 0, 1041, 0, 540, 1180,
+    0, 173, 1163, 452, 0, 1088, 1113, 724, 303, 322, 0, 671, 303, 684, 1113, 1090, 568, 85, 661, 0,
+    711, 108, 0, 1144, 745, 628, 0, 490, 0, 377, 0, 0, 1202, 1088, 1280, 0, 0, 1180, 0, 0,
+    301, 51, 1281, 1302, 959, 1108, 709, 0, 449, 1148, 0, 735, 885, 232, 904, 0, 0, 1202, 0, 0,
+    0, 605, 375, 0, 1180, 1318, 1250, 989, 1079, 709, 349, 476, 47, 85, 0, 261, 818, 1172, 357, 739,
+    399, 1154, 1126, 0, 424, 0, 1124, 69, 501, 0, 1144, 27, 0, 147, 0, 1027, 146, 133, 717, 350,
+    293, 1126, 0, 261, 476, 424, 1238, 904, 260, 587, 646, 0, 363, 646, 594, 0, 1188, 0, 350, 181,
+    566, 246, 0, 265, 0, 0, 0, 214, 214, 445, 570, 0, 935, 1106, 0, 1088, 0, 0, 386, 1196,
+    605, 542, 750, 946, 474, 818, 0, 1213, 0, 818, 0, 564, 434, 626, 157, 713, 0, 568, 587, 0,
+    125, 0, 1113, 403, 0, 1311, 203, 203, 428, 0, 123, 1025, 0, 743, 1271, 591, 287, 449, 0, 17,
+    583, 0, 882, 1019, 784, 1130, 928, 1126, 1074, 1019, 0, 1106, 1126, 784, 1170, 1170, 745, 383, 722, 1184,
+    278, 688, 133, 1084, 1205, 1108, 1278, 1205, 951, 652, 0, 322, 768, 287, 405, 709, 171, 652, 55, 0,
+    681, 1202, 265, 1270, 722, 1144, 620, 424, 1155, 695, 374, 438, 244, 409, 0, 0, 181, 1106, 983, 650,
+    1130, 1102, 848, 1267, 141, 1134, 467, 471, 426, 1025, 629, 442, 817, 955, 559, 1079, 123, 87, 454, 1198,
+    423, 1241, 989, 322, 696, 1106, 0, 0, 133, 1086, 671, 359, 0, 0, 1230, 424, 606, 577, 553, 0,
+    0, 822, 19, 721, 994, 628, 1012, 1130, 459, 9, 1005, 110, 1088, 1057, 436, 125, 123, 1144, 1113, 1127,
+    0, 0, 0, 696, 0, 1164, 851, 395, 982, 481, 577, 469, 0, 630, 582, 0, 147, 134, 1116, 0,
+    640, 959, 95, 134, 339, 1200, 0, 0, 577, 553, 959, 1259, 0, 0, 0, 0, 265, 0, 922, 1306,
+    476, 481, 0, 598, 1086, 0, 1282, 540, 0, 1259, 1256, 0, 1180, 0, 709, 0, 0, 1179, 383, 1159,
+    414, 631, 631, 855, 554, 381, 0, 642, 1112, 1264, 957, 1323, 1282, 337, 1148, 1180, 1025, 0, 457, 85,
+    0, 76, 573, 1271, 436, 1079, 350, 0, 844, 7, 303, 357, 337, 1114, 895, 1271, 58, 1178, 1001, 232,
+    356, 947, 1155, 127, 937, 844, 0, 0, 166, 395, 241, 128, 1087, 232, 958, 0, 434, 1215, 816, 0,
+    303, 18, 301, 806, 0, 1011, 1242, 122, 855, 1198, 385, 401, 356, 265, 446, 1212, 1050, 852, 0, 303,
+    1323, 403, 0, 69, 0, 477, 222, 476, 303, 418, 0, 1193, 162, 1001, 133, 0, 0, 0, 629, 79,
+    818, 443, 52, 0, 1269, 1280, 855, 1249, 434, 225, 0, 568, 568, 539, 859, 0, 303, 104, 1016, 951,
+    379, 838, 816, 69, 683, 1050, 145, 181, 1209, 222, 125, 147, 52, 632, 21, 1029, 662, 581, 294, 0,
+    853, 1034, 301, 536, 442, 0, 0, 0, 1264, 851, 196, 135, 529, 582, 33, 248, 1101, 0, 477, 605,
+    115, 0, 145, 574, 1030, 533, 114, 476, 1052, 409, 287, 51, 0, 820, 1098, 436, 857, 530, 403, 181,
+    996, 0, 0, 853, 785, 41, 1074, 449, 885, 0, 181, 232, 135, 194, 648, 1147, 260, 60, 1261, 145,
+    112, 357, 251, 1309, 218, 542, 1023, 1209, 859, 958, 587, 0, 841, 303, 939, 1035, 0, 5, 0, 848,
+    230, 369, 927, 1076, 1249, 595, 467, 568, 0, 663, 885, 1209, 476, 493, 277, 816, 395, 301, 603, 395,
+    1068, 662, 1029, 474, 817, 1266, 460, 333, 1029, 549, 637, 1184, 605, 1212, 469, 785, 0, 1124, 55, 0,
+    0, 885, 913, 1101, 104, 340, 110, 779, 631, 0, 0, 970, 505, 1287, 110, 0, 157, 996, 41, 487,
+    0, 1271, 1088, 662, 587, 0, 701, 587, 818, 1209, 0, 1180, 1105, 125, 0, 886, 125, 731, 1196, 436,
+    69, 282, 0, 0, 180, 221, 0, 1200, 322, 1144, 619, 385, 0, 28, 334, 462, 0, 1159, 738, 1196,
+    983, 1126, 90, 1170, 959, 1162, 965, 579, 0, 1202, 69, 994, 0, 1164, 560, 583, 1007, 246, 1209, 435,
+    0, 1211, 0, 0, 0, 470, 0, 125, 0, 1118, 1113, 0, 356, 1201, 559, 0, 1052, 125, 1132, 851,
+    379, 0, 209, 82, 221, 1163, 0, 0, 0, 110, 0, 566, 1001, 623, 623, 0, 1014, 772, 598, 0,
+    194, 1052, 265, 85, 452, 1025, 434, 209, 450, 51, 560, 1180, 165, 165, 806, 566, 1218, 1008, 806, 1030,
+    471, 1144, 279, 0, 1144, 271, 430, 0, 869, 273, 0, 0, 573, 1026, 652, 0, 0, 97, 639, 1184,
+    654, 1052, 529, 0, 0, 652, 885, 362, 0, 650, 469, 784, 456, 1084, 435, 646, 443, 1152, 38, 313,
+    111, 568, 567, 851, 257, 1188, 1212, 125, 433, 869, 0, 620, 0, 356, 1209, 424, 785, 102, 260, 110,
+    0, 523, 939, 1132, 1094, 951, 135, 1176, 373, 287, 1176, 1162, 1315, 0, 1183, 261, 1114, 0, 0, 838,
+    111, 373, 648, 1209, 181, 826, 456, 928, 678, 0, 0, 0, 1267, 1271, 165, 1201, 674, 1080, 141, 0,
+    989, 795, 1029, 522, 181, 996, 0, 452, 443, 17, 449, 1176, 0, 1176, 594, 1228, 36, 570, 0, 414,
+    619, 1086, 1113, 1038, 69, 1267, 1280, 23, 648, 1125, 0, 0, 0, 1121, 568, 1240, 650, 0, 1174, 0,
+    0, 0, 1125, 0, 0, 0, 928, 0, 0, 928, 476, 436, 282, 0, 717, 17, 147, 1102, 349, 1126,
+    1042, 1126, 210, 0, 1011, 0, 1108, 1144, 52, 980, 432, 1267, 1100, 0, 900, 151, 950, 414, 536, 303,
+    151, 1112, 840, 836, 545, 0, 1159, 0, 864, 0, 166, 1271, 0, 530, 826, 379, 1180, 710, 1267, 151,
+    0, 949, 0, 173, 476, 1144, 1212, 0, 0, 147, 213, 227, 324, 1027, 395, 710, 0, 567, 0, 1113,
+    0, 1106, 1148, 0, 0, 0, 542, 0, 679, 129, 443, 52, 816, 587, 383, 34, 1014, 222, 303, 1114,
+    967, 0, 0, 0, 812, 424, 1086, 1179, 1176, 0, 123, 381, 0, 0, 1113, 110, 428, 0, 375, 171,
+    0, 816, 529, 888, 0, 0, 1136, 0, 403, 187, 0, 864, 220, 123, 0, 0, 1164, 577, 50, 0,
+    0, 0, 0, 746, 36, 1187, 395, 171, 822, 1025, 1202, 558, 36, 0, 436, 301, 1114, 97, 0, 917,
+    0, 0, 1201, 0, 6, 373, 207, 322, 220, 405, 764, 0, 0, 587, 626, 628, 570, 0, 1151, 1264,
+    806, 303, 734, 1106, 254, 207, 1212, 1114, 1183, 0, 254, 48, 405, 286, 286, 824, 41, 0, 0, 951,
+    1030, 1249, 442, 0, 424, 302, 1079, 670, 832, 578, 0, 661, 322, 395, 1200, 816, 261, 13, 0, 23,
+    222, 1148, 222, 52, 1278, 768, 712, 1178, 0, 438, 198, 260, 1106, 207, 1034, 1126, 116, 1205, 349, 574,
+    47, 0, 605, 434, 1148, 959, 0, 958, 403, 1213, 111, 0, 885, 263, 0, 23, 293, 0, 1261, 289,
+    349, 75, 322, 0, 418, 246, 1026, 69, 825, 540, 594, 1088, 1250, 545, 0, 683, 52, 1068, 450, 0,
+    75, 469, 806, 1108, 1087, 301, 386, 277, 112, 405, 1215, 0, 0, 0, 0, 0, 277, 232, 395, 133,
+    36, 1182, 0, 0, 69, 895, 142, 1186, 0, 309, 0, 1212, 1263, 1158, 0, 401, 662, 772, 322, 55,
+    0, 383, 650, 946, 327, 52, 260, 165, 148, 911, 129, 868, 1235, 637, 69, 1060, 784, 302, 0, 0,
+    583, 0, 642, 1100, 818, 1271, 126, 1108, 385, 913, 0, 399, 0, 302, 873, 426, 772, 826, 0, 1104,
+    664, 530, 322, 0, 19, 910, 969, 598, 1263, 424, 85, 0, 585, 681, 375, 246, 457, 653, 277, 265,
+    695, 395, 395, 1150, 1152, 0, 52, 0, 1197, 1178, 1152, 904, 1202, 568, 568, 1206, 254, 383, 838, 562,
+    0, 0, 362, 76, 1087, 1088, 0, 11, 1144, 930, 392, 1166, 0, 1170, 0, 52, 0, 392, 1018, 591,
+    0, 1282, 0, 818, 118, 1180, 244, 1204, 181, 0, 69, 86, 1167, 0, 1178, 712, 935, 44, 0, 30,
+    671, 7, 268, 938, 0, 1271, 1168, 443, 1206, 254, 1025, 1087, 1155, 1271, 1180, 879, 951, 403, 698, 1180,
+    443, 995, 1187, 37, 403, 403, 1124, 0, 1168, 570, 0, 268, 0, 443, 1282, 1187, 1164, 456, 157, 207,
+    0, 520, 1180, 1176, 442, 268, 724, 171, 825, 1152, 69, 651, 973, 652, 573, 817, 817, 954, 52, 69,
+    47, 60, 710, 1088, 414, 277, 816, 591, 303, 13, 13, 0, 816, 866, 1068, 1180, 69, 787, 69, 0,
+    1146, 0, 0, 1202, 133, 603, 1178, 568, 0, 717, 1106, 1100, 0, 560, 0, 1257, 1317, 169, 0, 11,
+    269, 1202, 564, 303, 922, 414, 147, 985, 0, 52, 232, 0, 220, 568, 0, 373, 1218, 339, 129, 598,
+    671, 652, 628, 19, 206, 1280, 418, 277, 218, 1044, 0, 246, 403, 1088, 436, 135, 583, 0, 764, 442,
+    721, 614, 434, 0, 0, 721, 1180, 0, 1078, 1159, 822, 69, 0, 587, 314, 430, 369, 0, 392, 529,
+    97, 0, 549, 52, 416, 806, 750, 442, 1027, 995, 0, 254, 18, 442, 669, 357, 520, 11, 624, 845,
+    289, 0, 496, 383, 260, 0, 684, 0, 454, 303, 753, 0, 114, 721, 629, 0, 173, 0, 536, 0,
+    220, 302, 1034, 1311, 1097, 287, 83, 779, 951, 0, 888, 816, 103, 760, 69, 629, 1305, 173, 357, 436,
+    545, 0, 646, 653, 760, 603, 183, 0, 591, 1179, 1090, 568, 568, 1238, 1281, 426, 941, 135, 1134, 1083,
+    0, 432, 784, 0, 641, 122, 641, 118, 469, 735, 0, 710, 891, 587, 1159, 0, 818, 0, 0, 34,
+    0, 1231, 454, 1200, 1128, 41, 23, 1068, 0, 832, 1197, 221, 454, 671, 945, 928, 816, 928, 651, 206,
+    1178, 331, 331, 1049, 0, 1150, 1180, 1041, 1034, 674, 591, 0, 566, 0, 605, 1144, 196, 23, 591, 471,
+    1250, 469, 0, 1311, 1114, 1269, 0, 0, 1271, 0, 0, 540, 0, 331, 263, 677, 1274, 222, 1162, 0,
+    331, 0, 549, 1200, 0, 683, 369, 407, 1249, 0, 598, 112, 232, 1088, 1146, 1229, 662, 0, 0, 0,
+    0, 0, 1069, 97, 522, 1023, 700, 553, 604, 1178, 1126, 1163, 844, 813, 141, 1112, 349, 452, 544, 646,
+    1176, 0, 568, 1184, 0, 0, 1023, 1200, 0, 0, 102, 248, 395, 0, 1106, 0, 816, 0, 1204, 434,
+    1213, 282, 0, 377, 1264, 405, 0, 0, 454, 772, 314, 1146, 0, 212, 833, 171, 232, 21, 1034, 1079,
+    171, 1270, 26, 1101, 37, 207, 21, 1044, 0, 0, 467, 357, 173, 1197, 1204, 554, 467, 297, 701, 263,
+    263, 1133, 385, 1164, 1052, 76, 47, 511, 161, 0, 816, 1204, 0, 0, 0, 399, 418, 0, 474, 529,
+    265, 434, 671, 137, 37, 1102, 1264, 1144, 198, 135, 0, 175, 622, 511, 1164, 85, 0, 386, 0, 545,
+    1044, 1202, 379, 695, 568, 289, 812, 587, 18, 1146, 1178, 1146, 646, 0, 559, 1164, 37, 232, 587, 948,
+    447, 582, 458, 469, 1024, 785, 316, 449, 411, 76, 220, 414, 1171, 568, 650, 0, 0, 0, 878, 0,
+    0, 791, 605, 587, 1180, 81, 928, 0, 957, 1068, 671, 386, 1039, 66, 779, 426, 0, 363, 76, 566,
+    111, 28, 194, 646, 1001, 830, 1269, 527, 50, 17, 646, 1114, 0, 1048, 0, 1087, 0, 0, 0, 554,
+    111, 711, 711, 566, 240, 471, 443, 301, 922, 1241, 1019, 443, 732, 1159, 460, 313, 220, 442, 641, 198,
+    442, 939, 1126, 1219, 632, 566, 360, 1202, 1005, 1261, 1168, 1057, 0, 386, 230, 1088, 1213, 1240, 855, 0,
+    0, 0, 1042, 340, 0, 79, 301, 1039, 1005, 1005, 1298, 373, 802, 385, 0, 1278, 69, 591, 745, 0,
+    770, 222, 922, 1026, 520, 1027, 816, 436, 133, 753, 457, 501, 568, 471, 856, 540, 341, 822, 816, 1114,
+    442, 949, 1112, 5, 407, 470, 1231, 1171, 0, 436, 102, 489, 0, 0, 1162, 0, 0, 1044, 688, 1209,
+    0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1177, 234, 496, 815,
+    931, 1110, 0, 1080, 1253, 909, 931, 1110, 433, 76, 1201, 654, 310, 142, 142, 1286, 837, 782, 951, 951,
+    850, 66, 1176, 175, 239, 978, 129, 238, 850, 574, 238, 1197, 574, 1162, 67, 912, 359, 464, 324, 1156,
+    828, 1272, 435, 454, 292, 350, 155, 111, 583, 1299, 1281, 0, 1078, 205, 1088, 1281, 459, 568, 470, 795,
+    301, 1178, 1180, 685, 0, 466, 466, 1259, 1169, 1180, 0, 1268, 1099, 1242, 402, 273, 556, 1274, 801, 763,
+    832, 404, 345, 129, 129, 1179, 1183, 0, 660, 466, 817, 1175, 1104, 1115, 310, 466, 0, 0, 956, 0,
+    950, 433, 692, 437, 0, 949, 0, 0, 627, 608, 0, 892, 1150, 1163, 302, 920, 682, 311, 0, 0,
+    0, 0, 311, 135, 354, 311, 608, 583, 1180, 476, 557, 0, 1200, 1265, 951, 951, 271, 147, 1200, 1200,
+    1200, 1211, 405, 816, 1101, 459, 980, 996, 328, 328, 1159, 1123, 1159, 816, 1159, 434, 1048, 1082, 494, 1005,
+    447, 371, 1180, 111, 391, 678, 0, 1117, 458, 1041, 575, 1117, 458, 1176, 839, 69, 1198, 1126, 206, 570,
+    260, 1087, 878, 878, 434, 0, 1082, 1180, 949, 878, 556, 234, 1232, 456, 811, 141, 20, 1252, 455, 454,
+    65, 882, 175, 296, 910, 610, 0, 88, 1302, 951, 1003, 1253, 303, 1111, 1111, 1067, 395, 1044, 880, 823,
+    312, 1180, 220, 204, 589, 1179, 120, 114, 902, 0, 1178, 679, 645, 880, 439, 120, 1167, 824, 1274, 784,
+    1080, 1101, 443, 440, 1171, 292, 88, 880, 1082, 291, 219, 282, 1272, 817, 774, 1200, 230, 257, 1092, 1180,
+    1129, 494, 1177, 434, 7, 1101, 436, 301, 273, 1138, 457, 39, 206, 300, 1015, 1274, 1195, 431, 424, 1201,
+    188, 153, 910, 1087, 153, 121, 1157, 1114, 929, 113, 610, 88, 1155, 1130, 1087, 1282, 0, 1146, 736, 69,
+    338, 710, 710, 1126, 31, 1144, 587, 1278, 940, 854, 980, 45, 980, 836, 782, 1180, 980, 6, 1265, 227,
+    373, 628, 207, 1282, 76, 854, 51, 935, 172, 1088, 219, 1282, 1324, 1198, 1165, 1026, 1250, 385, 52, 1068,
+    937, 1200, 1180, 296, 1325, 511, 726, 1044, 710, 1145, 855, 1194, 1073, 823, 0, 483, 0, 774, 422, 386,
+    554, 1116, 322, 1166, 27, 274, 664, 437, 271, 67, 434, 389, 430, 356, 859, 1033, 449, 173, 1180, 950,
+    1132, 940, 1067, 489, 1269, 308, 542, 1178, 134, 515, 351, 568, 1181, 951, 651, 1279, 1144, 1198, 8, 605,
+    674, 269, 610, 1043, 104, 135, 1155, 332, 1275, 1177, 892, 443, 1108, 440, 1219, 618, 0, 449, 1262, 95,
+    832, 520, 106, 726, 731, 456, 1101, 399, 462, 130, 1264, 1325, 142, 839, 618, 469, 959, 1042, 943, 1067,
+    69, 688, 380, 55, 1061, 1201, 1106, 181, 263, 851, 1142, 526, 514, 1102, 481, 1180, 302, 549, 1312, 834,
+    568, 1193, 428, 460, 1114, 911, 757, 988, 301, 1103, 567, 302, 801, 37, 1200, 980, 1108, 1130, 1138, 1201,
+    1027, 121, 141, 0, 1163, 569, 568, 542, 0, 442, 1138, 302, 386, 471, 1122, 756, 443, 58, 147, 287,
+    295, 1159, 10, 41, 1202, 1127, 51, 443, 113, 133, 67, 1221, 1170, 188, 569, 1079, 542, 88, 1306, 324,
+    348, 41, 1028, 956, 956, 645, 212, 1010, 476, 161, 1134, 779, 1015, 401, 1179, 815, 1027, 314, 460, 454,
+    993, 116, 452, 282, 1269, 506, 474, 1304, 471, 826, 709, 610, 1297, 1085, 615, 981, 562, 428, 239, 1303,
+    44, 1101, 471, 686, 82, 442, 1246, 1173, 1269, 922, 843, 0, 1185, 128, 441, 1163, 740, 1274, 166, 439,
+    452, 1087, 1201, 66, 901, 1025, 1085, 786, 1164, 292, 1015, 1098, 265, 1124, 122, 946, 489, 222, 1325, 101,
+    1041, 41, 1176, 418, 1171, 1250, 142, 1161, 1197, 443, 1141, 1239, 170, 303, 49, 1271, 1305, 654, 434, 1179,
+    1126, 1154, 978, 249, 95, 1262, 750, 1047, 1047, 41, 1215, 618, 452, 1087, 291, 114, 354, 985, 1271, 989,
+    1107, 303, 1206, 886, 568, 893, 1212, 337, 624, 34, 224, 1014, 383, 452, 1103, 928, 826, 476, 88, 147,
+    910, 41, 1122, 1193, 1170, 1012, 1000, 1167, 272, 67, 437, 203, 1219, 1015, 0, 64, 146, 741, 84, 559,
+    185, 1191, 1227, 1305, 779, 982, 19, 153, 1201, 1246, 178, 929, 829, 460, 135, 921, 375, 1251, 843, 1164,
+    222, 1103, 618, 41, 793, 456, 570, 605, 631, 823, 1111, 1012, 1186, 241, 1288, 1118, 928, 832, 462, 1061,
+    1320, 812, 1103, 553, 115, 351, 577, 815, 218, 110, 1087, 433, 276, 424, 154, 443, 207, 449, 467, 919,
+    291, 1114, 476, 265, 447, 443, 1044, 584, 69, 341, 0, 989, 1114, 444, 663, 1176, 457, 440, 834, 785,
+    292, 1278, 7, 907, 1178, 481, 731, 110, 1180, 208, 459, 1145, 520, 442, 147, 205, 449, 921, 1219, 0,
+    64, 11, 891, 1007, 141, 106, 545, 710, 456, 826, 646, 1101, 724, 848, 710, 114, 582, 559, 618, 527,
+    38, 246, 56, 1222, 1269, 980, 1195, 381, 127, 127, 568, 1023, 1087, 595, 146, 112, 870, 956, 424, 568,
+    614, 1222, 741, 1015, 1163, 559, 694, 269, 1102, 1212, 1220, 1204, 1135, 136, 1257, 1135, 1111, 351, 254, 501,
+    254, 654, 1054, 114, 269, 254, 269, 1127, 1054, 980, 1163, 1163, 950, 0, 209, 823, 242, 288, 635, 940,
+    242, 0, 458, 567, 418, 893, 1082, 701, 859, 574, 1200, 20, 332, 593, 1103, 0, 545, 334, 1028, 348,
+    1131, 65, 816, 471, 226, 1301, 0, 1167, 441, 955, 436, 1180, 436, 111, 461, 0, 869, 701, 0, 636,
+    315, 869, 95, 461, 95, 1219, 343, 462, 637, 1278, 637, 337, 1143, 654, 652, 886, 1182, 1125, 489, 479,
+    731, 1178, 650, 951, 348, 646, 1273, 471, 1203, 664, 511, 0, 303, 1125, 652, 65, 239, 1007, 315, 293,
+    65, 405, 136, 476, 405, 527, 1175, 563, 762, 301, 663, 241, 1113, 582, 1108, 441, 460, 959, 640, 1052,
+    815, 341, 1295, 981, 460, 573, 846, 228, 587, 241, 314, 442, 1181, 178, 1178, 568, 88, 665, 0, 186,
+    978, 259, 457, 584, 584, 724, 1103, 246, 433, 277, 277, 277, 295, 468, 146, 0, 292, 0, 0, 301,
+    292, 802, 292, 486, 418, 486, 311, 218, 802, 854, 1135, 520, 1051, 16, 144, 434, 210, 373, 373, 1228,
+    211, 228, 211, 880, 880, 156, 288, 835, 1180, 433, 488, 826, 191, 145, 1091, 433, 206, 1132, 407, 1078,
+    476, 566, 1209, 582, 591, 1231, 315, 159, 301, 144, 857, 468, 926, 663, 587, 1272, 762, 60, 452, 452,
+    38, 568, 926, 60, 111, 459, 342, 326, 213, 159, 528, 512, 261, 271, 1271, 960, 861, 104, 173, 501,
+    452, 357, 173, 357, 486, 261, 436, 1027, 459, 598, 326, 1231, 1203, 196, 1149, 501, 540, 824, 104, 159,
+    343, 443, 196, 566, 1024, 287, 807, 111, 816, 159, 1303, 315, 1077, 68, 433, 258, 844, 1163, 1298, 443,
+    436, 68, 1161, 471, 432, 947, 442, 259, 249, 1099, 343, 303, 947, 443, 321, 1239, 486, 159, 472, 111,
+    1056, 605, 566, 297, 926, 793, 509, 449, 342, 831, 476, 409, 1240, 1300, 570, 471, 782, 591, 357, 449,
+    357, 443, 443, 1013, 429, 436, 443, 1180, 443, 1269, 110, 183, 669, 566, 1280, 568, 1156, 861, 31, 332,
+    437, 1102, 628, 582, 457, 504, 1124, 1270, 241, 1282, 737, 452, 855, 935, 1180, 1279, 658, 568, 460, 553,
+    553, 474, 510, 1166, 1071, 1122, 674, 524, 452, 582, 385, 951, 501, 457, 381, 69, 663, 135, 549, 1193,
+    1193, 654, 501, 1153, 474, 844, 605, 809, 647, 544, 556, 487, 654, 241, 1144, 1144, 488, 1102, 1180, 1153,
+    1094, 947, 553, 679, 605, 793, 951, 433, 840, 829, 449, 861, 1167, 1180, 476, 277, 474, 1044, 471, 205,
+    1124, 628, 1153, 1153, 619, 568, 123, 870, 861, 35, 933, 1211, 464, 38, 335, 1102, 1211, 0, 0, 310,
+    310, 35, 174, 0, 1135, 778, 469, 1018, 322, 812, 11, 768, 301, 332, 198, 467, 847, 51, 409, 40,
+    696, 133, 280, 467, 1178, 1214, 446, 494, 446, 524, 402, 1108, 854, 55, 356, 838, 1224, 524, 286, 402,
+    1048, 356, 357, 424, 205, 357, 570, 570, 991, 246, 467, 855, 1105, 784, 854, 1180, 822, 1163, 54, 711,
+    854, 949, 1130, 823, 714, 904, 1311, 944, 1101, 424, 31, 951, 1106, 1080, 407, 1124, 1080, 39, 1311, 1297,
+    1124, 205, 628, 688, 205, 434, 69, 965, 75, 527, 55, 75, 1247, 821, 603, 1197, 604, 1103, 344, 1098,
+    1126, 452, 452, 1088, 13, 848, 1268, 636, 1184, 1085, 935, 434, 864, 607, 951, 474, 1126, 1144, 456, 864,
+    1102, 434, 265, 843, 1103, 0, 115, 1247, 265, 1040, 568, 1259, 374, 568, 1158, 1156, 1164, 939, 1270, 1241,
+    764, 0, 385, 1157, 1271, 95, 764, 1025, 566, 939, 401, 1040, 1316, 196, 287, 1204, 95, 1204, 1115, 1163,
+    568, 476, 922, 224, 145, 467, 840, 17, 356, 1164, 978, 568, 115, 545, 568, 1162, 1163, 1204, 978, 332,
+    583, 851, 857, 857, 0, 559, 245, 1114, 1286, 909, 84, 84, 84, 84, 7, 204, 1198, 101, 434, 1197,
+    968, 278, 953, 347, 21, 272, 901, 951, 956, 1298, 856, 955, 55, 1144, 439, 762, 985, 320, 1088, 985,
+    232, 898, 175, 510, 340, 471, 589, 343, 1017, 511, 1270, 450, 1257, 20, 234, 500, 1007, 135, 950, 1198,
+    851, 805, 1176, 383, 978, 1012, 134, 556, 228, 433, 0, 394, 660, 1141, 632, 132, 324, 1145, 1169, 1302,
+    385, 434, 230, 192, 1044, 664, 401, 568, 1053, 1118, 1242, 1110, 1175, 618, 1, 625, 750, 1149, 1177, 479,
+    142, 585, 1063, 1182, 287, 51, 842, 842, 454, 76, 298, 24, 255, 288, 263, 373, 1040, 377, 974, 817,
+    395, 1268, 942, 1100, 1100, 119, 699, 1152, 1103, 160, 242, 1091, 400, 748, 1100, 320, 1156, 481, 618, 265,
+    322, 639, 202, 817, 129, 1100, 320, 300, 450, 394, 134, 944, 698, 1063, 302, 1180, 202, 748, 568, 28,
+    1204, 518, 0, 827, 1099, 265, 948, 860, 775, 1091, 709, 0, 587, 869, 1195, 221, 1275, 951, 1278, 1037,
+    1106, 1180, 818, 802, 1302, 338, 1301, 1088, 1141, 384, 695, 1107, 771, 1180, 1119, 940, 402, 666, 198, 854,
+    470, 0, 1214, 1067, 258, 810, 768, 52, 301, 1165, 385, 1242, 385, 368, 467, 1193, 303, 864, 1278, 1073,
+    483, 338, 482, 1324, 76, 594, 239, 724, 0, 978, 1114, 432, 818, 271, 265, 351, 1242, 1106, 1178, 581,
+    1301, 660, 649, 1270, 1171, 433, 1278, 321, 965, 1221, 1122, 499, 421, 515, 412, 1018, 1112, 265, 1147, 1138,
+    1075, 1161, 554, 1177, 4, 799, 942, 1044, 394, 1135, 258, 1071, 366, 1217, 1202, 222, 758, 1117, 4, 389,
+    524, 1158, 197, 1119, 52, 1208, 0, 406, 0, 520, 260, 0, 436, 731, 673, 1190, 383, 1204, 596, 809,
+    632, 321, 263, 132, 935, 565, 682, 1311, 385, 512, 1119, 1114, 553, 68, 1259, 1239, 575, 20, 660, 556,
+    993, 297, 75, 375, 391, 330, 976, 323, 1197, 1164, 340, 340, 28, 372, 1000, 165, 1180, 4, 438, 1053,
+    1112, 415, 568, 1103, 1014, 1325, 851, 121, 1100, 1230, 1158, 242, 817, 220, 842, 624, 0, 396, 243, 0,
+    553, 574, 1001, 1230, 416, 0, 920, 433, 1324, 1096, 294, 1182, 404, 815, 955, 1086, 960, 116, 269, 568,
+    830, 10, 454, 1189, 714, 1199, 1030, 543, 922, 1103, 1070, 402, 5, 1275, 735, 502, 1298, 1298, 929, 220,
+    393, 545, 3, 1119, 1115, 1063, 1101, 1092, 188, 922, 402, 817, 817, 1018, 207, 207, 1176, 1302, 51, 188,
+    169, 385, 1158, 817, 1259, 284, 574, 1112, 783, 922, 541, 1231, 843, 344, 752, 1260, 917, 1288, 721, 365,
+    613, 1161, 222, 859, 1009, 72, 237, 548, 1122, 0, 1014, 135, 1025, 9, 464, 207, 482, 1192, 1088, 688,
+    928, 1202, 1259, 539, 451, 399, 374, 232, 1275, 106, 1075, 876, 1202, 1181, 1221, 1169, 747, 654, 403, 1212,
+    154, 424, 416, 416, 1105, 384, 433, 531, 1273, 1087, 922, 1143, 418, 248, 721, 1145, 575, 1202, 912, 132,
+    832, 1164, 205, 775, 84, 566, 1190, 1239, 1085, 656, 1186, 775, 0, 529, 1106, 1202, 452, 601, 514, 916,
+    432, 1025, 1170, 386, 2, 1140, 827, 917, 1191, 989, 396, 1124, 1180, 1000, 625, 101, 371, 501, 1005, 913,
+    1029, 893, 984, 1071, 433, 765, 1099, 1112, 951, 322, 1301, 451, 616, 1093, 1074, 980, 132, 381, 1000, 0,
+    368, 1001, 840, 721, 384, 0, 907, 0, 324, 681, 223, 7, 0, 1043, 52, 17, 17, 570, 185, 1258,
+    671, 986, 985, 1011, 220, 815, 450, 136, 447, 486, 1012, 909, 92, 437, 5, 1119, 790, 601, 304, 340,
+    1119, 402, 424, 361, 748, 1111, 1231, 114, 1141, 804, 214, 625, 624, 403, 561, 245, 304, 1013, 1175, 45,
+    1185, 0, 450, 652, 1122, 406, 627, 868, 1322, 778, 553, 1122, 433, 1281, 118, 531, 1317, 1119, 978, 381,
+    302, 577, 832, 1103, 1140, 1009, 1010, 387, 1155, 264, 1320, 276, 132, 421, 1222, 157, 181, 207, 1202, 1063,
+    128, 450, 1173, 1103, 818, 381, 570, 1141, 216, 421, 1182, 811, 475, 840, 1154, 721, 602, 978, 1163, 1188,
+    197, 205, 747, 1278, 457, 731, 1208, 424, 818, 265, 1230, 1177, 951, 450, 1203, 6, 1191, 476, 520, 1201,
+    775, 213, 322, 1127, 255, 208, 0, 908, 782, 784, 1181, 1317, 724, 220, 547, 1005, 432, 891, 380, 1110,
+    1159, 258, 1106, 141, 436, 457, 381, 1027, 114, 0, 0, 77, 1027, 602, 424, 69, 1195, 721, 1182, 405,
+    671, 417, 1259, 566, 591, 0, 692, 1119, 669, 1164, 568, 603, 594, 301, 207, 127, 798, 784, 1118, 432,
+    669, 1106, 260, 514, 1162, 110, 1185, 871, 226, 537, 1005, 1119, 448, 169, 413, 432, 1288, 721, 1119, 79,
+    566, 111, 108, 568, 1180, 613, 692, 1223, 987, 1105, 0, 441, 1215, 1281, 545, 721, 691, 0, 0, 1086,
+    422, 1181, 851, 980, 722, 442, 422, 1130, 1181, 687, 1056, 1056, 257, 494, 1203, 462, 786, 1213, 174, 403,
+    422, 1204, 263, 362, 534, 174, 1086, 1052, 1086, 610, 362, 865, 884, 587, 341, 362, 1006, 362, 1052, 1198,
+    362, 1182, 428, 813, 1201, 373, 1204, 610, 858, 1201, 843, 362, 153, 1086, 1204, 858, 512, 303, 1204, 1204,
+    265, 0, 1052, 1052, 1056, 620, 424, 1180, 1204, 606, 606, 1053, 1159, 1053, 1040, 947, 813, 605, 0, 1156,
+    1219, 1086, 321, 1202, 1099, 354, 784, 1178, 222, 823, 823, 1264, 1298, 210, 822, 0, 0, 527, 114, 816,
+    721, 671, 434, 438, 1270, 1270, 30, 1153, 1048, 841, 289, 479, 504, 1064, 280, 291, 44, 1009, 489, 412,
+    1325, 504, 52, 1132, 222, 458, 436, 520, 221, 458, 441, 1010, 568, 23, 1102, 289, 1293, 803, 761, 1013,
+    532, 854, 1011, 1268, 1068, 311, 802, 227, 344, 709, 1007, 782, 461, 1167, 296, 19, 593, 850, 679, 500,
+    337, 1152, 21, 133, 123, 587, 1282, 303, 402, 1271, 161, 537, 595, 595, 603, 19, 0, 768, 0, 1132,
+    241, 436, 501, 605, 171, 134, 559, 308, 1181, 401, 252, 1257, 301, 351, 1170, 260, 260, 356, 102, 1166,
+    1182, 273, 337, 1204, 232, 1124, 502, 461, 954, 265, 0, 227, 395, 1102, 516, 0, 0, 210, 486, 0,
+    696, 10, 1131, 1114, 416, 32, 771, 23, 1180, 1184, 375, 1144, 161, 97, 330, 4, 779, 281, 864, 1193,
+    1155, 438, 222, 626, 551, 1148, 129, 1162, 455, 1259, 560, 582, 813, 129, 0, 76, 949, 1153, 361, 461,
+    1175, 714, 221, 1202, 76, 1159, 473, 996, 783, 128, 1079, 471, 611, 1265, 506, 138, 239, 204, 1012, 10,
+    83, 957, 47, 489, 1269, 260, 1180, 1269, 1180, 772, 433, 1295, 816, 916, 471, 709, 512, 501, 1014, 532,
+    711, 441, 252, 456, 315, 1202, 265, 779, 341, 1054, 564, 0, 1157, 826, 0, 11, 0, 261, 696, 1051,
+    129, 1181, 426, 52, 572, 361, 232, 1288, 401, 37, 37, 1200, 219, 635, 451, 894, 265, 331, 488, 1304,
+    1200, 418, 265, 1170, 1164, 38, 434, 639, 114, 247, 1068, 1184, 293, 1274, 454, 1262, 292, 315, 154, 442,
+    0, 0, 1118, 417, 562, 251, 0, 1145, 436, 434, 520, 1186, 1003, 129, 1193, 486, 989, 989, 949, 652,
+    1004, 1094, 129, 1052, 1014, 864, 1273, 568, 779, 34, 905, 1226, 252, 1029, 1102, 130, 1153, 322, 1264, 7,
+    332, 1162, 489, 1029, 1204, 1089, 1126, 593, 0, 550, 114, 779, 48, 125, 181, 604, 750, 826, 639, 671,
+    1286, 969, 957, 599, 133, 631, 56, 460, 815, 959, 222, 1251, 490, 1191, 227, 126, 1268, 1106, 361, 829,
+    457, 219, 929, 679, 185, 1164, 1004, 1236, 816, 828, 573, 0, 1293, 831, 1236, 1141, 928, 928, 21, 811,
+    520, 240, 277, 864, 671, 255, 255, 1319, 222, 947, 261, 261, 1010, 218, 1101, 289, 418, 1010, 197, 1176,
+    0, 0, 19, 828, 433, 831, 502, 1180, 783, 52, 227, 444, 1175, 1191, 69, 1010, 546, 471, 412, 210,
+    871, 826, 1153, 547, 1105, 386, 7, 1156, 212, 381, 894, 0, 559, 527, 603, 1162, 1010, 1086, 412, 595,
+    595, 898, 568, 583, 871, 0, 1153, 1162, 558, 23, 0, 951, 878, 0, 1290, 1290, 944, 1177, 628, 499,
+    1281, 1290, 403, 403, 533, 1177, 403, 1144, 533, 955, 633, 1319, 955, 1177, 1270, 338, 147, 446, 293, 41,
+    0, 55, 993, 865, 587, 303, 1325, 1110, 1137, 0, 695, 1110, 529, 1103, 1076, 1206, 636, 989, 258, 258,
+    1176, 844, 0, 337, 337, 818, 648, 648, 1182, 431, 127, 200, 1232, 1028, 1008, 300, 347, 1169, 1165, 376,
+    319, 948, 43, 1008, 1048, 1163, 51, 1178, 515, 437, 259, 0, 526, 1213, 437, 752, 266, 570, 416, 222,
+    1163, 770, 860, 816, 686, 295, 1124, 291, 226, 0, 529, 1309, 416, 818, 485, 936, 42, 1180, 445, 1020,
+    1226, 43, 1103, 1117, 286, 228, 1155, 504, 227, 19, 936, 1094, 761, 19, 1102, 19, 445, 570, 259, 1210,
+    445, 951, 291, 432, 52, 570, 260, 744, 736, 234, 685, 823, 441, 1003, 466, 688, 104, 382, 1111, 279,
+    435, 977, 891, 284, 1084, 395, 1289, 303, 621, 205, 880, 300, 460, 1162, 1126, 1092, 1272, 752, 248, 436,
+    504, 1274, 1169, 457, 1211, 659, 771, 0, 1209, 1289, 727, 1164, 683, 1127, 289, 51, 1200, 1069, 292, 1204,
+    281, 1101, 1202, 354, 248, 21, 708, 1276, 1298, 1254, 198, 685, 1205, 1049, 1146, 1269, 262, 641, 671, 815,
+    52, 940, 838, 262, 385, 1143, 273, 1265, 662, 31, 678, 300, 587, 1302, 1302, 950, 869, 926, 1165, 629,
+    453, 338, 980, 1134, 1087, 1301, 471, 926, 797, 880, 1170, 1045, 444, 956, 434, 308, 931, 536, 472, 447,
+    337, 678, 441, 441, 1178, 714, 1269, 433, 433, 1114, 392, 351, 479, 515, 1164, 665, 582, 774, 1163, 1198,
+    1162, 104, 940, 1181, 134, 356, 858, 1301, 981, 1085, 395, 1072, 598, 1159, 874, 447, 606, 801, 1114, 935,
+    567, 129, 1122, 632, 0, 1000, 1101, 1087, 501, 544, 169, 237, 715, 1132, 688, 1200, 741, 771, 700, 472,
+    940, 1271, 373, 222, 1289, 263, 798, 1062, 375, 654, 1100, 1162, 1101, 1103, 1162, 1200, 980, 1200, 1071, 0,
+    1112, 468, 856, 973, 815, 1112, 1291, 239, 113, 605, 6, 262, 262, 598, 653, 175, 809, 469, 804, 82,
+    235, 1079, 57, 1119, 958, 817, 421, 303, 262, 1097, 1010, 284, 0, 452, 1028, 709, 859, 460, 425, 458,
+    823, 227, 1134, 405, 1074, 542, 52, 1181, 1275, 169, 303, 460, 610, 1164, 545, 532, 1182, 1159, 0, 568,
+    226, 1112, 0, 409, 1185, 110, 942, 1041, 210, 1171, 1102, 690, 901, 439, 1047, 1144, 1200, 1085, 1025, 888,
+    640, 205, 895, 839, 0, 1099, 824, 164, 635, 303, 453, 249, 1103, 1274, 639, 418, 653, 8, 1185, 1145,
+    0, 1085, 641, 1206, 1262, 850, 1025, 1126, 1069, 572, 637, 869, 978, 786, 1088, 1071, 467, 403, 18, 0,
+    0, 1141, 1047, 354, 1307, 1170, 785, 1104, 1204, 1188, 885, 893, 132, 591, 640, 760, 18, 621, 337, 531,
+    840, 440, 915, 1262, 1204, 101, 1192, 664, 1185, 434, 989, 717, 1112, 1017, 764, 549, 696, 36, 7, 785,
+    798, 1180, 793, 1202, 558, 1146, 631, 1177, 1251, 491, 1192, 711, 566, 220, 354, 1161, 457, 1286, 114, 95,
+    372, 704, 555, 669, 1258, 405, 405, 19, 704, 828, 0, 796, 338, 1101, 448, 1069, 1249, 635, 1112, 1112,
+    671, 577, 570, 409, 354, 216, 1268, 1141, 0, 407, 1103, 424, 874, 1103, 1164, 110, 447, 640, 279, 276,
+    1111, 1180, 1088, 450, 303, 951, 52, 928, 996, 828, 571, 414, 0, 717, 240, 1180, 85, 7, 715, 705,
+    621, 1035, 141, 457, 171, 1200, 798, 0, 1141, 685, 1161, 1007, 1185, 85, 717, 0, 1186, 653, 0, 621,
+    942, 1134, 711, 246, 592, 1203, 546, 1164, 968, 587, 449, 715, 546, 1111, 1185, 968, 963, 859, 651, 566,
+    606, 1162, 1281, 546, 1302, 452, 476, 476, 507, 1213, 1301, 1303, 190, 997, 301, 41, 1301, 1122, 1130, 648,
+    980, 1006, 35, 436, 338, 736, 1150, 0, 1287, 369, 606, 997, 412, 660, 175, 823, 957, 110, 1156, 1301,
+    710, 300, 1301, 566, 1150, 71, 891, 542, 721, 721, 1185, 606, 653, 724, 886, 1003, 356, 1244, 848, 1201,
+    954, 8, 1052, 983, 1078, 890, 1171, 395, 1178, 459, 1294, 652, 1281, 210, 395, 1304, 348, 1278, 237, 1079,
+    1178, 37, 949, 949, 138, 942, 501, 1145, 951, 1198, 416, 1178, 1035, 950, 1114, 332, 129, 866, 332, 1119,
+    1218, 1242, 37, 371, 1164, 1119, 437, 942, 125, 885, 419, 652, 511, 521, 63, 989, 83, 1222, 436, 1203,
+    436, 1182, 652, 511, 843, 864, 1262, 442, 303, 724, 67, 414, 641, 841, 373, 1202, 949, 724, 457, 724,
+    1271, 1201, 37, 521, 724, 841, 671, 102, 471, 343, 841, 402, 1102, 577, 949, 724, 1246, 942, 1087, 1125,
+    521, 424, 577, 481, 414, 1180, 1178, 37, 842, 138, 37, 292, 192, 254, 980, 1154, 212, 619, 254, 955,
+    805, 292, 1286, 300, 939, 501, 444, 444, 1286, 1088, 1319, 1154, 959, 254, 212, 1121, 433, 934, 270, 270,
+    270, 306, 441, 957, 125, 931, 931, 0, 305, 114, 579, 1113, 1113, 0, 1081, 1081, 1196, 579, 579, 1170,
+    632, 1081, 1081, 1081, 307, 1170, 261, 531, 1273, 467, 311, 340, 311, 1060, 311, 311, 948, 1183, 134, 495,
+    709, 456, 1087, 718, 469, 785, 99, 1106, 49, 468, 454, 1029, 854, 1027, 454, 1099, 229, 948, 950, 802,
+    433, 1126, 125, 1106, 709, 1249, 1103, 0, 630, 262, 600, 802, 1027, 287, 958, 1126, 1052, 618, 618, 1105,
+    99, 618, 471, 1126, 471, 475, 577, 476, 958, 1106, 123, 1064, 711, 926, 0, 1111, 568, 1149, 0, 0,
+    594, 1180, 817, 880, 1102, 375, 940, 1201, 144, 996, 817, 0, 1209, 30, 1171, 13, 1157, 1102, 452, 265,
+    434, 823, 288, 1204, 816, 97, 824, 816, 104, 454, 854, 316, 1114, 19, 545, 212, 20, 1325, 1325, 1167,
+    471, 315, 500, 336, 1152, 39, 568, 1034, 468, 1162, 301, 1140, 439, 587, 1068, 771, 1197, 204, 527, 1209,
+    854, 405, 806, 662, 11, 1034, 587, 133, 0, 239, 0, 528, 1140, 636, 1044, 1150, 1180, 0, 384, 498,
+    616, 262, 303, 1154, 232, 605, 8, 270, 308, 859, 1044, 1178, 678, 949, 8, 1086, 402, 1271, 652, 567,
+    433, 1044, 1086, 1198, 0, 1108, 567, 1170, 450, 1265, 606, 447, 263, 263, 1202, 1174, 73, 834, 865, 292,
+    292, 695, 567, 1196, 1114, 395, 212, 940, 129, 1052, 330, 481, 383, 1108, 1181, 1201, 551, 489, 553, 542,
+    1113, 864, 506, 137, 137, 1005, 0, 407, 468, 542, 816, 662, 532, 532, 1311, 341, 185, 1157, 1157, 316,
+    610, 610, 562, 476, 258, 1265, 361, 1182, 239, 373, 1265, 1087, 1170, 784, 1161, 981, 452, 45, 1311, 476,
+    239, 1249, 341, 1182, 0, 1231, 418, 1200, 1085, 1166, 292, 851, 257, 1025, 1179, 1271, 951, 1218, 1171, 265,
+    1282, 488, 619, 1163, 640, 311, 433, 433, 415, 1041, 947, 639, 826, 1102, 1200, 1304, 545, 476, 1162, 1162,
+    1087, 1304, 102, 996, 885, 0, 839, 1200, 0, 599, 1052, 252, 1103, 1093, 88, 208, 395, 452, 5, 591,
+    1101, 981, 831, 1301, 1086, 45, 224, 194, 825, 1193, 721, 194, 434, 0, 0, 982, 1304, 446, 577, 0,
+    111, 232, 96, 236, 1051, 599, 1253, 1249, 1249, 17, 92, 854, 827, 1316, 1317, 212, 212, 1104, 1202, 69,
+    594, 1117, 99, 68, 839, 447, 1163, 553, 1250, 583, 577, 577, 455, 218, 261, 1319, 450, 357, 1170, 832,
+    1170, 476, 1247, 1180, 1150, 695, 1176, 1176, 1178, 265, 1113, 434, 1126, 500, 1103, 222, 19, 1317, 0, 1178,
+    885, 212, 588, 1215, 1201, 1209, 1183, 0, 451, 568, 995, 594, 594, 224, 1186, 1103, 469, 110, 1187, 528,
+    1162, 1085, 695, 859, 119, 183, 606, 224, 224, 0, 1162, 1162, 1163, 695, 1163, 152, 357, 152, 1275, 417,
+    458, 1154, 118, 118, 580, 332, 1324, 833, 471, 333, 0, 1099, 0, 0, 104, 851, 851, 435, 1179, 980,
+    20, 1268, 1254, 1118, 1178, 456, 1155, 474, 0, 1155, 455, 301, 1214, 52, 951, 76, 234, 965, 276, 721,
+    948, 288, 754, 1270, 1103, 405, 207, 1086, 1253, 1015, 204, 624, 774, 754, 1037, 301, 570, 1271, 1277, 69,
+    1271, 222, 671, 1180, 1180, 802, 822, 474, 891, 965, 204, 1267, 973, 834, 1262, 948, 866, 1104, 32, 204,
+    354, 141, 802, 1253, 920, 1077, 204, 1086, 114, 922, 816, 1231, 362, 637, 247, 399, 1267, 1141, 652, 1086,
+    1098, 301, 1180, 32, 802, 0, 332, 760, 419, 211, 652, 437, 1023, 421, 1272, 926, 631, 679, 56, 362,
+    1231, 679, 32, 1253, 462, 111, 301, 1271, 402, 276, 157, 52, 0, 0, 652, 831, 109, 289, 646, 32,
+    141, 661, 145, 452, 1113, 545, 311, 802, 712, 823, 67, 67, 1134, 314, 1169, 416, 1198, 1195, 435, 352,
+    784, 1040, 1232, 352, 1289, 672, 846, 52, 840, 257, 157, 356, 1158, 28, 454, 1144, 603, 1101, 0, 514,
+    1188, 221, 768, 227, 1156, 659, 329, 170, 302, 1044, 764, 287, 1116, 1179, 1271, 1033, 1271, 1138, 248, 1325,
+    1119, 1052, 356, 514, 764, 1041, 1197, 73, 234, 130, 542, 39, 434, 8, 959, 491, 1191, 1069, 981, 959,
+    845, 1202, 1201, 659, 984, 95, 1115, 287, 467, 385, 424, 593, 922, 570, 549, 984, 1271, 809, 845, 467,
+    467, 456, 17, 536, 598, 1184, 579, 204, 605, 1180, 145, 110, 1051, 978, 1127, 659, 115, 1101, 287, 352,
+    0, 520, 52, 828, 1126, 584, 584, 577, 603, 0, 1186, 1111, 1040, 1191, 566, 1040, 1183, 1154, 1162, 1041,
+    220, 806, 443, 422, 685, 422, 333, 714, 485, 55, 1180, 818, 733, 289, 470, 1163, 1180, 1226, 52, 1180,
+    1177, 271, 909, 951, 271, 951, 951, 332, 230, 1183, 405, 301, 395, 1099, 1060, 133, 446, 23, 942, 222,
+    1251, 476, 1017, 302, 221, 650, 1112, 403, 117, 737, 460, 1263, 1178, 651, 858, 1077, 932, 901, 1145, 460,
+    255, 1251, 446, 828, 779, 207, 828, 52, 52, 939, 207, 442, 337, 0, 272, 52, 509, 0, 62, 1119,
+    207, 536, 828, 395, 650, 536, 1077, 476, 436, 436, 354, 208, 605, 605, 1058, 424, 1271, 424, 424, 1178,
+    1178, 1178, 1178, 432, 432, 926, 1132, 1090, 1044, 1164, 1164, 1202, 132, 82, 56, 228, 63, 779, 1193, 790,
+    1251, 1187, 132, 135, 1298, 1069, 434, 764, 1272, 1180, 1082, 123, 51, 133, 588, 301, 1083, 1265, 180, 1083,
+    460, 204, 1103, 1155, 389, 1166, 411, 619, 401, 1071, 130, 1271, 1142, 460, 1052, 175, 0, 542, 175, 214,
+    756, 1105, 0, 818, 114, 1271, 175, 1275, 542, 1202, 1126, 454, 443, 133, 439, 55, 418, 303, 1154, 1087,
+    764, 1170, 1085, 1103, 1265, 793, 133, 214, 1265, 1265, 62, 214, 136, 123, 449, 1088, 450, 421, 639, 596,
+    1115, 38, 855, 1127, 0, 52, 1180, 556, 878, 211, 237, 309, 436, 879, 878, 112, 1011, 1021, 1021, 311,
+    818, 951, 191, 1271, 1084, 632, 1103, 277, 1185, 1030, 662, 662, 1272, 136, 1102, 434, 1101, 1106, 1176, 1195,
+    1080, 174, 1272, 520, 1202, 55, 1271, 816, 188, 125, 1008, 1064, 824, 714, 426, 1135, 729, 1083, 1111, 1127,
+    491, 402, 487, 291, 411, 1008, 982, 1101, 751, 116, 159, 471, 1180, 37, 117, 662, 771, 1325, 1234, 1168,
+    511, 31, 738, 695, 1265, 754, 76, 1037, 341, 405, 471, 198, 570, 978, 140, 222, 204, 1178, 1052, 1196,
+    300, 434, 778, 1134, 1206, 709, 347, 301, 1106, 52, 1195, 838, 1148, 174, 66, 419, 1144, 147, 782, 1103,
+    1103, 1009, 0, 1305, 254, 0, 0, 1180, 134, 880, 1154, 951, 1106, 554, 392, 524, 677, 1270, 1124, 572,
+    1033, 419, 232, 382, 507, 356, 392, 1103, 1122, 959, 0, 516, 850, 1168, 424, 422, 135, 438, 1178, 1135,
+    347, 585, 421, 1303, 1144, 134, 1118, 745, 390, 266, 501, 1043, 1029, 332, 859, 1103, 822, 1209, 778, 502,
+    214, 424, 265, 0, 1046, 1164, 486, 95, 696, 1213, 632, 1193, 1193, 1203, 782, 533, 833, 1209, 1202, 1202,
+    454, 1103, 1259, 585, 1027, 375, 383, 838, 1027, 76, 1180, 826, 423, 1103, 41, 629, 1177, 391, 982, 858,
+    130, 528, 1102, 1102, 1195, 566, 575, 416, 174, 1180, 1209, 568, 722, 696, 265, 864, 1146, 823, 1102, 663,
+    175, 286, 39, 259, 188, 116, 644, 568, 436, 350, 350, 1134, 213, 815, 506, 1030, 610, 1103, 489, 532,
+    711, 844, 141, 255, 363, 109, 573, 1079, 1203, 455, 436, 583, 1202, 432, 385, 859, 1010, 1027, 1027, 719,
+    1083, 169, 402, 425, 1103, 115, 1127, 1086, 424, 265, 897, 1305, 441, 1193, 227, 471, 86, 129, 214, 41,
+    838, 85, 207, 350, 261, 696, 1213, 1117, 1293, 233, 418, 166, 848, 876, 1131, 95, 54, 425, 1304, 1025,
+    833, 141, 41, 1145, 1085, 322, 823, 1087, 1202, 1200, 52, 1145, 416, 663, 52, 1180, 654, 1193, 487, 210,
+    1181, 265, 125, 676, 501, 501, 1200, 7, 838, 1163, 743, 313, 1213, 1305, 905, 564, 291, 0, 531, 531,
+    864, 332, 1211, 989, 989, 816, 1170, 982, 419, 434, 340, 471, 159, 711, 1124, 486, 1266, 1193, 93, 999,
+    943, 69, 487, 1206, 1124, 428, 1193, 1167, 568, 914, 1017, 1181, 171, 1144, 826, 1008, 417, 1213, 943, 665,
+    0, 939, 175, 793, 671, 679, 362, 135, 86, 85, 85, 186, 663, 1021, 1251, 1046, 19, 969, 631, 350,
+    864, 1230, 467, 424, 486, 570, 751, 982, 456, 1184, 619, 929, 1088, 1056, 629, 823, 939, 1191, 846, 491,
+    222, 1269, 598, 474, 815, 815, 1202, 802, 577, 174, 1195, 136, 1271, 1046, 128, 818, 854, 779, 41, 59,
+    165, 447, 1236, 135, 570, 802, 531, 424, 832, 129, 1184, 1184, 1105, 1105, 207, 1010, 260, 254, 254, 989,
+    476, 95, 1119, 277, 291, 553, 555, 136, 372, 818, 1112, 663, 459, 578, 1101, 86, 476, 181, 1114, 1011,
+    945, 782, 1180, 146, 1111, 695, 207, 1011, 459, 981, 375, 447, 1076, 414, 240, 840, 840, 855, 93, 502,
+    1126, 1185, 19, 637, 1180, 584, 917, 481, 411, 644, 546, 7, 584, 1161, 342, 1110, 135, 1201, 1184, 202,
+    648, 7, 646, 254, 816, 670, 545, 644, 141, 1271, 743, 743, 1161, 1167, 69, 1269, 527, 527, 1197, 300,
+    591, 661, 129, 0, 112, 647, 546, 411, 1146, 872, 112, 436, 471, 413, 939, 1180, 572, 689, 650, 1015,
+    476, 317, 317, 317, 321, 1209, 1102, 441, 1141, 959, 885, 1106, 129, 1097, 454, 321, 441, 827, 432, 827,
+    1250, 241, 815, 438, 232, 1233, 438, 435, 951, 488, 434, 529, 310, 217, 1250, 156, 321, 442, 452, 1202,
+    442, 1163, 605, 1106, 1250, 1106, 1106, 167, 204, 855, 405, 405, 405, 265, 951, 568, 636, 405, 568, 281,
+    1001, 54, 227, 461, 930, 1178, 1179, 928, 405, 284, 1163, 954, 0, 81, 1239, 851, 556, 811, 20, 199,
+    881, 301, 0, 1219, 1067, 1253, 228, 492, 1199, 512, 375, 940, 101, 1179, 340, 511, 1102, 1067, 823, 1269,
+    880, 536, 642, 915, 1166, 729, 31, 122, 874, 1103, 824, 29, 438, 1200, 301, 19, 1103, 782, 1270, 1303,
+    265, 257, 1256, 129, 436, 1163, 525, 55, 117, 468, 1092, 403, 1209, 476, 22, 842, 1263, 1266, 1212, 1078,
+    738, 1180, 956, 1283, 808, 1048, 243, 494, 1259, 808, 302, 767, 21, 18, 1231, 1056, 509, 610, 829, 0,
+    405, 38, 66, 1270, 778, 1009, 811, 782, 1007, 1171, 1263, 1239, 1167, 38, 384, 710, 1180, 221, 135, 782,
+    1214, 670, 641, 943, 1156, 140, 854, 663, 147, 437, 301, 1249, 1281, 207, 105, 678, 712, 537, 302, 767,
+    31, 755, 586, 681, 346, 824, 471, 1070, 21, 1067, 1067, 18, 468, 1298, 762, 1254, 28, 28, 221, 710,
+    471, 536, 595, 442, 0, 1193, 545, 724, 68, 1231, 823, 388, 536, 951, 452, 1266, 723, 333, 333, 859,
+    966, 190, 1222, 496, 134, 1124, 95, 421, 797, 1176, 949, 681, 71, 133, 344, 1271, 536, 260, 260, 1270,
+    838, 11, 733, 1264, 322, 450, 512, 241, 891, 1033, 582, 1239, 618, 232, 1071, 476, 0, 470, 1271, 606,
+    1159, 1283, 1005, 1124, 695, 209, 449, 1265, 435, 421, 1154, 0, 4, 1067, 741, 196, 69, 330, 1026, 1264,
+    129, 1000, 1000, 504, 640, 596, 469, 779, 442, 1180, 1042, 926, 743, 1079, 1124, 101, 292, 449, 1101, 481,
+    467, 1045, 533, 432, 1052, 1297, 808, 556, 20, 375, 932, 719, 472, 1231, 982, 1174, 476, 75, 414, 76,
+    1321, 1180, 1243, 618, 984, 1067, 552, 998, 32, 442, 416, 212, 0, 1080, 840, 780, 938, 582, 662, 642,
+    302, 27, 471, 212, 1097, 5, 473, 1209, 1305, 126, 161, 452, 1051, 44, 683, 713, 741, 1311, 1098, 1103,
+    1111, 129, 224, 915, 609, 846, 315, 259, 955, 230, 808, 221, 1252, 359, 435, 1017, 819, 816, 756, 957,
+    823, 589, 1176, 1159, 476, 1265, 574, 344, 1179, 432, 928, 1266, 620, 82, 1012, 123, 65, 451, 1027, 508,
+    1059, 1163, 196, 1307, 469, 1031, 824, 503, 25, 954, 451, 604, 362, 0, 0, 1269, 206, 0, 1111, 914,
+    350, 781, 1206, 743, 442, 1262, 464, 441, 1200, 1162, 529, 689, 394, 888, 785, 1085, 905, 1309, 1145, 657,
+    1025, 719, 101, 951, 1305, 1264, 1177, 974, 392, 55, 1166, 416, 1163, 1315, 10, 1141, 1159, 1098, 501, 150,
+    434, 1027, 538, 540, 129, 485, 464, 464, 1052, 451, 421, 329, 139, 977, 937, 1126, 1204, 824, 1174, 101,
+    1239, 39, 1170, 0, 0, 546, 1092, 842, 109, 321, 599, 1305, 329, 449, 337, 842, 1193, 864, 140, 134,
+    1249, 998, 997, 69, 147, 886, 48, 193, 914, 501, 1170, 212, 1268, 738, 1124, 441, 984, 852, 319, 1113,
+    977, 913, 457, 661, 265, 161, 743, 926, 1005, 452, 1014, 760, 29, 197, 568, 1017, 403, 1271, 1071, 1108,
+    823, 1092, 829, 1029, 1262, 265, 1103, 743, 859, 102, 1242, 322, 1101, 268, 939, 492, 939, 956, 27, 1170,
+    64, 984, 1009, 904, 111, 1000, 577, 136, 156, 362, 67, 293, 963, 222, 818, 0, 1243, 571, 1014, 132,
+    350, 605, 616, 599, 1305, 310, 405, 1239, 158, 1016, 409, 185, 684, 669, 444, 354, 1188, 1269, 17, 1271,
+    721, 629, 928, 509, 956, 1001, 1056, 449, 668, 669, 1259, 927, 504, 790, 446, 1181, 337, 823, 579, 434,
+    1185, 475, 794, 794, 552, 255, 1114, 894, 531, 1222, 1180, 1154, 128, 128, 902, 695, 393, 978, 825, 418,
+    197, 1320, 713, 584, 1266, 421, 1290, 449, 435, 91, 206, 206, 123, 68, 122, 476, 1119, 576, 44, 302,
+    834, 68, 193, 1298, 1288, 1069, 811, 842, 255, 713, 0, 1124, 604, 449, 182, 1005, 375, 834, 1283, 442,
+    313, 1191, 558, 535, 604, 928, 1298, 1231, 811, 169, 433, 209, 1001, 91, 844, 460, 416, 451, 840, 519,
+    205, 1103, 323, 785, 71, 19, 471, 1176, 0, 0, 985, 650, 435, 1007, 1298, 212, 1133, 546, 77, 470,
+    1174, 892, 1176, 1176, 710, 1098, 434, 64, 724, 321, 1271, 452, 536, 669, 443, 1124, 582, 1009, 27, 985,
+    604, 620, 874, 1269, 759, 1167, 560, 904, 956, 1222, 713, 1113, 481, 432, 568, 540, 375, 1186, 603, 595,
+    823, 823, 1222, 823, 545, 909, 1185, 639, 872, 109, 0, 182, 1124, 939, 615, 481, 650, 566, 1222, 606,
+    1009, 1315, 568, 224, 1071, 209, 449, 476, 546, 568, 693, 1268, 357, 356, 815, 1128, 811, 993, 953, 496,
+    1195, 309, 1179, 332, 311, 29, 283, 1267, 69, 224, 511, 663, 1102, 341, 385, 95, 1122, 651, 147, 322,
+    220, 1144, 450, 663, 125, 467, 1264, 259, 1201, 135, 17, 28, 1144, 450, 259, 572, 721, 52, 115, 226,
+    259, 1180, 313, 911, 500, 1164, 255, 817, 243, 1122, 259, 450, 460, 1166, 1108, 662, 959, 5, 831, 5,
+    1266, 220, 1264, 300, 959, 577, 854, 1137, 1105, 449, 0, 449, 1298, 1180, 571, 52, 568, 1122, 1122, 1090,
+    1150, 816, 816, 1243, 63, 476, 1243, 0, 286, 29, 29, 545, 1201, 545, 1087, 243, 944, 579, 439, 403,
+    1124, 439, 1201, 1262, 450, 1098, 1049, 147, 455, 135, 1182, 302, 827, 1249, 855, 1298, 1249, 251, 1298, 978,
+    1127, 1298, 1298, 840, 583, 1298, 147, 251, 1281, 280, 1126, 377, 1200, 948, 774, 1196, 0, 764, 816, 1247,
+    635, 618, 774, 782, 591, 300, 282, 1146, 458, 458, 710, 1311, 1257, 1179, 591, 932, 443, 0, 1179, 816,
+    1271, 276, 790, 276, 1247, 347, 996, 1200, 1100, 436, 436, 436, 432, 884, 207, 467, 1270, 1229, 1124, 1033,
+    1154, 1144, 1144, 1144, 314, 375, 1007, 222, 1141, 111, 949, 527, 1166, 949, 1084, 662, 662, 1063, 164, 1101,
+    1211, 41, 13, 1232, 30, 452, 532, 944, 405, 282, 383, 357, 113, 1145, 664, 425, 288, 841, 402, 1180,
+    1103, 1127, 1162, 1232, 282, 1010, 943, 471, 1166, 1222, 66, 1131, 1188, 1148, 773, 1263, 586, 164, 383, 641,
+    1323, 671, 55, 1143, 425, 1254, 1306, 951, 951, 1202, 287, 232, 636, 711, 115, 1089, 239, 6, 66, 13,
+    1278, 594, 1113, 527, 1035, 118, 949, 419, 419, 1145, 529, 1141, 449, 457, 1270, 457, 930, 1044, 396, 1164,
+    308, 1117, 925, 1121, 1173, 1210, 421, 373, 375, 481, 1079, 1114, 532, 1278, 1103, 947, 945, 73, 1259, 1258,
+    1102, 375, 424, 383, 125, 1079, 1030, 1298, 1318, 1277, 813, 459, 1103, 927, 1179, 1106, 844, 817, 458, 356,
+    1263, 1180, 1271, 10, 1079, 583, 575, 113, 1083, 1121, 1223, 0, 1145, 1147, 1178, 1108, 1210, 421, 302, 663,
+    529, 386, 1188, 247, 1087, 958, 844, 637, 688, 442, 739, 11, 1166, 164, 1170, 1001, 457, 664, 449, 486,
+    319, 1094, 116, 818, 383, 1164, 568, 7, 436, 357, 643, 1223, 1126, 383, 679, 671, 174, 711, 1251, 424,
+    38, 375, 1146, 153, 577, 1111, 207, 459, 794, 583, 1063, 1105, 1180, 436, 420, 1008, 1176, 1176, 568, 1010,
+    1044, 1121, 287, 841, 1257, 383, 1180, 1118, 1131, 918, 449, 38, 460, 1164, 7, 1176, 891, 959, 646, 1153,
+    1172, 814, 568, 125, 527, 232, 0, 1164, 432, 603, 1103, 885, 594, 693, 615, 606, 925, 1015, 1163, 145,
+    1207, 1207, 854, 1176, 331, 1176, 402, 385, 956, 92, 92, 0, 631, 98, 99, 1027, 1318, 86, 1144, 424,
+    1184, 838, 288, 783, 1209, 1197, 895, 779, 29, 301, 587, 286, 855, 0, 745, 1036, 977, 1264, 550, 550,
+    472, 664, 417, 1084, 1063, 1254, 433, 815, 1185, 1304, 1084, 1044, 550, 0, 646, 594, 679, 217, 1088, 671,
+    43, 1240, 959, 1280, 0, 1279, 878, 20, 806, 260, 260, 211, 568, 851, 433, 464, 51, 1139, 1041, 173,
+    920, 0, 1215, 859, 823, 1200, 311, 1099, 101, 926, 1154, 276, 1102, 1302, 567, 1134, 81, 189, 880, 933,
+    1067, 222, 1253, 632, 135, 1180, 340, 332, 248, 1178, 817, 959, 315, 1034, 0, 0, 0, 542, 0, 632,
+    1166, 624, 658, 980, 1204, 377, 287, 39, 452, 239, 319, 1171, 1111, 146, 164, 753, 956, 409, 1127, 142,
+    1282, 142, 981, 30, 981, 434, 1209, 457, 335, 433, 635, 783, 52, 1083, 15, 280, 289, 1180, 301, 688,
+    1103, 405, 1157, 243, 1154, 1263, 1169, 583, 898, 264, 639, 1257, 363, 1268, 174, 1213, 0, 243, 956, 1229,
+    0, 568, 0, 443, 129, 0, 827, 292, 688, 1119, 1111, 512, 802, 1178, 1105, 1268, 346, 1119, 440, 437,
+    470, 300, 671, 1180, 1176, 1176, 951, 721, 51, 261, 1178, 587, 66, 710, 537, 385, 760, 277, 1272, 204,
+    171, 1165, 300, 27, 675, 311, 815, 869, 888, 637, 1254, 981, 1261, 1108, 1198, 940, 357, 1070, 1325, 688,
+    724, 1193, 221, 1269, 1239, 102, 207, 338, 0, 467, 16, 301, 442, 68, 261, 498, 686, 1282, 52, 592,
+    106, 1242, 980, 1282, 771, 951, 346, 102, 1171, 476, 467, 951, 1268, 592, 639, 0, 885, 1242, 0, 56,
+    1250, 452, 594, 241, 603, 0, 568, 545, 1193, 959, 1154, 966, 818, 1262, 815, 568, 1179, 1116, 1264, 568,
+    989, 342, 488, 65, 879, 1122, 69, 879, 67, 1301, 141, 1180, 452, 1143, 1279, 443, 1318, 269, 270, 1197,
+    273, 333, 496, 554, 1247, 568, 0, 1166, 385, 326, 1270, 951, 322, 1217, 606, 301, 452, 392, 357, 1018,
+    353, 1086, 527, 891, 11, 8, 474, 1178, 1297, 512, 1271, 848, 1044, 912, 912, 414, 452, 467, 1152, 261,
+    1293, 1200, 1222, 0, 1185, 0, 0, 1250, 1157, 695, 1262, 209, 815, 832, 409, 520, 445, 1289, 1154, 1000,
+    920, 1262, 39, 1040, 342, 460, 69, 44, 301, 897, 1045, 476, 1103, 549, 592, 292, 815, 1091, 479, 313,
+    181, 573, 851, 1042, 1197, 639, 32, 596, 778, 1289, 222, 1145, 1052, 1230, 16, 341, 52, 220, 373, 1302,
+    1268, 880, 41, 330, 443, 416, 1079, 741, 438, 1034, 436, 1119, 618, 426, 932, 97, 289, 981, 648, 1100,
+    566, 566, 244, 96, 1187, 1000, 469, 1024, 1126, 533, 1298, 956, 109, 279, 1087, 460, 566, 65, 0, 0,
+    1018, 1271, 542, 570, 442, 1298, 587, 566, 818, 67, 1294, 174, 826, 653, 816, 816, 82, 360, 110, 1021,
+    286, 756, 34, 809, 425, 1304, 129, 1229, 434, 568, 779, 1202, 1202, 341, 426, 241, 1014, 315, 1083, 222,
+    1104, 277, 128, 1250, 817, 1203, 1163, 1202, 858, 1180, 918, 879, 161, 562, 815, 1298, 301, 498, 542, 1307,
+    1307, 1297, 348, 289, 289, 124, 848, 721, 1079, 363, 605, 381, 451, 1179, 141, 470, 469, 129, 1323, 573,
+    827, 1269, 1291, 1156, 468, 39, 447, 1298, 1301, 63, 779, 237, 146, 0, 0, 0, 442, 354, 1106, 246,
+    826, 0, 0, 0, 614, 1268, 0, 0, 0, 0, 781, 1249, 0, 1069, 918, 259, 1174, 299, 1087, 1085,
+    251, 439, 1304, 441, 1178, 943, 1104, 1164, 1163, 153, 1250, 164, 1201, 385, 1239, 1098, 787, 52, 1169, 432,
+    1141, 901, 1166, 540, 1162, 43, 426, 529, 454, 529, 978, 292, 1123, 1069, 1271, 443, 679, 637, 146, 405,
+    403, 572, 562, 1041, 688, 1200, 1196, 639, 982, 1148, 1148, 1185, 1262, 787, 1176, 434, 452, 1176, 146, 974,
+    1200, 178, 1085, 639, 222, 434, 452, 486, 850, 1186, 888, 392, 598, 556, 0, 0, 799, 0, 310, 1010,
+    546, 1211, 1200, 127, 617, 470, 0, 0, 0, 1126, 439, 1180, 1249, 303, 686, 652, 549, 885, 340, 443,
+    470, 1004, 1171, 1262, 33, 920, 1204, 1302, 664, 989, 440, 1170, 452, 419, 314, 286, 1242, 824, 624, 998,
+    1204, 1126, 885, 949, 1268, 185, 1211, 1041, 591, 885, 1014, 864, 1243, 978, 947, 1005, 501, 1103, 341, 815,
+    496, 319, 997, 760, 1017, 322, 1154, 224, 735, 434, 977, 337, 161, 827, 102, 825, 411, 639, 1144, 317,
+    318, 1298, 1070, 0, 1168, 224, 439, 443, 1318, 0, 0, 63, 1279, 0, 1104, 817, 570, 424, 1192, 826,
+    363, 310, 310, 1056, 409, 181, 918, 185, 48, 1197, 403, 445, 405, 416, 531, 1180, 721, 318, 491, 354,
+    354, 92, 629, 456, 222, 1289, 556, 549, 125, 174, 566, 1138, 844, 969, 277, 1043, 350, 433, 1000, 559,
+    604, 573, 652, 598, 118, 989, 498, 144, 1014, 56, 605, 464, 959, 1239, 956, 1251, 642, 669, 717, 1168,
+    1034, 779, 1282, 920, 1103, 859, 392, 441, 174, 0, 0, 828, 0, 1185, 271, 1128, 1269, 832, 1316, 174,
+    812, 959, 409, 531, 1262, 1319, 1209, 1249, 1103, 1154, 227, 272, 313, 669, 1101, 831, 695, 585, 591, 832,
+    1114, 900, 277, 1249, 1068, 554, 1211, 975, 1060, 128, 1014, 646, 469, 129, 989, 476, 476, 1009, 424, 433,
+    742, 1118, 1069, 725, 897, 1279, 157, 1236, 289, 848, 869, 392, 97, 338, 592, 555, 318, 145, 0, 0,
+    0, 0, 434, 242, 0, 604, 0, 0, 1204, 1005, 956, 444, 1010, 584, 731, 1183, 1104, 996, 926, 1318,
+    1146, 128, 314, 468, 1318, 1180, 840, 813, 1162, 558, 292, 423, 210, 436, 996, 71, 52, 236, 146, 1283,
+    357, 434, 453, 439, 844, 1261, 442, 828, 213, 1179, 57, 981, 936, 584, 0, 102, 646, 1182, 1018, 1007,
+    653, 816, 0, 63, 432, 436, 823, 650, 724, 1177, 319, 443, 1184, 269, 845, 1163, 816, 652, 1257, 357,
+    164, 433, 529, 804, 218, 145, 0, 653, 1195, 1271, 353, 823, 559, 559, 904, 604, 568, 183, 617, 661,
+    424, 748, 617, 452, 318, 246, 1204, 568, 287, 1298, 985, 570, 0, 145, 0, 1279, 603, 1162, 568, 1279,
+    127, 452, 265, 987, 411, 721, 1202, 594, 544, 0, 1113, 0, 470, 1119, 587, 1185, 441, 1183, 1196, 1186,
+    1115, 731, 69, 110, 545, 470, 968, 939, 1086, 176, 859, 855, 0, 0, 1202, 614, 567, 1223, 606, 209,
+    476, 0, 546, 545, 1281, 558, 567, 23, 692, 1202, 587, 0, 826, 173, 413, 1127, 1200, 1202, 823, 748,
+    1141, 117, 147, 132, 487, 1180, 476, 1104, 1141, 1110, 1202, 520, 549, 522, 977, 1103, 6, 1177, 815, 1141,
+    134, 839, 522, 489, 522, 489, 153, 922, 0, 1181, 1127, 1123, 1200, 826, 1119, 1178, 321, 1099, 1012, 457,
+    748, 402, 1027, 413, 1141, 775, 1103, 1122, 1141, 1103, 0, 372, 147, 1180, 489, 1200, 169, 413, 1270, 1267,
+    172, 76, 1101, 816, 76, 76, 1075, 471, 824, 133, 917, 134, 917, 1273, 996, 996, 568, 196, 1200, 568,
+    354, 203, 203, 979, 441, 1259, 671, 671, 1171, 671, 180, 1165, 1030, 944, 204, 929, 1144, 1155, 956, 85,
+    476, 792, 822, 853, 989, 844, 1212, 572, 1180, 298, 1269, 1176, 85, 425, 205, 434, 1176, 0, 1212, 1089,
+    143, 64, 1027, 457, 929, 1182, 228, 181, 424, 184, 1180, 205, 248, 444, 572, 64, 246, 0, 441, 956,
+    748, 251, 1282, 1181, 846, 1180, 920, 864, 499, 1170, 481, 227, 423, 423, 340, 864, 433, 1180, 748, 423,
+    251, 1177, 1119, 1100, 350, 678, 640, 640, 6, 1324, 246, 1202, 51, 52, 52, 783, 783, 52, 110, 635,
+    0, 0, 812, 0, 437, 1247, 905, 679, 1070, 1154, 271, 885, 1113, 469, 677, 381, 851, 244, 0, 1011,
+    772, 469, 259, 188, 49, 909, 0, 637, 993, 956, 1199, 1070, 385, 443, 1005, 909, 617, 677, 635, 1044,
+    886, 115, 813, 614, 1247, 916, 1247, 646, 614, 855, 232, 951, 221, 662, 476, 632, 818, 794, 685, 818,
+    211, 1111, 152, 288, 884, 701, 0, 301, 940, 239, 843, 818, 1181, 1103, 371, 1167, 8, 1159, 501, 843,
+    1159, 239, 207, 619, 843, 1167, 1210, 1210, 972, 0, 1266, 65, 1193, 210, 0, 556, 711, 1065, 279, 356,
+    1040, 1268, 851, 63, 1232, 654, 182, 424, 228, 375, 104, 1298, 155, 1078, 279, 204, 1106, 1067, 632, 851,
+    818, 928, 758, 375, 823, 1099, 1099, 1155, 980, 892, 333, 444, 133, 1099, 0, 0, 1013, 1268, 133, 823,
+    652, 340, 1081, 846, 459, 898, 479, 395, 1008, 860, 434, 55, 55, 314, 1092, 1272, 280, 1135, 476, 378,
+    0, 818, 289, 1144, 1144, 842, 1178, 1098, 1211, 1204, 377, 1163, 125, 125, 207, 1196, 257, 405, 432, 815,
+    679, 888, 639, 1005, 654, 1102, 136, 1028, 51, 920, 1270, 774, 762, 1292, 1214, 335, 591, 639, 1231, 292,
+    751, 568, 610, 88, 293, 1086, 405, 671, 641, 959, 468, 1222, 1067, 1068, 1068, 385, 568, 651, 1178, 272,
+    287, 1196, 1029, 1271, 1256, 338, 1247, 1162, 978, 527, 462, 471, 1126, 851, 1177, 437, 1272, 859, 69, 424,
+    652, 42, 1298, 147, 556, 1197, 338, 395, 311, 274, 636, 980, 402, 802, 172, 279, 133, 989, 726, 128,
+    587, 770, 68, 818, 980, 709, 469, 1209, 1282, 944, 560, 1148, 1152, 300, 762, 663, 1008, 1165, 435, 1193,
+    350, 48, 1150, 594, 603, 0, 69, 1126, 803, 1231, 458, 1182, 1275, 434, 1180, 421, 422, 1317, 129, 1181,
+    1086, 401, 443, 1166, 582, 980, 436, 269, 1132, 301, 903, 1001, 1270, 1181, 1100, 1105, 496, 1279, 446, 616,
+    0, 11, 241, 1178, 674, 559, 1177, 651, 859, 455, 671, 1087, 1120, 1126, 395, 1144, 977, 524, 1018, 838,
+    471, 270, 1275, 893, 802, 1154, 1135, 1271, 351, 414, 664, 430, 1071, 822, 758, 1099, 856, 591, 1180, 438,
+    460, 825, 444, 447, 129, 948, 1298, 95, 0, 520, 436, 591, 111, 426, 404, 731, 1154, 457, 582, 851,
+    1087, 1261, 481, 375, 32, 632, 1298, 1196, 1103, 69, 244, 1079, 395, 1180, 813, 1187, 546, 383, 551, 374,
+    567, 329, 301, 1100, 572, 165, 293, 1180, 1202, 1044, 553, 370, 457, 438, 136, 1094, 640, 993, 128, 774,
+    1114, 943, 1052, 534, 797, 721, 375, 458, 1119, 939, 713, 1051, 1193, 1122, 1112, 1042, 263, 989, 1063, 472,
+    97, 1027, 568, 973, 980, 560, 973, 1017, 246, 555, 542, 570, 1086, 1096, 1211, 416, 220, 0, 900, 443,
+    1252, 917, 301, 350, 1134, 955, 967, 1157, 169, 1253, 1176, 506, 1098, 373, 1067, 239, 385, 1096, 468, 314,
+    573, 425, 1005, 1297, 227, 838, 214, 474, 1301, 1103, 1170, 816, 340, 363, 375, 583, 1015, 1275, 780, 383,
+    113, 957, 815, 280, 135, 605, 697, 469, 1018, 175, 560, 1271, 779, 285, 981, 1030, 785, 207, 1202, 709,
+    1199, 605, 314, 652, 460, 587, 610, 1182, 188, 855, 411, 1202, 713, 940, 791, 165, 1074, 1203, 542, 428,
+    843, 1161, 825, 1028, 658, 1270, 1183, 652, 42, 1203, 1092, 877, 284, 843, 1203, 500, 436, 939, 1203, 0,
+    605, 1303, 246, 0, 443, 663, 785, 0, 1200, 1203, 942, 943, 888, 416, 1281, 442, 739, 1200, 851, 1041,
+    855, 248, 293, 1239, 69, 1098, 1096, 222, 1085, 1089, 891, 1126, 95, 1088, 321, 316, 1163, 395, 1148, 651,
+    500, 635, 1185, 1163, 1196, 394, 658, 1133, 640, 1217, 426, 686, 529, 949, 265, 758, 639, 572, 818, 818,
+    639, 1029, 178, 1086, 84, 1055, 654, 424, 671, 1143, 434, 776, 441, 442, 403, 295, 1115, 1180, 1184, 1250,
+    949, 451, 129, 418, 1012, 1200, 52, 663, 948, 1052, 944, 1193, 857, 1274, 0, 449, 449, 0, 1181, 1013,
+    594, 432, 1204, 689, 31, 1197, 859, 161, 575, 110, 1162, 165, 721, 1301, 1077, 948, 630, 1186, 0, 531,
+    0, 443, 1144, 618, 354, 310, 0, 0, 803, 457, 357, 1014, 1204, 1001, 1204, 570, 1171, 648, 1295, 945,
+    501, 1008, 198, 1071, 590, 335, 914, 664, 1242, 949, 1180, 610, 623, 813, 1086, 568, 81, 1102, 1103, 1089,
+    827, 1231, 948, 989, 1177, 1262, 984, 1211, 1140, 1181, 885, 428, 989, 989, 711, 1005, 948, 893, 1085, 762,
+    147, 145, 763, 1094, 88, 661, 385, 224, 383, 419, 1106, 1301, 220, 1270, 1132, 302, 452, 407, 321, 1302,
+    1017, 1023, 993, 51, 450, 424, 359, 1182, 318, 594, 1271, 1164, 939, 630, 1188, 165, 619, 547, 606, 0,
+    63, 1009, 1202, 985, 405, 52, 56, 1271, 445, 511, 943, 929, 219, 652, 17, 604, 404, 402, 1196, 111,
+    279, 1192, 359, 630, 846, 1200, 790, 434, 1157, 449, 815, 1105, 436, 605, 618, 594, 456, 362, 175, 600,
+    1269, 310, 828, 566, 1163, 92, 450, 174, 165, 1056, 751, 1023, 1175, 1104, 652, 1014, 671, 929, 375, 570,
+    546, 1071, 566, 824, 293, 1146, 1177, 631, 1303, 633, 491, 1005, 778, 959, 1252, 1251, 137, 1144, 416, 536,
+    443, 1161, 158, 577, 187, 1025, 1168, 444, 175, 1187, 395, 1154, 959, 350, 1186, 1119, 0, 0, 1144, 572,
+    1271, 1086, 785, 476, 450, 803, 210, 424, 452, 1101, 753, 434, 759, 355, 1119, 824, 824, 1103, 605, 1106,
+    999, 257, 418, 663, 900, 989, 554, 1262, 1272, 1180, 220, 1077, 207, 1010, 118, 1154, 531, 0, 935, 1052,
+    1279, 911, 387, 51, 926, 110, 110, 958, 1044, 813, 583, 1086, 917, 917, 129, 463, 129, 409, 447, 555,
+    123, 313, 189, 393, 978, 959, 779, 375, 1211, 593, 397, 301, 383, 385, 1111, 443, 926, 1106, 0, 0,
+    545, 0, 1200, 584, 654, 1229, 208, 415, 1231, 1126, 1202, 567, 951, 1150, 587, 631, 1301, 1191, 520, 87,
+    572, 227, 1176, 19, 414, 1262, 110, 631, 206, 207, 1180, 996, 785, 471, 1005, 840, 433, 1298, 570, 731,
+    361, 457, 289, 917, 434, 993, 424, 146, 1005, 981, 236, 0, 1281, 544, 63, 570, 651, 948, 959, 652,
+    726, 1186, 1186, 646, 457, 816, 785, 436, 381, 891, 1317, 1098, 1017, 1184, 1183, 254, 171, 432, 460, 547,
+    481, 7, 812, 1298, 1086, 63, 340, 824, 1132, 0, 536, 287, 0, 0, 443, 1087, 616, 1223, 619, 568,
+    1195, 1168, 604, 980, 452, 1188, 246, 1083, 421, 1126, 760, 942, 56, 110, 671, 591, 441, 814, 917, 129,
+    340, 63, 432, 1114, 603, 839, 375, 1186, 1191, 568, 460, 1119, 1186, 995, 1086, 1126, 411, 383, 1279, 594,
+    544, 254, 277, 403, 544, 0, 0, 1186, 650, 436, 572, 443, 1187, 291, 583, 1180, 441, 1209, 110, 204,
+    870, 442, 545, 277, 970, 1203, 1298, 292, 939, 559, 545, 175, 855, 1191, 824, 274, 350, 864, 1164, 383,
+    0, 903, 1223, 606, 1164, 566, 651, 928, 1009, 209, 449, 111, 0, 383, 23, 1280, 546, 545, 693, 1077,
+    606, 1154, 1113, 1164, 313, 1164, 1202, 431, 56, 661, 351, 216, 421, 1119, 1119, 0, 395, 587, 1230, 1288,
+    466, 1242, 1126, 135, 1298, 1217, 1217, 87, 1166, 818, 1272, 289, 729, 462, 1090, 806, 1180, 603, 160, 782,
+    487, 762, 1162, 487, 766, 679, 119, 579, 357, 494, 1064, 351, 1127, 1271, 0, 351, 1087, 830, 0, 198,
+    1108, 1265, 1280, 500, 1257, 301, 21, 261, 261, 589, 1298, 1148, 471, 1012, 770, 462, 768, 1007, 1007, 66,
+    1167, 1043, 372, 1282, 1242, 226, 1088, 949, 572, 135, 419, 0, 402, 977, 547, 459, 449, 1144, 1132, 861,
+    582, 416, 1166, 1119, 1138, 1113, 1182, 1099, 1275, 1170, 951, 1085, 1044, 1152, 1217, 487, 394, 616, 1108, 1280,
+    1147, 1265, 806, 1161, 423, 351, 1261, 421, 496, 0, 277, 932, 1176, 424, 0, 1016, 457, 877, 0, 1103,
+    301, 462, 123, 813, 459, 1298, 1042, 1078, 370, 778, 550, 926, 402, 292, 135, 885, 403, 0, 957, 386,
+    1153, 514, 476, 1119, 1103, 1161, 375, 1290, 481, 222, 1126, 434, 1102, 0, 0, 373, 1164, 416, 644, 469,
+    141, 41, 289, 585, 532, 428, 1063, 1104, 188, 1100, 394, 471, 302, 1098, 447, 174, 295, 801, 847, 901,
+    1104, 848, 1130, 1298, 1164, 1164, 1180, 476, 1202, 317, 868, 783, 340, 0, 944, 116, 932, 0, 0, 329,
+    0, 125, 386, 530, 1272, 251, 1107, 421, 295, 572, 1145, 1131, 418, 449, 441, 52, 1185, 1281, 1087, 1055,
+    1031, 1103, 739, 739, 110, 1161, 462, 462, 1202, 641, 920, 1088, 1176, 1130, 848, 889, 639, 416, 1143, 1257,
+    1085, 277, 851, 996, 1166, 582, 1281, 0, 320, 342, 35, 403, 1210, 1107, 0, 0, 53, 337, 1062, 1014,
+    119, 926, 266, 69, 419, 1124, 1106, 1102, 1104, 1213, 385, 386, 1103, 1211, 1136, 684, 928, 0, 1172, 1153,
+    652, 570, 1186, 1101, 885, 0, 0, 830, 590, 1103, 52, 56, 1305, 605, 441, 957, 1180, 598, 292, 993,
+    1180, 1043, 476, 1304, 1213, 405, 1178, 1271, 17, 1088, 577, 375, 748, 877, 462, 631, 0, 929, 184, 1236,
+    441, 1103, 1103, 1103, 1180, 1122, 135, 418, 111, 1176, 824, 868, 1164, 1112, 832, 1321, 216, 257, 940, 447,
+    289, 978, 578, 1202, 583, 1044, 932, 288, 277, 1164, 1154, 547, 640, 1016, 1177, 459, 644, 0, 0, 1186,
+    1202, 1180, 1150, 545, 1008, 1230, 87, 996, 1103, 864, 174, 570, 423, 1280, 1126, 587, 1085, 1180, 1124, 1257,
+    424, 0, 0, 545, 891, 1113, 496, 1153, 457, 141, 213, 1172, 386, 547, 56, 885, 568, 671, 38, 901,
+    617, 540, 17, 1155, 527, 977, 0, 568, 603, 476, 579, 1164, 1103, 1126, 594, 1176, 0, 871, 1209, 547,
+    175, 476, 1044, 350, 0, 123, 650, 1015, 547, 1280, 0, 587, 184, 1202, 1284, 0, 753, 1265, 768, 128,
+    1204, 7, 1088, 0, 476, 476, 303, 1174, 23, 231, 1174, 1170, 1312, 969, 270, 828, 157, 321, 1224, 232,
+    827, 1192, 828, 789, 30, 762, 933, 441, 756, 246, 156, 1048, 1240, 53, 232, 33, 69, 156, 1197, 0,
+    246, 1157, 131, 728, 0, 800, 464, 674, 1068, 678, 553, 880, 632, 280, 635, 679, 315, 1102, 1164, 321,
+    41, 980, 443, 340, 1198, 321, 944, 678, 221, 823, 861, 859, 1303, 1021, 1103, 632, 504, 823, 1100, 341,
+    1103, 566, 566, 809, 433, 315, 1269, 42, 859, 899, 246, 471, 437, 441, 292, 786, 498, 469, 497, 145,
+    1106, 41, 616, 454, 622, 909, 1088, 566, 255, 1044, 0, 446, 0, 568, 246, 582, 783, 792, 38, 1103,
+    140, 1088, 529, 140, 860, 0, 21, 279, 851, 435, 81, 168, 11, 321, 1290, 352, 624, 1196, 494, 69,
+    400, 1157, 1182, 413, 1290, 1212, 525, 729, 220, 843, 1274, 679, 41, 782, 469, 709, 944, 768, 1108, 1068,
+    403, 587, 287, 782, 710, 18, 1198, 336, 1209, 468, 207, 806, 340, 1113, 724, 414, 389, 449, 385, 1257,
+    434, 1155, 926, 1005, 885, 955, 1043, 554, 246, 1108, 948, 407, 1265, 1202, 997, 1200, 52, 632, 1105, 474,
+    566, 1108, 1182, 990, 549, 41, 1271, 1162, 920, 568, 375, 1113, 458, 756, 284, 1170, 23, 816, 709, 56,
+    1184, 542, 1104, 441, 827, 532, 1161, 363, 1306, 650, 113, 1177, 1271, 1265, 1157, 647, 80, 181, 939, 0,
+    0, 614, 403, 1304, 436, 1087, 292, 1096, 1204, 1131, 1279, 634, 1088, 1204, 1114, 1055, 1159, 695, 1123, 437,
+    399, 53, 1196, 1196, 639, 1239, 1170, 997, 69, 664, 407, 1204, 984, 624, 1204, 202, 1202, 948, 381, 0,
+    1180, 1262, 159, 381, 631, 460, 445, 677, 1251, 110, 17, 17, 381, 185, 289, 476, 52, 52, 418, 812,
+    583, 1202, 1044, 1172, 577, 977, 1119, 0, 0, 1104, 322, 474, 246, 424, 520, 1113, 1126, 1005, 1113, 1153,
+    724, 798, 432, 735, 646, 582, 695, 352, 955, 603, 1004, 1114, 650, 870, 413, 695, 614, 1113, 816, 476,
+    1146, 659, 1301, 619, 603, 1202, 989, 1082, 851, 306, 234, 556, 20, 433, 395, 222, 155, 311, 466, 1200,
+    435, 1200, 1166, 623, 332, 1101, 300, 662, 454, 1159, 63, 55, 34, 1209, 476, 1212, 476, 1078, 441, 639,
+    206, 783, 1087, 414, 1114, 827, 587, 204, 1180, 9, 802, 227, 301, 1146, 1105, 68, 172, 336, 439, 933,
+    806, 171, 498, 869, 944, 940, 1178, 1312, 437, 662, 926, 592, 52, 1262, 1262, 476, 275, 594, 455, 450,
+    443, 568, 351, 1111, 1275, 333, 1161, 1140, 1166, 1143, 616, 989, 1279, 840, 503, 1154, 37, 270, 1118, 1170,
+    1108, 392, 354, 136, 1144, 29, 774, 0, 208, 0, 426, 1090, 263, 129, 222, 1101, 1100, 129, 481, 639,
+    41, 1042, 1114, 169, 373, 1146, 1162, 851, 860, 549, 567, 1140, 301, 591, 1174, 1103, 587, 568, 457, 570,
+    1001, 0, 0, 1078, 227, 798, 1249, 188, 662, 1202, 468, 124, 542, 1090, 947, 1086, 226, 147, 1298, 773,
+    128, 404, 816, 265, 532, 113, 816, 47, 1079, 605, 175, 349, 1163, 228, 41, 583, 840, 783, 753, 864,
+    1298, 840, 275, 0, 848, 247, 454, 426, 1201, 637, 639, 0, 1145, 1025, 1131, 204, 888, 662, 1262, 1087,
+    895, 416, 451, 152, 442, 1288, 1166, 572, 859, 1108, 251, 1206, 1174, 696, 403, 1185, 1200, 418, 898, 917,
+    591, 0, 885, 1001, 1170, 1089, 1099, 455, 457, 1186, 623, 1017, 591, 1014, 568, 549, 354, 1031, 827, 195,
+    476, 1256, 1170, 7, 63, 1052, 114, 532, 1286, 174, 456, 1177, 187, 174, 816, 566, 1187, 1001, 851, 1146,
+    17, 570, 642, 1251, 1182, 0, 1185, 1271, 605, 1100, 216, 0, 1236, 1154, 855, 210, 583, 577, 848, 989,
+    418, 354, 812, 459, 277, 457, 591, 433, 0, 459, 7, 52, 87, 855, 1229, 208, 449, 360, 1011, 424,
+    414, 917, 996, 1029, 0, 1200, 457, 603, 63, 955, 1092, 1317, 545, 1105, 436, 1146, 895, 432, 310, 558,
+    246, 568, 1269, 888, 566, 1223, 848, 1259, 354, 996, 540, 594, 603, 568, 1223, 547, 1185, 650, 1115, 1103,
+    350, 213, 1223, 414, 342, 69, 232, 36, 405, 1269, 791, 31, 870, 568, 1073, 0, 444, 0, 278, 776,
+    282, 206, 1095, 748, 0, 0, 0, 403, 587, 1178, 802, 171, 0, 474, 114, 132, 0, 210, 647, 809,
+    1293, 802, 53, 1278, 1262, 0, 171, 1185, 818, 1112, 599, 222, 748, 646, 1286, 781, 583, 1238, 1101, 785,
+    205, 1095, 1185, 1163, 311, 204, 941, 1029, 1029, 372, 114, 944, 844, 940, 111, 111, 896, 944, 987, 918,
+    1194, 964, 605, 302, 1193, 46, 295, 724, 1029, 1196, 439, 940, 1240, 227, 301, 688, 227, 802, 1042, 409,
+    1042, 860, 1301, 646, 52, 816, 593, 1154, 591, 116, 678, 1211, 279, 301, 329, 1029, 454, 454, 860, 1088,
+    301, 1029, 678, 0, 762, 444, 1071, 198, 688, 591, 43, 1263, 147, 678, 678, 95, 0, 308, 52, 198,
+    1271, 620, 816, 620, 759, 0, 276, 409, 1200, 1200, 678, 481, 1180, 591, 1200, 232, 141, 409, 208, 169,
+    433, 1079, 444, 945, 116, 1057, 558, 433, 101, 591, 0, 1057, 583, 444, 444, 141, 71, 232, 232, 784,
+    721, 207, 956, 956, 1271, 1178, 157, 685, 234, 51, 452, 577, 315, 321, 467, 1277, 1110, 928, 1141, 746,
+    568, 1166, 127, 1196, 20, 454, 476, 1268, 1107, 188, 52, 1180, 568, 1306, 156, 292, 1282, 770, 783, 311,
+    498, 170, 1126, 816, 206, 1263, 273, 1270, 1023, 468, 434, 287, 855, 227, 437, 1112, 1242, 67, 711, 1267,
+    1191, 460, 859, 137, 1043, 1178, 485, 1087, 422, 260, 1167, 135, 1271, 388, 1158, 641, 244, 460, 1119, 1046,
+    1051, 632, 784, 1119, 990, 811, 568, 1271, 194, 259, 1102, 920, 553, 955, 416, 1112, 1180, 779, 1253, 349,
+    1010, 287, 622, 583, 132, 436, 226, 8, 135, 52, 52, 662, 341, 252, 262, 1087, 1199, 188, 1158, 1280,
+    181, 207, 943, 1273, 436, 1202, 399, 292, 540, 1166, 943, 1052, 1201, 342, 1090, 416, 514, 439, 1181, 1180,
+    617, 914, 476, 135, 1104, 348, 1180, 1089, 434, 156, 29, 559, 591, 108, 955, 746, 224, 201, 794, 1009,
+    1253, 56, 943, 181, 615, 1180, 1306, 140, 1253, 1246, 986, 1001, 863, 230, 600, 617, 671, 457, 1183, 1187,
+    418, 301, 577, 594, 832, 591, 553, 1112, 287, 207, 1184, 386, 5, 29, 1112, 348, 347, 731, 1202, 1086,
+    1180, 1191, 784, 559, 568, 958, 207, 584, 227, 584, 544, 61, 436, 132, 1167, 1113, 452, 1265, 0, 568,
+    432, 544, 0, 224, 1147, 1187, 1183, 855, 1191, 1009, 224, 615, 606, 606, 68, 0, 356, 803, 272, 216,
+    272, 26, 27, 836, 49, 1230, 1230, 637, 215, 752, 451, 418, 354, 172, 587, 318, 671, 434, 449, 780,
+    318, 5, 263, 383, 375, 49, 1079, 141, 826, 1103, 5, 462, 383, 419, 383, 1231, 187, 383, 1121, 1176,
+    804, 383, 449, 7, 1131, 420, 568, 792, 386, 450, 783, 313, 770, 1278, 479, 851, 189, 864, 1239, 340,
+    479, 479, 1278, 1239, 340, 1249, 246, 663, 817, 1186, 1200, 39, 1254, 1272, 776, 385, 1186, 385, 1180, 68,
+    1079, 385, 15, 1249, 1162, 441, 385, 1199, 528, 279, 310, 213, 760, 302, 851, 947, 213, 605, 1249, 646,
+    567, 457, 1144, 441, 760, 350, 8, 603, 958, 1275, 210, 8, 340, 568, 679, 234, 313, 1141, 632, 632,
+    1269, 818, 895, 1029, 1115, 256, 1127, 1106, 762, 292, 257, 662, 664, 946, 951, 1211, 654, 759, 282, 658,
+    205, 639, 637, 490, 1114, 748, 951, 1165, 1265, 1171, 943, 432, 200, 1263, 527, 468, 943, 135, 946, 641,
+    671, 1282, 1262, 1262, 653, 219, 1203, 232, 1178, 1303, 1303, 119, 1241, 1148, 66, 651, 594, 993, 241, 651,
+    232, 1178, 271, 665, 1148, 132, 527, 474, 674, 1264, 1036, 1166, 1163, 671, 1274, 628, 1255, 1265, 639, 481,
+    935, 375, 415, 222, 130, 193, 474, 263, 1079, 1114, 1103, 534, 544, 442, 927, 1030, 427, 1079, 587, 951,
+    848, 582, 1160, 458, 1265, 566, 544, 996, 474, 973, 993, 245, 52, 52, 679, 425, 711, 605, 1180, 452,
+    82, 1277, 1200, 425, 624, 1110, 1133, 1103, 360, 0, 166, 441, 641, 247, 399, 1145, 1027, 529, 318, 898,
+    637, 1144, 272, 1089, 657, 142, 531, 649, 1094, 511, 210, 124, 498, 985, 1107, 848, 637, 664, 629, 973,
+    1231, 1253, 1180, 228, 748, 671, 975, 174, 597, 132, 629, 792, 128, 436, 646, 0, 899, 794, 1103, 832,
+    812, 1281, 218, 942, 975, 578, 123, 1112, 490, 1176, 1144, 1044, 674, 583, 531, 1112, 1176, 7, 424, 1247,
+    442, 340, 1257, 471, 1086, 142, 916, 725, 1153, 1172, 432, 646, 653, 63, 653, 568, 527, 476, 1145, 653,
+    432, 603, 646, 594, 350, 630, 1105, 147, 1015, 490, 1281, 635, 455, 583, 1202, 977, 95, 476, 950, 1179,
+    942, 1268, 399, 942, 1187, 470, 1275, 449, 194, 250, 6, 449, 1236, 432, 27, 949, 237, 818, 433, 1302,
+    311, 1102, 1067, 514, 827, 1106, 277, 527, 210, 623, 920, 205, 476, 568, 300, 662, 742, 432, 494, 1270,
+    818, 489, 454, 288, 265, 1159, 782, 1259, 1162, 996, 1286, 121, 257, 759, 1164, 0, 292, 273, 671, 1242,
+    854, 1202, 615, 1068, 1068, 221, 1246, 1262, 7, 287, 678, 1281, 568, 53, 737, 801, 778, 587, 770, 556,
+    806, 68, 806, 940, 1215, 742, 568, 594, 1044, 0, 568, 0, 146, 504, 859, 1279, 524, 354, 265, 695,
+    438, 605, 1087, 7, 616, 503, 1132, 1162, 1044, 778, 1103, 0, 395, 977, 1108, 831, 0, 1088, 832, 0,
+    504, 1119, 864, 112, 550, 395, 1200, 1119, 1108, 633, 596, 1193, 121, 123, 263, 591, 1188, 632, 864, 1164,
+    920, 533, 1202, 0, 0, 604, 126, 442, 746, 981, 1298, 504, 779, 1163, 1293, 506, 99, 816, 1306, 846,
+    583, 479, 68, 237, 662, 228, 441, 386, 605, 7, 996, 864, 587, 39, 1182, 254, 1101, 816, 612, 1079,
+    226, 315, 41, 818, 126, 895, 1162, 232, 237, 246, 1068, 452, 1185, 54, 501, 52, 1085, 977, 1262, 251,
+    1108, 210, 1025, 696, 781, 442, 222, 1012, 102, 0, 818, 0, 292, 1148, 864, 864, 623, 332, 713, 989,
+    263, 171, 593, 978, 1014, 34, 407, 782, 1087, 913, 559, 193, 1262, 1108, 815, 570, 760, 1088, 1212, 252,
+    1259, 498, 537, 0, 846, 359, 1286, 110, 818, 17, 778, 605, 604, 490, 829, 126, 1183, 559, 56, 818,
+    669, 815, 185, 1304, 846, 169, 0, 433, 928, 553, 855, 1236, 218, 443, 1106, 583, 237, 227, 418, 760,
+    1215, 831, 219, 568, 0, 447, 0, 1252, 832, 255, 1113, 1202, 1293, 385, 432, 1244, 560, 500, 146, 434,
+    864, 210, 1179, 444, 785, 782, 1202, 797, 818, 7, 487, 441, 1202, 895, 646, 770, 171, 69, 0, 661,
+    78, 1112, 527, 560, 559, 1271, 568, 568, 277, 864, 770, 1185, 568, 594, 594, 671, 69, 968, 350, 545,
+    1222, 1162, 951, 951, 567, 882, 939, 1209, 980, 816, 1003, 624, 1126, 1169, 1111, 816, 816, 1270, 45, 254,
+    1274, 0, 1177, 949, 1198, 1271, 1034, 301, 303, 652, 1312, 1268, 992, 641, 1325, 854, 405, 1282, 941, 996,
+    171, 106, 650, 618, 1201, 1116, 1100, 1033, 793, 1279, 356, 1108, 1268, 436, 320, 1262, 320, 973, 455, 126,
+    308, 533, 222, 212, 432, 1018, 816, 341, 350, 1318, 587, 605, 66, 457, 212, 1269, 605, 928, 39, 1260,
+    421, 1197, 1106, 1181, 1301, 432, 1262, 301, 1206, 1100, 1113, 1166, 1025, 1177, 639, 978, 222, 0, 1298, 1262,
+    1193, 434, 320, 1014, 978, 624, 1003, 0, 1145, 816, 1202, 1105, 433, 980, 110, 1011, 520, 996, 567, 731,
+    710, 212, 568, 870, 1209, 1025, 1222, 560, 888, 1201, 1200, 566, 1126, 840, 385, 1051, 1140, 978, 878, 1051,
+    1302, 102, 313, 1180, 1111, 66, 712, 850, 850, 1273, 289, 383, 1211, 498, 658, 1268, 329, 51, 1268, 1202,
+    652, 514, 31, 782, 709, 568, 1196, 1310, 782, 21, 587, 671, 131, 712, 840, 1165, 1323, 1271, 1268, 957,
+    471, 1302, 430, 433, 128, 1044, 1271, 430, 385, 1181, 1301, 1269, 451, 879, 248, 1178, 1279, 424, 731, 302,
+    1103, 496, 549, 300, 1232, 973, 618, 533, 313, 329, 1025, 129, 1052, 932, 973, 1159, 611, 605, 341, 1323,
+    879, 1296, 34, 28, 433, 1269, 1271, 533, 562, 779, 498, 66, 141, 1311, 1202, 987, 620, 0, 1177, 1106,
+    53, 436, 303, 49, 743, 451, 1273, 1304, 1141, 128, 213, 1091, 570, 1301, 1202, 436, 1144, 1263, 1271, 213,
+    440, 433, 319, 319, 340, 885, 996, 0, 436, 491, 679, 926, 642, 1271, 436, 605, 987, 433, 1187, 1091,
+    850, 917, 0, 1180, 418, 838, 435, 996, 1119, 812, 447, 1297, 1044, 0, 618, 996, 731, 917, 424, 870,
+    743, 1202, 0, 436, 1060, 1091, 128, 432, 333, 618, 56, 0, 870, 1297, 566, 1223, 1150, 1071, 464, 848,
+    1106, 848, 506, 1199, 918, 459, 1172, 152, 1294, 1051, 553, 838, 1245, 1171, 54, 36, 1171, 66, 1071, 1280,
+    450, 834, 230, 1099, 354, 1170, 1271, 156, 1171, 1035, 450, 156, 462, 1119, 129, 511, 184, 1096, 207, 512,
+    498, 1293, 1144, 989, 0, 528, 244, 0, 1184, 1096, 1071, 1159, 1200, 471, 848, 1170, 1170, 1036, 118, 1201,
+    1029, 230, 471, 577, 1103, 1102, 528, 156, 1254, 0, 522, 594, 128, 188, 791, 1230, 184, 834, 848, 244,
+    1230, 595, 838, 568, 147, 0, 299, 0, 147, 395, 816, 0, 0, 0, 959, 659, 470, 1250, 1282, 587,
+    594, 67, 460, 460, 1251, 0, 980, 481, 395, 1044, 982, 460, 230, 1180, 959, 460, 856, 452, 802, 249,
+    933, 1287, 99, 216, 185, 410, 460, 490, 460, 1280, 1280, 556, 779, 1200, 133, 311, 632, 1280, 0, 247,
+    433, 1120, 20, 992, 434, 1263, 1257, 998, 1157, 1293, 1204, 405, 315, 1122, 97, 783, 51, 442, 1179, 239,
+    926, 944, 1108, 220, 1280, 683, 132, 338, 568, 838, 663, 35, 1034, 980, 301, 95, 44, 774, 198, 1302,
+    222, 587, 1231, 736, 301, 336, 277, 437, 323, 279, 950, 636, 805, 0, 441, 848, 594, 0, 53, 616,
+    357, 856, 133, 1181, 1172, 1113, 51, 848, 342, 217, 449, 455, 859, 998, 891, 273, 524, 1280, 1045, 433,
+    198, 1132, 95, 1274, 511, 542, 52, 923, 208, 1265, 95, 300, 1211, 1052, 753, 568, 549, 470, 349, 442,
+    373, 1045, 1108, 1271, 129, 992, 951, 1282, 1323, 1121, 932, 1041, 95, 1162, 319, 520, 311, 141, 0, 317,
+    1211, 0, 823, 1121, 442, 812, 542, 1307, 52, 52, 52, 324, 133, 346, 1199, 441, 1257, 338, 133, 1265,
+    458, 922, 1277, 605, 69, 433, 583, 992, 481, 301, 1240, 338, 506, 824, 858, 481, 161, 349, 1203, 95,
+    469, 70, 1231, 838, 1070, 614, 205, 1119, 901, 443, 0, 53, 998, 1115, 1113, 802, 1262, 946, 403, 948,
+    1282, 1207, 166, 619, 1099, 240, 977, 434, 452, 418, 1131, 639, 279, 161, 1288, 786, 292, 1280, 395, 838,
+    399, 850, 658, 826, 0, 531, 0, 599, 1211, 385, 1014, 1209, 140, 318, 286, 901, 1265, 335, 721, 826,
+    1121, 184, 332, 764, 247, 568, 52, 1298, 145, 923, 133, 1280, 827, 594, 545, 441, 76, 566, 424, 52,
+    220, 174, 1161, 779, 918, 1288, 756, 793, 242, 1201, 661, 1286, 1231, 1105, 362, 1178, 405, 111, 511, 181,
+    802, 143, 433, 356, 989, 599, 1242, 605, 713, 1000, 184, 0, 1000, 556, 251, 0, 1119, 69, 652, 978,
+    210, 577, 205, 227, 302, 442, 663, 531, 204, 447, 216, 418, 998, 553, 1220, 1119, 605, 951, 1220, 0,
+    756, 0, 756, 314, 471, 248, 605, 1162, 71, 208, 907, 498, 594, 823, 570, 76, 1278, 544, 0, 545,
+    531, 1200, 1209, 381, 1262, 1007, 1027, 650, 141, 434, 0, 0, 1023, 1288, 1278, 276, 985, 1278, 0, 1298,
+    1023, 605, 603, 441, 1070, 1186, 1202, 544, 594, 0, 570, 545, 823, 1209, 1272, 855, 570, 53, 251, 1314,
+    566, 978, 614, 1186, 1209, 1298, 1202, 651, 220, 277, 940, 1259, 940, 744, 1124, 560, 1111, 1302, 709, 192,
+    0, 823, 0, 51, 30, 1102, 920, 491, 889, 290, 52, 188, 0, 566, 134, 0, 0, 20, 568, 311,
+    471, 806, 671, 179, 712, 1278, 566, 989, 1036, 568, 1103, 989, 395, 1044, 1301, 95, 1209, 1275, 585, 1289,
+    27, 0, 291, 0, 0, 0, 573, 1114, 301, 573, 87, 329, 567, 1209, 605, 469, 816, 188, 28, 1251,
+    583, 1306, 458, 363, 0, 909, 910, 1014, 53, 889, 655, 399, 1143, 1306, 403, 443, 1221, 171, 566, 1126,
+    300, 711, 41, 340, 1139, 318, 1014, 852, 0, 91, 1289, 1014, 650, 910, 291, 1227, 491, 446, 669, 910,
+    910, 743, 1103, 573, 446, 520, 69, 414, 0, 1306, 1114, 743, 1056, 721, 568, 1325, 220, 721, 1036, 545,
+    652, 978, 464, 1106, 332, 1266, 464, 1198, 436, 104, 1278, 1154, 1207, 395, 1199, 385, 1078, 880, 1092, 1090,
+    851, 683, 1301, 1049, 729, 297, 454, 956, 165, 782, 1183, 920, 395, 1270, 434, 288, 1211, 880, 206, 455,
+    989, 282, 1001, 188, 466, 1240, 0, 456, 303, 1271, 172, 1302, 141, 395, 1214, 560, 1106, 301, 1126, 940,
+    41, 1282, 856, 587, 1282, 935, 314, 1165, 301, 1068, 1263, 204, 147, 948, 1272, 1112, 1312, 462, 31, 471,
+    671, 959, 1318, 0, 458, 878, 393, 1126, 452, 1279, 141, 344, 27, 476, 527, 403, 173, 329, 329, 1017,
+    1124, 514, 449, 858, 309, 616, 1148, 65, 1114, 301, 325, 1044, 885, 1036, 1181, 559, 1126, 861, 1144, 308,
+    232, 1045, 978, 446, 1116, 424, 476, 1269, 442, 474, 132, 654, 1263, 618, 129, 851, 956, 33, 1045, 1119,
+    1080, 839, 330, 1139, 1025, 1140, 1124, 395, 1106, 301, 1040, 993, 254, 533, 300, 458, 405, 1268, 1162, 462,
+    293, 436, 0, 0, 1304, 583, 260, 568, 619, 573, 141, 860, 935, 818, 816, 1295, 816, 1079, 826, 1114,
+    955, 1086, 817, 1018, 1079, 315, 1083, 45, 1293, 82, 363, 188, 610, 592, 817, 1250, 39, 169, 587, 653,
+    815, 838, 1009, 1304, 359, 1307, 1180, 1301, 1134, 574, 456, 284, 896, 662, 1202, 1305, 277, 619, 1144, 1185,
+    1253, 0, 1144, 1115, 441, 501, 1114, 895, 653, 433, 251, 1274, 222, 662, 657, 1204, 1126, 37, 978, 850,
+    53, 415, 329, 174, 654, 1088, 303, 1087, 1200, 335, 658, 1124, 572, 1304, 55, 1213, 1181, 1025, 342, 1271,
+    1210, 128, 110, 204, 1108, 1204, 1305, 1141, 0, 0, 329, 0, 1186, 457, 1180, 1293, 711, 32, 340, 760,
+    1278, 441, 195, 860, 969, 1210, 1108, 185, 1103, 885, 1017, 301, 1211, 124, 319, 893, 403, 1218, 1023, 1114,
+    989, 1263, 1306, 1017, 0, 83, 52, 293, 181, 566, 1000, 1183, 1105, 1306, 558, 1288, 823, 631, 1269, 618,
+    671, 792, 570, 650, 1148, 1305, 433, 926, 996, 277, 965, 45, 1177, 914, 674, 1170, 829, 426, 0, 1106,
+    0, 1140, 868, 1148, 996, 831, 1236, 1324, 1268, 928, 910, 583, 1202, 276, 577, 169, 1319, 443, 875, 111,
+    897, 1140, 424, 409, 1314, 1103, 829, 0, 198, 945, 424, 1106, 917, 442, 444, 414, 1229, 174, 454, 449,
+    71, 110, 1180, 695, 996, 1180, 924, 1141, 436, 63, 825, 545, 812, 1153, 1314, 816, 779, 568, 671, 560,
+    1124, 1314, 527, 1195, 1144, 558, 1111, 110, 0, 603, 110, 1185, 81, 1115, 1111, 1316, 1314, 616, 1105, 213,
+    547, 558, 572, 978, 464, 1199, 395, 1278, 1111, 385, 1207, 434, 1078, 527, 436, 880, 1087, 1211, 395, 165,
+    783, 920, 315, 683, 878, 1306, 610, 288, 1270, 1090, 282, 1282, 1183, 729, 956, 1114, 314, 1126, 301, 572,
+    1312, 940, 1106, 1268, 1272, 1278, 31, 301, 1298, 935, 1180, 458, 204, 33, 885, 452, 514, 875, 232, 393,
+    424, 325, 1148, 446, 616, 476, 449, 1045, 330, 1119, 474, 1140, 1106, 993, 1017, 436, 1025, 433, 1144, 587,
+    1185, 1144, 817, 284, 169, 1252, 359, 945, 1086, 653, 955, 45, 141, 1018, 592, 860, 1306, 1250, 1079, 619,
+    1293, 1301, 501, 1115, 441, 654, 547, 1025, 658, 818, 1210, 424, 978, 260, 251, 55, 1114, 335, 1293, 415,
+    222, 618, 53, 662, 1204, 457, 301, 893, 1262, 293, 963, 319, 110, 566, 1180, 441, 63, 792, 631, 558,
+    1185, 1000, 674, 914, 1124, 577, 928, 1236, 444, 825, 1229, 414, 449, 1314, 298, 1126, 315, 298, 862, 298,
+    0, 68, 802, 401, 0, 315, 1185, 1185, 846, 1110, 350, 1319, 1010, 0, 818, 1095, 1185, 558, 1010, 603,
+    350, 1083, 1083, 315, 1083, 374, 0, 613, 301, 650, 273, 338, 1281, 468, 635, 340, 662, 315, 23, 344,
+    1025, 474, 301, 583, 1163, 1257, 1318, 344, 1298, 1202, 1271, 10, 273, 689, 958, 978, 783, 624, 592, 23,
+    273, 566, 117, 1088, 52, 436, 1236, 1044, 592, 433, 474, 652, 1257, 614, 783, 433, 433, 606, 1166, 651,
+    827, 1005, 640, 1166, 1197, 1197, 289, 20, 318, 1168, 340, 827, 1224, 318, 587, 1180, 1282, 219, 1138, 823,
+    1178, 1114, 885, 866, 866, 829, 414, 1000, 1114, 1180, 0, 827, 1112, 1200, 329, 452, 1013, 1204, 1103, 277,
+    926, 290, 926, 571, 558, 329, 734, 830, 112, 1201, 334, 1180, 136, 1093, 288, 395, 135, 135, 188, 301,
+    1108, 777, 1180, 537, 1180, 782, 587, 593, 1271, 855, 1104, 1124, 1116, 1106, 1106, 816, 832, 424, 421, 1119,
+    917, 395, 444, 220, 188, 286, 1017, 922, 135, 1282, 442, 1145, 951, 786, 1304, 1080, 421, 399, 385, 386,
+    375, 17, 790, 1180, 570, 855, 0, 583, 777, 832, 17, 276, 1180, 424, 1145, 213, 1172, 554, 0, 496,
+    637, 1260, 816, 336, 336, 336, 233, 233, 269, 961, 895, 269, 686, 1286, 559, 1040, 1302, 329, 120, 383,
+    1211, 23, 782, 133, 980, 145, 437, 471, 385, 145, 555, 611, 434, 1015, 750, 598, 735, 445, 765, 1231,
+    598, 433, 555, 432, 1195, 671, 411, 270, 1259, 1040, 1174, 197, 982, 840, 1211, 134, 205, 205, 395, 330,
+    1269, 0, 721, 205, 1263, 123, 587, 1265, 1197, 1071, 577, 594, 1269, 724, 1033, 269, 1159, 232, 342, 0,
+    570, 383, 947, 582, 800, 458, 471, 52, 221, 362, 1090, 1144, 802, 174, 0, 0, 1041, 1201, 174, 529,
+    0, 531, 174, 570, 1094, 531, 570, 570, 174, 17, 944, 982, 1040, 531, 721, 1269, 205, 724, 0, 433,
+    1040, 1040, 594, 1202, 1202, 1257, 980, 989, 1180, 989, 980, 1257, 1257, 890, 1180, 560, 433, 851, 502, 94,
+    321, 222, 414, 417, 1179, 880, 1122, 892, 1277, 1203, 248, 315, 885, 311, 101, 1098, 114, 340, 1268, 373,
+    300, 285, 289, 771, 766, 441, 281, 1294, 1196, 683, 377, 502, 868, 332, 1202, 1091, 1170, 457, 783, 823,
+    1106, 1103, 287, 502, 459, 1008, 943, 1273, 1253, 1124, 940, 1088, 1278, 232, 206, 287, 21, 69, 855, 1029,
+    41, 342, 1006, 1302, 512, 1268, 711, 802, 1303, 303, 766, 1262, 1112, 1325, 771, 439, 947, 1268, 35, 678,
+    854, 403, 498, 1179, 1184, 1141, 1165, 594, 241, 483, 603, 460, 737, 1161, 764, 517, 1178, 351, 370, 321,
+    241, 1271, 1120, 1135, 1135, 269, 265, 1132, 787, 705, 1303, 0, 129, 1036, 1268, 188, 639, 1124, 188, 1124,
+    628, 628, 434, 0, 0, 520, 904, 1224, 816, 696, 651, 731, 606, 1079, 69, 1091, 349, 851, 449, 460,
+    888, 391, 195, 582, 926, 1042, 639, 165, 943, 825, 1021, 1316, 181, 1138, 1130, 1067, 767, 129, 700, 302,
+    244, 1067, 718, 0, 784, 340, 342, 568, 571, 1253, 188, 452, 574, 1275, 783, 56, 610, 787, 364, 531,
+    161, 207, 1030, 700, 458, 451, 540, 1180, 1161, 879, 943, 169, 302, 302, 468, 285, 827, 1080, 241, 783,
+    362, 1304, 237, 1099, 639, 895, 1288, 1271, 178, 342, 750, 222, 8, 1131, 696, 1200, 154, 689, 1213, 1273,
+    888, 265, 905, 1052, 1169, 443, 1087, 449, 1200, 437, 251, 52, 114, 303, 1114, 711, 654, 1074, 1023, 1061,
+    33, 823, 618, 1074, 986, 1014, 989, 1293, 322, 1180, 69, 577, 434, 783, 1124, 318, 618, 64, 0, 114,
+    605, 362, 763, 149, 792, 445, 300, 1014, 671, 1103, 1286, 619, 447, 1188, 617, 1271, 0, 164, 571, 1044,
+    779, 711, 1242, 577, 188, 354, 1119, 1022, 277, 1269, 447, 928, 402, 188, 900, 1115, 995, 291, 1185, 207,
+    1283, 206, 520, 731, 1064, 570, 52, 1193, 476, 147, 1180, 473, 540, 571, 914, 1064, 340, 816, 188, 64,
+    1153, 891, 432, 1226, 1114, 56, 1134, 521, 540, 1161, 603, 432, 1224, 615, 855, 1226, 606, 709, 1224, 125,
+    823, 1098, 353, 1224, 583, 353, 1303, 449, 721, 143, 436, 318, 143, 653, 721, 1271, 1271, 322, 443, 232,
+    1271, 1138, 1007, 1262, 467, 1114, 1200, 101, 1171, 1200, 136, 1106, 1106, 467, 1200, 1201, 1131, 470, 467, 1130,
+    937, 939, 0, 466, 951, 1009, 956, 951, 1030, 207, 814, 814, 349, 409, 1009, 154, 975, 1108, 1101, 1275,
+    211, 315, 926, 1179, 0, 752, 1008, 277, 30, 153, 377, 282, 29, 864, 0, 1272, 443, 88, 587, 1280,
+    1231, 261, 69, 1112, 323, 153, 1108, 604, 395, 764, 1103, 0, 301, 1230, 293, 566, 932, 1200, 549, 1042,
+    0, 1087, 69, 647, 714, 468, 418, 954, 1304, 55, 637, 232, 0, 34, 101, 1180, 914, 88, 92, 598,
+    204, 0, 1172, 1044, 0, 208, 1010, 604, 1179, 454, 443, 432, 646, 816, 604, 603, 110, 968, 328, 573,
+    441, 441, 917, 1164, 301, 802, 1164, 1164, 93, 0, 1180, 556, 1040, 851, 7, 685, 1034, 447, 452, 779,
+    1078, 1180, 105, 653, 660, 311, 823, 1202, 1202, 933, 847, 1053, 1110, 817, 632, 1302, 423, 993, 1271, 1115,
+    783, 301, 1064, 1087, 1100, 1268, 817, 926, 1090, 826, 878, 301, 509, 454, 603, 1144, 434, 840, 816, 1204,
+    288, 20, 898, 1127, 436, 406, 406, 280, 1102, 476, 335, 1270, 1211, 840, 18, 145, 637, 1157, 287, 883,
+    377, 174, 1182, 1197, 55, 1180, 0, 1087, 568, 784, 265, 1114, 114, 88, 646, 987, 1178, 1206, 869, 587,
+    1007, 1034, 221, 657, 849, 568, 1194, 498, 679, 774, 35, 336, 662, 1179, 1179, 471, 782, 901, 513, 1282,
+    710, 69, 66, 926, 851, 1171, 1111, 43, 395, 1185, 1241, 239, 468, 232, 720, 311, 402, 802, 639, 301,
+    944, 338, 52, 1088, 301, 1298, 637, 279, 836, 635, 636, 21, 1302, 671, 1301, 221, 133, 436, 458, 594,
+    0, 717, 0, 1150, 1186, 848, 322, 664, 568, 885, 1184, 328, 826, 107, 125, 1202, 1138, 1303, 582, 1100,
+    436, 354, 95, 137, 171, 336, 351, 632, 133, 447, 447, 301, 1200, 1279, 1301, 444, 422, 1181, 102, 273,
+    885, 891, 136, 633, 1044, 1274, 0, 1280, 1154, 414, 515, 859, 308, 197, 458, 1134, 154, 93, 458, 269,
+    11, 953, 133, 879, 443, 1025, 417, 802, 568, 455, 554, 959, 1289, 198, 438, 873, 52, 1231, 832, 424,
+    816, 210, 0, 885, 425, 1186, 616, 1186, 1154, 457, 997, 1184, 627, 395, 1278, 1172, 248, 1087, 147, 244,
+    300, 879, 1182, 385, 50, 76, 1211, 220, 1052, 993, 993, 129, 125, 1100, 60, 1103, 330, 568, 302, 1282,
+    671, 568, 1289, 434, 259, 851, 920, 1000, 125, 292, 470, 639, 646, 1134, 458, 121, 940, 479, 1162, 1041,
+    230, 196, 348, 375, 1197, 196, 438, 1082, 1196, 729, 932, 1114, 549, 301, 263, 671, 1092, 452, 688, 679,
+    489, 542, 570, 949, 1096, 0, 571, 432, 1196, 1186, 1185, 0, 165, 633, 633, 173, 1079, 458, 219, 855,
+    239, 441, 1307, 338, 537, 605, 469, 1088, 479, 721, 532, 385, 812, 1301, 319, 363, 301, 610, 113, 141,
+    981, 161, 1250, 642, 83, 21, 566, 1054, 68, 375, 38, 842, 473, 1103, 840, 221, 451, 812, 210, 456,
+    1256, 1007, 329, 407, 338, 587, 284, 455, 8, 1083, 47, 1277, 1161, 468, 441, 584, 1011, 957, 1029, 213,
+    404, 816, 385, 188, 1018, 164, 785, 114, 414, 285, 542, 815, 646, 802, 1085, 207, 922, 414, 1163, 1178,
+    1034, 816, 1079, 95, 686, 0, 1070, 464, 1037, 614, 0, 0, 646, 0, 0, 0, 1186, 1186, 1186, 1119,
+    904, 850, 498, 1118, 1080, 1201, 1202, 303, 572, 1145, 1204, 688, 1231, 1096, 166, 1119, 1200, 786, 637, 8,
+    265, 616, 1186, 430, 342, 444, 654, 1323, 1325, 468, 37, 888, 1105, 1176, 8, 855, 441, 301, 619, 458,
+    776, 292, 395, 395, 399, 1162, 1052, 1282, 1301, 1115, 943, 322, 452, 460, 651, 418, 940, 812, 310, 240,
+    1278, 824, 1087, 69, 1085, 752, 436, 403, 1226, 437, 251, 1172, 481, 174, 859, 1085, 1262, 529, 1041, 425,
+    1105, 948, 818, 545, 1304, 1169, 1203, 639, 1210, 959, 222, 1288, 348, 0, 1149, 111, 486, 531, 0, 445,
+    598, 1086, 758, 0, 984, 1181, 948, 165, 949, 1210, 1262, 551, 736, 646, 385, 862, 992, 1204, 568, 470,
+    1104, 34, 145, 1142, 1052, 591, 1098, 1262, 826, 1310, 806, 193, 1203, 145, 1202, 519, 760, 812, 812, 683,
+    977, 1103, 289, 1211, 1265, 441, 434, 901, 88, 266, 650, 380, 997, 1262, 664, 432, 1144, 591, 1104, 340,
+    549, 885, 1094, 310, 196, 948, 1014, 615, 893, 1000, 1111, 41, 1171, 357, 52, 1305, 359, 0, 1138, 95,
+    0, 545, 0, 436, 566, 84, 549, 1202, 0, 1188, 671, 230, 1033, 637, 1043, 1280, 779, 8, 570, 174,
+    1105, 802, 850, 457, 165, 452, 1087, 1059, 92, 1201, 1180, 434, 578, 52, 604, 989, 76, 1251, 614, 446,
+    631, 1162, 587, 436, 792, 359, 374, 220, 989, 605, 939, 929, 220, 661, 1153, 631, 72, 222, 194, 1261,
+    918, 1148, 1088, 403, 17, 651, 598, 181, 1272, 83, 804, 445, 652, 174, 717, 424, 481, 1182, 443, 1161,
+    956, 1184, 531, 125, 405, 920, 511, 826, 622, 1224, 0, 828, 242, 572, 585, 511, 6, 52, 566, 1086,
+    434, 1154, 947, 277, 646, 750, 111, 226, 1155, 447, 897, 897, 559, 1200, 832, 145, 407, 441, 627, 1211,
+    35, 1196, 855, 605, 873, 424, 265, 1023, 286, 476, 1318, 275, 891, 289, 531, 975, 896, 1158, 1141, 303,
+    476, 210, 1100, 1044, 978, 1119, 1106, 594, 1213, 0, 816, 441, 1213, 997, 587, 1202, 1108, 1191, 434, 397,
+    980, 731, 559, 1145, 1213, 1202, 1104, 383, 69, 380, 7, 1086, 424, 1088, 436, 170, 1115, 608, 661, 1180,
+    562, 444, 87, 940, 828, 570, 498, 1204, 198, 1027, 1014, 1149, 52, 1248, 997, 571, 277, 236, 451, 340,
+    1126, 958, 443, 496, 394, 904, 1127, 1153, 1172, 0, 985, 958, 1153, 254, 798, 1087, 705, 141, 626, 891,
+    790, 1007, 171, 1229, 125, 1262, 270, 710, 1186, 319, 176, 1119, 816, 273, 442, 1144, 528, 454, 54, 230,
+    652, 545, 457, 89, 658, 848, 838, 1113, 0, 750, 1112, 989, 617, 1180, 1144, 1125, 566, 1180, 539, 559,
+    1122, 220, 1270, 39, 1023, 1172, 671, 415, 56, 277, 985, 1010, 1059, 848, 832, 1088, 591, 424, 0, 319,
+    1213, 0, 568, 958, 145, 6, 585, 1229, 1145, 127, 544, 432, 1070, 1102, 897, 897, 816, 392, 603, 987,
+    1060, 632, 1213, 798, 1201, 1153, 436, 461, 1111, 669, 0, 987, 461, 0, 721, 71, 870, 1180, 1113, 1200,
+    469, 572, 572, 1183, 828, 1185, 594, 1046, 1087, 1209, 587, 855, 1170, 277, 650, 545, 528, 545, 436, 210,
+    0, 560, 558, 408, 292, 1269, 1088, 529, 1250, 412, 566, 436, 650, 559, 412, 614, 433, 529, 605, 441,
+    0, 0, 558, 860, 1119, 1180, 606, 642, 59, 402, 404, 604, 746, 619, 978, 1119, 824, 147, 402, 1141,
+    194, 301, 1141, 1141, 604, 404, 1200, 383, 449, 471, 362, 38, 1162, 1250, 1250, 528, 29, 1106, 957, 137,
+    851, 228, 433, 851, 129, 948, 0, 222, 1259, 937, 1199, 311, 1302, 395, 423, 646, 324, 993, 1107, 108,
+    949, 1179, 623, 1118, 280, 265, 752, 134, 823, 1090, 1090, 898, 34, 51, 1209, 1209, 479, 816, 1044, 1183,
+    816, 85, 1204, 476, 422, 840, 816, 1274, 1157, 173, 679, 1082, 289, 289, 377, 332, 1229, 302, 868, 454,
+    301, 132, 243, 791, 1114, 709, 1021, 850, 1196, 1242, 802, 133, 1197, 385, 372, 471, 568, 303, 868, 1240,
+    336, 783, 70, 1112, 1282, 228, 61, 66, 338, 868, 854, 937, 1039, 587, 340, 207, 340, 1186, 568, 128,
+    854, 674, 322, 173, 422, 422, 632, 303, 1166, 1071, 582, 1279, 1177, 1112, 536, 447, 568, 1180, 802, 452,
+    367, 937, 1178, 1083, 671, 848, 838, 356, 333, 1271, 629, 0, 1269, 438, 873, 978, 816, 1131, 582, 851,
+    932, 1193, 438, 1062, 121, 28, 263, 375, 958, 1146, 292, 943, 1264, 302, 1114, 1259, 1100, 301, 566, 549,
+    52, 145, 1203, 1197, 452, 207, 1162, 1041, 227, 973, 422, 342, 1268, 981, 284, 468, 652, 816, 816, 1202,
+    480, 540, 647, 827, 978, 1103, 610, 568, 232, 1034, 1017, 532, 311, 375, 1202, 34, 285, 783, 1087, 255,
+    1180, 1203, 989, 859, 825, 898, 709, 843, 1088, 574, 363, 1077, 239, 265, 30, 222, 1083, 85, 1167, 1186,
+    361, 110, 0, 540, 498, 434, 385, 1041, 628, 1141, 653, 1200, 451, 949, 1145, 418, 1163, 53, 888, 1085,
+    303, 1204, 641, 1088, 301, 895, 1124, 1196, 851, 635, 1107, 1185, 948, 137, 1013, 1279, 1304, 1025, 303, 1204,
+    423, 646, 540, 246, 403, 850, 232, 568, 342, 1210, 470, 689, 598, 867, 885, 1186, 444, 0, 549, 764,
+    978, 1103, 173, 1103, 1204, 1093, 570, 984, 29, 885, 885, 434, 1099, 853, 375, 840, 1178, 49, 407, 1014,
+    1179, 248, 686, 385, 403, 424, 623, 664, 1180, 1090, 1186, 1023, 1201, 88, 0, 0, 630, 0, 929, 951,
+    92, 132, 222, 17, 605, 1088, 1271, 1014, 125, 790, 855, 783, 1200, 443, 614, 598, 841, 1272, 1183, 444,
+    965, 1090, 447, 1080, 1259, 1261, 622, 622, 361, 591, 635, 1103, 174, 566, 630, 1119, 0, 1251, 633, 1118,
+    671, 1316, 978, 850, 1021, 1269, 779, 779, 449, 855, 60, 577, 760, 356, 1105, 435, 1286, 418, 287, 553,
+    476, 476, 424, 1182, 110, 447, 928, 873, 1119, 674, 137, 1154, 978, 0, 128, 208, 567, 1126, 928, 1179,
+    459, 198, 110, 818, 170, 1118, 939, 615, 840, 1186, 108, 568, 1231, 1145, 570, 1280, 1231, 1123, 633, 1126,
+    816, 885, 442, 647, 381, 891, 432, 1298, 452, 63, 386, 661, 277, 558, 452, 540, 652, 567, 166, 568,
+    850, 721, 603, 248, 1119, 1279, 594, 568, 594, 292, 1173, 48, 931, 340, 472, 1185, 0, 1103, 85, 855,
+    859, 248, 85, 629, 476, 452, 1280, 1240, 1125, 417, 730, 771, 745, 1130, 1274, 671, 271, 501, 661, 1106,
+    1132, 1163, 490, 1206, 0, 587, 1148, 959, 1112, 1046, 596, 451, 1112, 1157, 403, 1088, 213, 136, 1088, 213,
+    1294, 392, 855, 1177, 0, 75, 313, 1200, 57, 104, 1179, 926, 127, 300, 359, 288, 963, 452, 683, 1272,
+    206, 884, 1274, 1272, 1126, 816, 1124, 868, 1268, 880, 839, 455, 479, 1204, 641, 108, 18, 717, 421, 868,
+    437, 1068, 588, 204, 38, 768, 1172, 1325, 52, 935, 1011, 470, 386, 959, 1140, 1263, 1178, 754, 68, 219,
+    1074, 303, 359, 1271, 1271, 868, 762, 1180, 637, 0, 683, 509, 1114, 109, 854, 41, 359, 1104, 0, 69,
+    0, 301, 1178, 134, 514, 880, 446, 438, 190, 671, 452, 269, 616, 891, 1279, 354, 1181, 81, 582, 0,
+    0, 1289, 208, 0, 532, 503, 717, 959, 438, 533, 129, 567, 472, 940, 808, 322, 1180, 1202, 1263, 591,
+    851, 866, 436, 1180, 75, 1289, 973, 920, 866, 567, 570, 572, 514, 442, 297, 109, 52, 358, 1018, 1206,
+    587, 134, 113, 141, 259, 57, 574, 114, 772, 772, 284, 1203, 615, 363, 1163, 247, 1104, 1271, 468, 817,
+    436, 1269, 344, 503, 0, 1027, 1025, 303, 137, 1123, 54, 232, 532, 249, 1140, 1140, 385, 1206, 35, 37,
+    303, 1200, 1058, 1163, 421, 41, 146, 618, 0, 0, 1212, 198, 335, 197, 411, 885, 1206, 893, 686, 462,
+    1001, 29, 1066, 134, 913, 717, 1185, 454, 823, 411, 514, 570, 37, 566, 1259, 948, 618, 1180, 232, 1126,
+    1111, 1088, 57, 92, 433, 445, 918, 35, 1115, 0, 812, 442, 1288, 443, 1318, 434, 205, 1215, 277, 69,
+    1118, 1128, 60, 873, 630, 545, 18, 259, 357, 94, 996, 731, 109, 572, 52, 455, 208, 957, 1011, 52,
+    545, 812, 891, 1270, 0, 958, 1074, 951, 27, 1124, 69, 127, 544, 594, 1104, 1111, 545, 1259, 204, 0,
+    1223, 948, 442, 762, 1180, 0, 1159, 1103, 1103, 1172, 294, 1010, 0, 58, 303, 23, 385, 433, 433, 443,
+    348, 55, 1164, 354, 476, 788, 635, 652, 652, 661, 951, 978, 1247, 614, 476, 652, 1036, 570, 1172, 1271,
+    479, 1104, 927, 1085, 1106, 1030, 1200, 546, 265, 247, 839, 765, 436, 664, 1186, 337, 857, 1250, 456, 348,
+    216, 443, 614, 857, 443, 1086, 476, 857, 614, 546, 942, 220, 348, 443, 348, 1164, 354, 652, 951, 1247,
+    546, 476, 436, 1104, 220, 1030, 1200, 337, 456, 857, 449, 464, 455, 179, 476, 1271, 120, 434, 338, 207,
+    1301, 221, 929, 409, 859, 322, 135, 453, 356, 332, 147, 453, 428, 851, 1131, 989, 709, 433, 605, 1271,
+    1239, 52, 1131, 403, 929, 332, 1271, 1150, 147, 1103, 1178, 605, 476, 1103, 1164, 1103, 1162, 0, 237, 303,
+    851, 851, 450, 394, 436, 279, 1155, 230, 395, 104, 1019, 1141, 452, 1178, 880, 1155, 1182, 928, 818, 1067,
+    436, 1155, 1182, 263, 288, 1159, 1169, 983, 942, 1182, 1127, 476, 1120, 698, 125, 1196, 1270, 1135, 282, 1130,
+    117, 939, 1111, 921, 1064, 1143, 1180, 1180, 989, 132, 384, 940, 385, 1144, 1263, 1282, 1267, 337, 1302, 1302,
+    1247, 340, 303, 860, 232, 587, 221, 1168, 568, 695, 762, 1278, 314, 1180, 471, 19, 1242, 1068, 1178, 856,
+    1257, 802, 52, 1137, 854, 21, 198, 1312, 1017, 1281, 171, 1259, 1193, 1143, 1154, 1180, 419, 385, 951, 102,
+    447, 948, 389, 104, 337, 356, 859, 424, 452, 409, 308, 1116, 1085, 940, 141, 1044, 650, 1247, 666, 265,
+    421, 1162, 1135, 344, 271, 47, 1035, 134, 559, 1279, 524, 515, 1100, 1202, 1023, 436, 1271, 880, 989, 550,
+    263, 525, 265, 951, 1042, 207, 69, 110, 1198, 392, 834, 839, 962, 8, 1201, 1122, 129, 454, 1114, 1099,
+    1102, 320, 983, 813, 424, 460, 976, 1264, 976, 246, 0, 116, 971, 452, 501, 854, 175, 1120, 996, 1083,
+    1146, 286, 132, 1005, 1180, 681, 1182, 230, 784, 169, 111, 124, 1294, 433, 815, 1010, 1293, 1087, 469, 845,
+    443, 1265, 1231, 1307, 823, 1298, 575, 443, 1282, 381, 612, 942, 57, 412, 787, 1200, 232, 1143, 788, 951,
+    1145, 951, 428, 409, 265, 1274, 222, 1124, 301, 813, 1041, 443, 817, 1202, 1301, 153, 1105, 424, 1181, 8,
+    1112, 688, 125, 294, 1279, 1166, 1164, 391, 1145, 322, 743, 818, 674, 1176, 1088, 0, 1023, 1307, 928, 442,
+    69, 0, 419, 432, 321, 1186, 650, 1121, 652, 1106, 827, 124, 746, 1025, 989, 34, 133, 823, 951, 445,
+    1206, 1126, 1152, 1017, 1170, 1170, 0, 1200, 56, 176, 846, 566, 669, 671, 929, 1259, 667, 442, 1231, 451,
+    570, 598, 84, 748, 350, 1104, 1298, 17, 17, 456, 1259, 1178, 405, 446, 629, 118, 375, 407, 111, 1141,
+    1236, 917, 1103, 936, 254, 1267, 695, 545, 263, 1188, 476, 433, 1320, 449, 71, 424, 1288, 677, 1235, 1240,
+    952, 832, 1010, 1235, 813, 945, 1145, 1230, 1009, 209, 996, 823, 433, 450, 459, 570, 734, 1177, 7, 1247,
+    785, 423, 409, 1180, 1180, 928, 872, 735, 825, 1293, 1005, 405, 1275, 381, 1176, 1185, 443, 1202, 442, 424,
+    246, 1259, 1148, 1223, 559, 942, 1088, 111, 568, 1178, 55, 1259, 1164, 265, 141, 1088, 141, 1172, 110, 872,
+    1183, 545, 127, 432, 1259, 413, 1223, 1180, 209, 1247, 1164, 246, 1162, 436, 237, 303, 880, 433, 452, 395,
+    1019, 872, 928, 818, 1067, 1155, 1180, 1155, 436, 880, 445, 424, 748, 471, 1159, 698, 1143, 263, 612, 1135,
+    983, 292, 939, 282, 476, 1267, 340, 384, 802, 1312, 951, 1137, 1242, 989, 1263, 221, 1307, 171, 857, 1257,
+    52, 1180, 1178, 524, 559, 951, 344, 948, 452, 421, 129, 1279, 940, 409, 207, 337, 859, 356, 1154, 1180,
+    1265, 308, 1116, 104, 428, 1143, 1275, 454, 1100, 1201, 834, 1102, 320, 1198, 424, 525, 976, 983, 4, 845,
+    1279, 1307, 743, 246, 1298, 286, 501, 1087, 1200, 971, 942, 230, 111, 575, 1294, 996, 1010, 942, 1178, 674,
+    125, 232, 419, 443, 1124, 746, 1176, 1088, 265, 1202, 1145, 110, 1301, 8, 1164, 222, 650, 787, 1143, 669,
+    209, 989, 1126, 1170, 34, 951, 823, 652, 456, 629, 1259, 442, 667, 1010, 1235, 832, 545, 813, 476, 1164,
+    825, 1247, 127, 340, 823, 395, 1107, 476, 395, 372, 394, 1103, 1103, 429, 577, 374, 246, 594, 244, 444,
+    817, 134, 567, 216, 1077, 49, 959, 1114, 292, 1271, 1271, 1164, 1164, 950, 147, 421, 1064, 1180, 1064, 1180,
+    441, 20, 401, 265, 180, 1118, 416, 441, 502, 308, 855, 300, 1103, 63, 381, 1202, 1279, 437, 289, 1103,
+    69, 1089, 414, 63, 220, 1304, 289, 1180, 1271, 38, 106, 11, 783, 683, 782, 336, 683, 1198, 228, 671,
+    980, 1138, 414, 532, 385, 385, 671, 375, 637, 566, 709, 51, 1201, 437, 1055, 634, 783, 1103, 265, 471,
+    671, 144, 1010, 413, 476, 41, 1262, 1204, 303, 81, 334, 1021, 1178, 377, 1080, 798, 432, 279, 1009, 350,
+    1231, 1269, 271, 1281, 951, 52, 1301, 271, 357, 788, 54, 627, 204, 947, 527, 287, 1037, 1178, 133, 637,
+    386, 52, 605, 585, 424, 308, 787, 1301, 439, 1144, 1233, 449, 310, 1224, 443, 1188, 1155, 1264, 936, 63,
+    63, 851, 936, 155, 1224, 1275, 544, 1223, 173, 124, 930, 1030, 772, 329, 1112, 628, 443, 996, 303, 1012,
+    175, 175, 1271, 433, 1253, 247, 457, 1135, 974, 1212, 37, 1217, 544, 295, 90, 433, 947, 7, 1288, 303,
+    337, 907, 1231, 577, 1088, 28, 126, 1288, 1271, 1293, 56, 1210, 1238, 1011, 1223, 1164, 0, 928, 1080, 1186,
+    457, 313, 1112, 1224, 52, 246, 957, 1164, 0, 1148, 596, 314, 1224, 41, 1262, 303, 1204, 334, 81, 1231,
+    1112, 28, 1253, 432, 1269, 279, 1009, 798, 54, 337, 1281, 350, 271, 443, 52, 951, 1037, 357, 527, 204,
+    637, 287, 386, 1178, 1233, 1271, 439, 424, 1301, 880, 605, 1224, 1301, 308, 457, 851, 1264, 544, 936, 303,
+    247, 433, 957, 930, 980, 52, 1275, 329, 772, 1012, 544, 295, 1293, 303, 1288, 907, 1231, 1164, 1223, 1210,
+    1238, 928, 1186, 314, 135, 1106, 939, 689, 1136, 1106, 128, 386, 128, 1260, 1108, 1014, 1308, 1308, 568, 466,
+    303, 1257, 313, 817, 928, 848, 840, 1113, 170, 476, 841, 133, 170, 127, 127, 232, 468, 117, 219, 917,
+    1247, 1280, 1209, 854, 452, 133, 145, 342, 1152, 170, 1034, 260, 582, 313, 1000, 181, 1104, 1257, 989, 1183,
+    469, 443, 864, 1016, 169, 187, 605, 857, 210, 850, 1301, 1025, 854, 135, 418, 832, 832, 1172, 1230, 1027,
+    0, 1222, 1222, 1311, 752, 38, 514, 498, 256, 476, 300, 126, 442, 283, 1270, 904, 1209, 753, 816, 1209,
+    827, 1070, 1007, 1180, 713, 587, 641, 21, 231, 512, 1068, 437, 172, 769, 821, 1282, 468, 232, 1269, 300,
+    760, 470, 926, 70, 709, 471, 568, 326, 1178, 433, 204, 1113, 447, 261, 1279, 859, 517, 1285, 357, 848,
+    530, 1116, 135, 605, 48, 1271, 438, 1036, 82, 443, 1005, 831, 52, 1111, 261, 433, 469, 436, 957, 1052,
+    147, 460, 721, 1119, 69, 135, 865, 675, 956, 549, 1193, 449, 141, 831, 0, 1005, 443, 816, 1096, 1087,
+    1298, 452, 434, 719, 469, 468, 610, 605, 564, 411, 471, 133, 1079, 859, 1024, 69, 1311, 838, 435, 181,
+    1304, 82, 1304, 781, 1271, 1265, 226, 1269, 1200, 261, 257, 166, 1193, 1273, 222, 1260, 126, 151, 443, 342,
+    1014, 470, 301, 1311, 232, 787, 888, 743, 1025, 103, 1061, 442, 212, 193, 1103, 1005, 827, 1249, 224, 1025,
+    434, 721, 629, 590, 1250, 52, 136, 605, 577, 181, 1013, 204, 1000, 1105, 530, 433, 1269, 827, 220, 760,
+    1304, 570, 48, 1227, 713, 60, 1060, 469, 218, 100, 1111, 277, 145, 1272, 255, 68, 181, 1311, 476, 476,
+    585, 1005, 831, 831, 812, 576, 255, 182, 527, 1230, 1005, 52, 52, 1280, 471, 145, 834, 256, 141, 433,
+    1101, 1209, 713, 585, 582, 1269, 568, 1271, 110, 145, 251, 1088, 594, 585, 1111, 1088, 1313, 545, 1126, 870,
+    1125, 721, 1005, 855, 454, 182, 1313, 1105, 529, 476, 585, 940, 332, 205, 0, 854, 1026, 260, 260, 332,
+    549, 0, 615, 6, 433, 469, 1015, 0, 0, 1163, 0, 491, 854, 598, 555, 1069, 1269, 0, 1026, 213,
+    0, 1202, 121, 1159, 356, 479, 1088, 1209, 1130, 222, 1145, 279, 880, 926, 828, 956, 1064, 125, 204, 265,
+    683, 816, 635, 895, 880, 278, 1287, 394, 402, 855, 420, 221, 587, 204, 16, 1263, 279, 524, 14, 778,
+    41, 338, 512, 768, 1282, 886, 265, 21, 1276, 1270, 1170, 498, 1180, 843, 951, 802, 269, 848, 469, 450,
+    351, 605, 486, 859, 1275, 1219, 1271, 936, 575, 1202, 932, 1196, 415, 1212, 1259, 1079, 302, 843, 1275, 709,
+    587, 1259, 1250, 575, 1301, 421, 1083, 169, 363, 489, 1179, 779, 826, 359, 713, 787, 349, 41, 610, 756,
+    573, 895, 888, 434, 1166, 1112, 153, 178, 164, 322, 1196, 394, 956, 303, 1301, 301, 1089, 44, 1249, 1200,
+    1089, 1017, 340, 1262, 1108, 1204, 605, 464, 118, 1287, 1088, 426, 0, 123, 450, 1250, 812, 554, 289, 276,
+    583, 322, 917, 489, 416, 1179, 434, 254, 269, 1200, 1114, 394, 559, 774, 568, 568, 603, 585, 121, 1159,
+    356, 1145, 222, 880, 1287, 265, 610, 895, 394, 512, 498, 603, 1276, 1270, 1180, 402, 1263, 568, 1170, 843,
+    951, 1219, 1271, 450, 1275, 859, 605, 450, 1259, 302, 575, 713, 41, 421, 359, 1083, 573, 169, 1301, 178,
+    301, 434, 1089, 956, 774, 1204, 1108, 1249, 605, 123, 583, 1127, 338, 171, 171, 785, 1318, 55, 540, 540,
+    171, 1149, 31, 55, 55, 55, 0, 55, 29, 171, 55, 55, 125, 892, 731, 731, 1263, 169, 169, 0,
+    882, 53, 53, 0, 0, 577, 198, 109, 311, 823, 1199, 1199, 818, 1155, 1179, 364, 628, 816, 1214, 1084,
+    0, 1294, 1186, 1027, 1213, 457, 377, 1159, 278, 1102, 198, 263, 414, 1261, 0, 457, 1205, 1086, 570, 133,
+    123, 711, 1034, 1271, 1179, 462, 437, 125, 204, 270, 220, 806, 1083, 232, 1231, 1018, 959, 1068, 0, 460,
+    422, 1044, 1198, 650, 48, 433, 685, 1178, 452, 1291, 582, 1155, 1062, 983, 951, 1018, 764, 401, 711, 257,
+    462, 1147, 1155, 73, 1196, 1119, 851, 1050, 1280, 851, 222, 222, 1052, 460, 1027, 244, 1179, 1261, 1043, 353,
+    1102, 951, 130, 989, 1230, 865, 293, 570, 1002, 422, 567, 0, 542, 44, 196, 476, 48, 416, 204, 605,
+    1196, 1275, 457, 1202, 169, 529, 1085, 1027, 1180, 198, 1205, 614, 49, 743, 1200, 210, 994, 257, 996, 1163,
+    153, 133, 1025, 1202, 949, 1262, 1196, 1213, 265, 55, 364, 265, 1108, 418, 851, 213, 198, 1086, 0, 1178,
+    337, 1170, 147, 591, 1155, 1005, 222, 133, 1205, 989, 1005, 825, 0, 1170, 350, 1251, 17, 951, 95, 135,
+    989, 1227, 1258, 257, 222, 598, 133, 193, 583, 1319, 875, 823, 1147, 1202, 1178, 1102, 577, 471, 951, 52,
+    1169, 628, 1126, 996, 414, 1247, 1023, 270, 658, 53, 53, 538, 566, 1204, 1170, 614, 567, 1180, 1041, 218,
+    817, 1191, 926, 373, 1200, 632, 891, 848, 0, 527, 300, 494, 63, 280, 1132, 683, 0, 942, 32, 1204,
+    189, 431, 1124, 32, 1099, 471, 1196, 373, 1007, 850, 52, 772, 66, 935, 41, 1073, 221, 1307, 1176, 583,
+    524, 354, 1279, 948, 512, 1202, 308, 385, 1106, 1271, 434, 1154, 401, 1132, 447, 1104, 354, 741, 549, 438,
+    520, 1267, 0, 1213, 1162, 129, 242, 132, 618, 302, 1100, 301, 320, 382, 549, 438, 330, 481, 1187, 69,
+    1106, 41, 568, 1211, 76, 1120, 815, 783, 843, 361, 0, 1010, 1307, 802, 542, 709, 124, 1196, 76, 1115,
+    205, 469, 1191, 831, 1177, 245, 1163, 639, 901, 41, 265, 1200, 474, 1201, 1213, 401, 529, 1115, 1115, 984,
+    1014, 664, 1106, 893, 147, 1301, 1307, 469, 1099, 1115, 1211, 383, 1191, 51, 671, 118, 300, 578, 1182, 1286,
+    405, 831, 1161, 1251, 631, 831, 1143, 218, 52, 1128, 52, 99, 1086, 1267, 637, 928, 583, 804, 205, 646,
+    1176, 91, 520, 292, 646, 1307, 527, 571, 1223, 110, 1195, 816, 1161, 110, 1223, 587, 413, 1103, 292, 1223,
+    568, 1197, 236, 851, 1298, 774, 1278, 1178, 379, 1201, 466, 1163, 1318, 635, 205, 1144, 1048, 1262, 288, 0,
+    0, 1213, 1008, 1028, 821, 1068, 1325, 372, 338, 987, 806, 141, 1219, 664, 555, 169, 141, 1198, 1044, 1270,
+    1111, 446, 129, 1184, 1052, 450, 639, 514, 990, 560, 812, 1318, 370, 1164, 1105, 716, 1086, 605, 546, 1161,
+    1018, 771, 1249, 165, 1010, 1318, 169, 181, 532, 1025, 653, 245, 403, 1143, 1133, 1011, 464, 165, 1213, 806,
+    501, 984, 650, 859, 142, 194, 1213, 1194, 15, 1242, 370, 1014, 446, 792, 927, 1202, 566, 1228, 553, 1177,
+    446, 74, 450, 1103, 1010, 806, 731, 1180, 567, 471, 450, 1180, 716, 891, 1153, 141, 1164, 587, 650, 650,
+    716, 1130, 450, 1105, 650, 1164, 55, 82, 951, 1198, 951, 951, 567, 1274, 1175, 575, 566, 455, 0, 305,
+    1179, 578, 211, 1254, 234, 806, 851, 385, 302, 1262, 1269, 20, 608, 302, 684, 230, 928, 833, 511, 155,
+    1302, 277, 1200, 407, 375, 315, 816, 632, 884, 222, 980, 1106, 1180, 105, 948, 1053, 1106, 744, 823, 0,
+    443, 782, 1174, 1182, 22, 280, 125, 1132, 243, 1209, 1162, 300, 782, 683, 1127, 263, 476, 257, 335, 1183,
+    824, 30, 434, 878, 117, 729, 288, 1212, 435, 840, 783, 361, 395, 1182, 479, 948, 1180, 1272, 719, 310,
+    884, 431, 1008, 494, 0, 0, 0, 0, 259, 1301, 709, 1052, 951, 662, 338, 498, 587, 67, 1178, 340,
+    69, 782, 1202, 980, 1323, 76, 1196, 227, 439, 1262, 950, 951, 1038, 471, 109, 948, 948, 1148, 1254, 38,
+    385, 52, 944, 145, 949, 69, 1282, 135, 1214, 803, 1044, 824, 301, 1245, 592, 823, 301, 568, 1209, 782,
+    1165, 31, 68, 452, 335, 959, 1265, 678, 710, 719, 222, 437, 679, 207, 940, 1179, 978, 527, 483, 40,
+    443, 1044, 1132, 395, 449, 134, 270, 324, 66, 951, 674, 366, 1182, 479, 1275, 139, 931, 1044, 671, 560,
+    433, 1202, 1144, 878, 1321, 1271, 847, 928, 135, 1113, 1132, 859, 782, 1038, 1279, 399, 664, 516, 1170, 1111,
+    1112, 1138, 479, 101, 554, 434, 784, 891, 651, 1177, 1181, 351, 10, 238, 1197, 917, 497, 824, 606, 0,
+    4, 230, 375, 898, 951, 504, 851, 1119, 1259, 1140, 1226, 1024, 196, 342, 333, 1272, 244, 618, 639, 549,
+    1079, 1127, 1211, 41, 1102, 989, 1202, 110, 1042, 69, 375, 438, 395, 182, 292, 109, 1079, 1271, 978, 1145,
+    1100, 1100, 1034, 333, 1298, 620, 1132, 823, 943, 373, 620, 1124, 145, 1267, 468, 1114, 1038, 632, 811, 566,
+    762, 898, 129, 320, 567, 1021, 0, 1282, 0, 1051, 592, 1318, 471, 115, 1203, 443, 315, 230, 1018, 114,
+    610, 363, 587, 39, 605, 566, 827, 808, 474, 662, 1318, 779, 11, 783, 1114, 1159, 1291, 560, 1, 506,
+    1005, 532, 247, 1088, 161, 1301, 1265, 42, 719, 175, 254, 1010, 237, 816, 824, 1298, 816, 1202, 456, 349,
+    635, 113, 1030, 1104, 572, 1018, 341, 196, 959, 1262, 605, 647, 605, 406, 57, 305, 542, 502, 0, 0,
+    686, 1079, 1223, 0, 214, 1111, 0, 429, 575, 0, 642, 486, 1185, 219, 572, 361, 1113, 248, 1052, 1086,
+    174, 303, 888, 434, 265, 888, 126, 1025, 1240, 397, 1166, 251, 1107, 1200, 504, 1131, 418, 1087, 303, 1254,
+    102, 838, 937, 394, 529, 1030, 674, 831, 831, 399, 1047, 174, 414, 1176, 662, 443, 249, 443, 978, 528,
+    403, 1145, 1260, 452, 1262, 53, 1272, 1301, 1138, 1174, 640, 758, 4, 454, 0, 639, 167, 1005, 34, 1108,
+    570, 1001, 1106, 591, 1311, 1176, 735, 1093, 885, 1014, 1001, 827, 322, 977, 161, 69, 760, 904, 52, 913,
+    315, 1301, 1099, 1188, 419, 1034, 591, 486, 998, 920, 984, 1080, 383, 1264, 1264, 615, 1180, 1204, 1015, 721,
+    1104, 437, 321, 623, 472, 0, 0, 1001, 0, 0, 0, 681, 604, 1001, 748, 1311, 1056, 1138, 350, 1148,
+    572, 955, 17, 630, 671, 614, 52, 1088, 591, 220, 831, 174, 1178, 605, 17, 504, 827, 185, 818, 114,
+    1013, 631, 1191, 111, 292, 460, 56, 959, 600, 1140, 174, 594, 1223, 443, 92, 566, 1110, 1103, 491, 0,
+    48, 0, 0, 1265, 605, 407, 434, 812, 424, 827, 803, 583, 1001, 1140, 910, 128, 531, 978, 593, 695,
+    392, 795, 996, 277, 832, 858, 1166, 1016, 1118, 476, 447, 1319, 577, 452, 553, 254, 1010, 1220, 433, 442,
+    1272, 218, 1159, 1188, 254, 476, 735, 1027, 813, 1038, 0, 0, 236, 928, 485, 442, 287, 996, 604, 472,
+    424, 1202, 570, 1298, 831, 823, 1298, 558, 52, 1038, 414, 1176, 259, 363, 208, 471, 289, 198, 41, 1180,
+    7, 1304, 1155, 230, 1282, 392, 1293, 433, 719, 1005, 432, 846, 63, 1185, 531, 724, 1141, 443, 443, 0,
+    103, 1271, 661, 566, 558, 433, 1315, 527, 931, 779, 540, 246, 977, 169, 619, 56, 38, 604, 0, 0,
+    594, 265, 603, 1127, 443, 545, 69, 441, 1172, 110, 1115, 443, 1103, 350, 89, 721, 559, 184, 855, 762,
+    614, 1313, 606, 1228, 721, 476, 1015, 958, 545, 455, 851, 1179, 1262, 234, 1254, 806, 229, 1053, 823, 155,
+    928, 434, 277, 230, 642, 744, 1104, 105, 1132, 310, 76, 1008, 471, 257, 117, 1272, 683, 41, 315, 30,
+    824, 1172, 839, 479, 1102, 335, 494, 280, 430, 243, 729, 22, 1202, 824, 1265, 824, 338, 68, 262, 803,
+    76, 21, 1209, 1315, 679, 207, 439, 227, 1196, 1038, 69, 587, 977, 823, 592, 38, 951, 1148, 937, 52,
+    710, 782, 259, 1132, 497, 554, 271, 632, 1159, 1197, 129, 438, 1174, 695, 1271, 208, 1044, 618, 230, 1181,
+    486, 1240, 1279, 1113, 1042, 238, 1111, 407, 859, 920, 438, 1170, 324, 664, 1265, 917, 449, 1179, 111, 139,
+    1016, 8, 1182, 892, 1282, 553, 811, 1100, 542, 1021, 572, 504, 1119, 1001, 567, 1267, 145, 361, 320, 1038,
+    1140, 196, 620, 292, 1127, 592, 485, 442, 898, 1027, 549, 823, 469, 1, 827, 260, 1030, 196, 635, 42,
+    816, 214, 516, 532, 113, 1104, 341, 614, 161, 1291, 456, 1271, 1111, 474, 429, 808, 1010, 237, 443, 471,
+    647, 1301, 838, 1185, 486, 827, 981, 265, 102, 831, 1272, 251, 984, 418, 414, 4, 248, 640, 600, 1301,
+    287, 639, 671, 1264, 69, 322, 721, 1015, 472, 721, 681, 591, 383, 34, 1180, 437, 63, 885, 56, 1013,
+    631, 614, 48, 1191, 460, 220, 1311, 1148, 591, 1010, 476, 577, 812, 604, 254, 547, 813, 184, 827, 216,
+    432, 558, 414, 1298, 570, 1180, 103, 56, 540, 110, 1115, 114, 114, 466, 18, 232, 854, 578, 650, 114,
+    642, 624, 966, 927, 432, 642, 1162, 52, 375, 52, 0, 485, 494, 45, 395, 900, 911, 1112, 1112, 441,
+    663, 1107, 0, 244, 1240, 697, 0, 778, 1109, 587, 55, 52, 900, 385, 348, 322, 322, 273, 147, 397,
+    354, 663, 0, 533, 550, 617, 1041, 922, 469, 1209, 1209, 111, 857, 585, 113, 925, 533, 1161, 1090, 1162,
+    265, 425, 1202, 1090, 1118, 35, 1118, 857, 1171, 1090, 30, 11, 1086, 1181, 536, 864, 545, 245, 0, 0,
+    1029, 721, 1005, 486, 385, 864, 158, 348, 244, 817, 528, 1014, 348, 791, 490, 1106, 424, 111, 785, 210,
+    414, 1005, 1090, 0, 642, 966, 927, 1164, 375, 52, 1092, 158, 900, 1086, 1112, 395, 441, 663, 494, 644,
+    1240, 697, 354, 1090, 1005, 663, 617, 486, 273, 322, 385, 533, 464, 1209, 550, 245, 1202, 1161, 113, 1106,
+    1090, 425, 1162, 265, 111, 545, 857, 424, 536, 864, 322, 1029, 1005, 864, 490, 414, 303, 303, 556, 254,
+    1130, 823, 1102, 1180, 1068, 1181, 1166, 243, 265, 944, 30, 772, 504, 1212, 895, 1270, 783, 459, 281, 1166,
+    1181, 1264, 451, 128, 265, 854, 221, 1312, 1325, 227, 588, 1, 1068, 1068, 39, 66, 303, 436, 605, 595,
+    125, 1132, 261, 600, 671, 446, 956, 261, 1114, 269, 356, 1199, 308, 927, 1155, 834, 1132, 165, 303, 52,
+    1108, 927, 944, 1271, 811, 243, 1206, 1264, 145, 1114, 0, 721, 1212, 1113, 772, 772, 1307, 1177, 253, 610,
+    1181, 468, 161, 125, 783, 587, 1018, 1114, 605, 0, 1113, 1181, 1281, 1166, 882, 927, 137, 1164, 1181, 1200,
+    219, 1200, 594, 1085, 1085, 721, 254, 994, 10, 418, 451, 994, 1183, 308, 1163, 421, 322, 1212, 1102, 1087,
+    7, 1106, 1014, 436, 1253, 212, 17, 1106, 1183, 0, 875, 583, 1060, 218, 784, 996, 994, 1202, 1113, 288,
+    710, 269, 433, 212, 1104, 1183, 263, 421, 595, 1103, 568, 568, 568, 1291, 386, 1268, 1295, 481, 688, 1180,
+    864, 1164, 840, 1158, 1136, 1158, 434, 341, 414, 1271, 337, 481, 171, 1191, 468, 145, 402, 1215, 616, 1200,
+    141, 228, 993, 375, 432, 968, 350, 145, 1215, 1191, 433, 1103, 141, 593, 566, 688, 1150, 1215, 434, 434,
+    1201, 1200, 1151, 682, 298, 917, 679, 1090, 288, 764, 1211, 568, 568, 14, 587, 558, 9, 36, 646, 227,
+    210, 1132, 1102, 1257, 1141, 436, 679, 125, 1119, 1240, 1041, 1264, 774, 639, 587, 815, 140, 432, 922, 284,
+    1093, 1247, 1181, 709, 1282, 1064, 583, 0, 241, 1185, 1102, 587, 968, 587, 1108, 395, 1181, 671, 628, 1212,
+    593, 648, 63, 1102, 1088, 432, 1182, 1104, 1180, 6, 207, 218, 1114, 1202, 605, 594, 204, 434, 764, 1166,
+    23, 782, 1086, 0, 1105, 436, 626, 648, 646, 558, 568, 432, 6, 287, 204, 594, 587, 7, 292, 568,
+    37, 0, 386, 386, 67, 843, 843, 460, 1028, 1262, 460, 131, 846, 460, 460, 227, 460, 1028, 284, 284,
+    497, 651, 655, 655, 770, 1176, 1030, 424, 1176, 322, 234, 101, 441, 880, 220, 248, 1102, 880, 840, 457,
+    1149, 729, 22, 1183, 903, 683, 671, 1312, 198, 31, 1180, 1172, 1018, 1068, 438, 395, 768, 1167, 0, 1181,
+    438, 1018, 434, 1124, 8, 8, 388, 333, 0, 198, 831, 1040, 1079, 1188, 993, 1034, 834, 1148, 508, 47,
+    1005, 1252, 66, 536, 468, 541, 1126, 888, 32, 1180, 850, 850, 385, 1122, 679, 469, 441, 53, 219, 441,
+    0, 1017, 335, 1005, 41, 1124, 760, 322, 52, 536, 0, 598, 357, 832, 1149, 433, 441, 444, 112, 198,
+    432, 1113, 823, 246, 1074, 441, 545, 1086, 880, 301, 641, 474, 322, 1087, 834, 373, 116, 0, 888, 1155,
+    939, 1087, 322, 41, 1017, 335, 1213, 0, 52, 1087, 424, 246, 1074, 246, 1086, 880, 301, 373, 1087, 1213,
+    1017, 466, 466, 1111, 1126, 1111, 433, 1181, 1215, 1213, 933, 556, 779, 392, 1185, 1213, 779, 1181, 1181, 1117,
+    405, 1176, 236, 845, 529, 1118, 975, 372, 1141, 1178, 1144, 341, 983, 530, 816, 377, 1202, 1078, 29, 257,
+    220, 205, 762, 803, 588, 95, 459, 559, 385, 831, 265, 263, 1087, 452, 342, 942, 1178, 942, 369, 252,
+    786, 801, 560, 302, 438, 1048, 424, 529, 438, 556, 1042, 128, 1187, 479, 403, 375, 459, 1060, 1060, 798,
+    544, 1060, 1301, 1301, 161, 237, 544, 1162, 375, 441, 498, 188, 462, 839, 1178, 905, 1025, 263, 265, 1162,
+    426, 489, 1192, 1286, 1162, 1113, 1130, 1179, 1206, 913, 224, 224, 445, 512, 560, 577, 793, 1180, 629, 815,
+    875, 383, 832, 341, 1155, 823, 421, 1250, 891, 394, 63, 1113, 798, 603, 546, 721, 859, 1176, 236, 845,
+    372, 1118, 975, 1141, 1144, 1078, 341, 257, 816, 29, 983, 377, 1202, 603, 588, 805, 459, 452, 438, 1032,
+    375, 1187, 462, 369, 1178, 798, 424, 1060, 375, 1187, 1187, 498, 1025, 1192, 265, 1286, 1162, 263, 721, 629,
+    224, 913, 383, 560, 1250, 891, 798, 859, 292, 56, 0, 301, 1107, 1249, 56, 904, 21, 1007, 582, 342,
+    1148, 935, 471, 49, 978, 1087, 1166, 1170, 984, 486, 914, 277, 591, 1104, 577, 790, 790, 591, 56, 56,
+    57, 577, 0, 917, 292, 56, 292, 1166, 1249, 56, 904, 471, 978, 984, 1170, 591, 790, 56, 56, 284,
+    276, 284, 284, 949, 949, 84, 433, 237, 980, 1067, 1247, 997, 1117, 1064, 880, 1202, 474, 135, 1183, 279,
+    279, 997, 1183, 1282, 1178, 1245, 52, 453, 1017, 592, 171, 1039, 980, 37, 951, 261, 371, 880, 1030, 449,
+    438, 66, 1170, 1044, 171, 1117, 1167, 1167, 270, 1164, 557, 1177, 84, 68, 700, 265, 73, 481, 244, 989,
+    1200, 951, 1170, 426, 363, 951, 443, 1293, 66, 1114, 76, 1176, 1010, 286, 1251, 1088, 349, 265, 739, 426,
+    403, 418, 1039, 424, 441, 399, 385, 1132, 288, 1088, 340, 101, 983, 1014, 69, 318, 1106, 531, 593, 984,
+    1018, 1176, 1211, 669, 1014, 629, 52, 1202, 1138, 456, 910, 531, 1288, 928, 135, 207, 1180, 433, 873, 128,
+    1191, 1017, 424, 1117, 1247, 288, 371, 646, 1164, 669, 110, 1117, 614, 1315, 693, 949, 237, 433, 1067, 1132,
+    1064, 1106, 880, 1202, 135, 279, 1183, 443, 951, 37, 980, 261, 1178, 270, 873, 1117, 438, 557, 449, 1177,
+    66, 69, 244, 265, 1200, 700, 481, 363, 426, 1114, 349, 101, 531, 340, 984, 110, 1176, 669, 69, 593,
+    1138, 456, 629, 910, 1288, 693, 954, 529, 362, 1115, 289, 21, 710, 52, 69, 1052, 372, 284, 441, 8,
+    6, 303, 1111, 1089, 1127, 289, 63, 1131, 623, 1202, 293, 375, 222, 1068, 1067, 133, 1154, 1282, 1268, 774,
+    1130, 884, 904, 1183, 1090, 1269, 207, 617, 1196, 69, 37, 520, 1068, 1180, 854, 0, 854, 461, 70, 1254,
+    1203, 778, 1278, 471, 1282, 736, 468, 782, 1225, 440, 587, 1262, 1007, 303, 1167, 950, 52, 1068, 1068, 980,
+    591, 624, 787, 1018, 1271, 885, 1023, 241, 1154, 859, 940, 461, 270, 371, 69, 0, 1181, 616, 0, 207,
+    1126, 591, 469, 982, 839, 632, 573, 375, 1052, 1148, 1062, 481, 263, 130, 1131, 5, 605, 1291, 1275, 938,
+    787, 532, 1018, 542, 1304, 501, 816, 816, 1164, 284, 914, 1163, 452, 1171, 1102, 789, 174, 789, 824, 284,
+    418, 441, 432, 1202, 1025, 859, 1108, 1304, 529, 888, 978, 342, 1068, 531, 984, 823, 129, 1271, 591, 764,
+    1023, 1103, 93, 246, 1164, 1204, 1307, 914, 928, 566, 1271, 969, 605, 1104, 614, 1251, 671, 19, 84, 793,
+    174, 854, 52, 1271, 1202, 1141, 407, 68, 989, 1119, 583, 111, 255, 591, 1068, 1236, 1010, 447, 1038, 1164,
+    614, 1247, 458, 1180, 1176, 1067, 63, 1309, 1164, 779, 617, 1023, 1115, 436, 968, 469, 1103, 413, 566, 56,
+    623, 1202, 1068, 1154, 133, 854, 884, 69, 617, 1225, 950, 980, 303, 468, 1307, 1282, 1068, 736, 440, 1180,
+    1007, 1119, 624, 1181, 447, 407, 616, 371, 787, 56, 566, 130, 1164, 1127, 839, 481, 816, 816, 501, 1291,
+    1304, 989, 84, 789, 1271, 529, 914, 1102, 17, 591, 823, 928, 793, 614, 174, 111, 1309, 436, 968, 1115,
+    340, 1087, 1087, 1087, 1200, 314, 1180, 12, 1048, 1126, 35, 52, 132, 1026, 221, 512, 369, 831, 337, 517,
+    322, 1061, 330, 787, 52, 498, 484, 1200, 995, 598, 69, 1119, 764, 68, 170, 521, 64, 669, 577, 598,
+    695, 246, 1224, 995, 1026, 64, 521, 603, 318, 318, 834, 495, 831, 555, 1230, 56, 532, 532, 1027, 282,
+    1138, 868, 635, 207, 532, 64, 275, 1034, 782, 1301, 275, 868, 1027, 770, 782, 635, 301, 269, 885, 854,
+    0, 1138, 344, 436, 779, 1283, 932, 920, 1027, 568, 64, 1304, 1027, 779, 981, 1265, 859, 1304, 975, 441,
+    260, 403, 540, 464, 816, 570, 1263, 64, 779, 671, 909, 631, 629, 919, 1141, 582, 823, 823, 731, 414,
+    520, 724, 64, 582, 870, 244, 244, 697, 397, 1106, 244, 374, 244, 244, 464, 116, 1202, 1202, 568, 474,
+    302, 824, 354, 1304, 593, 354, 929, 1202, 356, 641, 436, 816, 454, 529, 426, 21, 806, 641, 1144, 1163,
+    1119, 574, 1202, 1060, 815, 1083, 574, 1088, 441, 132, 790, 52, 669, 435, 1141, 142, 1163, 1249, 1200, 211,
+    878, 436, 0, 332, 1068, 230, 435, 1144, 263, 265, 920, 377, 1064, 671, 454, 942, 278, 1204, 50, 604,
+    1090, 403, 603, 1215, 281, 289, 683, 1196, 0, 0, 385, 1108, 854, 372, 783, 587, 1068, 68, 851, 802,
+    301, 52, 436, 1088, 468, 228, 69, 1196, 359, 782, 712, 1131, 1007, 38, 303, 1241, 471, 338, 0, 0,
+    0, 1005, 452, 959, 401, 1117, 269, 11, 1086, 1033, 1279, 1184, 582, 616, 1044, 1178, 816, 67, 1087, 447,
+    76, 354, 1111, 322, 422, 0, 0, 496, 0, 259, 479, 1025, 654, 1119, 1216, 920, 839, 1200, 700, 1259,
+    359, 330, 0, 1100, 851, 1041, 302, 1079, 1034, 567, 920, 920, 320, 646, 0, 0, 0, 0, 1193, 709,
+    1301, 816, 843, 1117, 700, 165, 436, 228, 838, 341, 1277, 239, 542, 284, 709, 1180, 532, 605, 467, 113,
+    458, 610, 587, 1307, 566, 647, 1304, 1271, 712, 0, 0, 0, 948, 940, 427, 951, 399, 1131, 1279, 540,
+    1304, 436, 53, 53, 416, 859, 1231, 1085, 1085, 1200, 865, 888, 232, 418, 572, 1163, 851, 850, 443, 52,
+    265, 1166, 303, 905, 442, 1108, 1069, 403, 0, 901, 0, 1089, 441, 383, 1099, 281, 914, 591, 623, 949,
+    948, 348, 0, 1023, 1005, 1170, 322, 885, 824, 816, 1089, 901, 0, 570, 17, 556, 421, 663, 436, 1034,
+    854, 441, 914, 629, 1104, 851, 58, 433, 436, 1280, 444, 850, 1286, 1192, 1251, 491, 1151, 59, 476, 854,
+    1118, 68, 449, 1154, 989, 418, 1321, 928, 928, 276, 357, 583, 1154, 657, 1105, 0, 0, 291, 348, 401,
+    520, 1233, 914, 1247, 313, 357, 945, 567, 114, 0, 0, 0, 891, 436, 1144, 432, 0, 568, 582, 568,
+    661, 1262, 1117, 265, 603, 350, 566, 1111, 1200, 211, 435, 1196, 1064, 604, 281, 20, 385, 68, 802, 712,
+    603, 1196, 1241, 303, 69, 38, 401, 782, 1007, 354, 452, 496, 1087, 269, 1044, 1231, 401, 520, 436, 449,
+    1111, 1216, 1117, 1154, 330, 566, 570, 441, 567, 949, 1034, 359, 920, 1079, 479, 436, 1193, 843, 587, 816,
+    1307, 284, 532, 113, 341, 709, 712, 228, 458, 940, 948, 1301, 291, 232, 52, 114, 951, 1089, 1085, 905,
+    265, 850, 303, 418, 859, 444, 53, 914, 17, 816, 1005, 1182, 1170, 281, 441, 556, 58, 1151, 59, 629,
+    663, 1192, 1088, 1104, 476, 928, 583, 1321, 432, 313, 567, 1247, 349, 717, 1179, 301, 568, 464, 75, 1164,
+    301, 228, 433, 295, 0, 311, 948, 295, 664, 37, 1203, 1268, 405, 840, 300, 288, 1090, 441, 948, 1202,
+    298, 1169, 478, 476, 782, 413, 1264, 37, 1164, 1156, 1267, 280, 295, 1090, 748, 1021, 437, 736, 587, 661,
+    301, 1068, 1090, 568, 55, 1271, 321, 1203, 1301, 855, 1119, 132, 207, 468, 1198, 338, 1272, 1202, 1165, 887,
+    1156, 1038, 1202, 0, 1185, 1291, 1099, 269, 342, 7, 1268, 1164, 392, 447, 434, 582, 1279, 878, 1178, 395,
+    616, 891, 674, 321, 880, 447, 1138, 1275, 1268, 616, 0, 0, 0, 606, 438, 436, 1200, 413, 1069, 73,
+    1100, 472, 1202, 69, 1155, 1155, 52, 1103, 481, 469, 1052, 458, 1025, 263, 263, 525, 403, 1101, 940, 544,
+    0, 0, 605, 802, 956, 301, 8, 1257, 779, 840, 823, 39, 228, 605, 864, 441, 469, 1054, 1156, 1203,
+    816, 566, 1176, 1291, 506, 1293, 532, 944, 816, 458, 1180, 1180, 458, 1301, 542, 239, 815, 165, 329, 468,
+    854, 0, 0, 433, 959, 0, 135, 657, 888, 8, 850, 1025, 403, 1025, 265, 451, 635, 301, 164, 1052,
+    1163, 385, 1204, 786, 1213, 639, 403, 1185, 257, 1102, 469, 0, 88, 282, 341, 1185, 1204, 1145, 1093, 948,
+    386, 145, 1014, 1110, 901, 591, 434, 339, 441, 1295, 375, 1301, 1301, 711, 1172, 1164, 433, 568, 1029, 511,
+    1024, 1024, 711, 1052, 623, 447, 318, 1029, 125, 568, 1286, 1261, 17, 1171, 1177, 748, 135, 1271, 577, 885,
+    598, 52, 968, 1298, 1200, 1100, 476, 1182, 859, 978, 447, 1180, 406, 52, 1185, 989, 418, 277, 447, 577,
+    1164, 495, 467, 1112, 1112, 1052, 627, 1319, 1202, 1185, 605, 1056, 1112, 1150, 1180, 785, 957, 614, 815, 1178,
+    434, 1259, 1200, 1247, 1176, 1166, 785, 724, 432, 650, 1185, 646, 220, 1209, 1200, 559, 38, 603, 386, 594,
+    968, 1209, 1185, 350, 855, 566, 606, 717, 464, 433, 1203, 664, 948, 748, 1156, 88, 37, 1264, 338, 239,
+    603, 1156, 1119, 1165, 587, 1268, 855, 1203, 1150, 1068, 978, 1271, 269, 342, 1138, 392, 1275, 321, 606, 395,
+    1100, 69, 566, 472, 403, 263, 1202, 1112, 1025, 1101, 864, 657, 8, 532, 39, 779, 823, 165, 329, 1203,
+    989, 403, 385, 265, 339, 850, 1301, 639, 679, 711, 1172, 1093, 591, 434, 711, 441, 386, 1177, 1185, 1261,
+    577, 577, 447, 467, 1202, 605, 1146, 1247, 1185, 432, 646, 350, 968, 604, 455, 587, 442, 1112, 194, 442,
+    442, 1162, 194, 605, 1195, 179, 435, 56, 179, 56, 1282, 479, 1281, 441, 650, 650, 1100, 591, 125, 479,
+    583, 709, 816, 605, 467, 479, 458, 568, 1115, 1162, 437, 650, 568, 939, 1251, 583, 458, 433, 587, 1162,
+    179, 628, 628, 321, 119, 300, 654, 654, 300, 770, 857, 855, 674, 300, 1114, 542, 855, 655, 0, 292,
+    300, 855, 655, 622, 638, 672, 421, 0, 1307, 702, 289, 418, 418, 455, 351, 1028, 1049, 392, 1103, 526,
+    392, 958, 566, 712, 132, 387, 387, 1180, 824, 205, 1106, 1057, 671, 671, 824, 204, 147, 1197, 226, 1177,
+    1108, 1163, 854, 640, 1163, 844, 1202, 566, 209, 246, 86, 1181, 11, 1161, 1011, 11, 1263, 204, 86, 1177,
+    639, 206, 1163, 246, 603, 1270, 290, 301, 302, 663, 663, 1204, 181, 857, 118, 1071, 1279, 1268, 632, 17,
+    59, 1068, 52, 1204, 118, 1068, 236, 652, 686, 236, 1301, 340, 340, 239, 289, 1018, 1203, 783, 113, 318,
+    818, 1203, 1013, 1022, 958, 958, 289, 287, 1090, 21, 228, 1068, 1044, 855, 944, 949, 1198, 949, 1041, 1100,
+    714, 458, 426, 469, 1163, 1052, 1025, 1103, 1113, 1163, 558, 50, 1171, 851, 372, 1099, 1102, 398, 1106, 322,
+    1239, 1140, 1095, 1239, 731, 694, 816, 1243, 436, 1301, 433, 433, 816, 433, 134, 127, 127, 385, 1157, 502,
+    1126, 768, 196, 951, 1301, 132, 714, 470, 1034, 587, 587, 144, 859, 1126, 502, 721, 467, 1171, 169, 533,
+    1201, 146, 1179, 709, 196, 1307, 856, 703, 1113, 749, 265, 1098, 1180, 167, 1307, 224, 146, 457, 1159, 134,
+    127, 385, 502, 470, 587, 768, 1034, 1301, 502, 1201, 169, 856, 1098, 594, 764, 332, 764, 1163, 594, 594,
+    332, 488, 1005, 587, 1005, 594, 332, 488, 354, 850, 59, 354, 1209, 163, 385, 476, 1124, 1202, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 540, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1102, 432, 0, 0, 1273, 0, 844, 0, 0, 1103, 1279, 1180, 567, 941, 1116, 301, 460, 458, 1201, 0,
+    0, 0, 1279, 0, 0, 1180, 245, 0, 0, 0, 279, 980, 349, 386,
+};
+
+} // namespace Table
+} // namespace Pinyin
+
+#endif // PINYIN_TABLE_H
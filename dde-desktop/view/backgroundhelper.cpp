@@ -26,6 +26,14 @@
 #include <QBackingStore>
 #include <QPainter>
 #include <QPaintEvent>
+#include <QImageReader>
+#include <QFileInfo>
+#include <QDir>
+#include <QCryptographicHash>
+#include <QStandardPaths>
+#include <QFutureWatcher>
+#include <QSaveFile>
+#include <QtConcurrent>
 #include <qpa/qplatformwindow.h>
 #include <qpa/qplatformscreen.h>
 #include <qpa/qplatformbackingstore.h>
@@ -33,6 +41,8 @@
 #include <private/qhighdpiscaling_p.h>
 #undef private
 
+#include <utime.h>
+
 class BackgroundLabel : public QWidget
 {
 public:
@@ -75,11 +85,104 @@ public:
         QWidget::setVisible(visible);
     }
 
+    // 当前需要显示的壁纸
+    QString wallpaperKey;
+
 private:
     QPixmap m_pixmap;
     QPixmap m_noScalePixmap;
 };
 
+// 磁盘缓存中最多保留的壁纸数量
+static const int MAX_DISK_CACHE_COUNT = 16;
+
+static QString wallpaperCacheKey(const QString &path, const QSize &size, qreal devicePixelRatio)
+{
+    const QFileInfo info(path);
+
+    // 壁纸文件被替换后需要重新缩放
+    return QString("%1|%2|%3|%4x%5@%6").arg(path)
+                                      .arg(info.lastModified().toMSecsSinceEpoch())
+                                      .arg(info.size())
+                                      .arg(size.width())
+                                      .arg(size.height())
+                                      .arg(devicePixelRatio);
+}
+
+static QString wallpaperCacheDir()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)
+            + "/" + qApp->organizationName() + "/" + qApp->applicationName() + "/wallpapers";
+}
+
+static QString wallpaperCacheFile(const QString &dir, const QString &key)
+{
+    return dir + "/" + QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Md5).toHex() + ".png";
+}
+
+// 按修改时间删除最久未使用的缓存，命中缓存时会更新文件的修改时间
+static void pruneWallpaperCache(const QString &dir)
+{
+    const QFileInfoList files = QDir(dir).entryInfoList({"*.png"}, QDir::Files, QDir::Time);
+
+    for (int i = MAX_DISK_CACHE_COUNT; i < files.size(); ++i) {
+        QFile::remove(files.at(i).absoluteFilePath());
+    }
+}
+
+// 在工作线程中执行，按屏幕大小解码壁纸并居中裁剪
+static QImage scaleWallpaper(const QString &path, const QSize &trueSize, const QString &cacheDir, const QString &key)
+{
+    const QString cacheFile = wallpaperCacheFile(cacheDir, key);
+    QImage image;
+
+    if (image.load(cacheFile) && image.size() == trueSize) {
+        utime(QFile::encodeName(cacheFile).constData(), nullptr);
+
+        return image;
+    }
+
+    QImageReader reader(path);
+    const QSize sourceSize = reader.size();
+
+    // 只在缩小时让解码器直接输出目标大小，避免先解码出原图再缩放
+    if (sourceSize.isValid()) {
+        const QSize scaledSize = sourceSize.scaled(trueSize, Qt::KeepAspectRatioByExpanding);
+
+        if (scaledSize.width() < sourceSize.width()) {
+            reader.setScaledSize(scaledSize);
+        }
+    }
+
+    if (!reader.read(&image)) {
+        qWarning() << "failed to read wallpaper:" << path << reader.errorString();
+        return QImage();
+    }
+
+    if (image.width() < trueSize.width() || image.height() < trueSize.height()) {
+        image = image.scaled(trueSize,
+                             Qt::KeepAspectRatioByExpanding,
+                             Qt::SmoothTransformation);
+    }
+
+    if (image.width() > trueSize.width() || image.height() > trueSize.height()) {
+        image = image.copy(QRect((image.width() - trueSize.width()) / 2.0,
+                                 (image.height() - trueSize.height()) / 2.0,
+                                 trueSize.width(),
+                                 trueSize.height()));
+    }
+
+    // 桌面和壁纸预览会同时读写此目录，写完后再替换，避免读到不完整的文件
+    QSaveFile file(cacheFile);
+
+    if (QDir().mkpath(cacheDir) && file.open(QIODevice::WriteOnly)
+            && image.save(&file, "png", 50) && file.commit()) {
+        pruneWallpaperCache(cacheDir);
+    }
+
+    return image;
+}
+
 BackgroundHelper *BackgroundHelper::desktop_instance = nullptr;
 
 BackgroundHelper::BackgroundHelper(bool preview, QObject *parent)
@@ -95,6 +198,9 @@ BackgroundHelper::BackgroundHelper(bool preview, QObject *parent)
         desktop_instance = this;
     }
 
+    // 以KB为单位，约可容纳4张4K分辨率的壁纸
+    wallpaperCache.setMaxCost(128 * 1024);
+
     checkTimer = new QTimer(this);
     checkTimer->setInterval(2000);
     checkTimer->setSingleShot(true);
@@ -143,7 +249,6 @@ void BackgroundHelper::setBackground(const QString &path)
 {
     qInfo() << "path:" << path;
     currentWallpaper = path.startsWith("file:") ? QUrl(path).toLocalFile() : path;
-    backgroundPixmap = QPixmap(currentWallpaper);
 
     // 更新背景图
     for (BackgroundLabel *l : backgroundMap) {
@@ -223,7 +328,7 @@ void BackgroundHelper::onWMChanged()
 
         currentWallpaper.clear();
         currentWorkspaceIndex = 0;
-        backgroundPixmap = QPixmap();
+        wallpaperCache.clear();
 
         disconnect(qApp, &QGuiApplication::screenAdded, this, &BackgroundHelper::onScreenAdded);
         disconnect(qApp, &QGuiApplication::screenRemoved, this, &BackgroundHelper::onScreenRemoved);
@@ -239,30 +344,67 @@ void BackgroundHelper::onWMChanged()
 
 void BackgroundHelper::updateBackground(QWidget *l)
 {
-    if (backgroundPixmap.isNull())
+    if (currentWallpaper.isEmpty())
         return;
 
     QScreen *s = l->windowHandle()->screen();
     l->windowHandle()->handle()->setGeometry(s->handle()->geometry());
 
     const QSize trueSize = s->handle()->geometry().size();
-    QPixmap pix = backgroundPixmap;
+    BackgroundLabel *label = dynamic_cast<BackgroundLabel*>(l);
+    const QString key = wallpaperCacheKey(currentWallpaper, trueSize, l->devicePixelRatioF());
+
+    label->wallpaperKey = key;
+
+    if (QPixmap *pix = wallpaperCache.object(key)) {
+        applyWallpaper(label, *pix);
+        return;
+    }
+
+    // 相同壁纸、相同大小的屏幕共用一次缩放
+    if (scalingWallpapers.contains(key))
+        return;
+
+    scalingWallpapers << key;
 
-    pix = pix.scaled(trueSize,
-                     Qt::KeepAspectRatioByExpanding,
-                     Qt::SmoothTransformation);
+    QFutureWatcher<QImage> *watcher = new QFutureWatcher<QImage>(this);
 
-    if (pix.width() > trueSize.width() || pix.height() > trueSize.height()) {
-        pix = pix.copy(QRect((pix.width() - trueSize.width()) / 2.0,
-                             (pix.height() - trueSize.height()) / 2.0,
-                             trueSize.width(),
-                             trueSize.height()));
+    connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, key] {
+        onWallpaperScaled(key, watcher->result());
+        watcher->deleteLater();
+    });
+
+    watcher->setFuture(QtConcurrent::run(scaleWallpaper, currentWallpaper, trueSize, wallpaperCacheDir(), key));
+}
+
+void BackgroundHelper::onWallpaperScaled(const QString &key, const QImage &image)
+{
+    scalingWallpapers.remove(key);
+
+    if (image.isNull())
+        return;
+
+    QPixmap *pix = new QPixmap(QPixmap::fromImage(image));
+    const QPixmap result = *pix;
+
+    wallpaperCache.insert(key, pix, image.bytesPerLine() * image.height() / 1024);
+
+    // 缩放期间壁纸或屏幕可能已经改变，只更新仍然需要此壁纸的窗口
+    for (BackgroundLabel *l : backgroundMap) {
+        if (l->wallpaperKey == key) {
+            applyWallpaper(l, result);
+        }
     }
+}
+
+void BackgroundHelper::applyWallpaper(BackgroundLabel *l, const QPixmap &pix)
+{
+    QPixmap pixmap = pix;
 
-    pix.setDevicePixelRatio(l->devicePixelRatioF());
-    dynamic_cast<BackgroundLabel*>(l)->setPixmap(pix);
+    pixmap.setDevicePixelRatio(l->devicePixelRatioF());
+    l->setPixmap(pixmap);
 
-    qInfo() << l->windowHandle()->screen() << currentWallpaper << pix;
+    qInfo() << l->windowHandle()->screen() << currentWallpaper << pixmap;
 
     if (checkTimer) {
         checkTimer->start();
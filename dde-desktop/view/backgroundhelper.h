@@ -22,6 +22,8 @@
 #define BACKGROUNDHELPER_H
 
 #include <QLabel>
+#include <QCache>
+#include <QSet>
 
 #include <com_deepin_wm.h>
 #include <DWindowManagerHelper>
@@ -66,6 +68,8 @@ private:
     void onWMChanged();
     void updateBackground(QWidget *l);
     void updateBackground();
+    void onWallpaperScaled(const QString &key, const QImage &image);
+    void applyWallpaper(BackgroundLabel *l, const QPixmap &pix);
     void onScreenAdded(QScreen *screen);
     void onScreenRemoved(QScreen *screen);
     void updateBackgroundGeometry(QScreen *screen, BackgroundLabel * l);
@@ -80,7 +84,9 @@ private:
     QTimer *checkTimer = nullptr;
     int currentWorkspaceIndex = 0;
     QString currentWallpaper;
-    QPixmap backgroundPixmap;
+    // 缩放后的壁纸，key 为 wallpaperCacheKey 的返回值
+    QCache<QString, QPixmap> wallpaperCache;
+    QSet<QString> scalingWallpapers;
     QMap<QScreen*, BackgroundLabel*> backgroundMap;
     static BackgroundHelper *desktop_instance;
 
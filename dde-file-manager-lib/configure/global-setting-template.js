@@ -171,6 +171,18 @@
                             "text": qsTranslate("GenerateSettingTranslate", "Index external storage device after connected to computer"),
                             "type": "checkbox",
                             "default": false
+                    },
+                    {
+                            "key": "index_full_text",
+                            "text": qsTranslate("GenerateSettingTranslate", "Full-Text search"),
+                            "type": "checkbox",
+                            "default": false
+                    },
+                    {
+                            "key": "index_file_name",
+                            "text": qsTranslate("GenerateSettingTranslate", "Index file names when deepin-anything is unavailable"),
+                            "type": "checkbox",
+                            "default": false
                     }
                     ]
                 },
@@ -263,6 +275,12 @@
                             "type": "checkbox",
                             "default": false
                         },
+                        {
+                            "key": "async_integrity_checking",
+                            "text": qsTranslate("GenerateSettingTranslate", "Verify copied files in the background"),
+                            "type": "checkbox",
+                            "default": false
+                        },
                         {
                             "key": "show_crumbbar_clickable_area",
                             "text": "Show crumb bar clickable area",
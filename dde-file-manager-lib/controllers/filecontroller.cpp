@@ -523,6 +523,10 @@ static DUrlList pasteFilesV2(DFMGlobal::ClipboardAction action, const DUrlList &
     if (action == DFMGlobal::CutAction && !target.isValid()) {
         // for remove mode
         job->setActionOfErrorType(DFileCopyMoveJob::NonexistenceError, DFileCopyMoveJob::SkipAction);
+    } else if (DFMApplication::genericAttribute(DFMApplication::GA_AsyncIntegrityChecking).toBool()) {
+        // 后台校验时优先使用可由 CPU 指令加速的 crc32c
+        job->setFileHints(job->fileHints() | DFileCopyMoveJob::AsyncIntegrityChecking);
+        job->setChecksumType(DFileCopyMoveJob::Crc32cChecksum);
     }
 
     if (QThread::currentThread()->loopLevel() <= 0) {
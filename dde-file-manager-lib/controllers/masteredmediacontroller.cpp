@@ -130,7 +130,11 @@ class MasteredMediaFileWatcherPrivate : public DAbstractFileWatcherPrivate
 {
 public:
     MasteredMediaFileWatcherPrivate(MasteredMediaFileWatcher *qq)
-        : DAbstractFileWatcherPrivate(qq) {}
+        : DAbstractFileWatcherPrivate(qq)
+    {
+        // 按光盘设备匹配信号，与路径无关
+        ghostSignalMatchPath = false;
+    }
 
     bool start() override;
     bool stop() override;
@@ -29,6 +29,7 @@
 #include <QDomDocument>
 #include <QtConcurrent>
 #include <QQueue>
+#include <QSet>
 #include <QTimer>
 #include <QDebug>
 
@@ -387,11 +388,19 @@ DUrlList RecentController::realUrlList(const DUrlList &recentUrls)
     return list;
 }
 
+static bool recentFileExists(const DUrl &url)
+{
+    const QFileInfo info(url.path());
+
+    return info.exists() && info.isFile();
+}
+
 void RecentController::handleFileChanged()
 {
     // read xbel file.
     QFile file(m_xbelPath);
-    QList<DUrl> urlList;
+    // recent url -> 最后访问的时间
+    QHash<DUrl, QString> bookmarks;
 
     // try interrupting any other running parsers, then acquire the lock
     m_condition.wakeAll();
@@ -420,48 +429,78 @@ void RecentController::handleFileChanged()
             const QStringRef &location = reader.attributes().value("href");
 
             if (!location.isEmpty()) {
-                DUrl url = DUrl(location.toString());
-                QFileInfo info(url.toLocalFile());
-                DUrl recentUrl = url;
+                DUrl recentUrl = DUrl(location.toString());
                 recentUrl.setScheme(RECENT_SCHEME);
 
-                if (info.exists() && info.isFile()) {
-                    urlList << recentUrl;
-
-                    DThreadUtil::runInMainThread([=]() {
-                        if (!recentNodes.contains(recentUrl)) {
-                            RecentFileInfo *fileInfo = new RecentFileInfo(recentUrl);
-                            recentNodes[recentUrl] = fileInfo;
-
-                            DAbstractFileWatcher::ghostSignal(DUrl(RECENT_ROOT),
-                                                              &DAbstractFileWatcher::subfileCreated,
-                                                              recentUrl);
-                        }
-                    });
+                // 与 RecentFileInfo::updateInfo 一致，同一文件以第一个记录为准
+                if (!bookmarks.contains(recentUrl)) {
+                    bookmarks.insert(recentUrl, reader.attributes().value("modified").toString());
                 }
             }
         }
     }
 
-    // delete does not exist url.
-    for (auto iter = recentNodes.begin(); iter != recentNodes.end(); ) {
-        DUrl url = iter.key();
+    // 访问时间未变化的文件也可能已被删除或移动，所有记录都要重新检查，在此线程中并行完成
+    const QSet<DUrl> existingUrls = QtConcurrent::blockingFiltered(bookmarks.keys(), recentFileExists).toSet();
+    QHash<DUrl, Bookmark> newBookmarks;
+    QMap<DUrl, RecentPointer> createdNodes;
+    QHash<DUrl, QString> updatedUrls;
+    DUrlList deletedUrls;
+
+    newBookmarks.reserve(bookmarks.size());
+
+    for (auto it = bookmarks.constBegin(); it != bookmarks.constEnd(); ++it) {
+        auto old = m_bookmarks.constFind(it.key());
+        const bool oldExists = old != m_bookmarks.constEnd() && old->exists;
+        Bookmark bookmark;
+
+        bookmark.readTime = it.value();
+        bookmark.exists = existingUrls.contains(it.key());
+        newBookmarks.insert(it.key(), bookmark);
+
+        if (bookmark.exists && !oldExists) {
+            createdNodes.insert(it.key(), RecentPointer(new RecentFileInfo(it.key(), bookmark.readTime)));
+        } else if (!bookmark.exists && oldExists) {
+            deletedUrls << it.key();
+        } else if (bookmark.exists && old->readTime != bookmark.readTime) {
+            updatedUrls.insert(it.key(), bookmark.readTime);
+        }
+    }
 
-        if (!urlList.contains(url)) {
-            DThreadUtil::runInMainThread([this, &iter, url]() {
-                iter = recentNodes.erase(iter);
+    for (auto it = m_bookmarks.constBegin(); it != m_bookmarks.constEnd(); ++it) {
+        if (it->exists && !bookmarks.contains(it.key())) {
+            deletedUrls << it.key();
+        }
+    }
 
-                DAbstractFileWatcher::ghostSignal(DUrl(RECENT_ROOT),
-                                                  &DAbstractFileWatcher::fileDeleted,
-                                                  url);
-            });
-        } else {
-            iter.value()->updateInfo();
+    m_bookmarks = newBookmarks;
 
-            ++iter;
-        }
+    if (createdNodes.isEmpty() && deletedUrls.isEmpty() && updatedUrls.isEmpty()) {
+        m_xbelFileLock.unlock();
+        return;
     }
 
+    // 在主线程中一次完成节点的增删，并批量发送信号
+    DThreadUtil::runInMainThread([this, &createdNodes, &deletedUrls, &updatedUrls]() {
+        for (auto it = createdNodes.constBegin(); it != createdNodes.constEnd(); ++it) {
+            recentNodes.insert(it.key(), it.value());
+        }
+
+        for (const DUrl &url : deletedUrls) {
+            recentNodes.remove(url);
+        }
+
+        for (auto it = updatedUrls.constBegin(); it != updatedUrls.constEnd(); ++it) {
+            if (const RecentPointer &node = recentNodes.value(it.key())) {
+                node->setReadDateTime(it.value());
+            }
+        }
+
+        DAbstractFileWatcher::ghostSignal(DUrl(RECENT_ROOT), &DAbstractFileWatcher::subfileCreated, createdNodes.keys());
+        DAbstractFileWatcher::ghostSignal(DUrl(RECENT_ROOT), &DAbstractFileWatcher::fileDeleted, deletedUrls);
+        DAbstractFileWatcher::ghostSignal(DUrl(RECENT_ROOT), &DAbstractFileWatcher::fileAttributeChanged, updatedUrls.keys());
+    });
+
     m_xbelFileLock.unlock();
 }
 
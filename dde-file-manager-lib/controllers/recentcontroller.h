@@ -24,6 +24,7 @@
 #include "models/recentfileinfo.h"
 
 #include <QWaitCondition>
+#include <QHash>
 #include <QMutex>
 
 class QFileSystemWatcher;
@@ -70,6 +71,14 @@ private:
     DFileWatcher *m_watcher;
     QWaitCondition m_condition;
     QMutex m_xbelFileLock;
+
+    struct Bookmark {
+        QString readTime;
+        bool exists = false;
+    };
+
+    // 上次解析 recently-used.xbel 的结果，用于计算变化的记录，只在持有 m_xbelFileLock 时访问
+    QHash<DUrl, Bookmark> m_bookmarks;
 };
 
 #endif // RECENTCONTROLLER_H
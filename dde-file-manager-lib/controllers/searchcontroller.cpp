@@ -31,9 +31,13 @@
 #include "models/searchfileinfo.h"
 #include "ddiriterator.h"
 #include "shutil/dfmregularexpression.h"
+#include "dfulltextindex.h"
+#include "dfilenameindex.h"
 
 #include "app/define.h"
 #include "app/filesignalmanager.h"
+#include "controllers/pathmanager.h"
+#include "singleton.h"
 
 #ifndef DISABLE_QUICK_SEARCH
 #include "anything_interface.h"
@@ -44,6 +48,18 @@
 #include <QDebug>
 #include <QRegularExpression>
 #include <QQueue>
+#include <QSet>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
 
 class SearchFileWatcherPrivate;
 class SearchFileWatcher : public DAbstractFileWatcher
@@ -229,6 +245,375 @@ bool SearchFileWatcherPrivate::stop()
     return ok;
 }
 
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+// 在本地目录中并行搜索文件名，直接使用系统调用遍历目录，不为每个文件创建 DAbstractFileInfo
+class LocalSearchEngine
+{
+public:
+    LocalSearchEngine(const QString &keyword, QDir::Filters filter, const QStringList &quickSearchDirectories);
+    ~LocalSearchEngine();
+
+    void start(const QByteArray &path);
+    void stop();
+
+    // 等待并取出一批结果，uncertainResults 中的文件需要再比较显示名称，搜索结束后返回false
+    bool takeResults(QList<QByteArray> *results, QList<QByteArray> *uncertainResults);
+    // 支持快速搜索的目录不在此处遍历
+    QList<QByteArray> delegatedDirectories() const;
+
+private:
+    enum MatchMode {
+        ContainsMatch,
+        PrefixMatch,
+        SuffixMatch,
+        RegularExpressionMatch
+    };
+
+    bool match(const char *name, int length) const;
+    void worker();
+    void processDirectory(const QByteArray &path, char *buffer, int bufferSize);
+    void flushResults(QList<QByteArray> &results, QList<QByteArray> &uncertainResults);
+
+    MatchMode matchMode;
+    QString pattern;
+    // 关键字只包含ascii字符时直接比较文件名的字节
+    QByteArray asciiPattern;
+    QRegularExpression regex;
+    QDir::Filters filter;
+    QSet<QByteArray> quickSearchDirectories;
+    QSet<QByteArray> systemPaths;
+
+    QThreadPool pool;
+    mutable QMutex mutex;
+    QWaitCondition directoryCondition;
+    QWaitCondition resultCondition;
+    QQueue<QByteArray> directoryQueue;
+    QList<QByteArray> resultList;
+    QList<QByteArray> uncertainResultList;
+    QList<QByteArray> delegatedDirectoryList;
+    QSet<QPair<quint64, quint64>> visitedDirectories;
+    int busyWorkers = 0;
+    QAtomicInt stopped;
+};
+
+LocalSearchEngine::LocalSearchEngine(const QString &keyword, QDir::Filters filter, const QStringList &quickSearchDirectories)
+    : filter(filter)
+{
+    static const QRegularExpression wildcard("[*?\\[]");
+
+    // 未指定文件类型时和 QDirIterator 一样不过滤
+    if (!(filter & (QDir::Dirs | QDir::Files)))
+        this->filter |= QDir::Dirs | QDir::Files;
+
+    const int wildcard_index = keyword.indexOf(wildcard);
+
+    // 不包含通配符，或只在首尾包含 * 时不需要使用正则表达式
+    if (wildcard_index < 0) {
+        matchMode = ContainsMatch;
+        pattern = keyword;
+    } else if (wildcard_index == keyword.size() - 1 && keyword.endsWith('*')) {
+        matchMode = PrefixMatch;
+        pattern = keyword.left(keyword.size() - 1);
+    } else if (wildcard_index == 0 && keyword.startsWith('*') && keyword.mid(1).indexOf(wildcard) < 0) {
+        matchMode = SuffixMatch;
+        pattern = keyword.mid(1);
+    } else {
+        matchMode = RegularExpressionMatch;
+        regex = QRegularExpression(DFMRegularExpression::checkWildcardAndToRegularExpression(keyword),
+                                   QRegularExpression::CaseInsensitiveOption);
+        regex.optimize();
+    }
+
+    bool is_ascii = true;
+
+    for (const QChar &ch : pattern) {
+        if (ch.unicode() >= 0x80) {
+            is_ascii = false;
+            break;
+        }
+    }
+
+    if (is_ascii && matchMode != RegularExpressionMatch)
+        asciiPattern = pattern.toLatin1().toLower();
+
+    for (const QString &path : quickSearchDirectories) {
+        // "/" 只是在未获取到结果前的占位
+        if (path != "/")
+            this->quickSearchDirectories << path.toLocal8Bit();
+    }
+
+    // 这些目录的显示名称和文件名不同
+    for (const QString &path : systemPathManager->systemPathsMap().values())
+        systemPaths << path.toLocal8Bit();
+}
+
+LocalSearchEngine::~LocalSearchEngine()
+{
+    stop();
+    pool.waitForDone();
+}
+
+void LocalSearchEngine::start(const QByteArray &path)
+{
+    directoryQueue << path;
+
+    // 目录遍历主要是在等待io，线程数可以适当多于cpu数
+    const int worker_count = qBound(1, QThread::idealThreadCount(), 4);
+
+    pool.setMaxThreadCount(worker_count);
+
+    for (int i = 0; i < worker_count; ++i) {
+        QtConcurrent::run(&pool, [this] {
+            worker();
+        });
+    }
+}
+
+void LocalSearchEngine::stop()
+{
+    stopped.storeRelease(1);
+
+    QMutexLocker locker(&mutex);
+    directoryCondition.wakeAll();
+    resultCondition.wakeAll();
+}
+
+bool LocalSearchEngine::takeResults(QList<QByteArray> *results, QList<QByteArray> *uncertainResults)
+{
+    QMutexLocker locker(&mutex);
+
+    while (resultList.isEmpty() && uncertainResultList.isEmpty() && !stopped.loadAcquire()
+           && (busyWorkers > 0 || !directoryQueue.isEmpty())) {
+        resultCondition.wait(&mutex);
+    }
+
+    if (stopped.loadAcquire())
+        return false;
+
+    results->swap(resultList);
+    uncertainResults->swap(uncertainResultList);
+
+    return !results->isEmpty() || !uncertainResults->isEmpty();
+}
+
+QList<QByteArray> LocalSearchEngine::delegatedDirectories() const
+{
+    QMutexLocker locker(&mutex);
+
+    return delegatedDirectoryList;
+}
+
+bool LocalSearchEngine::match(const char *name, int length) const
+{
+    if (!asciiPattern.isNull()) {
+        const int pattern_length = asciiPattern.size();
+
+        if (length < pattern_length)
+            return false;
+
+        char lower_name[NAME_MAX + 1];
+
+        for (int i = 0; i < length; ++i) {
+            lower_name[i] = (name[i] >= 'A' && name[i] <= 'Z') ? name[i] - 'A' + 'a' : name[i];
+        }
+
+        switch (matchMode) {
+        case ContainsMatch:
+            return memmem(lower_name, length, asciiPattern.constData(), pattern_length) != nullptr;
+        case PrefixMatch:
+            return memcmp(lower_name, asciiPattern.constData(), pattern_length) == 0;
+        case SuffixMatch:
+            return memcmp(lower_name + length - pattern_length, asciiPattern.constData(), pattern_length) == 0;
+        default:
+            break;
+        }
+    }
+
+    const QString &file_name = QString::fromLocal8Bit(name, length);
+
+    switch (matchMode) {
+    case ContainsMatch:
+        return file_name.contains(pattern, Qt::CaseInsensitive);
+    case PrefixMatch:
+        return file_name.startsWith(pattern, Qt::CaseInsensitive);
+    case SuffixMatch:
+        return file_name.endsWith(pattern, Qt::CaseInsensitive);
+    case RegularExpressionMatch:
+        return regex.match(file_name).hasMatch();
+    }
+
+    return false;
+}
+
+void LocalSearchEngine::worker()
+{
+    const int buffer_size = 32 * 1024;
+    QByteArray buffer(buffer_size, Qt::Uninitialized);
+
+    Q_FOREVER {
+        mutex.lock();
+
+        while (directoryQueue.isEmpty() && busyWorkers > 0 && !stopped.loadAcquire()) {
+            directoryCondition.wait(&mutex);
+        }
+
+        if (stopped.loadAcquire() || directoryQueue.isEmpty()) {
+            // 通知等待结果的线程搜索已结束
+            resultCondition.wakeAll();
+            mutex.unlock();
+
+            return;
+        }
+
+        const QByteArray path = directoryQueue.dequeue();
+
+        ++busyWorkers;
+        mutex.unlock();
+
+        processDirectory(path, buffer.data(), buffer_size);
+
+        mutex.lock();
+        --busyWorkers;
+
+        if (busyWorkers == 0 && directoryQueue.isEmpty()) {
+            directoryCondition.wakeAll();
+            resultCondition.wakeAll();
+        }
+
+        mutex.unlock();
+    }
+}
+
+void LocalSearchEngine::processDirectory(const QByteArray &path, char *buffer, int bufferSize)
+{
+    int fd = ::open(path.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (fd < 0)
+        return;
+
+    struct stat directory_st;
+
+    if (fstat(fd, &directory_st) != 0) {
+        ::close(fd);
+
+        return;
+    }
+
+    {
+        QMutexLocker locker(&mutex);
+
+        // 避免绑定挂载等情况下重复搜索同一目录
+        const QPair<quint64, quint64> key(directory_st.st_dev, directory_st.st_ino);
+
+        if (visitedDirectories.contains(key)) {
+            ::close(fd);
+
+            return;
+        }
+
+        visitedDirectories << key;
+    }
+
+    const QByteArray prefix = path.endsWith('/') ? path : path + '/';
+    QList<QByteArray> results;
+    QList<QByteArray> uncertain_results;
+    QList<QByteArray> directories;
+
+    Q_FOREVER {
+        long size = syscall(SYS_getdents64, fd, buffer, bufferSize);
+
+        if (size <= 0)
+            break;
+
+        for (long offset = 0; offset < size;) {
+            const linux_dirent64 *entry = reinterpret_cast<const linux_dirent64 *>(buffer + offset);
+            const char *name = entry->d_name;
+
+            offset += entry->d_reclen;
+
+            if (name[0] == '.') {
+                if (name[1] == 0 || (name[1] == '.' && name[2] == 0))
+                    continue;
+
+                if (!filter.testFlag(QDir::Hidden))
+                    continue;
+            }
+
+            bool is_dir = entry->d_type == DT_DIR;
+
+            if (entry->d_type == DT_UNKNOWN) {
+                struct stat st;
+
+                is_dir = fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(st.st_mode);
+            }
+
+            if (is_dir ? !filter.testFlag(QDir::Dirs) : !filter.testFlag(QDir::Files))
+                continue;
+
+            const int length = static_cast<int>(strlen(name));
+            const QByteArray file_path = prefix + QByteArray::fromRawData(name, length);
+
+            if (is_dir) {
+                if (quickSearchDirectories.contains(file_path)) {
+                    QMutexLocker locker(&mutex);
+                    delegatedDirectoryList << file_path;
+                } else {
+                    directories << file_path;
+                }
+            }
+
+            if ((is_dir && systemPaths.contains(file_path))
+                    || (length > 8 && strcmp(name + length - 8, ".desktop") == 0)) {
+                uncertain_results << file_path;
+            } else if (match(name, length)) {
+                results << file_path;
+            }
+
+            if (results.size() >= 64)
+                flushResults(results, uncertain_results);
+        }
+
+        if (stopped.loadAcquire())
+            break;
+    }
+
+    ::close(fd);
+
+    QMutexLocker locker(&mutex);
+
+    directoryQueue.append(directories);
+
+    if (!directories.isEmpty())
+        directoryCondition.wakeAll();
+
+    locker.unlock();
+
+    flushResults(results, uncertain_results);
+}
+
+void LocalSearchEngine::flushResults(QList<QByteArray> &results, QList<QByteArray> &uncertainResults)
+{
+    if (results.isEmpty() && uncertainResults.isEmpty())
+        return;
+
+    QMutexLocker locker(&mutex);
+
+    resultList.append(results);
+    uncertainResultList.append(uncertainResults);
+    resultCondition.wakeAll();
+    locker.unlock();
+
+    results.clear();
+    uncertainResults.clear();
+}
+
 class SearchDiriterator : public DDirIterator
 {
 public:
@@ -245,6 +630,9 @@ public:
     DUrl url() const Q_DECL_OVERRIDE;
     void close() Q_DECL_OVERRIDE;
 
+    bool appendChild(const DUrl &url) const;
+    bool takeFullTextResults(bool wait) const;
+
     SearchController *parent;
     DAbstractFileInfoPointer currentFileInfo;
     mutable QQueue<DUrl> childrens;
@@ -259,6 +647,15 @@ public:
     mutable QList<DUrl> searchPathList;
     mutable DDirIteratorPointer it;
     mutable bool m_hasIteratorByKeywordOfCurrentIt;
+    // 本地目录在没有索引可用时使用并行搜索
+    mutable QScopedPointer<LocalSearchEngine> searchEngine;
+    mutable QMutex searchEngineMutex;
+    // 全文索引在后台查询，结果到达后插入到按文件名搜索的结果之间
+    mutable bool fullTextSearched = false;
+    mutable bool fullTextPending = false;
+    mutable QFuture<QStringList> fullTextFuture;
+    // 已添加的结果，避免同一文件同时被文件名和全文索引搜索到时重复添加
+    mutable QSet<DUrl> reportedUrls;
 
 #ifndef DISABLE_QUICK_SEARCH
     // 所有支持快速搜索的子目录(可包含待搜索目录本身)
@@ -346,6 +743,74 @@ bool SearchDiriterator::hasNext() const
             return false;
         }
 
+        if (!fullTextSearched) {
+            fullTextSearched = true;
+
+            if (DFM_NAMESPACE::DFullTextIndex::isEnabled()) {
+                DFM_NAMESPACE::DFullTextIndex::instance()->start();
+
+                if (targetUrl.isLocalFile()) {
+                    const QString &directory = targetUrl.toLocalFile();
+                    const QString &keyword = m_fileUrl.searchKeyword();
+                    const QStringList &name_filters = m_nameFilters;
+                    const QDir::Filters filters = m_filter;
+
+                    // 查询数据库可能较慢，不能阻塞按文件名搜索
+                    fullTextPending = true;
+                    fullTextFuture = QtConcurrent::run([directory, keyword, name_filters, filters] {
+                        return DFM_NAMESPACE::DFullTextIndex::instance()->search(directory, keyword, name_filters, filters);
+                    });
+                }
+            } else if (DFM_NAMESPACE::DFullTextIndex::instance()->isRunning()) {
+                DFM_NAMESPACE::DFullTextIndex::instance()->stop();
+            }
+        }
+
+        if (takeFullTextResults(false)) {
+            return true;
+        }
+
+        if (searchEngine) {
+            QList<QByteArray> results;
+            QList<QByteArray> uncertain_results;
+
+            if (searchEngine->takeResults(&results, &uncertain_results)) {
+                for (const QByteArray &path : results) {
+                    DUrl url = m_fileUrl;
+
+                    url.setSearchedFileUrl(DUrl::fromLocalFile(QString::fromLocal8Bit(path)));
+                    appendChild(url);
+                }
+
+                // 显示名称可能和文件名不同的文件
+                for (const QByteArray &path : uncertain_results) {
+                    const DUrl &realUrl = DUrl::fromLocalFile(QString::fromLocal8Bit(path));
+                    const DAbstractFileInfoPointer &fileInfo = DFileService::instance()->createFileInfo(parent, realUrl);
+
+                    if (fileInfo && regex.match(fileInfo->fileDisplayName()).hasMatch()) {
+                        DUrl url = m_fileUrl;
+
+                        url.setSearchedFileUrl(realUrl);
+                        appendChild(url);
+                    }
+                }
+
+                if (!childrens.isEmpty()) {
+                    return true;
+                }
+
+                continue;
+            }
+
+            for (const QByteArray &path : searchEngine->delegatedDirectories()) {
+                searchPathList << DUrl::fromLocalFile(QString::fromLocal8Bit(path));
+            }
+
+            QMutexLocker locker(&searchEngineMutex);
+            searchEngine.reset();
+            continue;
+        }
+
         if (!it) {
             if (searchPathList.isEmpty()) {
                 break;
@@ -384,6 +849,40 @@ bool SearchDiriterator::hasNext() const
             {
                 m_hasIteratorByKeywordOfCurrentIt = it->enableIteratorByKeyword(m_fileUrl.searchKeyword());
             }
+
+            // 目录不在 deepin-anything 的索引范围内时（如未安装 deepin-anything）使用内置的文件名索引,
+            // 索引不能按 nameFilters 过滤, 有过滤条件时仍遍历目录
+            if (!m_hasIteratorByKeywordOfCurrentIt && url.isLocalFile() && m_nameFilters.isEmpty()
+                    && DFM_NAMESPACE::DFileNameIndex::isEnabled()) {
+                DDirIterator *index_iterator = DFM_NAMESPACE::DFileNameIndex::instance()->createDirIterator(url.toLocalFile(),
+                                                                                                          m_fileUrl.searchKeyword(),
+                                                                                                          m_filter);
+
+                if (index_iterator) {
+                    it = DDirIteratorPointer(index_iterator);
+                    m_hasIteratorByKeywordOfCurrentIt = true;
+                }
+            }
+
+            if (!m_hasIteratorByKeywordOfCurrentIt && url.isLocalFile() && m_nameFilters.isEmpty()) {
+                QStringList quick_search_directories;
+
+#ifndef DISABLE_QUICK_SEARCH
+                quick_search_directories = hasLFTSubdirectories;
+#endif
+
+                it.clear();
+
+                QMutexLocker locker(&searchEngineMutex);
+
+                if (closed) {
+                    return false;
+                }
+
+                searchEngine.reset(new LocalSearchEngine(m_fileUrl.searchKeyword(), m_filter, quick_search_directories));
+                searchEngine->start(url.toLocalFile().toLocal8Bit());
+                continue;
+            }
         }
 
         while (it->hasNext()) {
@@ -391,6 +890,10 @@ bool SearchDiriterator::hasNext() const
                 return false;
             }
 
+            if (takeFullTextResults(false)) {
+                return true;
+            }
+
             it->next();
 
             DAbstractFileInfoPointer fileInfo = it->fileInfo();
@@ -402,9 +905,12 @@ bool SearchDiriterator::hasNext() const
                 const DUrl &realUrl = fileInfo->fileUrl();
 
                 url.setSearchedFileUrl(realUrl);
-                childrens << url;
 
-                return true;
+                if (appendChild(url)) {
+                    return true;
+                }
+
+                continue;
             }
 
             if (fileInfo->isDir() && !fileInfo->isSymLink()) {
@@ -422,16 +928,50 @@ bool SearchDiriterator::hasNext() const
 
                 url.setSearchedFileUrl(realUrl);
 
-                childrens << url;
-
-                return true;
+                if (appendChild(url)) {
+                    return true;
+                }
             }
         }
 
         it.clear();
     }
 
-    return false;
+    // 按文件名搜索完成后等待全文索引的结果
+    return !closed && takeFullTextResults(true);
+}
+
+bool SearchDiriterator::appendChild(const DUrl &url) const
+{
+    if (reportedUrls.contains(url)) {
+        return false;
+    }
+
+    reportedUrls << url;
+    childrens << url;
+
+    return true;
+}
+
+bool SearchDiriterator::takeFullTextResults(bool wait) const
+{
+    if (!fullTextPending || (!wait && !fullTextFuture.isFinished())) {
+        return false;
+    }
+
+    fullTextPending = false;
+
+    const QStringList &paths = fullTextFuture.result();
+
+    // 索引中的结果已按相关度排序
+    for (const QString &path : paths) {
+        DUrl url = m_fileUrl;
+
+        url.setSearchedFileUrl(DUrl::fromLocalFile(path));
+        appendChild(url);
+    }
+
+    return !childrens.isEmpty();
 }
 
 QString SearchDiriterator::fileName() const
@@ -457,6 +997,12 @@ DUrl SearchDiriterator::url() const
 void SearchDiriterator::close()
 {
     closed = true;
+
+    QMutexLocker locker(&searchEngineMutex);
+
+    if (searchEngine) {
+        searchEngine->stop();
+    }
 }
 
 SearchController::SearchController(QObject *parent)
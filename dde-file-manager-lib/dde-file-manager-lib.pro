@@ -98,6 +98,7 @@ HEADERS += \
     controllers/searchhistroymanager.h \
     views/windowmanager.h \
     shutil/desktopfile.h \
+    shutil/desktopentrysnapshot.h \
     shutil/fileutils.h \
     shutil/properties.h \
     views/dfilemanagerwindow.h \
@@ -296,6 +297,7 @@ SOURCES += \
     controllers/searchhistroymanager.cpp \
     views/windowmanager.cpp \
     shutil/desktopfile.cpp \
+    shutil/desktopentrysnapshot.cpp \
     shutil/fileutils.cpp \
     shutil/properties.cpp \
     views/dfilemanagerwindow.cpp \
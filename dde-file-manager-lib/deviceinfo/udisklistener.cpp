@@ -82,6 +82,7 @@ public:
 UDiskListener::UDiskListener(QObject *parent):
     DAbstractFileController(parent)
 {
+    updateMountPointIndex();
     initDiskManager();
     initConnect();
     loadCustomVolumeLetters();
@@ -125,6 +126,7 @@ void UDiskListener::addDevice(UDiskDeviceInfoPointer device)
 {
     m_map.insert(device->getDiskInfo().id(), device);
     m_list.append(device);
+    updateMountPointIndex();
 
     DAbstractFileWatcher::ghostSignal(DUrl(DEVICE_ROOT),
                                       &DAbstractFileWatcher::subfileCreated,
@@ -136,6 +138,7 @@ void UDiskListener::removeDevice(UDiskDeviceInfoPointer device)
 {
     m_list.removeOne(device);
     m_map.remove(device->getDiskInfo().id());
+    updateMountPointIndex();
 
     DAbstractFileWatcher::ghostSignal(DUrl(DEVICE_ROOT),
                                       &DAbstractFileWatcher::fileDeleted,
@@ -244,47 +247,73 @@ QList<UDiskDeviceInfoPointer> UDiskListener::getDeviceList()
     return m_list;
 }
 
-bool UDiskListener::isDeviceFolder(const QString &path) const
+UDiskListener::MountPointIndexPointer UDiskListener::mountPointIndex() const
 {
-    for (int i = 0; i < m_list.size(); i++) {
-        UDiskDeviceInfoPointer info = m_list.at(i);
-        if (info->getMountPointUrl().toLocalFile() == path) {
-            return true;
+    QMutexLocker locker(&m_mountPointIndexMutex);
+
+    return m_mountPointIndex;
+}
+
+void UDiskListener::updateMountPointIndex()
+{
+    QSharedPointer<MountPointIndex> index(new MountPointIndex());
+
+    for (const UDiskDeviceInfoPointer &info : m_list) {
+        const QString &mountPoint = info ? info->getMountPointUrl().toLocalFile() : QString();
+
+        if (mountPoint.isEmpty()) {
+            continue;
         }
+
+        (*index)[mountPoint] << info;
     }
-    return false;
+
+    QMutexLocker locker(&m_mountPointIndexMutex);
+
+    m_mountPointIndex = index;
+}
+
+bool UDiskListener::isDeviceFolder(const QString &path) const
+{
+    if (!path.startsWith('/')) {
+        return false;
+    }
+
+    const MountPointIndexPointer index = mountPointIndex();
+    const QList<UDiskDeviceInfoPointer> *infos = index->value(path);
+
+    return infos && !infos->isEmpty();
 }
 
 bool UDiskListener::isInDeviceFolder(const QString &path) const
 {
-    for (int i = 0; i < m_list.size(); i++) {
-        UDiskDeviceInfoPointer info = m_list.at(i);
-        if (info && !info->getMountPointUrl().isEmpty()) {
-            if (path.startsWith(info->getMountPointUrl().toLocalFile())) {
-                return true;
-            }
-        }
+    if (!path.startsWith('/')) {
+        return false;
     }
-    return false;
+
+    return mountPointIndex()->longestPrefixValue(path);
 }
 
 bool UDiskListener::isInRemovableDeviceFolder(const QString &path) const
 {
+    if (!path.startsWith('/')) {
+        return false;
+    }
+
     QList<UDiskDeviceInfo::MediaType> mediaTypes = {UDiskDeviceInfo::removable,
                                                     UDiskDeviceInfo::iphone,
                                                     UDiskDeviceInfo::phone,
                                                     UDiskDeviceInfo::camera
                                                    };
-    for (int i = 0; i < m_list.size(); i++) {
-        UDiskDeviceInfoPointer info = m_list.at(i);
-        if (mediaTypes.contains(info->getMediaType())) {
-            if (!info->getMountPointUrl().isEmpty()) {
-                if (path.startsWith(info->getMountPointUrl().toLocalFile())) {
-                    return true;
-                }
+
+    for (const QList<UDiskDeviceInfoPointer> &infos : mountPointIndex()->prefixValues(path)) {
+        for (const UDiskDeviceInfoPointer &info : infos) {
+            if (mediaTypes.contains(info->getMediaType())) {
+                return true;
             }
         }
     }
+
     return false;
 }
 
@@ -339,45 +368,39 @@ UDiskDeviceInfoPointer UDiskListener::getDeviceByMountPoint(const QString &mount
 
 UDiskDeviceInfoPointer UDiskListener::getDeviceByMountPointFilePath(const QString &filePath)
 {
-    for (int i = 0; i < m_list.size(); i++) {
-        UDiskDeviceInfoPointer info = m_list.at(i);
-        if (info && !info->getMountPoint().isEmpty()) {
-            bool flag = DUrl(info->getMountPoint()) == DUrl(filePath);
-            if (!flag && filePath.startsWith(QString("%1").arg(info->getMountPointUrl().toLocalFile()))) {
-                return info;
-            }
-        }
+    if (!filePath.startsWith('/')) {
+        return UDiskDeviceInfoPointer();
     }
-    return UDiskDeviceInfoPointer();
+
+    const MountPointIndexPointer index = mountPointIndex();
+    const QList<UDiskDeviceInfoPointer> *infos = index->longestPrefixValue(filePath);
+
+    return infos ? infos->first() : UDiskDeviceInfoPointer();
 }
 
 UDiskDeviceInfoPointer UDiskListener::getDeviceByPath(const QString &path)
 {
-    for (int i = 0; i < m_list.size(); i++) {
-        UDiskDeviceInfoPointer info = m_list.at(i);
-        if (info && !info->getMountPointUrl().isEmpty()) {
-            bool flag = (DUrl::fromLocalFile(path) == info->getMountPointUrl());
-
-            if (path.startsWith(info->getMountPointUrl().toLocalFile()) && flag) {
-                return info;
-            }
-        }
+    if (!path.startsWith('/')) {
+        return UDiskDeviceInfoPointer();
     }
-    return UDiskDeviceInfoPointer();
+
+    const MountPointIndexPointer index = mountPointIndex();
+    const QList<UDiskDeviceInfoPointer> *infos = index->value(path);
+
+    return infos ? infos->first() : UDiskDeviceInfoPointer();
 }
 
 UDiskDeviceInfoPointer UDiskListener::getDeviceByFilePath(const QString &path)
 {
-    for (int i = 0; i < m_list.size(); i++) {
-        UDiskDeviceInfoPointer info = m_list.at(i);
-        if (info && !info->getMountPointUrl().isEmpty()) {
-            bool flag = (DUrl::fromLocalFile(path) == info->getMountPointUrl());
-            if (!flag && path.startsWith(QString("%1").arg(info->getMountPointUrl().toLocalFile()))) {
-                return info;
-            }
-        }
+    if (!path.startsWith('/')) {
+        return UDiskDeviceInfoPointer();
     }
-    return UDiskDeviceInfoPointer();
+
+    // 不包括挂载点自身
+    const MountPointIndexPointer index = mountPointIndex();
+    const QList<UDiskDeviceInfoPointer> *infos = index->longestPrefixValue(path, false);
+
+    return infos ? infos->first() : UDiskDeviceInfoPointer();
 }
 
 UDiskDeviceInfoPointer UDiskListener::getDeviceByDeviceID(const QString &deviceID)
@@ -445,6 +468,7 @@ void UDiskListener::addMountDiskInfo(const QDiskInfo &diskInfo)
     if (m_map.value(diskInfo.id())) {
         device = m_map.value(diskInfo.id());
         device->setDiskInfo(diskInfo);
+        updateMountPointIndex();
     } else {
         device = new UDiskDeviceInfo();
         device->setDiskInfo(diskInfo);
@@ -484,6 +508,7 @@ void UDiskListener::removeMountDiskInfo(const QDiskInfo &diskInfo)
         qDebug() << diskInfo.has_volume();
         if (diskInfo.has_volume()) {
             device->setDiskInfo(diskInfo);
+            updateMountPointIndex();
         } else {
             removeDevice(device);
         }
@@ -506,6 +531,7 @@ void UDiskListener::addVolumeDiskInfo(const QDiskInfo &diskInfo)
     if (m_map.contains(diskInfo.id())) {
         device = m_map.value(diskInfo.id());
         device->setDiskInfo(diskInfo);
+        updateMountPointIndex();
 
         emit volumeChanged(device);
     } else {
@@ -565,6 +591,7 @@ void UDiskListener::changeVolumeDiskInfo(const QDiskInfo &diskInfo)
     }
     if (device) {
         device->setDiskInfo(diskInfo);
+        updateMountPointIndex();
         emit volumeChanged(device);
     }
 }
@@ -32,11 +32,14 @@
 #include <QDebug>
 #include <QDBusObjectPath>
 #include <QList>
+#include <QMutex>
+#include <QSharedPointer>
 #include <QMap>
 #include <QDBusArgument>
 #include <QXmlStreamReader>
 #include <QDBusPendingReply>
 #include "udiskdeviceinfo.h"
+#include "dpathtrie.h"
 
 
 #define EventTypeVolumeAdded 1
@@ -121,11 +124,20 @@ private slots:
     void insertFileSystemDevice(const QString dbusPath);
 
 private:
+    typedef DFM_NAMESPACE::DPathTrie<QList<UDiskDeviceInfoPointer>> MountPointIndex;
+    typedef QSharedPointer<const MountPointIndex> MountPointIndexPointer;
+    MountPointIndexPointer mountPointIndex() const;
+    void updateMountPointIndex();
+
     DDiskManager* m_diskMgr = nullptr;
     QMap<QString, DBlockDevice*> m_fsDevMap;
 
     QList<UDiskDeviceInfoPointer> m_list;
     QMap<QString, UDiskDeviceInfoPointer> m_map;
+    // 按挂载点路径索引的设备，设备或其挂载点变化后在主线程中重建。文件任务的线程也会查询，
+    // 因此每次重建都生成新的索引并替换，查询时持有旧索引的线程不受影响
+    MountPointIndexPointer m_mountPointIndex;
+    mutable QMutex m_mountPointIndexMutex;
     QMap<QString, QString> m_volumeLetters;
 
     QList<Subscriber *> m_subscribers;
@@ -122,6 +122,8 @@ private:
         {"base.hidden_files.show_recent", DFMApplication::GA_ShowRecentFileEntry},
         {"advance.index.index_internal", DFMApplication::GA_IndexInternal},
         {"advance.index.index_external", DFMApplication::GA_IndexExternal},
+        {"advance.index.index_full_text", DFMApplication::GA_IndexFullTextSearch},
+        {"advance.index.index_file_name", DFMApplication::GA_IndexFileName},
         {"advance.search.show_hidden", DFMApplication::GA_ShowedHiddenOnSearch},
         {"advance.preview.compress_file_preview", DFMApplication::GA_PreviewCompressFile},
         {"advance.preview.text_file_preview", DFMApplication::GA_PreviewTextFile},
@@ -132,6 +134,7 @@ private:
         {"advance.mount.auto_mount_and_open", DFMApplication::GA_AutoMountAndOpen},
         {"advance.dialog.default_chooser_dialog", DFMApplication::GA_OverrideFileChooserDialog},
         {"advance.other.hide_system_partition", DFMApplication::GA_HiddenSystemPartition},
+        {"advance.other.async_integrity_checking", DFMApplication::GA_AsyncIntegrityChecking},
         {"advance.other.show_crumbbar_clickable_area", DFMApplication::GA_ShowCsdCrumbBarClickableArea}
     };
 };
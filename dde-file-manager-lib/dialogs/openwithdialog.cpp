@@ -285,7 +285,7 @@ void OpenWithDialog::initData()
     const QStringList &recommendApps = mimeAppsManager->getRecommendedAppsByQio(m_mimeType);
 
     for (int i = 0; i < recommendApps.count(); ++i) {
-        const DesktopFile &desktop_info = mimeAppsManager->DesktopObjs.value(recommendApps.at(i));
+        const DesktopFile &desktop_info = mimeAppsManager->getDesktopObj(recommendApps.at(i));
 
         OpenWithDialogListItem *item = createItem(QIcon::fromTheme(desktop_info.getIcon()), desktop_info.getDisplayName(), recommendApps.at(i));
         m_recommandLayout->addWidget(item);
@@ -296,16 +296,21 @@ void OpenWithDialog::initData()
 
     QList<DesktopFile> other_app_list;
 
-    foreach (const QString& f, mimeAppsManager->DesktopObjs.keys()) {
+    QStringList desktop_files = mimeAppsManager->DesktopFiles;
+
+    std::sort(desktop_files.begin(), desktop_files.end());
+
+    foreach (const QString& f, desktop_files) {
         //filter recommend apps , no show apps and no mime support apps
-        const DesktopFile& app = mimeAppsManager->DesktopObjs.value(f);
         if(recommendApps.contains(f))
             continue;
 
-        if(mimeAppsManager->DesktopObjs.value(f).getNoShow())
+        const DesktopFile app = mimeAppsManager->getDesktopObj(f);
+
+        if(app.getNoShow())
             continue;
 
-        if(mimeAppsManager->DesktopObjs.value(f).getMimeType().isEmpty())
+        if(app.getMimeType().isEmpty())
             continue;
 
         bool isSameDesktop = false;
@@ -325,7 +330,7 @@ void OpenWithDialog::initData()
         if (isSameDesktop)
             continue;
 
-        other_app_list << mimeAppsManager->DesktopObjs.value(f);
+        other_app_list << app;
         QString iconName = other_app_list.last().getIcon();
         OpenWithDialogListItem *item = createItem(QIcon::fromTheme(iconName), other_app_list.last().getDisplayName(), f);
         m_otherLayout->addWidget(item);
@@ -77,10 +77,18 @@ DCORE_USE_NAMESPACE
 
 namespace FileSortFunction
 {
-QCollator sortCollator;
-
 bool compareByString(const QString &str1, const QString &str2, Qt::SortOrder order)
 {
+    // QCollator 不能同时在多个线程中使用，大列表会在多个线程中并行排序
+    static thread_local QCollator sortCollator = [] {
+        QCollator collator;
+
+        collator.setNumericMode(true);
+        collator.setCaseSensitivity(Qt::CaseInsensitive);
+
+        return collator;
+    }();
+
     if (DFMGlobal::startWithHanzi(str1)) {
         if (!DFMGlobal::startWithHanzi(str2)) {
             return order == Qt::DescendingOrder;
@@ -92,7 +100,38 @@ bool compareByString(const QString &str1, const QString &str2, Qt::SortOrder ord
     return ((order == Qt::DescendingOrder) ^ (sortCollator.compare(str1, str2) < 0)) == 0x01;
 }
 
-COMPARE_FUN_DEFINE(fileDisplayName, DisplayName, DAbstractFileInfo)
+bool compareByDisplayName(const DAbstractFileInfoPointer &info1, const DAbstractFileInfoPointer &info2, Qt::SortOrder order)
+{
+    bool hanzi1 = false;
+    bool hanzi2 = false;
+    const QCollatorSortKey &key1 = info1->fileDisplayNameSortKey(&hanzi1);
+    const QCollatorSortKey &key2 = info2->fileDisplayNameSortKey(&hanzi2);
+
+    if (hanzi1) {
+        if (!hanzi2) {
+            return order == Qt::DescendingOrder;
+        }
+    } else if (hanzi2) {
+        return order != Qt::DescendingOrder;
+    }
+
+    return ((order == Qt::DescendingOrder) ^ (key1.compare(key2) < 0)) == 0x01;
+}
+
+bool compareFileListByDisplayName(const DAbstractFileInfoPointer &info1, const DAbstractFileInfoPointer &info2, Qt::SortOrder order)
+{
+    bool isDir1 = info1->isDir();
+    bool isDir2 = info2->isDir();
+
+    if (isDir1) {
+        if (!isDir2) return true;
+    } else {
+        if (isDir2) return false;
+    }
+
+    return compareByDisplayName(info1, info2, order);
+}
+
 COMPARE_FUN_DEFINE(fileSize, Size, DAbstractFileInfo)
 COMPARE_FUN_DEFINE(lastModified, Modified, DAbstractFileInfo)
 COMPARE_FUN_DEFINE(fileTypeDisplayName, Mime, DAbstractFileInfo)
@@ -120,8 +159,6 @@ DAbstractFileInfoPrivate::DAbstractFileInfoPrivate(const DUrl &url, DAbstractFil
         urlToFileInfoMap[url] = qq;
     }
 
-    FileSortFunction::sortCollator.setNumericMode(true);
-    FileSortFunction::sortCollator.setCaseSensitivity(Qt::CaseInsensitive);
 }
 
 DAbstractFileInfoPrivate::~DAbstractFileInfoPrivate()
@@ -318,6 +355,37 @@ QString DAbstractFileInfo::fileDisplayPinyinName() const
     return d->pinyinName;
 }
 
+QCollatorSortKey DAbstractFileInfo::fileDisplayNameSortKey(bool *startWithHanzi) const
+{
+    Q_D(const DAbstractFileInfo);
+
+    // QCollator 不能同时在多个线程中使用
+    static thread_local QCollator collator = [] {
+        QCollator collator;
+
+        collator.setNumericMode(true);
+        collator.setCaseSensitivity(Qt::CaseInsensitive);
+
+        return collator;
+    }();
+
+    const QString &displayName = this->fileDisplayName();
+
+    QMutexLocker locker(&d->sortKeyMutex);
+
+    if (!d->sortKey || d->sortKeyText != displayName) {
+        d->sortKey.reset(new QCollatorSortKey(collator.sortKey(displayName)));
+        d->sortKeyText = displayName;
+        d->sortKeyStartWithHanzi = DFMGlobal::startWithHanzi(displayName);
+    }
+
+    if (startWithHanzi) {
+        *startWithHanzi = d->sortKeyStartWithHanzi;
+    }
+
+    return *d->sortKey;
+}
+
 bool DAbstractFileInfo::canRename() const
 {
     CALL_PROXY(canRename());
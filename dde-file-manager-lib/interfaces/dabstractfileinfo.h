@@ -34,6 +34,7 @@
 #include <QMimeType>
 #include <QMimeDatabase>
 #include <QDir>
+#include <QCollatorSortKey>
 
 #include "durl.h"
 #include "dfmglobal.h"
@@ -57,7 +58,7 @@ bool compareFileListBy##Name(const DAbstractFileInfoPointer &info1, const DAbstr
     }\
     \
     if ((isDir1 && isDir2 && (value1 == value2)) || (isFile1 && isFile2 && (value1 == value2))) {\
-        return compareByString(info1->fileDisplayName(), info2->fileDisplayName());\
+        return compareByDisplayName(info1, info2);\
     }\
     \
     bool isStrType = typeid(value1) == typeid(QString);\
@@ -81,6 +82,12 @@ bool compareByString(T, T, Qt::SortOrder order = Qt::AscendingOrder)
 class DAbstractFileInfo;
 class DAbstractFileWatcher;
 typedef QExplicitlySharedDataPointer<DAbstractFileInfo> DAbstractFileInfoPointer;
+
+namespace FileSortFunction {
+// 使用缓存的排序键比较文件的显示名称
+bool compareByDisplayName(const DAbstractFileInfoPointer &info1, const DAbstractFileInfoPointer &info2, Qt::SortOrder order = Qt::AscendingOrder);
+}
+
 typedef std::function<const DAbstractFileInfoPointer(int)> getFileInfoFun;
 typedef DFMGlobal::MenuAction MenuAction;
 class DAbstractFileInfoPrivate;
@@ -161,6 +168,8 @@ public:
     virtual QString fileDisplayName() const;
     virtual QString fileSharedName() const;
     QString fileDisplayPinyinName() const;
+    // 显示名称的排序键，在显示名称变化后重新生成
+    QCollatorSortKey fileDisplayNameSortKey(bool *startWithHanzi = nullptr) const;
 
     virtual bool canRename() const;
     virtual bool canShare() const;
@@ -12,14 +12,120 @@
 
 #include <QEvent>
 #include <QDebug>
+#include <QSet>
+#include <QDir>
 
-QList<DAbstractFileWatcher*> DAbstractFileWatcherPrivate::watcherList;
+QHash<QString, QMultiMap<QString, DAbstractFileWatcher*>> DAbstractFileWatcherPrivate::watcherPathIndex;
+QMultiHash<QString, DAbstractFileWatcher*> DAbstractFileWatcherPrivate::schemeWatchers;
 DAbstractFileWatcherPrivate::DAbstractFileWatcherPrivate(DAbstractFileWatcher *qq)
     : q_ptr(qq)
 {
 
 }
 
+// 去掉末尾的'/'等，使"/a/b/"与"/a/b"对应同一个索引
+static QString indexPath(const DUrl &url)
+{
+    const QString &path = url.path();
+
+    return path.isEmpty() ? path : QDir::cleanPath(path);
+}
+
+void DAbstractFileWatcherPrivate::registerWatcher(DAbstractFileWatcher *watcher)
+{
+    const DAbstractFileWatcherPrivate *d = watcher->d_func();
+
+    if (d->ghostSignalMatchPath) {
+        watcherPathIndex[d->url.scheme()].insert(indexPath(d->url), watcher);
+    } else {
+        schemeWatchers.insert(d->url.scheme(), watcher);
+    }
+}
+
+void DAbstractFileWatcherPrivate::unregisterWatcher(DAbstractFileWatcher *watcher)
+{
+    const DAbstractFileWatcherPrivate *d = watcher->d_func();
+
+    if (!d->ghostSignalMatchPath) {
+        schemeWatchers.remove(d->url.scheme(), watcher);
+
+        return;
+    }
+
+    auto index = watcherPathIndex.find(d->url.scheme());
+
+    if (index == watcherPathIndex.end()) {
+        return;
+    }
+
+    index->remove(indexPath(d->url), watcher);
+
+    if (index->isEmpty()) {
+        watcherPathIndex.erase(index);
+    }
+}
+
+/*!
+ * 返回可能需要处理这些url相关信号的watcher：监视路径与urls中的url相同或位于其下的watcher
+ * （父目录被删除或移动时监视其子文件的watcher也要处理），监视路径与parentUrls中的url相同的
+ * watcher，以及这些scheme下不按路径过滤的watcher。返回的watcher按handleGhostSignal做最终判断。
+ */
+QList<DAbstractFileWatcher*> DAbstractFileWatcherPrivate::watchersForUrls(const DUrlList &urls, const DUrlList &parentUrls)
+{
+    QList<DAbstractFileWatcher*> watchers;
+    QSet<DAbstractFileWatcher*> seen;
+    QSet<QString> schemes;
+
+    auto append = [&] (DAbstractFileWatcher *watcher) {
+        if (!seen.contains(watcher)) {
+            seen.insert(watcher);
+            watchers << watcher;
+        }
+    };
+
+    auto appendPath = [&] (const DUrl &url, bool withChildren) {
+        schemes << url.scheme();
+
+        auto index = watcherPathIndex.constFind(url.scheme());
+
+        if (index == watcherPathIndex.constEnd()) {
+            return;
+        }
+
+        const QString path = indexPath(url);
+
+        for (auto it = index->constFind(path); it != index->constEnd() && it.key() == path; ++it) {
+            append(it.value());
+        }
+
+        if (!withChildren) {
+            return;
+        }
+
+        const QString prefix = path.endsWith('/') ? path : path + '/';
+
+        for (auto it = index->lowerBound(prefix); it != index->constEnd() && it.key().startsWith(prefix); ++it) {
+            append(it.value());
+        }
+    };
+
+    for (const DUrl &url : urls) {
+        appendPath(url, true);
+    }
+
+    for (const DUrl &url : parentUrls) {
+        appendPath(url, false);
+    }
+
+    for (const QString &scheme : schemes) {
+        for (auto it = schemeWatchers.constFind(scheme); it != schemeWatchers.constEnd() && it.key() == scheme; ++it) {
+            append(it.value());
+        }
+    }
+
+    return watchers;
+}
+
 bool DAbstractFileWatcherPrivate::handleGhostSignal(const DUrl &targetUrl, DAbstractFileWatcher::SignalType1 signal, const DUrl &arg1)
 {
     Q_Q(DAbstractFileWatcher);
@@ -62,7 +168,7 @@ bool DAbstractFileWatcherPrivate::handleGhostSignal(const DUrl &targetUrl, DAbst
 DAbstractFileWatcher::~DAbstractFileWatcher()
 {
     stopWatcher();
-    DAbstractFileWatcherPrivate::watcherList.removeOne(this);
+    DAbstractFileWatcherPrivate::unregisterWatcher(this);
 }
 
 DUrl DAbstractFileWatcher::fileUrl() const
@@ -123,7 +229,7 @@ bool DAbstractFileWatcher::ghostSignal(const DUrl &targetUrl, DAbstractFileWatch
 
     bool ok = false;
 
-    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watcherList) {
+    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watchersForUrls({targetUrl, arg1}, {})) {
         if (watcher->d_func()->handleGhostSignal(targetUrl, signal, arg1))
             ok = true;
     }
@@ -138,7 +244,7 @@ bool DAbstractFileWatcher::ghostSignal(const DUrl &targetUrl, DAbstractFileWatch
 
     bool ok = false;
 
-    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watcherList) {
+    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watchersForUrls({targetUrl, arg1}, {})) {
         if (watcher->d_func()->handleGhostSignal(targetUrl, signal, arg1, isExternalSource))
             ok = true;
     }
@@ -153,7 +259,9 @@ bool DAbstractFileWatcher::ghostSignal(const DUrl &targetUrl, DAbstractFileWatch
 
     bool ok = false;
 
-    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watcherList) {
+    // 文件移动时，监视其新旧父目录的watcher也要处理
+    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watchersForUrls({targetUrl, arg1, arg2},
+                                                                                       {arg1.parentUrl(), arg2.parentUrl()})) {
         if (watcher->d_func()->handleGhostSignal(targetUrl, signal, arg1, arg2))
             ok = true;
     }
@@ -161,6 +269,40 @@ bool DAbstractFileWatcher::ghostSignal(const DUrl &targetUrl, DAbstractFileWatch
     return ok;
 }
 
+bool DAbstractFileWatcher::ghostSignal(const DUrl &targetUrl, DAbstractFileWatcher::SignalType1 signal, const QList<DUrl> &urls)
+{
+    if (!signal || urls.isEmpty())
+        return false;
+
+    bool ok = false;
+
+    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watchersForUrls(DUrlList() << targetUrl << urls, {})) {
+        for (const DUrl &url : urls) {
+            if (watcher->d_func()->handleGhostSignal(targetUrl, signal, url))
+                ok = true;
+        }
+    }
+
+    return ok;
+}
+
+bool DAbstractFileWatcher::ghostSignal(const DUrl &targetUrl, DAbstractFileWatcher::SignalType3 signal, const QList<DUrl> &urls, const int isExternalSource)
+{
+    if (!signal || urls.isEmpty())
+        return false;
+
+    bool ok = false;
+
+    for (DAbstractFileWatcher *watcher : DAbstractFileWatcherPrivate::watchersForUrls(DUrlList() << targetUrl << urls, {})) {
+        for (const DUrl &url : urls) {
+            if (watcher->d_func()->handleGhostSignal(targetUrl, signal, url, isExternalSource))
+                ok = true;
+        }
+    }
+
+    return ok;
+}
+
 DAbstractFileWatcher::DAbstractFileWatcher(DAbstractFileWatcherPrivate &dd,
                                            const DUrl &url, QObject *parent)
     : QObject(parent)
@@ -169,7 +311,7 @@ DAbstractFileWatcher::DAbstractFileWatcher(DAbstractFileWatcherPrivate &dd,
     Q_ASSERT(url.isValid());
 
     d_ptr->url = url;
-    DAbstractFileWatcherPrivate::watcherList << this;
+    DAbstractFileWatcherPrivate::registerWatcher(this);
 }
 
 #include "moc_dabstractfilewatcher.cpp"
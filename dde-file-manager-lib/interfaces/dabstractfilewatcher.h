@@ -35,6 +35,9 @@ public:
     static bool ghostSignal(const DUrl &targetUrl, SignalType1 signal, const DUrl &arg1);
     static bool ghostSignal(const DUrl &targetUrl, SignalType2 signal, const DUrl &arg1, const DUrl &arg2);
     static bool ghostSignal(const DUrl &targetUrl, SignalType3 signal, const DUrl &arg1, const int isExternalSource = 1);
+    // 批量发送，只查找一次需要处理信号的watcher
+    static bool ghostSignal(const DUrl &targetUrl, SignalType1 signal, const QList<DUrl> &urls);
+    static bool ghostSignal(const DUrl &targetUrl, SignalType3 signal, const QList<DUrl> &urls, const int isExternalSource = 1);
 
 signals:
     void fileDeleted(const DUrl &url);
@@ -43,6 +46,8 @@ signals:
     void subfileCreated(const DUrl &url);
     void fileModified(const DUrl &url);
     void fileClosed(const DUrl &url);
+    // 目录中的文件变化过多，没有发送单个文件的信号，需要重新读取此目录
+    void subfilesChanged(const DUrl &url);
 
 protected:
     explicit DAbstractFileWatcher(DAbstractFileWatcherPrivate &dd, const DUrl &url, QObject *parent = 0);
@@ -36,6 +36,7 @@
 #include "usershare/usersharemanager.h"
 #include "deviceinfo/udisklistener.h"
 #include "tag/tagmanager.h"
+#include "tag/tagcache.h"
 
 #include "dfileservices.h"
 #include "dthumbnailprovider.h"
@@ -52,7 +53,6 @@
 
 #include <QDateTime>
 #include <QDir>
-#include <QPainter>
 #include <QApplication>
 #include <QtConcurrent>
 #include <qplatformdefs.h>
@@ -139,18 +139,21 @@ void RequestEP::run()
         requestEPFilesLock.unlock();
 
         const DUrl &url = file_info.first;
-        const QStringList &tag_list = DFileService::instance()->getTagsThroughFiles(nullptr, {url});
+        QStringList tag_list;
+        QList<QColor> colors;
 
-        QVariantHash ep;
+        if (!TagCache::instance()->getTagsThroughFile(url.toLocalFile(), &tag_list, &colors)) {
+            tag_list = DFileService::instance()->getTagsThroughFiles(nullptr, {url});
 
-        if (!tag_list.isEmpty()) {
-            ep["tag_name_list"] = tag_list;
+            for (const QColor &color : TagManager::instance()->getTagColor(tag_list)) {
+                colors << color;
+            }
         }
 
-        QList<QColor> colors;
+        QVariantHash ep;
 
-        for (const QColor &color : TagManager::instance()->getTagColor(tag_list)) {
-            colors << color;
+        if (!tag_list.isEmpty()) {
+            ep["tag_name_list"] = tag_list;
         }
 
         if (!colors.isEmpty()) {
@@ -844,6 +847,10 @@ void DFileInfo::makeToActive()
     if (!d->isLowSpeedFile())
         d->fileInfo.refresh();
 
+    // 重新变为可见的文件优先生成缩略图
+    if (d->requestingThumbnail.load())
+        DThumbnailProvider::instance()->setProducePriority(d->fileInfo, DThumbnailProvider::Large, DThumbnailProvider::HighPriority);
+
     DAbstractFileInfo::makeToActive();
 }
 
@@ -856,9 +863,9 @@ void DFileInfo::makeToInactive()
     if (d->getIconTimer) {
         d->getIconTimer->stop();
         d->getIconTimer->deleteLater();
-    } else if (d->requestingThumbnail) {
-        d->requestingThumbnail = false;
-        DThumbnailProvider::instance()->removeInProduceQueue(d->fileInfo, DThumbnailProvider::Large);
+    } else if (d->requestingThumbnail.testAndSetOrdered(1, 0)) {
+        // 取消不再可见的文件的缩略图请求，只移除此对象的回调，重新变为可见时再次请求
+        DThumbnailProvider::instance()->removeInProduceQueue(d->fileInfo, DThumbnailProvider::Large, this);
     }
 
     if (d->getEPTimer) {
@@ -890,15 +897,11 @@ QIcon DFileInfo::fileIcon() const
     if (d->needThumbnail || d->hasThumbnail > 0) {
         d->needThumbnail = true;
 
-        const QIcon icon(DThumbnailProvider::instance()->thumbnailFilePath(d->fileInfo, DThumbnailProvider::Large));
-
-        if (!icon.isNull()) {
-            QPixmap pixmap = icon.pixmap(DThumbnailProvider::Large, DThumbnailProvider::Large);
-            QPainter pa(&pixmap);
+        // 优先使用内存中缓存的缩略图，滚动时重新创建的文件信息对象不需要再读取缩略图文件
+        const QImage thumbnail = DThumbnailProvider::instance()->thumbnailImage(d->fileInfo, DThumbnailProvider::Large);
 
-            pa.setPen(Qt::gray);
-            pa.drawPixmap(0, 0, pixmap);
-            d->icon.addPixmap(pixmap);
+        if (!thumbnail.isNull()) {
+            d->icon.addPixmap(QPixmap::fromImage(thumbnail));
             d->iconFromTheme = false;
             d->needThumbnail = false;
 
@@ -917,8 +920,12 @@ QIcon DFileInfo::fileIcon() const
             timer->setInterval(REQUEST_THUMBNAIL_DEALY);
 
             QObject::connect(timer, &QTimer::timeout, timer, [fileUrl, timer, me] {
+                // 回调可能在生成线程中先于appendToProduceQueue返回被调用，因此要在加入队列前设置
+                me->d_func()->requestingThumbnail.store(1);
                 DThumbnailProvider::instance()->appendToProduceQueue(me->d_func()->fileInfo, DThumbnailProvider::Large,
                                                                      [me] (const QString &path) {
+                    me->d_func()->requestingThumbnail.store(0);
+
                     if (path.isEmpty()) {
                         me->d_func()->iconFromTheme = true;
                     } else {
@@ -927,8 +934,7 @@ QIcon DFileInfo::fileIcon() const
                     }
 
                     me->d_func()->needThumbnail = false;
-                });
-                me->d_func()->requestingThumbnail = true;
+                }, me->isActive() ? DThumbnailProvider::HighPriority : DThumbnailProvider::NormalPriority, me.data());
                 timer->deleteLater();
             });
 
@@ -993,6 +999,20 @@ QVariantHash DFileInfo::extraProperties() const
         d->epInitialized = true;
 
         const DUrl &url = fileUrl();
+        QStringList tag_list;
+        QList<QColor> colors;
+
+        // 标记缓存可用时直接从内存中取，不需要经过DBus
+        if (TagCache::instance()->getTagsThroughFile(url.toLocalFile(), &tag_list, &colors)) {
+            d->extraProperties.clear();
+
+            if (!tag_list.isEmpty()) {
+                d->extraProperties["tag_name_list"] = tag_list;
+                d->extraProperties["colored"] = QVariant::fromValue(colors);
+            }
+
+            return d->extraProperties;
+        }
 
         if (!d->getEPTimer) {
             d->getEPTimer = new QTimer();
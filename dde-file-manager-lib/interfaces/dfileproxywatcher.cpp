@@ -56,6 +56,7 @@ DFileProxyWatcher::DFileProxyWatcher(const DUrl &url, DAbstractFileWatcher *prox
     connect(proxy, &DAbstractFileWatcher::fileDeleted, this, &DFileProxyWatcher::onFileDeleted);
     connect(proxy, &DAbstractFileWatcher::fileMoved, this, &DFileProxyWatcher::onFileMoved);
     connect(proxy, &DAbstractFileWatcher::subfileCreated, this, &DFileProxyWatcher::onSubfileCreated);
+    connect(proxy, &DAbstractFileWatcher::subfilesChanged, this, &DFileProxyWatcher::onSubfilesChanged);
 }
 
 void DFileProxyWatcher::onFileDeleted(const DUrl &url)
@@ -85,3 +86,10 @@ void DFileProxyWatcher::onSubfileCreated(const DUrl &url)
 
     emit subfileCreated(d->urlConvertFun(url));
 }
+
+void DFileProxyWatcher::onSubfilesChanged(const DUrl &url)
+{
+    Q_D(const DFileProxyWatcher);
+
+    emit subfilesChanged(d->urlConvertFun(url));
+}
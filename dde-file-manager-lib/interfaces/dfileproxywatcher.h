@@ -27,6 +27,7 @@ private slots:
     void onFileAttributeChanged(const DUrl &url);
     void onFileMoved(const DUrl &fromUrl, const DUrl &toUrl);
     void onSubfileCreated(const DUrl &url);
+    void onSubfilesChanged(const DUrl &url);
 
 private:
     Q_DECLARE_PRIVATE(DFileProxyWatcher)
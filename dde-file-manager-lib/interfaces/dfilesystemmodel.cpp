@@ -43,12 +43,14 @@
 #include "deviceinfo/udisklistener.h"
 
 #include <memory>
+#include <typeinfo>
 #include <QList>
 #include <QDebug>
 #include <QMimeData>
 #include <QSharedPointer>
 #include <QAbstractItemView>
 #include <QtConcurrent/QtConcurrent>
+#include <QFutureWatcher>
 
 #define fileService DFileService::instance()
 #define DEFAULT_COLUMN_COUNT 0
@@ -504,6 +506,12 @@ public:
         rootNode = node;
     }
 
+    // 还有文件没处理完时，之后的文件变化也需要交给此线程，保证按顺序处理
+    bool hasPendingFiles() const
+    {
+        return isRunning() || !fileQueue.isEmpty();
+    }
+
     void setEnable(bool enable)
     {
         this->enable = enable;
@@ -533,6 +541,8 @@ private:
         QList<DAbstractFileInfoPointer> backlogDirInfoList;
         // 使用计时器避免文件在批量插入列表中等待太久
         QTime timerOfFileList, timerOfDirList;
+        // 由文件事件新增的文件，全部插入后再检查是否需要选中或重命名
+        QList<DUrl> addedUrls;
 
         auto insertInfoList = [&] (int index, const QList<DAbstractFileInfoPointer> &list) {
             DThreadUtil::runInThread(&semaphore, model()->thread(), model(), &DFileSystemModel::beginInsertRows,
@@ -578,26 +588,24 @@ private:
                 return true;
             }
 
+            // 目录都排在文件之前，二分查找第一个文件的位置
             int row = 0;
+            int end = rootNode->childrenCount();
 
-            forever {
-                if (!enable) {
-                    return false;
-                }
-
-                if (row >= rootNode->childrenCount()) {
-                    break;
-                }
-
-                const FileSystemNodePointer &node = rootNode->getNodeByIndex(row);
+            while (row < end) {
+                int middle = row + (end - row) / 2;
+                const FileSystemNodePointer &node = rootNode->getNodeByIndex(middle);
 
-                if (node->fileInfo->isFile()) {
-                    break;
+                if (!node || node->fileInfo->isFile()) {
+                    end = middle;
+                } else {
+                    row = middle + 1;
                 }
-
-                ++row;
             }
 
+            if (!enable)
+                return false;
+
             if (!insertInfoList(row, backlogDirInfoList))
                 return false;
 
@@ -606,6 +614,58 @@ private:
             return true;
         };
 
+        // 在[begin, end)范围内二分查找文件应插入的位置，即第一个应排在此文件之后的节点
+        auto findSortedRow = [&] (const DAbstractFileInfoPointer &fileInfo, const DAbstractFileInfo::CompareFunction &compareFun,
+                                  Qt::SortOrder order, int begin, int end) {
+            while (begin < end) {
+                int middle = begin + (end - begin) / 2;
+                const FileSystemNodePointer &node = rootNode->getNodeByIndex(middle);
+
+                if (!node || compareFun(fileInfo, node->fileInfo, order)) {
+                    end = middle;
+                } else {
+                    begin = middle + 1;
+                }
+            }
+
+            return begin;
+        };
+
+        // 先对新文件排序，再把插入到同一位置的文件合并为一次插入
+        auto insertSortedList = [&] (QList<DAbstractFileInfoPointer> &list, const DAbstractFileInfo::CompareFunction &compareFun) {
+            const Qt::SortOrder order = model()->sortOrder();
+
+            std::stable_sort(list.begin(), list.end(), [&] (const DAbstractFileInfoPointer &a, const DAbstractFileInfoPointer &b) {
+                return compareFun(a, b, order);
+            });
+
+            QList<DAbstractFileInfoPointer> rowList;
+            int row = 0;
+
+            for (const DAbstractFileInfoPointer &fileInfo : list) {
+                if (!enable) {
+                    return false;
+                }
+
+                // 已排序的新文件不会排在上一个文件之前，只需在其后查找
+                int new_row = findSortedRow(fileInfo, compareFun, order, row, rootNode->childrenCount());
+
+                if (new_row != row && !rowList.isEmpty()) {
+                    if (!insertInfoList(row, rowList))
+                        return false;
+
+                    rowList.clear();
+                    // 插入的节点可能会被过滤规则隐藏，需要重新查找
+                    new_row = findSortedRow(fileInfo, compareFun, order, row, rootNode->childrenCount());
+                }
+
+                row = new_row;
+                rowList << fileInfo;
+            }
+
+            return rowList.isEmpty() || insertInfoList(row, rowList);
+        };
+
         auto removeInList = [&] (QList<DAbstractFileInfoPointer> &list, const DUrl &url) {
             for (int i = 0; i < list.count(); ++i) {
                 if (list.at(i)->fileUrl() == url) {
@@ -630,6 +690,9 @@ begin:
             const DUrl &fileUrl = fileInfo->fileUrl();
 
             if (v.first == AddFile || v.first == AppendFile) {
+                if (v.first == AddFile)
+                    addedUrls << fileUrl;
+
                 if (rootNode->childContains(fileUrl))
                     continue;
 
@@ -642,23 +705,37 @@ begin:
                         DAbstractFileInfo::CompareFunction compareFun = fileInfo->compareFunByColumn(model()->sortRole());
 
                         if (compareFun) {
-                            forever {
-                                if (!enable) {
-                                    return;
-                                }
+                            QList<DAbstractFileInfoPointer> sortedList {fileInfo};
+                            QSet<DUrl> sortedUrls {fileUrl};
 
-                                if (row >= rootNode->childrenCount()) {
+                            // 合并紧随其后的同类文件的插入事件，一起排序后批量插入
+                            while (sortedList.count() < 10000 && !fileQueue.isEmpty()) {
+                                const QPair<EventType, DAbstractFileInfoPointer> next = fileQueue.headNode()->data;
+
+                                if (next.first != AddFile || !next.second->hasOrderly()
+                                        || typeid(*next.second) != typeid(*fileInfo)) {
                                     break;
                                 }
 
-                                const FileSystemNodePointer &node = rootNode->getNodeByIndex(row);
+                                fileQueue.dequeue();
 
-                                if (compareFun(fileInfo, node->fileInfo, model()->sortOrder())) {
-                                    break;
+                                const DUrl &nextUrl = next.second->fileUrl();
+
+                                addedUrls << nextUrl;
+
+                                if (sortedUrls.contains(nextUrl) || rootNode->childContains(nextUrl)) {
+                                    continue;
                                 }
 
-                                ++row;
+                                sortedList << next.second;
+                                sortedUrls << nextUrl;
                             }
+
+                            if (!insertSortedList(sortedList, compareFun)) {
+                                return;
+                            }
+
+                            continue;
                         } else {
                             row = -1;
                         }
@@ -747,6 +824,20 @@ begin:
             return;
         }
 
+        if (!addedUrls.isEmpty()) {
+            DThreadUtil::runInThread(&semaphore, model()->thread(), [this, &addedUrls] {
+                for (const DUrl &url : addedUrls) {
+                    model()->selectAndRenameFile(url);
+                }
+            });
+
+            addedUrls.clear();
+        }
+
+        if (!enable) {
+            return;
+        }
+
         // 先等待一秒看是否还有数据
         QThread::msleep(300);
 
@@ -774,9 +865,28 @@ public:
         RmFile
     };
 
+    // 一批文件事件中新增的文件超过此数量时交给 rootNodeManager 批量插入
+    static const int maxSynchronousAddCount = 100;
+
+    // 在子线程中解析后的文件事件
+    struct ResolvedFileEvent {
+        EventType type;
+        DUrl fileUrl;
+        DAbstractFileInfoPointer info;
+    };
+
+    struct ResolvedFileEventBatch {
+        DUrl rootUrl;
+        // 根目录自身被创建或删除
+        bool rootChanged = false;
+        bool rootDeleted = false;
+        QList<ResolvedFileEvent> events;
+    };
+
     DFileSystemModelPrivate(DFileSystemModel *qq)
         : q_ptr(qq)
         , rootNodeManager(new FileNodeManagerThread(qq))
+        , fileEventWatcher(new QFutureWatcher<ResolvedFileEventBatch>(qq))
         , needQuitUpdateChildren(false)
     {
         if (DFMApplication::instance()->genericAttribute(DFMApplication::GA_ShowedHiddenFiles).toBool()) {
@@ -793,12 +903,15 @@ public:
                 qq->setState(DFileSystemModel::Idle);
             }
         });
+        qq->connect(fileEventWatcher, &QFutureWatcherBase::finished, qq, [this] {
+            applyFileEvents(fileEventWatcher->result());
+        });
     }
 
     ~DFileSystemModelPrivate();
 
     bool passNameFilters(const FileSystemNodePointer &node) const;
-    bool passFileFilters(const DAbstractFileInfoPointer &info) const;
+    static bool passFileFilters(const DAbstractFileInfoPointer &info, QDir::Filters filters);
 
     void _q_onFileCreated(const DUrl &fileUrl);
     void _q_onFileDeleted(const DUrl &fileUrl);
@@ -808,6 +921,9 @@ public:
 
     /// add/rm file event
     void _q_processFileEvent();
+    static ResolvedFileEventBatch resolveFileEvents(const DFileSystemModel *model, const DUrl &rootUrl,
+                                                    QDir::Filters filters, const QList<QPair<EventType, DUrl>> &events);
+    void applyFileEvents(const ResolvedFileEventBatch &batch);
 
     DFileSystemModel *q_ptr;
 
@@ -840,6 +956,7 @@ public:
     /// add/rm file event
     bool _q_processFileEvent_runing = false;
     QQueue<QPair<EventType, DUrl>> fileEventQueue;
+    QFutureWatcher<ResolvedFileEventBatch> *fileEventWatcher;
 
     bool enabledSort = true;
 
@@ -882,7 +999,7 @@ bool DFileSystemModelPrivate::passNameFilters(const FileSystemNodePointer &node)
     return true;
 }
 
-bool DFileSystemModelPrivate::passFileFilters(const DAbstractFileInfoPointer &info) const
+bool DFileSystemModelPrivate::passFileFilters(const DAbstractFileInfoPointer &info, QDir::Filters filters)
 {
     if (!(filters & (QDir::Dirs | QDir::AllDirs)) && info->isDir()) {
         return false;
@@ -919,13 +1036,7 @@ void DFileSystemModelPrivate::_q_onFileCreated(const DUrl &fileUrl)
 {
     Q_Q(DFileSystemModel);
 
-    const DAbstractFileInfoPointer &info = DFileService::instance()->createFileInfo(q, fileUrl);
-    qDebug() << fileUrl;
-
-    if (!info || !passFileFilters(info)) {
-        return;
-    }
-
+    // 文件信息的创建和过滤在 _q_processFileEvent 的子线程中完成，避免在主线程中stat文件
 //    rootNodeManager->addFile(info);
     fileEventQueue.enqueue(qMakePair(AddFile, fileUrl));
     q->metaObject()->invokeMethod(q, QT_STRINGIFY(_q_processFileEvent), Qt::QueuedConnection);
@@ -998,33 +1109,80 @@ void DFileSystemModelPrivate::_q_onFileRename(const DUrl &from, const DUrl &to)
 
 void DFileSystemModelPrivate::_q_processFileEvent()
 {
-    if (_q_processFileEvent_runing) {
+    // 上一批事件还在子线程中处理，处理完成后会再次调用此函数
+    if (_q_processFileEvent_runing || fileEventQueue.isEmpty()) {
         return;
     }
 
-    _q_processFileEvent_runing = true;
-
     Q_Q(DFileSystemModel);
 
+    // 同一文件的多个事件只保留最后一个，先创建后删除的文件只会产生一次移除（不存在时为空操作），
+    // 且不会再为其创建文件信息
+    QHash<DUrl, int> lastEventIndex;
+    // 被删除过的文件，删除后又被创建时已经是另一个文件
+    QSet<DUrl> removedUrls;
+    QList<QPair<EventType, DUrl>> events;
+
     while (!fileEventQueue.isEmpty()) {
-        const QPair<EventType, DUrl> &event = fileEventQueue.dequeue();
-        const DUrl &fileUrl = event.second;
+        const QPair<EventType, DUrl> event = fileEventQueue.dequeue();
 
-        const DAbstractFileInfoPointer &info = DFileService::instance()->createFileInfo(q, fileUrl);
+        if (event.first == RmFile) {
+            removedUrls << event.second;
+        }
 
-        if (!info) {
+        lastEventIndex[event.second] = events.count();
+        events << event;
+    }
+
+    QList<QPair<EventType, DUrl>> collapsedEvents;
+
+    collapsedEvents.reserve(lastEventIndex.count());
+
+    for (int i = 0; i < events.count(); ++i) {
+        const QPair<EventType, DUrl> &event = events.at(i);
+
+        if (lastEventIndex.value(event.second) != i) {
             continue;
         }
 
-        const DUrl &rootUrl = q->rootUrl();
-        const DAbstractFileInfoPointer rootinfo = fileService->createFileInfo(q, rootUrl);
+        // 先删除后创建的文件需要先移除旧的节点，否则节点已存在时新文件会被忽略，列表中仍是旧文件的信息
+        if (event.first == AddFile && removedUrls.contains(event.second)) {
+            collapsedEvents << qMakePair(RmFile, event.second);
+        }
+
+        collapsedEvents << event;
+    }
+
+    _q_processFileEvent_runing = true;
+    fileEventWatcher->setFuture(QtConcurrent::run(&DFileSystemModelPrivate::resolveFileEvents,
+                                                  static_cast<const DFileSystemModel *>(q), q->rootUrl(), filters, collapsedEvents));
+}
+
+DFileSystemModelPrivate::ResolvedFileEventBatch
+DFileSystemModelPrivate::resolveFileEvents(const DFileSystemModel *model, const DUrl &rootUrl,
+                                           QDir::Filters filters, const QList<QPair<EventType, DUrl>> &events)
+{
+    static const QRegularExpression burn_rxp("^(.*?)/(" BURN_SEG_ONDISC "|" BURN_SEG_STAGING ")(.*)$");
+
+    ResolvedFileEventBatch batch;
+    const bool isBurn = rootUrl.scheme() == BURN_SCHEME;
+    const QString rxp_after = isBurn ? QString("\\1/%1\\3").arg(rootUrl.burnIsOnDisc() ? BURN_SEG_ONDISC : BURN_SEG_STAGING) : QString();
+
+    batch.rootUrl = rootUrl;
+    batch.events.reserve(events.count());
+
+    for (const QPair<EventType, DUrl> &event : events) {
+        const DUrl &fileUrl = event.second;
+        const DAbstractFileInfoPointer &info = DFileService::instance()->createFileInfo(model, fileUrl);
+
+        if (!info) {
+            continue;
+        }
 
         DUrl nparentUrl(info->parentUrl());
         DUrl nfileUrl(fileUrl);
 
-        if (rootUrl.scheme() == BURN_SCHEME) {
-            QRegularExpression burn_rxp("^(.*?)/(" BURN_SEG_ONDISC "|" BURN_SEG_STAGING ")(.*)$");
-            QString rxp_after(QString("\\1/%1\\3").arg(rootUrl.burnIsOnDisc() ? BURN_SEG_ONDISC : BURN_SEG_STAGING));
+        if (isBurn) {
             nfileUrl.setPath(nfileUrl.path().replace(burn_rxp, rxp_after));
             nparentUrl.setPath(nparentUrl.path().replace(burn_rxp, rxp_after));
             if (!nparentUrl.path().endsWith('/')) {
@@ -1033,11 +1191,8 @@ void DFileSystemModelPrivate::_q_processFileEvent()
         }
 
         if (nfileUrl == rootUrl) {
-            if (event.first == RmFile) {
-                emit q->rootUrlDeleted(rootUrl);
-            }
-            // It must be refreshed when the root url itself is deleted or newly created
-            q->refresh();
+            batch.rootChanged = true;
+            batch.rootDeleted = event.first == RmFile;
             continue;
         }
 
@@ -1045,18 +1200,70 @@ void DFileSystemModelPrivate::_q_processFileEvent()
             continue;
         }
 
-        // Will refreshing the file info meta data
-        info->refresh();
-
         if (event.first == AddFile) {
-            q->addFile(info);
-            q->selectAndRenameFile(fileUrl);
-        } else {// rm file event
-            q->remove(fileUrl);
+            // Will refreshing the file info meta data
+            info->refresh();
+
+            if (!passFileFilters(info, filters)) {
+                continue;
+            }
         }
+
+        batch.events << ResolvedFileEvent {event.first, fileUrl, info};
     }
 
+    return batch;
+}
+
+void DFileSystemModelPrivate::applyFileEvents(const ResolvedFileEventBatch &batch)
+{
+    Q_Q(DFileSystemModel);
+
     _q_processFileEvent_runing = false;
+
+    // 处理期间切换了目录，这批事件已经没有意义
+    if (batch.rootUrl == q->rootUrl()) {
+        if (batch.rootChanged) {
+            if (batch.rootDeleted) {
+                emit q->rootUrlDeleted(batch.rootUrl);
+            }
+            // It must be refreshed when the root url itself is deleted or newly created
+            q->refresh();
+        } else {
+            int add_count = 0;
+
+            for (const ResolvedFileEvent &event : batch.events) {
+                if (event.type == AddFile) {
+                    ++add_count;
+                }
+            }
+
+            // DFileSystemModel::addFile 需要在主线程中为每个文件查找插入位置，新文件较多时
+            // 交给 rootNodeManager 排序后批量插入。rootNodeManager 还有未处理的文件时，
+            // 这批事件也交给它，避免删除事件先于之前的新增事件被处理
+            const bool use_node_manager = rootNode && rootNode->populatedChildren
+                    && (add_count > maxSynchronousAddCount || rootNodeManager->hasPendingFiles());
+
+            for (const ResolvedFileEvent &event : batch.events) {
+                if (use_node_manager) {
+                    if (event.type == AddFile) {
+                        rootNodeManager->addFile(event.info);
+                    } else {
+                        rootNodeManager->removeFile(event.info);
+                    }
+                } else if (event.type == AddFile) {
+                    q->addFile(event.info);
+                    q->selectAndRenameFile(event.fileUrl);
+                } else {// rm file event
+                    q->remove(event.fileUrl);
+                }
+            }
+        }
+    }
+
+    if (!fileEventQueue.isEmpty()) {
+        _q_processFileEvent();
+    }
 }
 
 DFileSystemModel::DFileSystemModel(DFileViewHelper *parent)
@@ -1080,6 +1287,9 @@ DFileSystemModel::~DFileSystemModel()
         d->updateChildrenFuture.waitForFinished();
     }
 
+    // 子线程中会以model作为创建文件信息的sender
+    d->fileEventWatcher->waitForFinished();
+
     if (d->watcher) {
         d->watcher->deleteLater();
     }
@@ -1740,6 +1950,10 @@ QModelIndex DFileSystemModel::setRootUrl(const DUrl &fileUrl)
                 this, SLOT(_q_onFileRename(DUrl, DUrl)));
         connect(d->watcher, SIGNAL(fileModified(DUrl)),
                 this, SLOT(_q_onFileUpdated(DUrl)));
+        // 文件变化过多时监视器不再发送单个文件的信号，需要重新读取整个目录
+        connect(d->watcher, &DAbstractFileWatcher::subfilesChanged, this, [this] {
+            refresh();
+        });
     }
 
     return index(fileUrl);
@@ -2446,9 +2660,39 @@ bool DFileSystemModel::sort(const DAbstractFileInfoPointer &parentInfo, QList<Fi
         return false;
     }
 
-    qSort(list.begin(), list.end(), [sortFun, d](const FileSystemNode *node1, const FileSystemNode *node2) {
+    auto lessThan = [sortFun, d](const FileSystemNode *node1, const FileSystemNode *node2) {
         return sortFun(node1->fileInfo, node2->fileInfo, d->srotOrder);
-    });
+    };
+
+    // 列表较大时先在多个线程中分段排序，再逐级合并
+    const int chunk_count = list.count() >= 20000 ? qBound(1, QThread::idealThreadCount(), 8) : 1;
+
+    if (chunk_count > 1) {
+        const QList<FileSystemNode*>::iterator begin = list.begin();
+        QVector<int> bounds;
+        QList<int> chunks;
+
+        for (int i = 0; i <= chunk_count; ++i) {
+            bounds << static_cast<int>(static_cast<qint64>(list.count()) * i / chunk_count);
+
+            if (i < chunk_count) {
+                chunks << i;
+            }
+        }
+
+        QtConcurrent::blockingMap(chunks, [&] (int i) {
+            std::sort(begin + bounds.at(i), begin + bounds.at(i + 1), lessThan);
+        });
+
+        for (int step = 1; step < chunk_count; step *= 2) {
+            for (int i = 0; i + step < chunk_count; i += step * 2) {
+                std::inplace_merge(begin + bounds.at(i), begin + bounds.at(i + step),
+                                   begin + bounds.at(qMin(i + step * 2, chunk_count)), lessThan);
+            }
+        }
+    } else {
+        qSort(list.begin(), list.end(), lessThan);
+    }
 
     if (columnIsCompact() && d->rootNode && d->rootNode->fileInfo) {
         int column = 0;
@@ -10,10 +10,18 @@
 #include "dfilesystemwatcher.h"
 #include "private/dfilesystemwatcher_p.h"
 #include "dfmglobal.h"
+#include "dfilesizecache.h"
+#include "dfilenameindex.h"
+#include "dfulltextindex.h"
 
 #include <QFileInfo>
 #include <QDir>
 #include <QDebug>
+#include <QMutex>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <errno.h>
 
 #if defined(Q_OS_LINUX)
 #include <sys/inotify.h>
@@ -22,13 +30,161 @@
 #include <unistd.h>
 #endif
 
+// 需要通知给目录大小缓存和搜索索引的文件变化
+struct FileChanges
+{
+    /// 目录中的文件内容被修改时不会更新目录的修改时间，需要使缓存的目录大小失效
+    QSet<QString> sizeChangedDirectories;
+    QSet<QString> createdFiles;
+    QSet<QString> createdDirectories;
+    QSet<QString> contentChangedFiles;
+    QSet<QString> removedFiles;
+    /// 事件风暴期间没有逐个记录变化的目录
+    QSet<QString> changedDirectories;
+
+    bool isEmpty() const
+    {
+        return sizeChangedDirectories.isEmpty() && createdFiles.isEmpty()
+                && contentChangedFiles.isEmpty() && removedFiles.isEmpty()
+                && changedDirectories.isEmpty();
+    }
+
+    void fileCreated(const QString &filePath, bool isDirectory)
+    {
+        createdFiles << filePath;
+
+        if (isDirectory)
+            createdDirectories << filePath;
+
+        // 删除后又新建的文件需要重新建立全文索引
+        if (removedFiles.remove(filePath))
+            contentChangedFiles << filePath;
+    }
+
+    void fileRemoved(const QString &filePath)
+    {
+        createdFiles.remove(filePath);
+        createdDirectories.remove(filePath);
+        contentChangedFiles.remove(filePath);
+        removedFiles << filePath;
+    }
+
+    // 合并之后的变化，同一文件以最后一次变化为准
+    void unite(const FileChanges &other)
+    {
+        for (const QString &filePath : other.createdFiles) {
+            if (removedFiles.remove(filePath))
+                contentChangedFiles << filePath;
+        }
+
+        createdFiles.subtract(other.removedFiles);
+        createdDirectories.subtract(other.removedFiles);
+        contentChangedFiles.subtract(other.removedFiles);
+        removedFiles.subtract(other.contentChangedFiles);
+
+        sizeChangedDirectories.unite(other.sizeChangedDirectories);
+        createdFiles.unite(other.createdFiles);
+        createdDirectories.unite(other.createdDirectories);
+        contentChangedFiles.unite(other.contentChangedFiles);
+        removedFiles.unite(other.removedFiles);
+        changedDirectories.unite(other.changedDirectories);
+    }
+};
+
+// 同一路径可能同时被多个 DFileSystemWatcher 监视，各自收到的变化在此合并后，
+// 在一个后台线程中通知给各个缓存和索引，避免在主线程中逐个文件调用
+class FileChangeNotifier
+{
+public:
+    FileChangeNotifier()
+    {
+        pool.setMaxThreadCount(1);
+    }
+
+    ~FileChangeNotifier()
+    {
+        pool.waitForDone();
+    }
+
+    void post(const FileChanges &changes)
+    {
+        if (changes.isEmpty())
+            return;
+
+        QMutexLocker locker(&mutex);
+
+        pendingChanges.unite(changes);
+
+        // 正在处理的变化发送完后才会处理之后到达的变化，期间重复的变化都会被合并
+        if (!scheduled) {
+            scheduled = true;
+            QtConcurrent::run(&pool, [this] {
+                process();
+            });
+        }
+    }
+
+private:
+    void process()
+    {
+        FileChanges changes;
+
+        mutex.lock();
+        std::swap(changes, pendingChanges);
+        scheduled = false;
+        mutex.unlock();
+
+        for (const QString &path : changes.sizeChangedDirectories) {
+            DFM_NAMESPACE::DFileSizeCache::instance()->invalidate(path);
+        }
+
+        // 将变化记录到文件名索引中，使其在下次重建索引前也可以被搜索到
+        for (const QString &filePath : changes.createdFiles) {
+            DFM_NAMESPACE::DFileNameIndex::instance()->fileCreated(filePath, changes.createdDirectories.contains(filePath));
+        }
+
+        for (const QString &filePath : changes.removedFiles) {
+            DFM_NAMESPACE::DFileNameIndex::instance()->fileRemoved(filePath);
+        }
+
+        for (const QString &path : changes.changedDirectories) {
+            DFM_NAMESPACE::DFileNameIndex::instance()->directoryChanged(path);
+        }
+
+        // 更新全文搜索的索引
+        if (DFM_NAMESPACE::DFullTextIndex::instance()->isRunning()) {
+            for (const QString &filePath : changes.contentChangedFiles) {
+                DFM_NAMESPACE::DFullTextIndex::instance()->fileChanged(filePath);
+            }
+
+            for (const QString &filePath : changes.removedFiles) {
+                DFM_NAMESPACE::DFullTextIndex::instance()->fileRemoved(filePath);
+            }
+        }
+    }
+
+    QMutex mutex;
+    FileChanges pendingChanges;
+    bool scheduled = false;
+    QThreadPool pool;
+};
+
+Q_GLOBAL_STATIC(FileChangeNotifier, globalFileChangeNotifier)
+
 DFileSystemWatcherPrivate::DFileSystemWatcherPrivate(int fd, DFileSystemWatcher *qq)
     : q_ptr(qq)
     , inotifyFd(fd)
     , notifier(fd, QSocketNotifier::Read, qq)
 {
     fcntl(inotifyFd, F_SETFD, FD_CLOEXEC);
+    // 以非阻塞方式读取，一次读完所有已到达的事件
+    fcntl(inotifyFd, F_SETFL, fcntl(inotifyFd, F_GETFL) | O_NONBLOCK);
     qq->connect(&notifier, SIGNAL(activated(int)), q_ptr, SLOT(_q_readFromInotify()));
+
+    eventStormTimer.setInterval(1000);
+    qq->connect(&eventStormTimer, &QTimer::timeout, qq, [this] {
+        _q_checkEventStorm();
+    });
 }
 
 DFileSystemWatcherPrivate::~DFileSystemWatcherPrivate()
@@ -134,27 +290,58 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
     Q_Q(DFileSystemWatcher);
 //    qDebug() << "QInotifyFileSystemWatcherEngine::readFromInotify";
 
-    int buffSize = 0;
-    ioctl(inotifyFd, FIONREAD, (char *) &buffSize);
-    QVarLengthArray<char, 4096> buffer(buffSize);
-    buffSize = read(inotifyFd, buffer.data(), buffSize);
-    char *at = buffer.data();
-    char * const end = at + buffSize;
+    // 按固定大小的块读取，直到读完或达到单次处理的上限（剩余的事件会再次触发activated信号）
+    QByteArray buffer;
+
+    while (buffer.size() < MaxReadSizeOnce) {
+        char block[InotifyReadBlockSize];
+        ssize_t size = read(inotifyFd, block, sizeof(block));
+
+        if (size < 0 && errno == EINTR)
+            continue;
 
-    QList<inotify_event *> eventList;
+        if (size <= 0)
+            break;
+
+        buffer.append(block, static_cast<int>(size));
+    }
+
+    const char *at = buffer.constData();
+    const char * const end = at + buffer.size();
+
+    QList<const inotify_event *> eventList;
+    // 用于事件去重，以 (wd, mask, cookie, name) 作为key
+    QSet<InotifyEventKey> eventKeys;
     QMultiHash<int, QString> batch_pathmap;
+    QSet<int> batch_ids;
     /// only save event: IN_MOVE_TO
     QMultiMap<int, QString> cookieToFilePath;
     QMultiMap<int, QString> cookieToFileName;
     QSet<int> hasMoveFromByCookie;
+    FileChanges changes;
+    int eventCountOfBatch = 0;
 #ifdef QT_DEBUG
     int exist_count = 0;
 #endif
     while (at < end) {
-        inotify_event *event = reinterpret_cast<inotify_event *>(at);
+        const inotify_event *event = reinterpret_cast<const inotify_event *>(at);
         QStringList paths;
 
         at += sizeof(inotify_event) + event->len;
+        ++eventCountOfBatch;
+
+        // 内核的事件队列已溢出，有事件丢失，所有目录都需要重新读取
+        if (event->mask & IN_Q_OVERFLOW) {
+            for (const QString &path : directories)
+                eventStormDirectories << path;
+
+            eventStorm = true;
+
+            if (!eventStormTimer.isActive())
+                eventStormTimer.start();
+
+            continue;
+        }
 
         int id = event->wd;
         paths = idToPath.values(id);
@@ -167,14 +354,11 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
         }
 
         if (!(event->mask & IN_MOVED_TO) || !hasMoveFromByCookie.contains(event->cookie)) {
-            auto it = std::find_if(eventList.begin(), eventList.end(), [event](inotify_event *e){
-                    return event->wd == e->wd && event->mask == e->mask &&
-                           event->cookie == e->cookie &&
-                           event->len == e->len &&
-                           !strcmp(event->name, e->name);
-            });
+            const InotifyEventKey key{event->wd, event->mask, event->cookie,
+                                      event->len > 0 ? QByteArray(event->name) : QByteArray()};
 
-            if (it==eventList.end()) {
+            if (!eventKeys.contains(key)) {
+                eventKeys.insert(key);
                 eventList.append(event);
             }
 #ifdef QT_DEBUG
@@ -184,9 +368,10 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
                             "event->cookie" << event->cookie << "exist counts " << ++exist_count;
             }
 #endif
-            const QList<QString> bps = batch_pathmap.values(id);
-            for (auto &path : paths) {
-                if (!bps.contains(path)) {
+            if (!batch_ids.contains(id)) {
+                batch_ids.insert(id);
+
+                for (auto &path : paths) {
                     batch_pathmap.insert(id, path);
                 }
             }
@@ -203,9 +388,34 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
             hasMoveFromByCookie << event->cookie;
     }
 
+    // 事件频率过高时进入风暴模式：不再逐个发送目录下文件的信号，风暴结束后通知重新读取目录
+    eventCountOfWindow += eventCountOfBatch;
+
+    if (!eventStorm) {
+        if (!eventRateTimer.isValid() || eventRateTimer.elapsed() > 1000) {
+            eventRateTimer.start();
+            eventCountOfWindow = eventCountOfBatch;
+        }
+
+        if (eventCountOfWindow > EventStormThreshold) {
+            qWarning() << "too many inotify events, stop emitting the signals of the files in the directories";
+
+            eventStorm = true;
+            eventCountOfWindow = 0;
+            eventStormTimer.start();
+        }
+    }
+
+    /// 目标路径被移动的文件，用于判断 IN_MOVE_SELF 事件是否为移动
+    QSet<QString> movedToFilePaths;
+
+    for (auto iterator = cookieToFilePath.constBegin(); iterator != cookieToFilePath.constEnd(); ++iterator) {
+        movedToFilePaths << QDir::cleanPath(iterator.value() + QDir::separator() + cookieToFileName.value(iterator.key()));
+    }
+
 //    qDebug() << "event count:" << eventList.count();
 
-    QList<inotify_event *>::const_iterator it = eventList.constBegin();
+    QList<const inotify_event *>::const_iterator it = eventList.constBegin();
     while (it != eventList.constEnd()) {
         const inotify_event &event = **it;
         ++it;
@@ -236,25 +446,8 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
 
             if ((event.mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT)) != 0) {
                 do {
-                    if (event.mask & IN_MOVE_SELF) {
-                        QMap<int, QString>::const_iterator iterator = cookieToFilePath.constBegin();
-
-                        bool isMove = false;
-
-                        while (iterator != cookieToFilePath.constEnd()) {
-                            const QString &_path = iterator.value();
-                            const QString &_name = cookieToFileName.value(iterator.key());
-
-                            if (QFileInfo(_path + QDir::separator() + _name) == QFileInfo(path)) {
-                                isMove = true;
-                                break;
-                            }
-
-                            ++iterator;
-                        }
-
-                        if (isMove)
-                            break;
+                    if ((event.mask & IN_MOVE_SELF) && movedToFilePaths.contains(QDir::cleanPath(path))) {
+                        break;
                     }
 
                     /// Keep watcher
@@ -287,8 +480,6 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
             }
 
             if (event.mask & IN_CREATE) {
-//                qDebug() << "IN_CREATE" << filePath << name;
-
                 if (name.isEmpty()) {
                     if (pathToID.contains(path)) {
                         q->removePath(path);
@@ -298,6 +489,33 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
                     q->removePath(filePath);
                     q->addPath(filePath);
                 }
+            }
+
+            // 风暴模式下只记录目录，风暴结束后由 subfilesChanged 通知重新读取目录
+            if (eventStorm && id < 0 && !name.isEmpty()) {
+                eventStormDirectories << path;
+                continue;
+            }
+
+            if (id < 0 && (event.mask & (IN_MODIFY | IN_CLOSE_WRITE))) {
+                changes.sizeChangedDirectories << path;
+            }
+
+            if (id < 0 && !name.isEmpty()) {
+                if (event.mask & (IN_CREATE | IN_MOVED_TO)) {
+                    changes.fileCreated(filePath, (event.mask & IN_ISDIR) != 0);
+                }
+
+                if (event.mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                    changes.contentChangedFiles << filePath;
+                    changes.removedFiles.remove(filePath);
+                } else if (event.mask & (IN_DELETE | IN_MOVED_FROM)) {
+                    changes.fileRemoved(filePath);
+                }
+            }
+
+            if (event.mask & IN_CREATE) {
+//                qDebug() << "IN_CREATE" << filePath << name;
 
                 emit q->fileCreated(path, name, DFileSystemWatcher::QPrivateSignal());
             }
@@ -350,6 +568,39 @@ void DFileSystemWatcherPrivate::_q_readFromInotify()
             }
         }
     }
+
+    globalFileChangeNotifier->post(changes);
+}
+
+void DFileSystemWatcherPrivate::_q_checkEventStorm()
+{
+    Q_Q(DFileSystemWatcher);
+
+    // 上一秒内的事件仍然过多，继续保持风暴模式
+    if (eventCountOfWindow > EventStormThreshold) {
+        eventCountOfWindow = 0;
+        return;
+    }
+
+    eventStormTimer.stop();
+    eventStorm = false;
+    eventCountOfWindow = 0;
+    eventRateTimer.start();
+
+    const QSet<QString> stormDirectories = eventStormDirectories;
+    eventStormDirectories.clear();
+
+    for (const QString &path : stormDirectories) {
+        if (directories.contains(path))
+            emit q->subfilesChanged(path, DFileSystemWatcher::QPrivateSignal());
+    }
+
+    // 风暴期间没有记录单个文件的变化，使这些目录缓存的大小失效，搜索时重新读取这些目录
+    FileChanges changes;
+
+    changes.sizeChangedDirectories = stormDirectories;
+    changes.changedDirectories = stormDirectories;
+    globalFileChangeNotifier->post(changes);
 }
 
 void DFileSystemWatcherPrivate::onFileChanged(const QString &path, bool removed)
@@ -39,6 +39,8 @@ Q_SIGNALS:
                    const QString &toPath, const QString &toName, QPrivateSignal);
     void fileCreated(const QString &path, const QString &name, QPrivateSignal);
     void fileModified(const QString &path, const QString &name, QPrivateSignal);
+    // 目录中的文件变化过于频繁时，不再发送单个文件的信号，而是在结束后通知重新读取此目录
+    void subfilesChanged(const QString &path, QPrivateSignal);
 
 private:
     QScopedPointer<DFileSystemWatcherPrivate> d_ptr;
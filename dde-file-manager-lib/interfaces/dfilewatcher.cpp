@@ -43,6 +43,7 @@ public:
     void _q_handleFileCreated(const QString &path, const QString &parentPath);
     void _q_handleFileModified(const QString &path, const QString &parentPath);
     void _q_handleFileClose(const QString &path, const QString &parentPath);
+    void _q_handleSubfilesChanged(const QString &path);
 
     static QString formatPath(const QString &path);
 
@@ -106,6 +107,8 @@ bool DFileWatcherPrivate::start()
                q, &DFileWatcher::onFileModified);
     q->connect(watcher_file_private, &DFileSystemWatcher::fileClosed,
                q, &DFileWatcher::onFileClosed);
+    q->connect(watcher_file_private, &DFileSystemWatcher::subfilesChanged,
+               q, &DFileWatcher::onSubfilesChanged);
 
     return true;
 }
@@ -250,6 +253,16 @@ void DFileWatcherPrivate::_q_handleFileClose(const QString &path, const QString
     emit q->fileClosed(DUrl::fromLocalFile(path));
 }
 
+void DFileWatcherPrivate::_q_handleSubfilesChanged(const QString &path)
+{
+    if (path != this->path)
+        return;
+
+    Q_Q(DFileWatcher);
+
+    emit q->subfilesChanged(url);
+}
+
 QString DFileWatcherPrivate::formatPath(const QString &path)
 {
     QString p = QFileInfo(path).absoluteFilePath();
@@ -325,6 +338,11 @@ void DFileWatcher::onFileClosed(const QString &path, const QString &name)
         d_func()->_q_handleFileClose(joinFilePath(path, name), path);
 }
 
+void DFileWatcher::onSubfilesChanged(const QString &path)
+{
+    d_func()->_q_handleSubfilesChanged(path);
+}
+
 QStringList DFileWatcher::getMonitorFiles()
 {
     QStringList list;
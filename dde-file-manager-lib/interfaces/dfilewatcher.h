@@ -31,6 +31,7 @@ private slots:
     void onFileCreated(const QString &path, const QString &name);
     void onFileModified(const QString &path, const QString &name);
     void onFileClosed(const QString &path, const QString &name);
+    void onSubfilesChanged(const QString &path);
 
 private:
     Q_DECLARE_PRIVATE(DFileWatcher)
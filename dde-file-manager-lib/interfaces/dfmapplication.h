@@ -69,7 +69,10 @@ public:
         GA_DisableNonRemovableDeviceUnmount, // 禁用本地磁盘卸载功能
         GA_HiddenSystemPartition, // 隐藏系统分区
         GA_ShowRecentFileEntry, // 在侧边栏显示“最近文件”入口
-        GA_ShowCsdCrumbBarClickableArea // 在面包屑栏预留可供点击以进入地址栏编辑状态的区域
+        GA_ShowCsdCrumbBarClickableArea, // 在面包屑栏预留可供点击以进入地址栏编辑状态的区域
+        GA_IndexFullTextSearch, // 搜索时同时搜索文件内容
+        GA_AsyncIntegrityChecking, // 复制文件时在后台校验已复制完成的文件
+        GA_IndexFileName // 没有 deepin-anything 的索引时使用内置的文件名索引搜索
     };
 
     Q_ENUM(GenericAttribute)
@@ -37,9 +37,12 @@
 #include <QDateTime>
 #include <QImageReader>
 #include <QQueue>
+#include <QCache>
 #include <QMimeType>
 #include <QReadWriteLock>
 #include <QWaitCondition>
+#include <QThreadPool>
+#include <QtConcurrent>
 #include <QPainter>
 #include <QDirIterator>
 #include <QJsonDocument>
@@ -75,34 +78,78 @@ public:
     QString sizeToFilePath(DThumbnailProvider::Size size) const;
 
     DThumbnailProvider *q_ptr;
+    // 多个线程会同时生成缩略图，记录最后一次生成失败的错误信息
     QString errorString;
+    mutable QMutex errorStringMutex;
     // 5MB
     qint64 defaultSizeLimit = 1024 * 1024 * 20;
     QHash<QMimeType, qint64> sizeLimitHash;
     DMimeDatabase mimeDatabase;
 
     static QSet<QString> hasThumbnailMimeHash;
+    static QReadWriteLock hasThumbnailMimeHashLock;
+
+    // 图片和文本文件的缩略图生成得很快，其它类型需要渲染文档或调用外部程序
+    enum ProduceCategory {
+        CheapProduce,
+        ExpensiveProduce,
+        ProduceCategoryCount
+    };
+
+    typedef QPair<QString, DThumbnailProvider::Size> ThumbnailKey;
 
     struct ProduceInfo {
         QFileInfo fileInfo;
         DThumbnailProvider::Size size;
-        DThumbnailProvider::CallBack callback;
+        // 对同一文件的多次请求会合并到一起，分别记录每个请求者的回调
+        QList<QPair<const void*, DThumbnailProvider::CallBack>> callbacks;
+        ProduceCategory category;
+        DThumbnailProvider::Priority priority;
+        // 在等待队列中的排序值
+        qint64 order;
+        bool producing = false;
     };
 
-    QQueue<ProduceInfo> produceQueue;
-    QSet<QPair<QString, DThumbnailProvider::Size>> discardedProduceInfos;
+    void setErrorString(const QString &error);
+    ProduceCategory categoryOf(const QFileInfo &info) const;
+    void enqueue(const ThumbnailKey &key, ProduceInfo &info, DThumbnailProvider::Priority priority);
+    bool takeProduceTask(ThumbnailKey *key);
+
+    QHash<ThumbnailKey, ProduceInfo> produceInfos;
+    // 每种类型的任务按排序值排队
+    QMap<qint64, ThumbnailKey> produceQueue[ProduceCategoryCount];
+    int producingCount[ProduceCategoryCount] = {0, 0};
+    int produceLimit[ProduceCategoryCount] = {1, 1};
+    qint64 produceSequence = 0;
+    QThreadPool workerPool;
 
     bool running = true;
 
     QWaitCondition waitCondition;
     QReadWriteLock dataReadWriteLock;
 
+    QMutex thumbnailToolMutex;
     QHash<QString, QString> keyToThumbnailTool;
+    // dtk 的缩略图生成器不能在多个线程中同时使用
+    QMutex dtkThumbnailMutex;
+
+    // 缓存解码后的缩略图，记录源文件的修改时间用于校验，避免重复读取缩略图文件
+    struct ImageCacheData {
+        uint mtime;
+        QImage image;
+    };
+
+    void cacheImage(const ThumbnailKey &key, uint mtime, const QImage &image) const;
+
+    mutable QMutex imageCacheMutex;
+    // 以字节为单位计算缓存的大小，默认64MB
+    mutable QCache<ThumbnailKey, ImageCacheData> imageCache {64 * 1024 * 1024};
 
     Q_DECLARE_PUBLIC(DThumbnailProvider)
 };
 
 QSet<QString> DThumbnailProviderPrivate::hasThumbnailMimeHash;
+QReadWriteLock DThumbnailProviderPrivate::hasThumbnailMimeHashLock;
 
 DThumbnailProviderPrivate::DThumbnailProviderPrivate(DThumbnailProvider *qq)
     : q_ptr(qq)
@@ -128,6 +175,72 @@ void DThumbnailProviderPrivate::init()
     sizeLimitHash.insert(mimeDatabase.mimeTypeForName("image/jpeg"), 1024 * 1024 * 30);
     sizeLimitHash.insert(mimeDatabase.mimeTypeForName("image/png"), 1024 * 1024 * 30);
     sizeLimitHash.insert(mimeDatabase.mimeTypeForName("image/pipeg"), 1024 * 1024 * 30);
+
+    produceLimit[CheapProduce] = qBound(2, QThread::idealThreadCount(), 4);
+    produceLimit[ExpensiveProduce] = qBound(1, QThread::idealThreadCount() / 4, 2);
+    workerPool.setMaxThreadCount(produceLimit[CheapProduce] + produceLimit[ExpensiveProduce]);
+}
+
+void DThumbnailProviderPrivate::setErrorString(const QString &error)
+{
+    QMutexLocker locker(&errorStringMutex);
+
+    errorString = error;
+}
+
+DThumbnailProviderPrivate::ProduceCategory DThumbnailProviderPrivate::categoryOf(const QFileInfo &info) const
+{
+    // 只根据文件名判断，避免在调用者的线程中读取文件内容
+    const QString &mime = mimeDatabase.mimeTypeForFile(info.fileName(), QMimeDatabase::MatchExtension).name();
+
+    if (mime.startsWith("image/") || mime == "text/plain")
+        return CheapProduce;
+
+    return ExpensiveProduce;
+}
+
+void DThumbnailProviderPrivate::enqueue(const ThumbnailKey &key, ProduceInfo &info, DThumbnailProvider::Priority priority)
+{
+    info.priority = priority;
+    info.order = ++produceSequence;
+
+    // 高优先级的任务排在所有普通任务之前，同一优先级内先来先处理
+    if (priority == DThumbnailProvider::HighPriority)
+        info.order -= Q_INT64_C(1) << 62;
+
+    produceQueue[info.category].insert(info.order, key);
+}
+
+void DThumbnailProviderPrivate::cacheImage(const ThumbnailKey &key, uint mtime, const QImage &image) const
+{
+    if (image.isNull())
+        return;
+
+    QMutexLocker locker(&imageCacheMutex);
+
+    imageCache.insert(key, new ImageCacheData {mtime, image}, image.bytesPerLine() * image.height());
+}
+
+bool DThumbnailProviderPrivate::takeProduceTask(ThumbnailKey *key)
+{
+    int category = -1;
+
+    for (int i = 0; i < ProduceCategoryCount; ++i) {
+        if (produceQueue[i].isEmpty() || producingCount[i] >= produceLimit[i])
+            continue;
+
+        if (category < 0 || produceQueue[i].firstKey() < produceQueue[category].firstKey())
+            category = i;
+    }
+
+    if (category < 0)
+        return false;
+
+    *key = produceQueue[category].take(produceQueue[category].firstKey());
+    produceInfos[*key].producing = true;
+    ++producingCount[category];
+
+    return true;
 }
 
 QString DThumbnailProviderPrivate::sizeToFilePath(DThumbnailProvider::Size size) const
@@ -201,10 +314,15 @@ bool DThumbnailProvider::hasThumbnail(const QMimeType &mimeType) const
         return false;
     }
 
-    if (DThumbnailProviderPrivate::hasThumbnailMimeHash.contains(mime))
-        return true;
+    {
+        QReadLocker locker(&DThumbnailProviderPrivate::hasThumbnailMimeHashLock);
+
+        if (DThumbnailProviderPrivate::hasThumbnailMimeHash.contains(mime))
+            return true;
+    }
 
     if (Q_LIKELY(mime.startsWith("image") || mime.startsWith("video/"))) {
+        QWriteLocker locker(&DThumbnailProviderPrivate::hasThumbnailMimeHashLock);
         DThumbnailProviderPrivate::hasThumbnailMimeHash.insert(mime);
 
         return true;
@@ -215,6 +333,7 @@ bool DThumbnailProvider::hasThumbnail(const QMimeType &mimeType) const
             || mime == "application/vnd.rn-realmedia"
             || mime == "application/vnd.ms-asf"
             || mime == "application/mxf")) {
+        QWriteLocker locker(&DThumbnailProviderPrivate::hasThumbnailMimeHashLock);
         DThumbnailProviderPrivate::hasThumbnailMimeHash.insert(mime);
 
         return true;
@@ -247,15 +366,32 @@ QString DThumbnailProvider::thumbnailFilePath(const QFileInfo &info, Size size)
         return QString();
     }
 
+    const DThumbnailProviderPrivate::ThumbnailKey key(absoluteFilePath, size);
+    const uint mtime = info.lastModified().toTime_t();
+    QMutexLocker locker(&d->imageCacheMutex);
+
+    // 缓存的图片和文件的修改时间一致时，缩略图文件也是有效的
+    if (const DThumbnailProviderPrivate::ImageCacheData *data = d->imageCache.object(key)) {
+        if (data->mtime == mtime)
+            return thumbnail;
+    }
+
+    locker.unlock();
+
+    // 只读取文件头中的文本信息，不解码图片
     QImageReader ir(thumbnail, QByteArray(FORMAT).mid(1));
 
     ir.setAutoDetectImageFormat(false);
 
-    const QImage image = ir.read();
+    const QString &thumb_mtime = ir.text(QT_STRINGIFY(Thumb::MTime));
 
-    if (!image.isNull() && image.text(QT_STRINGIFY(Thumb::MTime)).toInt() != (int)info.lastModified().toTime_t()) {
+    if (!thumb_mtime.isEmpty() && thumb_mtime.toInt() != (int)mtime) {
         QFile::remove(thumbnail);
 
+        locker.relock();
+        d->imageCache.remove(key);
+        locker.unlock();
+
         emit thumbnailChanged(absoluteFilePath, QString());
 
         return QString();
@@ -264,6 +400,39 @@ QString DThumbnailProvider::thumbnailFilePath(const QFileInfo &info, Size size)
     return thumbnail;
 }
 
+QImage DThumbnailProvider::thumbnailImage(const QFileInfo &info, DThumbnailProvider::Size size) const
+{
+    Q_D(const DThumbnailProvider);
+
+    const DThumbnailProviderPrivate::ThumbnailKey key(info.absoluteFilePath(), size);
+    const uint mtime = info.lastModified().toTime_t();
+    QMutexLocker locker(&d->imageCacheMutex);
+
+    if (const DThumbnailProviderPrivate::ImageCacheData *data = d->imageCache.object(key)) {
+        if (data->mtime == mtime)
+            return data->image;
+    }
+
+    locker.unlock();
+
+    // 缓存中没有时读取缩略图文件，成功读取后加入缓存
+    const QString &thumbnail = thumbnailFilePath(info, size);
+
+    if (thumbnail.isEmpty())
+        return QImage();
+
+    QImageReader ir(thumbnail, QByteArray(FORMAT).mid(1));
+
+    ir.setAutoDetectImageFormat(false);
+
+    const QImage &image = ir.read();
+
+    if (!image.isNull())
+        d->cacheImage(key, mtime, image);
+
+    return image;
+}
+
 static QString generalKey(const QString &key)
 {
     const QStringList &_tmp = key.split('/');
@@ -278,7 +447,7 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
 {
     Q_D(DThumbnailProvider);
 
-    d->errorString.clear();
+    QString error_string;
 
     const QString &absolutePath = info.absolutePath();
     const QString &absoluteFilePath = info.absoluteFilePath();
@@ -291,7 +460,8 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
     }
 
     if (!hasThumbnail(info)) {
-        d->errorString = QStringLiteral("This file has not support thumbnail: ") + absoluteFilePath;
+        error_string = QStringLiteral("This file has not support thumbnail: ") + absoluteFilePath;
+        d->setErrorString(error_string);
 
         //!Warnning: Do not store thumbnails to the fail path
         return QString();
@@ -325,14 +495,14 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
         QImageReader reader(absoluteFilePath, mime.preferredSuffix().toLatin1());
 
         if (!reader.canRead()) {
-            d->errorString = reader.errorString();
+            error_string = reader.errorString();
             goto _return;
         }
 
         const QSize &imageSize = reader.size();
 
 //        if(!imageSize.isValid()){
-//            d->errorString = "Fail to read image file attribute data:" + info.absoluteFilePath();
+//            error_string = "Fail to read image file attribute data:" + info.absoluteFilePath();
 //            goto _return;
 //        }
 
@@ -341,7 +511,7 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
         }
 
         if (!reader.read(image.data())) {
-            d->errorString = reader.errorString();
+            error_string = reader.errorString();
             goto _return;
         }
 
@@ -353,7 +523,7 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
         QFile file(absoluteFilePath);
 
         if (!file.open(QIODevice::ReadOnly)) {
-            d->errorString = file.errorString();
+            error_string = file.errorString();
             goto _return;
         }
 
@@ -382,19 +552,19 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
         QScopedPointer<poppler::document> doc(poppler::document::load_from_file(absoluteFilePath.toStdString()));
 
         if (!doc || doc->is_locked()) {
-            d->errorString = QStringLiteral("Cannot read this pdf file: ") + absoluteFilePath;
+            error_string = QStringLiteral("Cannot read this pdf file: ") + absoluteFilePath;
             goto _return;
         }
 
         if (doc->pages() < 1) {
-            d->errorString = QStringLiteral("This stream is invalid");
+            error_string = QStringLiteral("This stream is invalid");
             goto _return;
         }
 
         QScopedPointer<const poppler::page> page(doc->create_page(0));
 
         if (!page) {
-            d->errorString = QStringLiteral("Cannot get this page at index 0");
+            error_string = QStringLiteral("Cannot get this page at index 0");
             goto _return;
         }
 
@@ -405,7 +575,7 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
         poppler::image imageData = pr.render_page(page.data(), 72, 72, -1, -1, -1, size);
 
         if (!imageData.is_valid()) {
-            d->errorString = QStringLiteral("Render error");
+            error_string = QStringLiteral("Render error");
             goto _return;
         }
 
@@ -414,7 +584,7 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
 
         switch (format) {
         case poppler::image::format_invalid:
-            d->errorString = QStringLiteral("Image format is invalid");
+            error_string = QStringLiteral("Image format is invalid");
             goto _return;
         case poppler::image::format_mono:
             img = QImage((uchar*)imageData.data(), imageData.width(), imageData.height(), QImage::Format_Mono);
@@ -430,21 +600,26 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
         }
 
         if (img.isNull()) {
-            d->errorString = QStringLiteral("Render error");
+            error_string = QStringLiteral("Render error");
             goto _return;
         }
 
         *image = img.scaled(QSize(size, size), Qt::KeepAspectRatio, Qt::SmoothTransformation);
     } else {
+        QMutexLocker dtk_locker(&d->dtkThumbnailMutex);
+
         thumbnail = DTK_GUI_NAMESPACE::DThumbnailProvider::instance()->createThumbnail(info, (DTK_GUI_NAMESPACE::DThumbnailProvider::Size)size);
-        d->errorString = DTK_GUI_NAMESPACE::DThumbnailProvider::instance()->errorString();
+        error_string = DTK_GUI_NAMESPACE::DThumbnailProvider::instance()->errorString();
+        dtk_locker.unlock();
 
-        if (d->errorString.isEmpty()) {
+        if (error_string.isEmpty()) {
             emit createThumbnailFinished(absoluteFilePath, thumbnail);
             emit thumbnailChanged(absoluteFilePath, thumbnail);
 
             return thumbnail;
         } else { // fallback to thumbnail tool
+            QMutexLocker tool_locker(&d->thumbnailToolMutex);
+
             if (d->keyToThumbnailTool.isEmpty()) {
                 d->keyToThumbnailTool["Initialized"] = QString();
 
@@ -490,6 +665,8 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
                 tool = d->keyToThumbnailTool.value(mime_name);
             }
 
+            tool_locker.unlock();
+
             if (tool.isEmpty()) {
                 return thumbnail;
             }
@@ -498,7 +675,7 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
             process.start(tool, {QString::number(size), absoluteFilePath}, QIODevice::ReadOnly);
 
             if (!process.waitForFinished()) {
-                d->errorString = process.errorString();
+                error_string = process.errorString();
 
                 goto _return;
             }
@@ -507,9 +684,9 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
                 const QString &error = process.readAllStandardError();
 
                 if (error.isEmpty()) {
-                    d->errorString = QString("get thumbnail failed from the \"%1\" application").arg(tool);
+                    error_string = QString("get thumbnail failed from the \"%1\" application").arg(tool);
                 } else {
-                    d->errorString = error;
+                    error_string = error;
                 }
 
                 goto _return;
@@ -519,16 +696,16 @@ QString DThumbnailProvider::createThumbnail(const QFileInfo &info, DThumbnailPro
             Q_ASSERT(!png_data.isEmpty());
 
             if (image->loadFromData(png_data, "png")) {
-                d->errorString.clear();
+                error_string.clear();
             } else {
-                d->errorString = QString("load png image failed from the \"%1\" application").arg(tool);
+                error_string = QString("load png image failed from the \"%1\" application").arg(tool);
             }
         }
     }
 
 _return:
     // successful
-    if (d->errorString.isEmpty()) {
+    if (error_string.isEmpty()) {
         thumbnail = d->sizeToFilePath(size) + QDir::separator() + thumbnailName;
     } else {
         //fail
@@ -542,10 +719,12 @@ _return:
     QFileInfo(thumbnail).absoluteDir().mkpath(".");
 
     if (!image->save(thumbnail, Q_NULLPTR, 80)) {
-        d->errorString = QStringLiteral("Can not save image to ") + thumbnail;
+        error_string = QStringLiteral("Can not save image to ") + thumbnail;
     }
 
-    if (d->errorString.isEmpty()) {
+    if (error_string.isEmpty()) {
+        d->cacheImage(qMakePair(absoluteFilePath, size), info.lastModified().toTime_t(), *image);
+
         emit createThumbnailFinished(absoluteFilePath, thumbnail);
         emit thumbnailChanged(absoluteFilePath, thumbnail);
 
@@ -553,48 +732,99 @@ _return:
     }
 
     // fail
+    d->setErrorString(error_string);
     emit createThumbnailFailed(absoluteFilePath);
 
     return QString();
 }
 
-void DThumbnailProvider::appendToProduceQueue(const QFileInfo &info, DThumbnailProvider::Size size, DThumbnailProvider::CallBack callback)
+void DThumbnailProvider::appendToProduceQueue(const QFileInfo &info, DThumbnailProvider::Size size, DThumbnailProvider::CallBack callback,
+                                              DThumbnailProvider::Priority priority, const void *requester)
 {
-    DThumbnailProviderPrivate::ProduceInfo produceInfo;
+    Q_D(DThumbnailProvider);
 
-    produceInfo.fileInfo = info;
-    produceInfo.size = size;
-    produceInfo.callback = callback;
+    const DThumbnailProviderPrivate::ThumbnailKey key(info.absoluteFilePath(), size);
+    QWriteLocker locker(&d->dataReadWriteLock);
+    auto it = d->produceInfos.find(key);
 
-    Q_D(DThumbnailProvider);
+    if (it != d->produceInfos.end()) {
+        it->callbacks << qMakePair(requester, callback);
+
+        if (!it->producing && priority > it->priority) {
+            d->produceQueue[it->category].remove(it->order);
+            d->enqueue(key, *it, priority);
+        }
+    } else {
+        DThumbnailProviderPrivate::ProduceInfo produceInfo;
+
+        produceInfo.fileInfo = info;
+        produceInfo.size = size;
+        produceInfo.callbacks << qMakePair(requester, callback);
+        produceInfo.category = d->categoryOf(info);
+
+        d->enqueue(key, produceInfo, priority);
+        d->produceInfos.insert(key, produceInfo);
+    }
+
+    locker.unlock();
 
     if (isRunning()) {
-        QWriteLocker locker(&d->dataReadWriteLock);
-        d->produceQueue.append(std::move(produceInfo));
-        locker.unlock();
         d->waitCondition.wakeAll();
     } else {
-        d->produceQueue.append(std::move(produceInfo));
         start();
     }
 }
 
-void DThumbnailProvider::removeInProduceQueue(const QFileInfo &info, DThumbnailProvider::Size size)
+void DThumbnailProvider::removeInProduceQueue(const QFileInfo &info, DThumbnailProvider::Size size, const void *requester)
 {
     Q_D(DThumbnailProvider);
 
-    if (isRunning()) {
-        QWriteLocker locker(&d->dataReadWriteLock);
-        Q_UNUSED(locker)
+    const DThumbnailProviderPrivate::ThumbnailKey key(info.absoluteFilePath(), size);
+    QWriteLocker locker(&d->dataReadWriteLock);
+    auto it = d->produceInfos.find(key);
+
+    if (it == d->produceInfos.end())
+        return;
+
+    // 只移除此请求者的回调，其它合并进来的请求不受影响
+    if (requester) {
+        for (int i = it->callbacks.size() - 1; i >= 0; --i) {
+            if (it->callbacks.at(i).first == requester)
+                it->callbacks.removeAt(i);
+        }
+    } else {
+        it->callbacks.clear();
     }
 
-    d->discardedProduceInfos.insert(qMakePair(info.absoluteFilePath(), size));
+    // 正在生成的缩略图不能取消，生成完成后没有回调需要调用
+    if (!it->callbacks.isEmpty() || it->producing)
+        return;
+
+    d->produceQueue[it->category].remove(it->order);
+    d->produceInfos.erase(it);
+}
+
+void DThumbnailProvider::setProducePriority(const QFileInfo &info, DThumbnailProvider::Size size, DThumbnailProvider::Priority priority)
+{
+    Q_D(DThumbnailProvider);
+
+    const DThumbnailProviderPrivate::ThumbnailKey key(info.absoluteFilePath(), size);
+    QWriteLocker locker(&d->dataReadWriteLock);
+    auto it = d->produceInfos.find(key);
+
+    if (it == d->produceInfos.end() || it->producing || it->priority == priority)
+        return;
+
+    d->produceQueue[it->category].remove(it->order);
+    d->enqueue(key, *it, priority);
 }
 
 QString DThumbnailProvider::errorString() const
 {
     Q_D(const DThumbnailProvider);
 
+    QMutexLocker locker(&d->errorStringMutex);
+
     return d->errorString;
 }
 
@@ -637,40 +867,49 @@ DThumbnailProvider::~DThumbnailProvider()
 {
     Q_D(DThumbnailProvider);
 
+    QWriteLocker locker(&d->dataReadWriteLock);
     d->running = false;
+    locker.unlock();
     d->waitCondition.wakeAll();
     wait();
+    d->workerPool.waitForDone();
 }
 
 void DThumbnailProvider::run()
 {
     Q_D(DThumbnailProvider);
 
+    // 只负责调度，缩略图在线程池中生成，每种类型同时生成的数量有各自的上限
     forever {
         QWriteLocker locker(&d->dataReadWriteLock);
+        DThumbnailProviderPrivate::ThumbnailKey key;
 
-        if (d->produceQueue.isEmpty()) {
+        while (d->running && !d->takeProduceTask(&key)) {
             d->waitCondition.wait(&d->dataReadWriteLock);
         }
 
         if (!d->running)
             return;
 
-        const DThumbnailProviderPrivate::ProduceInfo &task = d->produceQueue.dequeue();
-        const QPair<QString, DThumbnailProvider::Size> &tmpKey = qMakePair(task.fileInfo.absoluteFilePath(), task.size);
-
-        if (d->discardedProduceInfos.contains(tmpKey)) {
-            d->discardedProduceInfos.remove(tmpKey);
-            locker.unlock();
-            continue;
-        }
+        const DThumbnailProviderPrivate::ProduceInfo task = d->produceInfos.value(key);
 
         locker.unlock();
 
-        const QString &thumbnail = createThumbnail(task.fileInfo, task.size);
+        QtConcurrent::run(&d->workerPool, [this, d, key, task] {
+            const QString &thumbnail = createThumbnail(task.fileInfo, task.size);
 
-        if (task.callback)
-            task.callback(thumbnail);
+            QWriteLocker locker(&d->dataReadWriteLock);
+            // 生成期间可能有新的请求合并进来
+            const auto callbacks = d->produceInfos.take(key).callbacks;
+            --d->producingCount[task.category];
+            locker.unlock();
+            d->waitCondition.wakeAll();
+
+            for (const auto &callback : callbacks) {
+                if (callback.second)
+                    callback.second(thumbnail);
+            }
+        });
     }
 }
 
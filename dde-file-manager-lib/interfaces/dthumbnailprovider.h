@@ -27,6 +27,7 @@
 
 #include <QThread>
 #include <QFileInfo>
+#include <QImage>
 
 #include "dfmglobal.h"
 
@@ -50,17 +51,27 @@ public:
         Large = 256,
     };
 
+    enum Priority {
+        NormalPriority,
+        // 用于视图中可见的文件，会排在所有普通请求之前
+        HighPriority
+    };
+
     static DThumbnailProvider *instance();
 
     bool hasThumbnail(const QFileInfo &info) const;
     bool hasThumbnail(const QMimeType &mimeType) const;
 
     QString thumbnailFilePath(const QFileInfo &info, Size size) const;
+    QImage thumbnailImage(const QFileInfo &info, Size size) const;
 
     QString createThumbnail(const QFileInfo &info, Size size);
     typedef std::function<void(const QString&)> CallBack;
-    void appendToProduceQueue(const QFileInfo &info, Size size, CallBack callback = 0);
-    void removeInProduceQueue(const QFileInfo &info, Size size);
+    // requester 用于区分合并到同一任务中的请求，移除请求时只移除此请求者的回调
+    void appendToProduceQueue(const QFileInfo &info, Size size, CallBack callback = 0,
+                              Priority priority = NormalPriority, const void *requester = nullptr);
+    void removeInProduceQueue(const QFileInfo &info, Size size, const void *requester = nullptr);
+    void setProducePriority(const QFileInfo &info, Size size, Priority priority);
 
     QString errorString() const;
 
@@ -14,6 +14,8 @@
 #include "dmimedatabase.h"
 
 #include <QPointer>
+#include <QMutex>
+#include <QCollator>
 
 QT_BEGIN_NAMESPACE
 class QReadWriteLock;
@@ -33,6 +35,11 @@ public:
     DAbstractFileInfo *q_ptr = Q_NULLPTR;
 
     mutable QString pinyinName;
+    // 排序时每次比较都进行完整的字符串排序计算代价太大，缓存显示名称的排序键
+    mutable QMutex sortKeyMutex;
+    mutable QString sortKeyText;
+    mutable QScopedPointer<QCollatorSortKey> sortKey;
+    mutable bool sortKeyStartWithHanzi = false;
     bool active = false;
 
     DAbstractFileInfoPointer proxy;
@@ -13,6 +13,9 @@
 #include "durl.h"
 #include "dabstractfilewatcher.h"
 
+#include <QHash>
+#include <QMultiMap>
+
 class DAbstractFileWatcherPrivate
 {
 public:
@@ -28,7 +31,16 @@ public:
 
     DUrl url;
     bool started = false;
-    static QList<DAbstractFileWatcher*> watcherList;
+    // 为false时不按路径过滤，同一scheme下的所有ghostSignal都会交给此watcher处理
+    bool ghostSignalMatchPath = true;
+
+    // 按scheme和路径索引的watcher，ghostSignal只会发给可能处理此信号的watcher
+    static QHash<QString, QMultiMap<QString, DAbstractFileWatcher*>> watcherPathIndex;
+    static QMultiHash<QString, DAbstractFileWatcher*> schemeWatchers;
+
+    static void registerWatcher(DAbstractFileWatcher *watcher);
+    static void unregisterWatcher(DAbstractFileWatcher *watcher);
+    static QList<DAbstractFileWatcher*> watchersForUrls(const DUrlList &urls, const DUrlList &parentUrls);
 
     Q_DECLARE_PUBLIC(DAbstractFileWatcher)
 };
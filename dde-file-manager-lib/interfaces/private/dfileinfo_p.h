@@ -34,7 +34,8 @@ public:
     mutable QIcon icon;
     mutable bool iconFromTheme = false;
     mutable QPointer<QTimer> getIconTimer;
-    bool requestingThumbnail = false;
+    // 在主线程和缩略图生成线程中都会修改
+    QAtomicInt requestingThumbnail = 0;
     mutable bool needThumbnail = false;
     // 小于0时表示此值未初始化，0表示不支持，1表示支持
     mutable qint8 hasThumbnail = -1;
@@ -13,8 +13,31 @@
 #include "dfilesystemwatcher.h"
 
 #include <QSocketNotifier>
+#include <QElapsedTimer>
+#include <QTimer>
 #include <QHash>
 #include <QMap>
+#include <QSet>
+
+// 用于 inotify 事件的去重
+struct InotifyEventKey
+{
+    int wd;
+    quint32 mask;
+    quint32 cookie;
+    QByteArray name;
+
+    bool operator==(const InotifyEventKey &other) const
+    {
+        return wd == other.wd && mask == other.mask
+                && cookie == other.cookie && name == other.name;
+    }
+};
+
+inline uint qHash(const InotifyEventKey &key, uint seed = 0)
+{
+    return qHash(key.name, seed) ^ qHash(key.wd) ^ qHash(key.mask) ^ qHash(key.cookie);
+}
 
 class DFileSystemWatcherPrivate
 {
@@ -35,8 +58,21 @@ public:
     QMultiHash<int, QString> idToPath;
     QSocketNotifier notifier;
 
+    // 每次读取 inotify 的块大小，以及单次处理的数据上限
+    static constexpr int InotifyReadBlockSize = 64 * 1024;
+    static constexpr int MaxReadSizeOnce = 4 * 1024 * 1024;
+    // 每秒的事件数超过此值时进入风暴模式
+    static constexpr int EventStormThreshold = 10000;
+
+    QElapsedTimer eventRateTimer;
+    int eventCountOfWindow = 0;
+    bool eventStorm = false;
+    QTimer eventStormTimer;
+    QSet<QString> eventStormDirectories;
+
     // private slots
     void _q_readFromInotify();
+    void _q_checkEventStorm();
 
 private:
     void onFileChanged(const QString &path, bool removed);
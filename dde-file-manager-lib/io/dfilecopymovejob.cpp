@@ -28,16 +28,37 @@
 #include "ddiriterator.h"
 #include "dfilestatisticsjob.h"
 #include "dlocalfiledevice.h"
+#include "dlocalfilehandler.h"
 
 #include <QMutex>
 #include <QTimer>
 #include <QLoggingCategory>
 #include <QProcess>
+#include <QFileInfo>
+#include <QThreadPool>
+#include <QtConcurrent>
 
 #include <unistd.h>
 #include <zlib.h>
 #include <fcntl.h>
 
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+#ifdef Q_OS_LINUX
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#endif
+
 DFM_BEGIN_NAMESPACE
 
 #ifdef QT_DEBUG
@@ -153,6 +174,7 @@ DFileCopyMoveJobPrivate::DFileCopyMoveJobPrivate(DFileCopyMoveJob *qq)
 
 DFileCopyMoveJobPrivate::~DFileCopyMoveJobPrivate()
 {
+    releaseCopyBuffers();
     delete updateSpeedElapsedTimer;
 }
 
@@ -198,6 +220,114 @@ QString DFileCopyMoveJobPrivate::errorToString(DFileCopyMoveJob::Error error)
     return QString();
 }
 
+struct Crc32cTable
+{
+    Crc32cTable()
+    {
+        for (quint32 i = 0; i < 256; ++i) {
+            quint32 crc = i;
+
+            for (int j = 0; j < 8; ++j) {
+                crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+            }
+
+            data[i] = crc;
+        }
+    }
+
+    quint32 data[256];
+};
+
+static quint32 crc32cSoftware(quint32 crc, const uchar *data, qint64 size)
+{
+    static const Crc32cTable table;
+
+    while (size-- > 0) {
+        crc = table.data[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+__attribute__((target("sse4.2")))
+static quint32 crc32cHardware(quint32 crc, const uchar *data, qint64 size)
+{
+    quint64 crc64 = crc;
+
+    for (; size >= 8; size -= 8, data += 8) {
+        quint64 value;
+
+        memcpy(&value, data, sizeof(value));
+        crc64 = _mm_crc32_u64(crc64, value);
+    }
+
+    crc = static_cast<quint32>(crc64);
+
+    while (size-- > 0) {
+        crc = _mm_crc32_u8(crc, *data++);
+    }
+
+    return crc;
+}
+
+static quint32 crc32c(quint32 crc, const uchar *data, qint64 size)
+{
+    static const bool has_sse42 = __builtin_cpu_supports("sse4.2");
+
+    return has_sse42 ? crc32cHardware(crc, data, size) : crc32cSoftware(crc, data, size);
+}
+#elif defined(__aarch64__) && defined(__ARM_FEATURE_CRC32)
+static quint32 crc32c(quint32 crc, const uchar *data, qint64 size)
+{
+    for (; size >= 8; size -= 8, data += 8) {
+        quint64 value;
+
+        memcpy(&value, data, sizeof(value));
+        crc = __crc32cd(crc, value);
+    }
+
+    while (size-- > 0) {
+        crc = __crc32cb(crc, *data++);
+    }
+
+    return crc;
+}
+#else
+static quint32 crc32c(quint32 crc, const uchar *data, qint64 size)
+{
+    return crc32cSoftware(crc, data, size);
+}
+#endif
+
+quint32 DFileCopyMoveJobPrivate::checksumInit(DFileCopyMoveJob::ChecksumType type)
+{
+    switch (type) {
+    case DFileCopyMoveJob::Crc32Checksum:
+        return crc32(0L, nullptr, 0);
+    case DFileCopyMoveJob::Crc32cChecksum:
+        return 0;
+    default:
+        break;
+    }
+
+    return adler32(0L, nullptr, 0);
+}
+
+quint32 DFileCopyMoveJobPrivate::checksumUpdate(DFileCopyMoveJob::ChecksumType type, quint32 checksum, const char *data, qint64 size)
+{
+    switch (type) {
+    case DFileCopyMoveJob::Crc32Checksum:
+        return crc32(checksum, reinterpret_cast<const Bytef *>(data), static_cast<uInt>(size));
+    case DFileCopyMoveJob::Crc32cChecksum:
+        return ~crc32c(~checksum, reinterpret_cast<const uchar *>(data), size);
+    default:
+        break;
+    }
+
+    return adler32(checksum, reinterpret_cast<const Bytef *>(data), static_cast<uInt>(size));
+}
+
 qint64 DFileCopyMoveJobPrivate::getWriteBytes(long tid)
 {
     QFile file(QStringLiteral("/proc/self/task/%1/io").arg(tid));
@@ -261,7 +391,7 @@ qint64 DFileCopyMoveJobPrivate::getCompletedDataSize() const
         return (getSectorsWritten() - targetDeviceStartSectorsWritten) * targetLogSecionSize;
     }
 
-    return completedDataSize;
+    return completedDataSize + parallelCopiedDataSize.load();
 }
 
 void DFileCopyMoveJobPrivate::setState(DFileCopyMoveJob::State s)
@@ -366,6 +496,10 @@ DFileCopyMoveJob::Action DFileCopyMoveJobPrivate::handleError(const DAbstractFil
 
     setState(DFileCopyMoveJob::SleepState);
 
+    QElapsedTimer wait_timer;
+
+    wait_timer.start();
+
     do {
         if (threadOfErrorHandle && threadOfErrorHandle->loopLevel() > 0) {
             lastErrorHandleAction = DThreadUtil::runInThread(threadOfErrorHandle, handle, &DFileCopyMoveJob::Handle::handleError,
@@ -380,6 +514,8 @@ DFileCopyMoveJob::Action DFileCopyMoveJobPrivate::handleError(const DAbstractFil
         }
     } while (lastErrorHandleAction == DFileCopyMoveJob::NoAction);
 
+    errorHandleTime += wait_timer.elapsed();
+
     if (state == DFileCopyMoveJob::SleepState) {
         setState(DFileCopyMoveJob::RunningState);
     }
@@ -737,6 +873,13 @@ process_file:
         }
 
         if (mode == DFileCopyMoveJob::CopyMode) {
+            // 交给复制线程池处理，避免逐个打开/关闭小文件时的延迟拖慢整个任务
+            if (canCopyInParallel(source_info.constData(), new_file_info.constData())) {
+                enqueueParallelCopy(from, source_info.constData(), new_file_info.constData(), target_info);
+
+                return true;
+            }
+
             if (new_file_info->isSymLink() || fileHints.testFlag(DFileCopyMoveJob::RemoveDestination)) {
                 if (!removeFile(handler, new_file_info.constData())) {
                     return false;
@@ -790,8 +933,23 @@ process_file:
         }
 
         if (ok) {
-            handler->setFileTime(new_file_info->fileUrl(), si_last_read, si_last_modified);
-            joinToCompletedDirectoryList(from, new_file_info->fileUrl(), size);
+            const DUrl &to_url = new_file_info->fileUrl();
+            const DFileCopyMoveJob::Action action = lastErrorHandleAction;
+
+            // 目录中的文件可能还在被并行复制，写入文件会改变目录的修改时间
+            runAfterParallelCopy([this, from, to_url, size, si_last_read, si_last_modified, action] {
+                QScopedPointer<DFileHandler> to_handler(DFileService::instance()->createFileHandler(nullptr, to_url));
+
+                if (to_handler) {
+                    to_handler->setFileTime(to_url, si_last_read, si_last_modified);
+                }
+
+                const DFileCopyMoveJob::Action current_action = lastErrorHandleAction;
+
+                lastErrorHandleAction = action;
+                joinToCompletedDirectoryList(from, to_url, size);
+                lastErrorHandleAction = current_action;
+            });
         }
 
         return ok;
@@ -858,6 +1016,10 @@ bool DFileCopyMoveJobPrivate::mergeDirectory(DFileHandler *handler, const DAbstr
         if (lastErrorHandleAction == DFileCopyMoveJob::SkipAction) {
             existsSkipFile = true;
         }
+
+        if (!processParallelCopyQueue(false) || !processIntegrityCheckQueue(false)) {
+            return false;
+        }
     }
 
     if (enter_dir) {
@@ -865,7 +1027,17 @@ bool DFileCopyMoveJobPrivate::mergeDirectory(DFileHandler *handler, const DAbstr
     }
 
     if (toInfo) {
-        handler->setPermissions(toInfo->fileUrl(), fromInfo->permissions());
+        const DUrl &to_url = toInfo->fileUrl();
+        const QFileDevice::Permissions permissions = fromInfo->permissions();
+
+        // 目录设置为只读后将无法在其中创建文件，需要等待并行复制完成
+        runAfterParallelCopy([to_url, permissions] {
+            QScopedPointer<DFileHandler> to_handler(DFileService::instance()->createFileHandler(nullptr, to_url));
+
+            if (to_handler) {
+                to_handler->setPermissions(to_url, permissions);
+            }
+        });
     }
 
     if (mode == DFileCopyMoveJob::CopyMode) {
@@ -978,7 +1150,40 @@ open_file: {
     currentJobFileHandle = toDevice->handle();
 
 //    int writtenDataSize = 0;
-    uLong source_checksum = adler32(0L, nullptr, 0);
+    quint32 source_checksum = checksumInit(checksumType);
+    bool copied_by_kernel = false;
+    bool cloned_by_kernel = false;
+    char *data = ensureCopyBuffer(blockSize);
+
+    // 读写不在同一设备上时，使用单独的线程预读数据，使两个设备可以同时工作。
+    // 内核复制会在同一线程中交替读写，因此这种情况下优先使用预读
+    if (canUsePipelineCopy(fromDevice.data())) {
+        switch (doPipelineCopy(fromDevice.data(), toDevice.data(), fromInfo, toInfo, &source_checksum)) {
+        case DFileCopyMoveJob::NoAction:
+            goto close_file;
+        case DFileCopyMoveJob::SkipAction:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    if (!fileHints.testFlag(DFileCopyMoveJob::DontUseKernelCopy)) {
+        switch (doKernelCopyFile(fromDevice.data(), toDevice.data(), fromInfo, toInfo, blockSize)) {
+        case KernelCopyFinished:
+            copied_by_kernel = true;
+            goto close_file;
+        case KernelCopyCloned:
+            cloned_by_kernel = true;
+            goto close_file;
+        case KernelCopySkipped:
+            return true;
+        case KernelCopyFailed:
+            return false;
+        default:
+            break;
+        }
+    }
 
     Q_FOREVER {
         qint64 current_pos = fromDevice->pos();
@@ -987,7 +1192,6 @@ open_file: {
             return false;
         }
 
-        char data[blockSize + 1];
         qint64 size_read = fromDevice->read(data, blockSize);
 
         if (Q_UNLIKELY(size_read <= 0)) {
@@ -1020,89 +1224,89 @@ open_file: {
             }
         }
 
-        current_pos = toDevice->pos();
-    write_data:
-        if (Q_UNLIKELY(!stateCheck())) {
+        switch (writeData(toDevice.data(), data, size_read, fromInfo, toInfo)) {
+        case DFileCopyMoveJob::NoAction:
+            break;
+        case DFileCopyMoveJob::SkipAction:
+            return true;
+        default:
             return false;
         }
 
-        qint64 size_write = toDevice->write(data, size_read);
-
-        if (Q_UNLIKELY(size_write != size_read)) {
-            do {
-                // 在某些情况下（往sftp挂载目录写入），可能一次未能写入那么多数据
-                // 但不代表写入失败，应该继续尝试，直到所有数据全部写入
-                if (size_write > 0) {
-                    const char *surplus_data = data;
-                    qint64 surplus_size = size_read;
+        if (Q_LIKELY(!fileHints.testFlag(DFileCopyMoveJob::DontIntegrityChecking))) {
+            source_checksum = checksumUpdate(checksumType, source_checksum, data, size_read);
+        }
+    }
 
-                    do {
-                        currentJobDataSizeInfo.second += size_write;
-                        completedDataSize += size_write;
-                        //        writtenDataSize += size_write;
+close_file:
+    // 关闭文件时可能会需要很长时间，因为内核可能要把内存里的脏数据回写到硬盘
+    setState(DFileCopyMoveJob::IOWaitState);
+    fromDevice->close();
+    toDevice->close();
 
-                        surplus_data += size_write;
-                        surplus_size -= size_write;
+    if (state == DFileCopyMoveJob::IOWaitState) {
+        setState(DFileCopyMoveJob::RunningState);
+    } else if (Q_UNLIKELY(!stateCheck())) {
+        return false;
+    }
 
-                        size_write = toDevice->write(surplus_data, surplus_size);
-                    } while (size_write > 0 && size_write != surplus_size);
+    if (cloned_by_kernel || fileHints.testFlag(DFileCopyMoveJob::DontIntegrityChecking)) {
+        return true;
+    }
 
-                    // 表示全部数据写入完成
-                    if (size_write > 0) {
-                        break;
-                    }
-                }
+    // 内核复制时数据不经过用户空间，只有要求校验时才重新读取源文件和目标文件，否则会抵消内核复制带来的速度提升
+    if (copied_by_kernel) {
+        if (!fileHints.testFlag(DFileCopyMoveJob::AsyncIntegrityChecking)) {
+            return true;
+        }
 
-                if (checkFreeSpace(currentJobDataSizeInfo.first - currentJobDataSizeInfo.second)) {
-                    setError(DFileCopyMoveJob::WriteError, qApp->translate("DFileCopyMoveJob", "Failed to write the file, cause: %1").arg(toDevice->errorString()));
-                } else {
-                    setError(DFileCopyMoveJob::NotEnoughSpaceError);
-                }
+        if (mode != DFileCopyMoveJob::MoveMode) {
+            enqueueIntegrityCheck(fromInfo->fileUrl(), toInfo->fileUrl(), currentJobDataSizeInfo.second, 0, true);
 
-                switch (handleError(fromInfo, toInfo)) {
-                case DFileCopyMoveJob::RetryAction: {
-                    if (!toDevice->seek(current_pos)) {
-                        setError(DFileCopyMoveJob::UnknowError, toDevice->errorString());
+            return true;
+        }
 
-                        return false;
-                    }
+        // 移动文件时复制完成后会立即删除源文件，必须在此之前完成校验
+        IntegrityCheckInfo info;
 
-                    goto write_data;
-                }
-                case DFileCopyMoveJob::SkipAction:
-                    return true;
-                default:
-                    return false;
-                }
-            } while (false);
-        }
+        info.source = fromInfo->fileUrl();
+        info.target = toInfo->fileUrl();
+        info.checksumType = checksumType;
+        info.sourceChecksum = 0;
+        info.readSource = true;
 
-        currentJobDataSizeInfo.second += size_write;
-        completedDataSize += size_write;
-//        writtenDataSize += size_write;
+        setState(DFileCopyMoveJob::IOWaitState);
+        doIntegrityCheck(&info);
 
-        if (Q_LIKELY(!fileHints.testFlag(DFileCopyMoveJob::DontIntegrityChecking))) {
-            source_checksum = adler32(source_checksum, reinterpret_cast<Bytef *>(data), size_read);
+        if (state == DFileCopyMoveJob::IOWaitState) {
+            setState(DFileCopyMoveJob::RunningState);
+        } else if (Q_UNLIKELY(!stateCheck())) {
+            return false;
         }
 
-//        if (Q_UNLIKELY(writtenDataSize > 20000000)) {
-//            writtenDataSize = 0;
-//            toDevice->syncToDisk();
-//        }
-    }
+        if (info.ok) {
+            return true;
+        }
 
-    // 关闭文件时可能会需要很长时间，因为内核可能要把内存里的脏数据回写到硬盘
-    setState(DFileCopyMoveJob::IOWaitState);
-    fromDevice->close();
-    toDevice->close();
+        setError(DFileCopyMoveJob::IntegrityCheckingError, info.errorString);
 
-    if (state == DFileCopyMoveJob::IOWaitState) {
-        setState(DFileCopyMoveJob::RunningState);
-    } else if (Q_UNLIKELY(!stateCheck())) {
-        return false;
+        switch (handleError(fromInfo, toInfo)) {
+        case DFileCopyMoveJob::RetryAction:
+            completedDataSize -= currentJobDataSizeInfo.second;
+            currentJobDataSizeInfo.second = 0;
+            goto open_file;
+        case DFileCopyMoveJob::SkipAction:
+            return true;
+        default:
+            return false;
+        }
     }
 
-    if (fileHints.testFlag(DFileCopyMoveJob::DontIntegrityChecking)) {
+    // 在复制下一个文件时校验，避免读写相互等待。移动文件时源文件会在复制后立即删除，不能延后校验
+    if (fileHints.testFlag(DFileCopyMoveJob::AsyncIntegrityChecking) && mode != DFileCopyMoveJob::MoveMode
+            && toInfo->fileUrl().isLocalFile()) {
+        enqueueIntegrityCheck(fromInfo->fileUrl(), toInfo->fileUrl(), currentJobDataSizeInfo.second, source_checksum);
+
         return true;
     }
 
@@ -1121,8 +1325,7 @@ open_file: {
         return true;
     }
 
-    char data[blockSize + 1];
-    ulong target_checksum = adler32(0L, nullptr, 0);
+    quint32 target_checksum = checksumInit(checksumType);
 
     qint64 elapsed_time_checksum = 0;
 
@@ -1151,7 +1354,7 @@ open_file: {
             }
         }
 
-        target_checksum = adler32(target_checksum, reinterpret_cast<Bytef *>(data), size);
+        target_checksum = checksumUpdate(checksumType, target_checksum, data, size);
 
         if (Q_UNLIKELY(!stateCheck())) {
             return false;
@@ -1161,7 +1364,7 @@ open_file: {
     qCDebug(fileJob(), "Time spent of integrity check of the file: %lld", updateSpeedElapsedTimer->elapsed() - elapsed_time_checksum);
 
     if (source_checksum != target_checksum) {
-        qCWarning(fileJob(), "Failed on file integrity checking, source file: 0x%lx, target file: 0x%lx", source_checksum, target_checksum);
+        qCWarning(fileJob(), "Failed on file integrity checking, source file: 0x%x, target file: 0x%x", source_checksum, target_checksum);
 
         setError(DFileCopyMoveJob::IntegrityCheckingError);
         DFileCopyMoveJob::Action action = handleError(fromInfo, toInfo);
@@ -1171,130 +1374,1157 @@ open_file: {
         }
 
         if (action == DFileCopyMoveJob::RetryAction) {
+            // 重新复制整个文件，减去本次已经计入进度的数据
+            completedDataSize -= currentJobDataSizeInfo.second;
+            currentJobDataSizeInfo.second = 0;
             goto open_file;
         }
 
         return false;
     }
 
-    qCDebug(fileJob(), "adler value: 0x%lx", source_checksum);
+    qCDebug(fileJob(), "checksum type: %d, value: 0x%x", checksumType, source_checksum);
 
     return true;
 }
 
-bool DFileCopyMoveJobPrivate::doRemoveFile(DFileHandler *handler, const DAbstractFileInfo *fileInfo)
+DFileCopyMoveJob::Action DFileCopyMoveJobPrivate::writeData(DFileDevice *toDevice, const char *data, qint64 size,
+                                                            const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo)
 {
-    if (!fileInfo->exists()) {
-        return true;
+    const qint64 start_pos = toDevice->pos();
+
+write_data:
+    if (Q_UNLIKELY(!stateCheck())) {
+        return DFileCopyMoveJob::CancelAction;
     }
 
-    DFileCopyMoveJob::Action action = DFileCopyMoveJob::NoAction;
-    bool is_file = fileInfo->isFile() || fileInfo->isSymLink();
+    const char *surplus_data = data;
+    qint64 surplus_size = size;
 
-    do {
-        if (is_file ? handler->remove(fileInfo->fileUrl()) : handler->rmdir(fileInfo->fileUrl())) {
-            return true;
-        }
+    // 在某些情况下（往sftp挂载目录写入），可能一次未能写入那么多数据
+    // 但不代表写入失败，应该继续尝试，直到所有数据全部写入
+    Q_FOREVER {
+        qint64 size_write = toDevice->write(surplus_data, surplus_size);
 
-        if (fileInfo->canRename()) {
-            setError(DFileCopyMoveJob::RemoveError, qApp->translate("DFileCopyMoveJob", "Failed to delete the file, cause: %1").arg(handler->errorString()));
-        } else {
-            setError(DFileCopyMoveJob::PermissionError);
+        if (Q_UNLIKELY(size_write <= 0)) {
+            break;
         }
 
-        action = handleError(fileInfo, nullptr);
-    } while (action == DFileCopyMoveJob::RetryAction);
-
-    return action == DFileCopyMoveJob::SkipAction;
-}
+        currentJobDataSizeInfo.second += size_write;
+        completedDataSize += size_write;
 
-bool DFileCopyMoveJobPrivate::doRenameFile(DFileHandler *handler, const DAbstractFileInfo *oldInfo, const DAbstractFileInfo *newInfo)
-{
-    const DStorageInfo &storage_source = directoryStack.top().sourceStorageInfo;
-    const DStorageInfo &storage_target = directoryStack.top().targetStorageInfo;
+        surplus_data += size_write;
+        surplus_size -= size_write;
 
-    if (storage_target.device() != "gvfsd-fuse" || storage_source == storage_target) {
-        // 先尝试直接rename
-        if (handler->rename(oldInfo->fileUrl(), newInfo->fileUrl())) {
-            return true;
+        if (Q_LIKELY(surplus_size <= 0)) {
+            return DFileCopyMoveJob::NoAction;
         }
     }
 
-    qCDebug(fileJob(), "Failed on rename, Well be copy and delete the file");
-
-    // 先复制再删除
-    if (!doCopyFile(oldInfo, newInfo)) {
-        return false;
+    if (checkFreeSpace(currentJobDataSizeInfo.first - currentJobDataSizeInfo.second)) {
+        setError(DFileCopyMoveJob::WriteError, qApp->translate("DFileCopyMoveJob", "Failed to write the file, cause: %1").arg(toDevice->errorString()));
+    } else {
+        setError(DFileCopyMoveJob::NotEnoughSpaceError);
     }
 
-    if (lastErrorHandleAction == DFileCopyMoveJob::SkipAction) {
-        // 说明复制文件过程被跳过
-        return true;
-    }
+    switch (handleError(fromInfo, toInfo)) {
+    case DFileCopyMoveJob::RetryAction: {
+        if (!toDevice->seek(start_pos)) {
+            setError(DFileCopyMoveJob::UnknowError, toDevice->errorString());
 
-    handler->setFileTime(newInfo->fileUrl(), oldInfo->lastRead(), oldInfo->lastModified());
-    handler->setPermissions(newInfo->fileUrl(), oldInfo->permissions());
+            return DFileCopyMoveJob::CancelAction;
+        }
 
-    if (!doRemoveFile(handler, oldInfo)) {
-        return false;
+        // 重新写入整块数据
+        currentJobDataSizeInfo.second -= size - surplus_size;
+        completedDataSize -= size - surplus_size;
+
+        goto write_data;
+    }
+    case DFileCopyMoveJob::SkipAction:
+        return DFileCopyMoveJob::SkipAction;
+    default:
+        break;
     }
 
-    return true;
+    return DFileCopyMoveJob::CancelAction;
 }
 
-bool DFileCopyMoveJobPrivate::doLinkFile(DFileHandler *handler, const DAbstractFileInfo *fileInfo, const QString &linkPath)
+class ReadAheadPipeline
 {
-    if (fileInfo->exists()) {
-        if (!removeFile(handler, fileInfo)) {
-            return false;
+public:
+    struct Block {
+        char *data = nullptr;
+        qint64 pos = 0;
+        qint64 size = 0;
+        bool atEnd = false;
+        QString errorString;
+    };
+
+    ReadAheadPipeline(char *buffer, int blockCount, int blockSize)
+        : blocks(blockCount)
+        , blockSize(blockSize)
+    {
+        for (int i = 0; i < blockCount; ++i) {
+            blocks[i].data = buffer + static_cast<qint64>(i) * blockSize;
         }
     }
 
-    DFileCopyMoveJob::Action action = DFileCopyMoveJob::NoAction;
+    ~ReadAheadPipeline()
+    {
+        stop();
+    }
 
-    do {
-        if (handler->link(linkPath, fileInfo->fileUrl())) {
-            return true;
-        }
+    void start(DFileDevice *device, QThreadPool *pool)
+    {
+        head = 0;
+        tail = 0;
+        filled = 0;
+        stopped = false;
+        future = QtConcurrent::run(pool, [this, device] {
+            readLoop(device);
+        });
+    }
 
-        setError(DFileCopyMoveJob::SymlinkError, qApp->translate("DFileCopyMoveJob", "Fail to create symlink, cause: %1").arg(handler->errorString()));
-        action = handleError(fileInfo, nullptr);
-    } while (action == DFileCopyMoveJob::RetryAction);
+    void stop()
+    {
+        mutex.lock();
+        stopped = true;
+        notFull.wakeAll();
+        mutex.unlock();
 
-    return action == DFileCopyMoveJob::SkipAction;
-}
+        future.waitForFinished();
+    }
 
-bool DFileCopyMoveJobPrivate::process(const DUrl &from, const DAbstractFileInfo *target_info)
-{
-    const DAbstractFileInfoPointer &source_info = DFileService::instance()->createFileInfo(nullptr, from);
+    // 超时返回nullptr，使调用者有机会检查任务的状态
+    Block *takeBlock(unsigned long timeout)
+    {
+        QMutexLocker locker(&mutex);
 
-    return process(from, source_info, target_info);
-}
+        if (filled == 0) {
+            notEmpty.wait(&mutex, timeout);
+        }
 
-bool DFileCopyMoveJobPrivate::process(const DUrl &from, const DAbstractFileInfoPointer &source_info, const DAbstractFileInfo *target_info)
-{
-    // reset error and action
-    unsetError();
-    lastErrorHandleAction = DFileCopyMoveJob::NoAction;
+        return filled > 0 ? &blocks[tail] : nullptr;
+    }
 
-    beginJob(JobInfo::Preprocess, from, (source_info && target_info) ? target_info->getUrlByChildFileName(source_info->fileName()) : DUrl());
-    bool ok = doProcess(from, source_info, target_info);
-    endJob();
+    void releaseBlock()
+    {
+        QMutexLocker locker(&mutex);
 
-    return ok;
-}
+        tail = (tail + 1) % blocks.size();
+        --filled;
+        notFull.wakeAll();
+    }
 
-bool DFileCopyMoveJobPrivate::copyFile(const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo, int blockSize)
-{
-    qint64 elapsed = 0;
+private:
+    void readLoop(DFileDevice *device)
+    {
+        Q_FOREVER {
+            mutex.lock();
 
-    if (fileJob().isDebugEnabled()) {
-        elapsed = updateSpeedElapsedTimer->elapsed();
-    }
+            while (filled == blocks.size() && !stopped) {
+                notFull.wait(&mutex);
+            }
 
-    beginJob(JobInfo::Copy, fromInfo->fileUrl(), toInfo->fileUrl());
-    bool ok = doCopyFile(fromInfo, toInfo, blockSize);
-    endJob();
+            if (stopped) {
+                mutex.unlock();
+
+                return;
+            }
+
+            Block &block = blocks[head];
+
+            mutex.unlock();
+
+            block.pos = device->pos();
+            block.size = device->read(block.data, blockSize);
+            block.atEnd = block.size <= 0 && device->atEnd();
+
+            if (block.size < 0) {
+                block.errorString = device->errorString();
+            }
+
+            mutex.lock();
+            head = (head + 1) % blocks.size();
+            ++filled;
+            notEmpty.wakeAll();
+            mutex.unlock();
+
+            // 读取完成或出错，由写入线程决定如何处理
+            if (block.size <= 0) {
+                return;
+            }
+        }
+    }
+
+    std::vector<Block> blocks;
+    const int blockSize;
+    int head = 0;
+    int tail = 0;
+    int filled = 0;
+    bool stopped = false;
+    QMutex mutex;
+    QWaitCondition notEmpty;
+    QWaitCondition notFull;
+    QFuture<void> future;
+};
+
+bool DFileCopyMoveJobPrivate::canUsePipelineCopy(DFileDevice *fromDevice) const
+{
+    // 小文件的读写时间很短，不值得使用预读线程
+    if (fromDevice->size() < static_cast<qint64>(pipelineBlockSize) * pipelineBlockCount || directoryStack.isEmpty()) {
+        return false;
+    }
+
+    const DirectoryInfo &info = directoryStack.top();
+
+    // 在同一磁盘上同时读写会导致磁头来回寻道，同一磁盘的不同分区也是如此
+    return info.sourceDisk.isEmpty() || info.targetDisk.isEmpty() || info.sourceDisk != info.targetDisk;
+}
+
+QByteArray DFileCopyMoveJobPrivate::diskOfDevice(const QByteArray &device)
+{
+#ifdef Q_OS_LINUX
+    struct stat device_stat;
+
+    if (device.startsWith("/dev/") && stat(device.constData(), &device_stat) == 0 && S_ISBLK(device_stat.st_mode)) {
+        // /sys/dev/block/主:次设备号 链接到块设备的目录，分区的目录在其所在磁盘的目录下
+        const QString &sys_path = QString("/sys/dev/block/%1:%2").arg(major(device_stat.st_rdev)).arg(minor(device_stat.st_rdev));
+        const QString &real_path = QFileInfo(sys_path).canonicalFilePath();
+
+        if (!real_path.isEmpty()) {
+            if (QFile::exists(real_path + "/partition")) {
+                return QFileInfo(real_path).path().toLocal8Bit();
+            }
+
+            return real_path.toLocal8Bit();
+        }
+    }
+#endif
+
+    return device;
+}
+
+DFileCopyMoveJob::Action DFileCopyMoveJobPrivate::doPipelineCopy(DFileDevice *fromDevice, DFileDevice *toDevice,
+                                                                 const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo,
+                                                                 quint32 *checksum)
+{
+    if (!readAheadPool) {
+        readAheadPool = new QThreadPool();
+        readAheadPool->setMaxThreadCount(1);
+    }
+
+    ReadAheadPipeline pipeline(ensurePipelineBuffer(), pipelineBlockCount, pipelineBlockSize);
+    QElapsedTimer timer;
+    const qint64 start_size = currentJobDataSizeInfo.second;
+    const qint64 start_error_handle_time = errorHandleTime;
+
+    timer.start();
+    pipeline.start(fromDevice, readAheadPool);
+
+    Q_FOREVER {
+        if (Q_UNLIKELY(!stateCheck())) {
+            return DFileCopyMoveJob::CancelAction;
+        }
+
+        ReadAheadPipeline::Block *block = pipeline.takeBlock(100);
+
+        if (!block) {
+            continue;
+        }
+
+        if (Q_UNLIKELY(block->size <= 0)) {
+            if (block->atEnd) {
+                break;
+            }
+
+            const_cast<DAbstractFileInfo *>(fromInfo)->refresh();
+
+            if (fromInfo->exists()) {
+                setError(DFileCopyMoveJob::ReadError, qApp->translate("DFileCopyMoveJob", "Failed to read the file, cause: %1").arg(block->errorString));
+            } else {
+                setError(DFileCopyMoveJob::NonexistenceError);
+            }
+
+            switch (handleError(fromInfo, toInfo)) {
+            case DFileCopyMoveJob::RetryAction:
+                pipeline.stop();
+
+                if (!fromDevice->seek(block->pos)) {
+                    setError(DFileCopyMoveJob::UnknowError, fromDevice->errorString());
+
+                    return DFileCopyMoveJob::CancelAction;
+                }
+
+                pipeline.start(fromDevice, readAheadPool);
+                continue;
+            case DFileCopyMoveJob::SkipAction:
+                return DFileCopyMoveJob::SkipAction;
+            default:
+                return DFileCopyMoveJob::CancelAction;
+            }
+        }
+
+        DFileCopyMoveJob::Action action = writeData(toDevice, block->data, block->size, fromInfo, toInfo);
+
+        if (action != DFileCopyMoveJob::NoAction) {
+            return action;
+        }
+
+        if (Q_LIKELY(!fileHints.testFlag(DFileCopyMoveJob::DontIntegrityChecking))) {
+            *checksum = checksumUpdate(checksumType, *checksum, block->data, block->size);
+        }
+
+        pipeline.releaseBlock();
+    }
+
+    // 根据实际的读写速度调整块大小，使每块数据的读写时间保持在几十毫秒左右
+    const qint64 elapsed = timer.elapsed() - (errorHandleTime - start_error_handle_time);
+    const qint64 speed = (currentJobDataSizeInfo.second - start_size) * 1000 / qMax<qint64>(elapsed, 1);
+    int block_size = minPipelineBlockSize;
+
+    while (block_size < maxPipelineBlockSize && block_size < speed / 32) {
+        block_size *= 2;
+    }
+
+    if (block_size != pipelineBlockSize) {
+        qCDebug(fileJob(), "copy speed: %lld, pipeline block size: %d", speed, block_size);
+
+        pipelineBlockSize = block_size;
+    }
+
+    return DFileCopyMoveJob::NoAction;
+}
+
+char *DFileCopyMoveJobPrivate::ensureCopyBuffer(int size)
+{
+    if (copyBufferSize < size) {
+        free(copyBuffer);
+        copyBuffer = nullptr;
+        copyBufferSize = 0;
+
+        void *buffer = nullptr;
+
+        if (posix_memalign(&buffer, 4096, static_cast<size_t>(size)) != 0) {
+            qFatal("Failed on allocate the copy buffer, size: %d", size);
+        }
+
+        copyBuffer = static_cast<char *>(buffer);
+        copyBufferSize = size;
+    }
+
+    return copyBuffer;
+}
+
+char *DFileCopyMoveJobPrivate::ensurePipelineBuffer()
+{
+    if (!pipelineBuffer) {
+        void *buffer = nullptr;
+
+        if (posix_memalign(&buffer, 4096, static_cast<size_t>(maxPipelineBlockSize) * pipelineBlockCount) != 0) {
+            qFatal("Failed on allocate the pipeline buffer");
+        }
+
+        pipelineBuffer = static_cast<char *>(buffer);
+    }
+
+    return pipelineBuffer;
+}
+
+void DFileCopyMoveJobPrivate::releaseCopyBuffers()
+{
+    free(copyBuffer);
+    copyBuffer = nullptr;
+    copyBufferSize = 0;
+
+    free(pipelineBuffer);
+    pipelineBuffer = nullptr;
+
+    delete readAheadPool;
+    readAheadPool = nullptr;
+}
+
+#ifdef Q_OS_LINUX
+static bool kernelCopyIsUnsupported(int error_number)
+{
+    switch (error_number) {
+    case ENOSYS:
+    case EXDEV: // 内核版本低于5.3时不支持跨文件系统的copy_file_range
+    case EINVAL:
+    case EOPNOTSUPP:
+    case EBADF:
+        return true;
+    default:
+        break;
+    }
+
+    return false;
+}
+#endif
+
+DFileCopyMoveJobPrivate::KernelCopyResult DFileCopyMoveJobPrivate::doKernelCopyFile(DFileDevice *fromDevice, DFileDevice *toDevice,
+                                                                                     const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo,
+                                                                                     int blockSize)
+{
+#ifdef Q_OS_LINUX
+    const int from_fd = fromDevice->handle();
+    const int to_fd = toDevice->handle();
+
+    // 只有两端都是本地文件时才能交给内核复制
+    if (from_fd <= 0 || to_fd <= 0 || !fromInfo->fileUrl().isLocalFile() || !toInfo->fileUrl().isLocalFile()) {
+        return KernelCopyUnsupported;
+    }
+
+#ifdef FICLONE
+    // 在btrfs/xfs等支持reflink的文件系统上，同一文件系统内的复制只需要共享数据块
+    if (currentJobDataSizeInfo.first > 0 && ioctl(to_fd, FICLONE, from_fd) == 0) {
+        currentJobDataSizeInfo.second += currentJobDataSizeInfo.first;
+        completedDataSize += currentJobDataSizeInfo.first;
+
+        qCDebug(fileJob(), "file is cloned by reflink, size: %lld", currentJobDataSizeInfo.first);
+
+        return KernelCopyCloned;
+    }
+#endif
+
+    // 每次交给内核复制的数据大小，在两次复制之间检查任务状态和更新进度
+    const size_t chunk_size = static_cast<size_t>(blockSize) * 8;
+    qint64 copied_size = 0;
+#ifdef __NR_copy_file_range
+    bool use_copy_file_range = true;
+#else
+    bool use_copy_file_range = false;
+#endif
+
+    Q_FOREVER {
+        const off_t from_pos = lseek(from_fd, 0, SEEK_CUR);
+        const off_t to_pos = lseek(to_fd, 0, SEEK_CUR);
+
+        if (Q_UNLIKELY(!stateCheck())) {
+            return KernelCopyFailed;
+        }
+
+        ssize_t size_copied = -1;
+
+        if (use_copy_file_range) {
+#ifdef __NR_copy_file_range
+            size_copied = syscall(__NR_copy_file_range, from_fd, nullptr, to_fd, nullptr, chunk_size, 0);
+#endif
+
+            // 某些文件系统会对copy_file_range直接返回0，此时改用sendfile
+            if ((size_copied < 0 && kernelCopyIsUnsupported(errno))
+                    || (size_copied == 0 && copied_size == 0 && currentJobDataSizeInfo.first > 0)) {
+                use_copy_file_range = false;
+                continue;
+            }
+        } else {
+            size_copied = sendfile(to_fd, from_fd, nullptr, chunk_size);
+
+            if ((size_copied < 0 && kernelCopyIsUnsupported(errno))
+                    || (size_copied == 0 && copied_size == 0 && currentJobDataSizeInfo.first > 0)) {
+                qCDebug(fileJob(), "kernel copy is unsupported, will be copy the file by buffer, copied size: %lld", copied_size);
+
+                // 从已复制的位置继续使用缓冲区读写的方式复制
+                if (!fromDevice->seek(from_pos) || !toDevice->seek(to_pos)) {
+                    setError(DFileCopyMoveJob::UnknowError, fromDevice->errorString() + toDevice->errorString());
+
+                    return KernelCopyFailed;
+                }
+
+                return KernelCopyUnsupported;
+            }
+        }
+
+        if (Q_LIKELY(size_copied > 0)) {
+            copied_size += size_copied;
+            currentJobDataSizeInfo.second += size_copied;
+            completedDataSize += size_copied;
+
+            continue;
+        }
+
+        // 已到达文件末尾
+        if (size_copied == 0) {
+            break;
+        }
+
+        const int error_number = errno;
+
+        if (error_number == EINTR) {
+            continue;
+        }
+
+        const_cast<DAbstractFileInfo *>(fromInfo)->refresh();
+
+        if (!fromInfo->exists()) {
+            setError(DFileCopyMoveJob::NonexistenceError);
+        } else if (error_number == ENOSPC || error_number == EDQUOT
+                   || !checkFreeSpace(currentJobDataSizeInfo.first - currentJobDataSizeInfo.second)) {
+            setError(DFileCopyMoveJob::NotEnoughSpaceError);
+        } else {
+            setError(DFileCopyMoveJob::WriteError, qApp->translate("DFileCopyMoveJob", "Failed to write the file, cause: %1").arg(QString::fromLocal8Bit(strerror(error_number))));
+        }
+
+        switch (handleError(fromInfo, toInfo)) {
+        case DFileCopyMoveJob::RetryAction:
+            if (lseek(from_fd, from_pos, SEEK_SET) < 0 || lseek(to_fd, to_pos, SEEK_SET) < 0) {
+                setError(DFileCopyMoveJob::UnknowError, QString::fromLocal8Bit(strerror(errno)));
+
+                return KernelCopyFailed;
+            }
+
+            break;
+        case DFileCopyMoveJob::SkipAction:
+            return KernelCopySkipped;
+        default:
+            return KernelCopyFailed;
+        }
+    }
+
+    qCDebug(fileJob(), "file is copied by %s, size: %lld", use_copy_file_range ? "copy_file_range" : "sendfile", copied_size);
+
+    return KernelCopyFinished;
+#else
+    Q_UNUSED(fromDevice)
+    Q_UNUSED(toDevice)
+    Q_UNUSED(fromInfo)
+    Q_UNUSED(toInfo)
+    Q_UNUSED(blockSize)
+
+    return KernelCopyUnsupported;
+#endif
+}
+
+bool DFileCopyMoveJobPrivate::doRemoveFile(DFileHandler *handler, const DAbstractFileInfo *fileInfo)
+{
+    if (!fileInfo->exists()) {
+        return true;
+    }
+
+    DFileCopyMoveJob::Action action = DFileCopyMoveJob::NoAction;
+    bool is_file = fileInfo->isFile() || fileInfo->isSymLink();
+
+    do {
+        if (is_file ? handler->remove(fileInfo->fileUrl()) : handler->rmdir(fileInfo->fileUrl())) {
+            return true;
+        }
+
+        if (fileInfo->canRename()) {
+            setError(DFileCopyMoveJob::RemoveError, qApp->translate("DFileCopyMoveJob", "Failed to delete the file, cause: %1").arg(handler->errorString()));
+        } else {
+            setError(DFileCopyMoveJob::PermissionError);
+        }
+
+        action = handleError(fileInfo, nullptr);
+    } while (action == DFileCopyMoveJob::RetryAction);
+
+    return action == DFileCopyMoveJob::SkipAction;
+}
+
+bool DFileCopyMoveJobPrivate::doRenameFile(DFileHandler *handler, const DAbstractFileInfo *oldInfo, const DAbstractFileInfo *newInfo)
+{
+    const DStorageInfo &storage_source = directoryStack.top().sourceStorageInfo;
+    const DStorageInfo &storage_target = directoryStack.top().targetStorageInfo;
+
+    if (storage_target.device() != "gvfsd-fuse" || storage_source == storage_target) {
+        // 先尝试直接rename
+        if (handler->rename(oldInfo->fileUrl(), newInfo->fileUrl())) {
+            return true;
+        }
+    }
+
+    qCDebug(fileJob(), "Failed on rename, Well be copy and delete the file");
+
+    // 先复制再删除
+    if (!doCopyFile(oldInfo, newInfo)) {
+        return false;
+    }
+
+    if (lastErrorHandleAction == DFileCopyMoveJob::SkipAction) {
+        // 说明复制文件过程被跳过
+        return true;
+    }
+
+    handler->setFileTime(newInfo->fileUrl(), oldInfo->lastRead(), oldInfo->lastModified());
+    handler->setPermissions(newInfo->fileUrl(), oldInfo->permissions());
+
+    if (!doRemoveFile(handler, oldInfo)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool DFileCopyMoveJobPrivate::doLinkFile(DFileHandler *handler, const DAbstractFileInfo *fileInfo, const QString &linkPath)
+{
+    if (fileInfo->exists()) {
+        if (!removeFile(handler, fileInfo)) {
+            return false;
+        }
+    }
+
+    DFileCopyMoveJob::Action action = DFileCopyMoveJob::NoAction;
+
+    do {
+        if (handler->link(linkPath, fileInfo->fileUrl())) {
+            return true;
+        }
+
+        setError(DFileCopyMoveJob::SymlinkError, qApp->translate("DFileCopyMoveJob", "Fail to create symlink, cause: %1").arg(handler->errorString()));
+        action = handleError(fileInfo, nullptr);
+    } while (action == DFileCopyMoveJob::RetryAction);
+
+    return action == DFileCopyMoveJob::SkipAction;
+}
+
+void DFileCopyMoveJobPrivate::initParallelCopy()
+{
+    if (mode != DFileCopyMoveJob::CopyMode || !targetUrl.isLocalFile()) {
+        return;
+    }
+
+    int count = parallelCopyCount;
+
+    if (count <= 0) {
+        // 可移除设备的随机写入性能一般都很差
+        count = targetIsRemovable ? 2 : qBound(2, QThread::idealThreadCount(), 8);
+    }
+
+    if (count <= 1) {
+        return;
+    }
+
+    parallelCopyPool = new QThreadPool();
+    parallelCopyPool->setMaxThreadCount(count);
+    parallelCopiedDataSize = 0;
+    // 复制线程写入的数据不会计入此任务线程的 write_bytes 中
+    canUseWriteBytes = 0;
+
+    qCDebug(fileJob(), "parallel copy count: %d", count);
+}
+
+bool DFileCopyMoveJobPrivate::canCopyInParallel(const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo) const
+{
+    // 大文件并行复制没有意义，且需要单独显示其复制进度
+    static const qint64 max_file_size = 16 * 1024 * 1024;
+
+    if (!parallelCopyPool || parallelCopyFallback) {
+        return false;
+    }
+
+    // 复制线程中只使用内核复制，且目标文件必须不存在，冲突和错误都由任务线程处理
+    if (fileHints.testFlag(DFileCopyMoveJob::DontUseKernelCopy)
+            || fileHints.testFlag(DFileCopyMoveJob::RemoveDestination)
+            || fileHints.testFlag(DFileCopyMoveJob::ResizeDestinationFile)) {
+        return false;
+    }
+
+    if (!fromInfo->fileUrl().isLocalFile() || !toInfo->fileUrl().isLocalFile()) {
+        return false;
+    }
+
+    return !toInfo->exists() && !toInfo->isSymLink() && fromInfo->size() < max_file_size;
+}
+
+void DFileCopyMoveJobPrivate::enqueueParallelCopy(const DUrl &from, const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo,
+                                                  const DAbstractFileInfo *targetDirectory)
+{
+    ParallelCopyInfoPointer info(new ParallelCopyInfo());
+
+    info->from = from;
+    info->source = fromInfo->fileUrl();
+    info->target = toInfo->fileUrl();
+    info->targetDirectory = targetDirectory->fileUrl();
+    info->lastRead = fromInfo->lastRead();
+    info->lastModified = fromInfo->lastModified();
+    info->permissions = fromInfo->permissions();
+    info->size = fromInfo->size();
+
+    parallelCopyQueue.enqueue(info);
+
+    QtConcurrent::run(parallelCopyPool, [this, info] {
+        doParallelCopyFile(info.data());
+
+        QMutexLocker locker(&parallelCopyMutex);
+
+        info->finished = 1;
+        parallelCopyCondition.wakeAll();
+    });
+}
+
+void DFileCopyMoveJobPrivate::doParallelCopyFile(ParallelCopyInfo *info)
+{
+#ifdef Q_OS_LINUX
+    if (!parallelCopyStateCheck()) {
+        return;
+    }
+
+    const QByteArray &source_path = info->source.toLocalFile().toLocal8Bit();
+    const QByteArray &target_path = info->target.toLocalFile().toLocal8Bit();
+    int from_fd = ::open(source_path.constData(), O_RDONLY | O_CLOEXEC);
+
+    if (from_fd < 0) {
+        return;
+    }
+
+    // 目标文件必须由此线程创建，已存在时交给任务线程处理冲突
+    int to_fd = ::open(target_path.constData(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+
+    if (to_fd < 0) {
+        ::close(from_fd);
+
+        return;
+    }
+
+    posix_fadvise(from_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    const size_t chunk_size = 8 * 1024 * 1024;
+    bool ok = false;
+#ifdef __NR_copy_file_range
+    bool use_copy_file_range = true;
+#else
+    bool use_copy_file_range = false;
+#endif
+
+    Q_FOREVER {
+        if (!parallelCopyStateCheck()) {
+            break;
+        }
+
+        ssize_t size_copied = -1;
+
+        if (use_copy_file_range) {
+#ifdef __NR_copy_file_range
+            size_copied = syscall(__NR_copy_file_range, from_fd, nullptr, to_fd, nullptr, chunk_size, 0);
+#endif
+
+            if ((size_copied < 0 && kernelCopyIsUnsupported(errno))
+                    || (size_copied == 0 && info->copiedSize == 0 && info->size > 0)) {
+                use_copy_file_range = false;
+                continue;
+            }
+        } else {
+            size_copied = sendfile(to_fd, from_fd, nullptr, chunk_size);
+
+            // 不支持内核复制时交给任务线程处理
+            if (size_copied == 0 && info->copiedSize == 0 && info->size > 0) {
+                break;
+            }
+        }
+
+        if (size_copied > 0) {
+            info->copiedSize += size_copied;
+            parallelCopiedDataSize.fetchAndAddRelaxed(size_copied);
+
+            continue;
+        }
+
+        if (size_copied == 0) {
+            ok = true;
+            break;
+        }
+
+        if (errno != EINTR) {
+            break;
+        }
+    }
+
+    ::close(from_fd);
+
+    if (::close(to_fd) != 0) {
+        ok = false;
+    }
+
+    if (!ok) {
+        ::unlink(target_path.constData());
+        parallelCopiedDataSize.fetchAndAddRelaxed(-info->copiedSize);
+        info->copiedSize = 0;
+
+        return;
+    }
+
+    DLocalFileHandler handler;
+
+    handler.setFileTime(info->target, info->lastRead, info->lastModified);
+    handler.setPermissions(info->target, info->permissions);
+    info->ok = true;
+#else
+    Q_UNUSED(info)
+#endif
+}
+
+bool DFileCopyMoveJobPrivate::parallelCopyStateCheck()
+{
+    while (state == DFileCopyMoveJob::PausedState) {
+        QMutex lock;
+
+        lock.lock();
+        waitCondition.wait(&lock, 100);
+        lock.unlock();
+    }
+
+    return state != DFileCopyMoveJob::StoppedState;
+}
+
+bool DFileCopyMoveJobPrivate::processParallelCopyQueue(bool waitForAll)
+{
+    while (!parallelCopyQueue.isEmpty()) {
+        const ParallelCopyInfoPointer info = parallelCopyQueue.head();
+
+        if (!info->finished.load()) {
+            // 限制排队的任务数量，防止遍历线程跑得太远
+            if (!waitForAll && parallelCopyQueue.size() < parallelCopyPool->maxThreadCount() * 64) {
+                return true;
+            }
+
+            parallelCopyMutex.lock();
+
+            while (!info->finished.load()) {
+                parallelCopyCondition.wait(&parallelCopyMutex);
+            }
+
+            parallelCopyMutex.unlock();
+        }
+
+        parallelCopyQueue.dequeue();
+
+        if (info->deferred) {
+            info->deferred();
+
+            continue;
+        }
+
+        if (info->ok) {
+            completedDataSize += info->copiedSize;
+            parallelCopiedDataSize.fetchAndAddRelaxed(-info->copiedSize);
+            ++completedFilesCount;
+
+            Q_EMIT q_ptr->completedFilesCountChanged(completedFilesCount);
+
+            completedFileList << qMakePair(info->from, info->target);
+
+            // 并行复制的数据没有经过任务线程，只有要求校验时才重新读取文件
+            if (fileHints.testFlag(DFileCopyMoveJob::AsyncIntegrityChecking)
+                    && !fileHints.testFlag(DFileCopyMoveJob::DontIntegrityChecking)) {
+                enqueueIntegrityCheck(info->source, info->target, info->copiedSize, 0, true);
+            }
+
+            continue;
+        }
+
+        if (!stateCheck()) {
+            return false;
+        }
+
+        qCDebug(fileJob()) << "Failed on parallel copy, will be copy the file again:" << info->from;
+
+        // 以普通的方式重新处理此文件，由其负责冲突和错误处理
+        const DAbstractFileInfoPointer &target_directory = DFileService::instance()->createFileInfo(nullptr, info->targetDirectory);
+
+        if (!target_directory) {
+            return false;
+        }
+
+        parallelCopyFallback = true;
+        enterDirectory(info->from.parentUrl(), info->targetDirectory);
+
+        bool ok = process(info->from, target_directory.constData());
+
+        leaveDirectory();
+        parallelCopyFallback = false;
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DFileCopyMoveJobPrivate::runAfterParallelCopy(std::function<void()> fun)
+{
+    if (parallelCopyQueue.isEmpty()) {
+        fun();
+
+        return;
+    }
+
+    ParallelCopyInfoPointer info(new ParallelCopyInfo());
+
+    info->finished = 1;
+    info->deferred = fun;
+    parallelCopyQueue.enqueue(info);
+}
+
+void DFileCopyMoveJobPrivate::finishParallelCopy()
+{
+    if (!parallelCopyPool) {
+        return;
+    }
+
+    parallelCopyPool->waitForDone();
+
+    // 任务被取消时，记录已经复制完成的文件
+    for (const ParallelCopyInfoPointer &info : parallelCopyQueue) {
+        if (info->deferred || !info->ok) {
+            continue;
+        }
+
+        completedDataSize += info->copiedSize;
+        ++completedFilesCount;
+        completedFileList << qMakePair(info->from, info->target);
+    }
+
+    parallelCopyQueue.clear();
+    parallelCopiedDataSize = 0;
+
+    delete parallelCopyPool;
+    parallelCopyPool = nullptr;
+}
+
+void DFileCopyMoveJobPrivate::enqueueIntegrityCheck(const DUrl &source, const DUrl &target, qint64 size, quint32 sourceChecksum, bool readSource)
+{
+    if (!integrityCheckPool) {
+        integrityCheckPool = new QThreadPool();
+        // 校验按文件的顺序进行，同时读取多个文件会打乱磁盘的顺序读
+        integrityCheckPool->setMaxThreadCount(1);
+    }
+
+    IntegrityCheckInfoPointer info(new IntegrityCheckInfo());
+
+    info->source = source;
+    info->target = target;
+    info->checksumType = checksumType;
+    info->sourceChecksum = sourceChecksum;
+    info->readSource = readSource;
+    info->size = size;
+
+    integrityCheckQueue.enqueue(info);
+
+    QtConcurrent::run(integrityCheckPool, [this, info] {
+        doIntegrityCheck(info.data());
+
+        QMutexLocker locker(&integrityCheckMutex);
+
+        info->finished = 1;
+        integrityCheckCondition.wakeAll();
+    });
+}
+
+// 计算文件的校验值，失败时返回false并记录错误信息
+static bool readFileChecksum(const DUrl &url, DFileCopyMoveJob::ChecksumType type, quint32 *checksum, QString *errorString)
+{
+    // O_DIRECT 要求缓冲区、读取的位置和大小都要按块对齐
+    static const size_t block_size = 1048576;
+    static const size_t alignment = 4096;
+
+    const QByteArray &path = url.toLocalFile().toLocal8Bit();
+    bool direct_io = true;
+    // 使用 O_DIRECT 读取时，内核会先回写文件的脏页，然后直接从磁盘读取数据，而不是校验页缓存中的数据
+    int fd = ::open(path.constData(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+
+    if (fd < 0 && errno == EINVAL) {
+        // 文件系统不支持 O_DIRECT
+        direct_io = false;
+        fd = ::open(path.constData(), O_RDONLY | O_CLOEXEC);
+    }
+
+    if (fd < 0) {
+        *errorString = qApp->translate("DFileCopyMoveJob", "File integrity was damaged, cause: %1").arg(QString::fromLocal8Bit(strerror(errno)));
+
+        return false;
+    }
+
+    void *buffer = nullptr;
+
+    if (posix_memalign(&buffer, alignment, block_size) != 0) {
+        ::close(fd);
+
+        return false;
+    }
+
+    bool ok = true;
+
+    *checksum = DFileCopyMoveJobPrivate::checksumInit(type);
+
+    Q_FOREVER {
+        ssize_t size = ::read(fd, buffer, block_size);
+
+        if (size > 0) {
+            *checksum = DFileCopyMoveJobPrivate::checksumUpdate(type, *checksum, static_cast<const char *>(buffer), size);
+
+            continue;
+        }
+
+        if (size == 0) {
+            break;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        *errorString = qApp->translate("DFileCopyMoveJob", "File integrity was damaged, cause: %1").arg(QString::fromLocal8Bit(strerror(errno)));
+        ok = false;
+        break;
+    }
+
+    if (!direct_io) {
+        // 校验的数据不应该继续占用页缓存
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    }
+
+    ::close(fd);
+    free(buffer);
+
+    return ok;
+}
+
+void DFileCopyMoveJobPrivate::doIntegrityCheck(IntegrityCheckInfo *info)
+{
+    if (info->readSource && !readFileChecksum(info->source, info->checksumType, &info->sourceChecksum, &info->errorString)) {
+        return;
+    }
+
+    quint32 checksum = 0;
+
+    if (!readFileChecksum(info->target, info->checksumType, &checksum, &info->errorString)) {
+        return;
+    }
+
+    if (checksum != info->sourceChecksum) {
+        qCWarning(fileJob(), "Failed on file integrity checking, source file: 0x%x, target file: 0x%x", info->sourceChecksum, checksum);
+
+        return;
+    }
+
+    info->ok = true;
+}
+
+bool DFileCopyMoveJobPrivate::processIntegrityCheckQueue(bool waitForAll)
+{
+    while (!integrityCheckQueue.isEmpty()) {
+        const IntegrityCheckInfoPointer info = integrityCheckQueue.head();
+
+        if (!info->finished.load()) {
+            if (!waitForAll) {
+                return true;
+            }
+
+            setState(DFileCopyMoveJob::IOWaitState);
+            integrityCheckMutex.lock();
+
+            while (!info->finished.load()) {
+                integrityCheckCondition.wait(&integrityCheckMutex);
+            }
+
+            integrityCheckMutex.unlock();
+
+            if (state == DFileCopyMoveJob::IOWaitState) {
+                setState(DFileCopyMoveJob::RunningState);
+            }
+        }
+
+        integrityCheckQueue.dequeue();
+
+        if (info->ok) {
+            continue;
+        }
+
+        if (!stateCheck()) {
+            return false;
+        }
+
+        const DAbstractFileInfoPointer &from_info = DFileService::instance()->createFileInfo(nullptr, info->source);
+        const DAbstractFileInfoPointer &to_info = DFileService::instance()->createFileInfo(nullptr, info->target);
+
+        if (!from_info || !to_info) {
+            return false;
+        }
+
+        setError(DFileCopyMoveJob::IntegrityCheckingError, info->errorString);
+
+        switch (handleError(from_info.constData(), to_info.constData())) {
+        case DFileCopyMoveJob::RetryAction: {
+            QScopedPointer<DFileHandler> handler(DFileService::instance()->createFileHandler(nullptr, info->target));
+
+            if (!handler) {
+                return false;
+            }
+
+            // 复制完成后目标文件的权限已经和源文件相同，可能是只读的
+            handler->setPermissions(info->target, QFileDevice::WriteUser | QFileDevice::ReadUser);
+            enterDirectory(info->source.parentUrl(), info->target.parentUrl());
+            // 上次复制的数据已经计入进度，重新复制前减去，避免进度超过100%
+            completedDataSize -= info->size;
+
+            bool ok = copyFile(from_info.constData(), to_info.constData());
+
+            leaveDirectory();
+
+            if (!ok) {
+                return false;
+            }
+
+            handler->setFileTime(info->target, from_info->lastRead(), from_info->lastModified());
+            handler->setPermissions(info->target, from_info->permissions());
+            break;
+        }
+        case DFileCopyMoveJob::SkipAction:
+            break;
+        default:
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DFileCopyMoveJobPrivate::finishIntegrityCheck()
+{
+    if (!integrityCheckPool) {
+        return;
+    }
+
+    integrityCheckPool->waitForDone();
+    integrityCheckQueue.clear();
+
+    delete integrityCheckPool;
+    integrityCheckPool = nullptr;
+}
+
+bool DFileCopyMoveJobPrivate::process(const DUrl &from, const DAbstractFileInfo *target_info)
+{
+    const DAbstractFileInfoPointer &source_info = DFileService::instance()->createFileInfo(nullptr, from);
+
+    return process(from, source_info, target_info);
+}
+
+bool DFileCopyMoveJobPrivate::process(const DUrl &from, const DAbstractFileInfoPointer &source_info, const DAbstractFileInfo *target_info)
+{
+    // reset error and action
+    unsetError();
+    lastErrorHandleAction = DFileCopyMoveJob::NoAction;
+
+    beginJob(JobInfo::Preprocess, from, (source_info && target_info) ? target_info->getUrlByChildFileName(source_info->fileName()) : DUrl());
+    bool ok = doProcess(from, source_info, target_info);
+    endJob();
+
+    return ok;
+}
+
+bool DFileCopyMoveJobPrivate::copyFile(const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo, int blockSize)
+{
+    qint64 elapsed = 0;
+
+    if (fileJob().isDebugEnabled()) {
+        elapsed = updateSpeedElapsedTimer->elapsed();
+    }
+
+    beginJob(JobInfo::Copy, fromInfo->fileUrl(), toInfo->fileUrl());
+    bool ok = doCopyFile(fromInfo, toInfo, blockSize);
+    endJob();
 
     qCDebug(fileJob(), "Time spent of copy the file: %lld", updateSpeedElapsedTimer->elapsed() - elapsed);
 
@@ -1368,6 +2598,23 @@ void DFileCopyMoveJobPrivate::enterDirectory(const DUrl &from, const DUrl &to)
         }
     }
 
+    // 子目录通常和上级目录在同一设备上，此时不需要再次查找所在的磁盘
+    const DirectoryInfo *parent_info = directoryStack.isEmpty() ? nullptr : &directoryStack.top();
+
+    if (info.sourceStorageInfo.isValid()) {
+        const QByteArray &device = info.sourceStorageInfo.device();
+
+        info.sourceDisk = parent_info && parent_info->sourceStorageInfo.isValid() && parent_info->sourceStorageInfo.device() == device
+                          ? parent_info->sourceDisk : diskOfDevice(device);
+    }
+
+    if (info.targetStorageInfo.isValid()) {
+        const QByteArray &device = info.targetStorageInfo.device();
+
+        info.targetDisk = parent_info && parent_info->targetStorageInfo.isValid() && parent_info->targetStorageInfo.device() == device
+                          ? parent_info->targetDisk : diskOfDevice(device);
+    }
+
     directoryStack.push(info);
 }
 
@@ -1518,6 +2765,13 @@ DFileCopyMoveJob::FileHints DFileCopyMoveJob::fileHints() const
     return d->fileHints;
 }
 
+DFileCopyMoveJob::ChecksumType DFileCopyMoveJob::checksumType() const
+{
+    Q_D(const DFileCopyMoveJob);
+
+    return d->checksumType;
+}
+
 QString DFileCopyMoveJob::errorString() const
 {
     Q_D(const DFileCopyMoveJob);
@@ -1591,6 +2845,21 @@ QList<QPair<DUrl, DUrl>> DFileCopyMoveJob::completedDirectorys() const
     return d->completedDirectoryList;
 }
 
+int DFileCopyMoveJob::parallelCopyCount() const
+{
+    Q_D(const DFileCopyMoveJob);
+
+    return d->parallelCopyCount;
+}
+
+void DFileCopyMoveJob::setParallelCopyCount(int count)
+{
+    Q_ASSERT(!isRunning());
+    Q_D(DFileCopyMoveJob);
+
+    d->parallelCopyCount = count;
+}
+
 DFileCopyMoveJob::Actions DFileCopyMoveJob::supportActions(DFileCopyMoveJob::Error error)
 {
     switch (error) {
@@ -1693,6 +2962,14 @@ void DFileCopyMoveJob::setFileHints(FileHints fileHints)
     d->fileStatistics->setFileHints(fileHints.testFlag(FollowSymlink) ? DFileStatisticsJob::FollowSymlink : DFileStatisticsJob::FileHints());
 }
 
+void DFileCopyMoveJob::setChecksumType(DFileCopyMoveJob::ChecksumType checksumType)
+{
+    Q_D(DFileCopyMoveJob);
+    Q_ASSERT(d->state != RunningState);
+
+    d->checksumType = checksumType;
+}
+
 DFileCopyMoveJob::DFileCopyMoveJob(DFileCopyMoveJobPrivate &dd, QObject *parent)
     : QThread(parent)
     , d_d_ptr(&dd)
@@ -1818,6 +3095,8 @@ void DFileCopyMoveJob::run()
         qCDebug(fileJob(), "remove mode");
     }
 
+    d->initParallelCopy();
+
     for (DUrl &source : d->sourceUrlList) {
         if (!d->stateCheck()) {
             goto end;
@@ -1849,28 +3128,42 @@ void DFileCopyMoveJob::run()
             d->leaveDirectory();
         }
 
-        DUrl target_url;
+        d->runAfterParallelCopy([this, d, source] {
+            DUrl target_url;
 
-        if (!d->completedFileList.isEmpty()) {
-            if (d->completedFileList.last().first == source) {
-                target_url = d->completedFileList.last().second;
+            if (!d->completedFileList.isEmpty()) {
+                if (d->completedFileList.last().first == source) {
+                    target_url = d->completedFileList.last().second;
+                }
             }
-        }
 
-        if (!d->completedDirectoryList.isEmpty()) {
-            if (d->completedDirectoryList.last().first == source) {
-                target_url = d->completedDirectoryList.last().second;
+            if (!d->completedDirectoryList.isEmpty()) {
+                if (d->completedDirectoryList.last().first == source) {
+                    target_url = d->completedDirectoryList.last().second;
+                }
             }
-        }
 
-        d->targetUrlList << target_url;
+            d->targetUrlList << target_url;
+
+            Q_EMIT finished(source, target_url);
+        });
+
+        if (!d->processParallelCopyQueue(false) || !d->processIntegrityCheckQueue(false)) {
+            goto end;
+        }
+    }
 
-        Q_EMIT finished(source, target_url);
+    if (!d->processParallelCopyQueue(true) || !d->processIntegrityCheckQueue(true)) {
+        goto end;
     }
 
     d->setError(NoError);
 
 end:
+    d->finishParallelCopy();
+    d->finishIntegrityCheck();
+    d->releaseCopyBuffers();
+
     if (d->targetIsRemovable && mayExecSync &&
             d->state != DFileCopyMoveJob::StoppedState) { //主动取消时state已经被设置为stop了
         qCDebug(fileJob()) << "sync file, lastErrorHandleAction" << d->lastErrorHandleAction
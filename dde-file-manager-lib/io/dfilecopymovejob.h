@@ -39,6 +39,7 @@ class DFileCopyMoveJob : public QThread
     Q_PROPERTY(State state READ state NOTIFY stateChanged)
     Q_PROPERTY(Error error READ error NOTIFY errorChanged)
     Q_PROPERTY(FileHints fileHints READ fileHints WRITE setFileHints)
+    Q_PROPERTY(ChecksumType checksumType READ checksumType WRITE setChecksumType)
     Q_PROPERTY(QString errorString READ errorString CONSTANT)
 
 public:
@@ -96,12 +97,23 @@ public:
         DontIntegrityChecking = 0x40, // 复制文件时不进行完整性校验
         DontFormatFileName = 0x80, // 不要自动处理文件名中的非法字符
         DontSortInode = 0x100, // 不要对目录中的文件按inode排序
-        ForceDeleteFile = 0x200 // 强制删除文件夹(去除文件夹的只读权限)
+        ForceDeleteFile = 0x200, // 强制删除文件夹(去除文件夹的只读权限)
+        DontUseKernelCopy = 0x400, // 不使用内核复制(reflink/copy_file_range/sendfile)，强制使用缓冲区读写的方式复制文件
+        AsyncIntegrityChecking = 0x800 // 复制下一个文件的同时在其它线程中校验已复制完成的文件，校验时绕过页缓存从磁盘读取
     };
 
     Q_ENUM(FileHint)
     Q_DECLARE_FLAGS(FileHints, FileHint)
 
+    // 完整性校验所使用的校验算法
+    enum ChecksumType {
+        Adler32Checksum,
+        Crc32Checksum,
+        Crc32cChecksum // 支持时使用 SSE4.2/ARMv8 的 crc32 指令计算
+    };
+
+    Q_ENUM(ChecksumType)
+
     enum Action {
         NoAction = 0x00,
         RetryAction = 0x01,
@@ -138,6 +150,7 @@ public:
     State state() const;
     Error error() const;
     FileHints fileHints() const;
+    ChecksumType checksumType() const;
     QString errorString() const;
 
     DUrlList sourceUrlList() const;
@@ -150,6 +163,10 @@ public:
     QList<QPair<DUrl, DUrl> > completedFiles() const;
     QList<QPair<DUrl, DUrl> > completedDirectorys() const;
 
+    // 并行复制小文件的线程数，为0时根据目标设备自动选择，为1时不进行并行复制
+    int parallelCopyCount() const;
+    void setParallelCopyCount(int count);
+
     static Actions supportActions(Error error);
 
 public Q_SLOTS:
@@ -159,6 +176,7 @@ public Q_SLOTS:
 
     void setMode(Mode mode);
     void setFileHints(FileHints fileHints);
+    void setChecksumType(ChecksumType checksumType);
 
 Q_SIGNALS:
     // 此类工作在一个新的线程中，信号不要以引用的方式传递参数，容易出现一些较为诡异的崩溃问题
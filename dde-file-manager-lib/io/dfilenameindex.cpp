@@ -0,0 +1,1131 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "dfilenameindex.h"
+#include "dmounttable.h"
+#include "dfmstandardpaths.h"
+#include "ddiriterator.h"
+#include "dfileinfo.h"
+#include "dfmapplication.h"
+#include "shutil/dfmregularexpression.h"
+
+#include <QHash>
+#include <QSet>
+#include <QQueue>
+#include <QMutex>
+#include <QFile>
+#include <QFileInfo>
+#include <QVarLengthArray>
+#include <QSaveFile>
+#include <QDir>
+#include <QDateTime>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <QSharedPointer>
+#include <QRegularExpression>
+#include <QCryptographicHash>
+#include <QDebug>
+
+#include <algorithm>
+#include <functional>
+
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+DFM_BEGIN_NAMESPACE
+
+namespace FileNameIndex {
+
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+// 索引文件的格式变化时需要修改版本号
+static const char indexMagic[8] = {'D', 'F', 'M', 'N', 'I', 'D', 'X', 0};
+static const quint32 indexVersion = 3;
+static const quint32 invalidParent = 0xffffffff;
+// 索引建立后的变化由文件监视器记录，只在变化过多或索引过旧时重建。
+// 定期重建是为了包含没有被监视的目录中的变化
+static const qint64 rebuildInterval = 24 * 60 * 60 * 1000;
+static const int maxChangeCount = 100000;
+
+struct Header {
+    char magic[8];
+    quint32 version;
+    quint32 entryCount;
+    qint64 buildTime;
+    quint64 entriesOffset;
+    quint64 namesOffset;
+    quint64 namesSize;
+    quint64 lowerNamesOffset;
+    quint64 lowerNamesSize;
+    // 小写文件名中所有连续三个字节的组合，按值排序，按8字节对齐
+    quint64 trigramsOffset;
+    quint64 trigramCount;
+    quint64 postingsOffset;
+    quint64 postingsSize;
+};
+
+struct Entry {
+    // 父目录在表中的位置，挂载点中的第一层文件为 invalidParent
+    quint32 parent;
+    // 以'\0'结尾的文件名在 names 中的偏移
+    quint32 name;
+    // 小写的文件名在 lowerNames 中的偏移，表中的项按此值递增
+    quint32 lowerName;
+};
+
+struct Trigram {
+    quint32 value;
+    // 文件名中包含此组合的文件数量
+    quint32 count;
+    // 文件列表在 postings 中的偏移，列表中为文件在表中位置的差值，使用变长整数编码
+    quint64 offset;
+};
+
+static inline quint32 trigramValue(const char *data)
+{
+    return (static_cast<quint32>(static_cast<uchar>(data[0])) << 16)
+            | (static_cast<quint32>(static_cast<uchar>(data[1])) << 8)
+            | static_cast<uchar>(data[2]);
+}
+
+static void appendVarint(QByteArray &data, quint32 value)
+{
+    while (value >= 0x80) {
+        data.append(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+
+    data.append(static_cast<char>(value));
+}
+
+static quint32 readVarint(const uchar *&data, const uchar *end)
+{
+    quint32 value = 0;
+
+    for (int shift = 0; data < end && shift < 35; shift += 7) {
+        const uchar byte = *data++;
+
+        value |= static_cast<quint32>(byte & 0x7f) << shift;
+
+        if (!(byte & 0x80))
+            break;
+    }
+
+    return value;
+}
+
+static QByteArray toLowerName(const char *name, int length)
+{
+    bool is_ascii = true;
+
+    for (int i = 0; i < length; ++i) {
+        if (static_cast<uchar>(name[i]) >= 0x80) {
+            is_ascii = false;
+            break;
+        }
+    }
+
+    if (is_ascii)
+        return QByteArray(name, length).toLower();
+
+    return QString::fromLocal8Bit(name, length).toLower().toLocal8Bit();
+}
+
+class Matcher
+{
+public:
+    enum Mode {
+        ContainsMatch,
+        PrefixMatch,
+        SuffixMatch,
+        RegularExpressionMatch
+    };
+
+    explicit Matcher(const QString &keyword)
+    {
+        static const QRegularExpression wildcard("[*?\\[]");
+
+        const int wildcard_index = keyword.indexOf(wildcard);
+        QString pattern;
+
+        // 不包含通配符，或只在首尾包含 * 时不需要使用正则表达式
+        if (wildcard_index < 0) {
+            mode = ContainsMatch;
+            pattern = keyword;
+        } else if (wildcard_index == keyword.size() - 1 && keyword.endsWith('*')) {
+            mode = PrefixMatch;
+            pattern = keyword.left(keyword.size() - 1);
+        } else if (wildcard_index == 0 && keyword.startsWith('*') && keyword.mid(1).indexOf(wildcard) < 0) {
+            mode = SuffixMatch;
+            pattern = keyword.mid(1);
+        } else {
+            mode = RegularExpressionMatch;
+            regex = QRegularExpression(DFMRegularExpression::checkWildcardAndToRegularExpression(keyword),
+                                       QRegularExpression::CaseInsensitiveOption);
+            regex.optimize();
+        }
+
+        lowerPattern = pattern.toLower().toLocal8Bit();
+    }
+
+    bool match(const char *lowerName, const char *name) const
+    {
+        switch (mode) {
+        case ContainsMatch:
+            return strstr(lowerName, lowerPattern.constData()) != nullptr;
+        case PrefixMatch:
+            return strncmp(lowerName, lowerPattern.constData(), static_cast<size_t>(lowerPattern.size())) == 0;
+        case SuffixMatch: {
+            const size_t length = strlen(lowerName);
+            const size_t pattern_length = static_cast<size_t>(lowerPattern.size());
+
+            return length >= pattern_length && memcmp(lowerName + length - pattern_length, lowerPattern.constData(), pattern_length) == 0;
+        }
+        case RegularExpressionMatch:
+            return regex.match(QString::fromLocal8Bit(name)).hasMatch();
+        }
+
+        return false;
+    }
+
+    Mode mode;
+    QByteArray lowerPattern;
+    QRegularExpression regex;
+};
+
+// 一次搜索在索引中的进度，搜索可以分多次进行
+struct SearchCursor {
+    bool started = false;
+    bool finished = false;
+    // 使用三字节组合的文件列表时为列表中下一个文件的位置
+    const uchar *posting = nullptr;
+    const uchar *postingEnd = nullptr;
+    quint32 remaining = 0;
+    // 按文件列表搜索时为上一个文件在表中的位置，否则为下一个要检查的位置
+    quint32 entry = 0;
+};
+
+// 映射到内存中的索引文件，建立后不再修改
+class Data
+{
+public:
+    static QSharedPointer<Data> load(const QByteArray &rootPath, const QString &filePath)
+    {
+        QSharedPointer<Data> data(new Data());
+
+        data->rootPath = rootPath;
+        data->file.setFileName(filePath);
+
+        if (!data->file.open(QIODevice::ReadOnly) || data->file.size() < static_cast<qint64>(sizeof(Header)))
+            return QSharedPointer<Data>();
+
+        const uchar *map = data->file.map(0, data->file.size());
+
+        if (!map)
+            return QSharedPointer<Data>();
+
+        const quint64 file_size = static_cast<quint64>(data->file.size());
+
+        data->header = reinterpret_cast<const Header*>(map);
+
+        const Header *header = data->header;
+
+        if (memcmp(header->magic, indexMagic, sizeof(indexMagic)) != 0 || header->version != indexVersion
+                || header->entriesOffset + header->entryCount * sizeof(Entry) > file_size
+                || header->namesOffset + header->namesSize > file_size
+                || header->lowerNamesOffset + header->lowerNamesSize > file_size
+                || header->trigramsOffset % 8 != 0
+                || header->trigramsOffset + header->trigramCount * sizeof(Trigram) > file_size
+                || header->postingsOffset + header->postingsSize > file_size) {
+            qWarning() << "Ignore the invalid file name index:" << filePath;
+
+            return QSharedPointer<Data>();
+        }
+
+        data->entries = reinterpret_cast<const Entry*>(map + header->entriesOffset);
+        data->names = reinterpret_cast<const char*>(map + header->namesOffset);
+        data->lowerNames = reinterpret_cast<const char*>(map + header->lowerNamesOffset);
+        data->trigrams = reinterpret_cast<const Trigram*>(map + header->trigramsOffset);
+        data->postings = map + header->postingsOffset;
+
+        struct stat st;
+
+        if (::stat(rootPath.constData(), &st) != 0)
+            return QSharedPointer<Data>();
+
+        data->rootDevice = st.st_dev;
+
+        return data;
+    }
+
+    QByteArray filePath(quint32 index) const
+    {
+        QVarLengthArray<const char*, 32> names;
+
+        for (quint32 i = index; i != invalidParent; i = entries[i].parent) {
+            names.append(this->names + entries[i].name);
+        }
+
+        QByteArray path = rootPath;
+
+        for (int i = names.size() - 1; i >= 0; --i) {
+            if (!path.endsWith('/'))
+                path.append('/');
+
+            path.append(names.at(i));
+        }
+
+        return path;
+    }
+
+    // 查找 pattern 中包含文件最少的三字节组合，pattern 不足三个字节时返回false。
+    // 有组合不在索引中时没有文件可以匹配，*trigram 为nullptr
+    bool rarestTrigram(const QByteArray &pattern, const Trigram **trigram) const
+    {
+        if (pattern.size() < 3)
+            return false;
+
+        const Trigram *end = trigrams + header->trigramCount;
+
+        *trigram = nullptr;
+
+        for (int i = 0; i + 3 <= pattern.size(); ++i) {
+            const quint32 value = trigramValue(pattern.constData() + i);
+            const Trigram *t = std::lower_bound(trigrams, end, value, [] (const Trigram &t, quint32 value) {
+                return t.value < value;
+            });
+
+            if (t == end || t->value != value || t->offset >= header->postingsSize) {
+                *trigram = nullptr;
+
+                return true;
+            }
+
+            if (!*trigram || t->count < (*trigram)->count)
+                *trigram = t;
+        }
+
+        return true;
+    }
+
+    // 从 cursor 处继续搜索 directoryPrefix 中的文件，最多返回 maxCount 个结果
+    void search(const Matcher &matcher, const QByteArray &directoryPrefix, SearchCursor *cursor, int maxCount, QList<QByteArray> *results) const
+    {
+        const quint32 count = header->entryCount;
+
+        auto append_result = [&] (quint32 index) {
+            const QByteArray &path = filePath(index);
+
+            if (path.startsWith(directoryPrefix))
+                results->append(path);
+        };
+
+        if (!cursor->started) {
+            const Trigram *trigram = nullptr;
+
+            cursor->started = true;
+
+            // 正则表达式中不能确定一定出现的内容，只能逐个匹配
+            if (matcher.mode != Matcher::RegularExpressionMatch && rarestTrigram(matcher.lowerPattern, &trigram)) {
+                if (!trigram) {
+                    cursor->finished = true;
+
+                    return;
+                }
+
+                cursor->posting = postings + trigram->offset;
+                cursor->postingEnd = postings + header->postingsSize;
+                cursor->remaining = trigram->count;
+            }
+        }
+
+        if (cursor->posting) {
+            // 只需检查文件名中包含此组合的文件
+            while (cursor->remaining > 0 && results->size() < maxCount) {
+                cursor->entry += readVarint(cursor->posting, cursor->postingEnd);
+                --cursor->remaining;
+
+                if (cursor->entry < count && matcher.match(lowerNames + entries[cursor->entry].lowerName, names + entries[cursor->entry].name))
+                    append_result(cursor->entry);
+            }
+
+            cursor->finished = cursor->remaining == 0;
+
+            return;
+        }
+
+        quint32 start = cursor->entry;
+
+        if (matcher.mode == Matcher::ContainsMatch && !matcher.lowerPattern.isEmpty()) {
+            // 不足三个字节的关键字，关键字中不会包含'\0'，在所有文件名中直接查找即可
+            const char *end = lowerNames + header->lowerNamesSize;
+
+            while (start < count && results->size() < maxCount) {
+                const char *begin = lowerNames + entries[start].lowerName;
+                const char *pos = static_cast<const char*>(memmem(begin, static_cast<size_t>(end - begin),
+                                                                  matcher.lowerPattern.constData(),
+                                                                  static_cast<size_t>(matcher.lowerPattern.size())));
+
+                if (!pos) {
+                    start = count;
+                    break;
+                }
+
+                const quint32 offset = static_cast<quint32>(pos - lowerNames);
+                // 找到匹配位置所属的文件
+                const Entry *entry = std::upper_bound(entries + start, entries + count, offset, [] (quint32 offset, const Entry &entry) {
+                    return offset < entry.lowerName;
+                }) - 1;
+                const quint32 index = static_cast<quint32>(entry - entries);
+
+                append_result(index);
+                start = index + 1;
+            }
+        } else {
+            for (; start < count && results->size() < maxCount; ++start) {
+                if (matcher.match(lowerNames + entries[start].lowerName, names + entries[start].name))
+                    append_result(start);
+            }
+        }
+
+        cursor->entry = start;
+        cursor->finished = start >= count;
+    }
+
+    QByteArray rootPath;
+    QFile file;
+    const Header *header = nullptr;
+    const Entry *entries = nullptr;
+    const char *names = nullptr;
+    const char *lowerNames = nullptr;
+    const Trigram *trigrams = nullptr;
+    const uchar *postings = nullptr;
+    dev_t rootDevice = 0;
+};
+
+// 索引建立后由文件监视器记录的变化
+struct Changes {
+    QSet<QByteArray> createdFiles;
+    // 新建或移动到此处的目录，其中的文件都不在索引中，搜索时需要遍历
+    QSet<QByteArray> createdDirectories;
+    // 被删除或移走的文件和目录，索引中的这些文件及目录中的文件不再作为结果
+    QSet<QByteArray> removedPaths;
+    // 有没有逐个记录的变化的目录，搜索时重新读取
+    QSet<QByteArray> changedDirectories;
+
+    int size() const
+    {
+        return createdFiles.size() + removedPaths.size() + changedDirectories.size();
+    }
+
+    void fileCreated(const QByteArray &path, bool isDirectory)
+    {
+        removedPaths.remove(path);
+        createdFiles << path;
+
+        if (isDirectory)
+            createdDirectories << path;
+    }
+
+    void fileRemoved(const QByteArray &path)
+    {
+        createdFiles.remove(path);
+        createdDirectories.remove(path);
+        removedPaths << path;
+    }
+
+    void directoryChanged(const QByteArray &path)
+    {
+        changedDirectories << path;
+    }
+};
+
+static bool build(const QByteArray &rootPath, const QString &indexFilePath, const QAtomicInt &stopped)
+{
+    struct stat root_st;
+
+    if (::stat(rootPath.constData(), &root_st) != 0)
+        return false;
+
+    // 使用开始遍历的时间，遍历期间新建的目录在搜索时会按其 ctime 被当作新目录读取
+    const qint64 build_time = QDateTime::currentMSecsSinceEpoch();
+    QVector<Entry> entries;
+    QByteArray names;
+    QByteArray lower_names;
+    // 广度优先遍历，目录用其在表中的位置表示
+    QQueue<QPair<quint32, QByteArray>> directories;
+    QByteArray buffer(32 * 1024, Qt::Uninitialized);
+
+    directories.enqueue(qMakePair(invalidParent, rootPath));
+
+    while (!directories.isEmpty()) {
+        if (stopped.loadAcquire())
+            return false;
+
+        const QPair<quint32, QByteArray> directory = directories.dequeue();
+        int fd = ::open(directory.second.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+        if (fd < 0)
+            continue;
+
+        const QByteArray prefix = directory.second.endsWith('/') ? directory.second : directory.second + '/';
+
+        Q_FOREVER {
+            long size = syscall(SYS_getdents64, fd, buffer.data(), buffer.size());
+
+            if (size <= 0)
+                break;
+
+            for (long offset = 0; offset < size;) {
+                const linux_dirent64 *dirent = reinterpret_cast<const linux_dirent64 *>(buffer.constData() + offset);
+                const char *name = dirent->d_name;
+
+                offset += dirent->d_reclen;
+
+                if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+                    continue;
+
+                bool is_dir = dirent->d_type == DT_DIR || dirent->d_type == DT_UNKNOWN;
+
+                if (is_dir) {
+                    struct stat st;
+
+                    // 不进入其它文件系统
+                    is_dir = fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) == 0 && S_ISDIR(st.st_mode) && st.st_dev == root_st.st_dev;
+                }
+
+                const int length = static_cast<int>(strlen(name));
+
+                if (static_cast<quint64>(lower_names.size()) + length * 3 + 1 > 0xffffffff) {
+                    qWarning() << "Too many files for the file name index:" << rootPath;
+                    ::close(fd);
+
+                    return false;
+                }
+
+                entries.append({directory.first, static_cast<quint32>(names.size()), static_cast<quint32>(lower_names.size())});
+                names.append(name, length + 1);
+                lower_names.append(toLowerName(name, length));
+                lower_names.append('\0');
+
+                if (is_dir)
+                    directories.enqueue(qMakePair(static_cast<quint32>(entries.size() - 1), prefix + name));
+            }
+        }
+
+        ::close(fd);
+    }
+
+    // 为小写文件名中的每个三字节组合建立包含它的文件列表。先统计每个列表的长度，
+    // 再将所有列表填充到一个数组中，避免为每个组合分配内存
+    struct TrigramSlot {
+        quint32 count = 0;
+        quint32 last = invalidParent;
+        quint32 fill = 0;
+    };
+
+    QHash<quint32, TrigramSlot> slots;
+
+    auto for_each_trigram = [&] (const std::function<void(quint32, TrigramSlot &)> &func) {
+        for (int i = 0; i < entries.size(); ++i) {
+            const char *name = lower_names.constData() + entries.at(i).lowerName;
+            const int length = static_cast<int>(strlen(name));
+
+            for (int j = 0; j + 3 <= length; ++j) {
+                TrigramSlot &slot = slots[trigramValue(name + j)];
+
+                // 同一文件名中重复出现的组合只记录一次
+                if (slot.last != static_cast<quint32>(i)) {
+                    slot.last = static_cast<quint32>(i);
+                    func(static_cast<quint32>(i), slot);
+                }
+            }
+        }
+    };
+
+    for_each_trigram([] (quint32, TrigramSlot &slot) {
+        ++slot.count;
+    });
+
+    if (stopped.loadAcquire())
+        return false;
+
+    QList<quint32> values = slots.keys();
+    quint32 total = 0;
+
+    std::sort(values.begin(), values.end());
+
+    for (quint32 value : values) {
+        TrigramSlot &slot = slots[value];
+
+        slot.fill = total;
+        slot.last = invalidParent;
+        total += slot.count;
+    }
+
+    QVector<quint32> lists(static_cast<int>(total));
+
+    // 文件按在表中的位置依次加入，每个列表都是递增的
+    for_each_trigram([&lists] (quint32 index, TrigramSlot &slot) {
+        lists[static_cast<int>(slot.fill++)] = index;
+    });
+
+    QVector<Trigram> trigrams;
+    QByteArray postings;
+
+    trigrams.reserve(values.size());
+
+    for (quint32 value : values) {
+        const TrigramSlot &slot = slots.value(value);
+        quint32 previous = 0;
+
+        trigrams.append({value, slot.count, static_cast<quint64>(postings.size())});
+
+        for (quint32 i = slot.fill - slot.count; i < slot.fill; ++i) {
+            appendVarint(postings, lists.at(static_cast<int>(i)) - previous);
+            previous = lists.at(static_cast<int>(i));
+        }
+    }
+
+    lists.clear();
+    slots.clear();
+
+    QDir().mkpath(QFileInfo(indexFilePath).absolutePath());
+
+    QSaveFile file(indexFilePath);
+
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    Header header;
+
+    memcpy(header.magic, indexMagic, sizeof(indexMagic));
+    header.version = indexVersion;
+    header.entryCount = static_cast<quint32>(entries.size());
+    header.buildTime = build_time;
+    header.entriesOffset = sizeof(Header);
+    header.namesOffset = header.entriesOffset + entries.size() * sizeof(Entry);
+    header.namesSize = static_cast<quint64>(names.size());
+    header.lowerNamesOffset = header.namesOffset + header.namesSize;
+    header.lowerNamesSize = static_cast<quint64>(lower_names.size());
+    header.trigramsOffset = (header.lowerNamesOffset + header.lowerNamesSize + 7) & ~quint64(7);
+    header.trigramCount = static_cast<quint64>(trigrams.size());
+    header.postingsOffset = header.trigramsOffset + header.trigramCount * sizeof(Trigram);
+    header.postingsSize = static_cast<quint64>(postings.size());
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entries.constData()), entries.size() * static_cast<qint64>(sizeof(Entry)));
+    file.write(names);
+    file.write(lower_names);
+    file.write(QByteArray(static_cast<int>(header.trigramsOffset - header.lowerNamesOffset - header.lowerNamesSize), '\0'));
+    file.write(reinterpret_cast<const char*>(trigrams.constData()), trigrams.size() * static_cast<qint64>(sizeof(Trigram)));
+    file.write(postings);
+
+    return file.commit();
+}
+
+static qint64 toMSecsSinceEpoch(const struct timespec &time)
+{
+    return static_cast<qint64>(time.tv_sec) * 1000 + time.tv_nsec / 1000000;
+}
+
+// 相对于搜索目录的路径中是否有以'.'开头的部分
+static bool isHiddenPath(const QByteArray &relativePath)
+{
+    return relativePath.startsWith('.') || relativePath.contains("/.");
+}
+
+// paths 中是否包含 path 或它的上级目录
+static bool containsPathOrParent(const QSet<QByteArray> &paths, QByteArray path)
+{
+    if (paths.isEmpty())
+        return false;
+
+    Q_FOREVER {
+        if (paths.contains(path))
+            return true;
+
+        const int index = path.lastIndexOf('/');
+
+        if (index <= 0)
+            return false;
+
+        path.truncate(index);
+    }
+}
+
+class DirIterator : public DDirIterator
+{
+public:
+    struct Snapshot {
+        QSharedPointer<Data> data;
+        Changes changes;
+    };
+
+    DirIterator(const QList<Snapshot> &snapshots, const QString &directory, const QString &realDirectory,
+                const QString &keyword, QDir::Filters filters)
+        : matcher(keyword)
+        , directory(directory)
+        , showHidden(filters.testFlag(QDir::Hidden))
+    {
+        directoryPrefix = realDirectory.toLocal8Bit();
+
+        if (!directoryPrefix.endsWith('/'))
+            directoryPrefix.append('/');
+
+        for (const Snapshot &snapshot : snapshots) {
+            Source source;
+
+            source.data = snapshot.data;
+            source.createdFiles = snapshot.changes.createdFiles.toList();
+            source.createdDirectories = snapshot.changes.createdDirectories;
+            source.removedPaths = snapshot.changes.removedPaths;
+            source.changedDirectories = snapshot.changes.changedDirectories.toList();
+            sources << source;
+        }
+    }
+
+    DUrl next() override
+    {
+        currentFileInfo.setFile(QString::fromLocal8Bit(searchResults.dequeue()));
+
+        return fileUrl();
+    }
+
+    bool hasNext() const override
+    {
+        while (searchResults.isEmpty()) {
+            if (currentSource < sources.size()) {
+                Source &source = sources[currentSource];
+
+                if (!source.cursor.finished) {
+                    QList<QByteArray> results;
+
+                    source.data->search(matcher, directoryPrefix, &source.cursor, 100, &results);
+
+                    for (const QByteArray &path : results) {
+                        if (!containsPathOrParent(source.removedPaths, path))
+                            appendResult(path);
+                    }
+                } else if (!source.createdFiles.isEmpty()) {
+                    const QByteArray path = source.createdFiles.takeFirst();
+
+                    if (path.startsWith(directoryPrefix)) {
+                        const QByteArray &name = path.mid(path.lastIndexOf('/') + 1);
+
+                        if (matcher.match(toLowerName(name.constData(), name.size()).constData(), name.constData()))
+                            appendResult(path);
+                    }
+                } else if (!source.changedDirectories.isEmpty()) {
+                    const QByteArray path = source.changedDirectories.takeFirst();
+
+                    if (inSearchDirectory(path))
+                        readDirectory(path, source.data->rootDevice, source.data->header->buildTime, false);
+                } else {
+                    for (const QByteArray &path : source.createdDirectories) {
+                        // 上级目录也是新目录时会在遍历上级目录时被读取
+                        if (!inSearchDirectory(path) || containsPathOrParent(source.createdDirectories, path.left(path.lastIndexOf('/'))))
+                            continue;
+
+                        newDirectories.enqueue({path, source.data->rootDevice, source.data->header->buildTime});
+                    }
+
+                    ++currentSource;
+                }
+
+                continue;
+            }
+
+            if (!newDirectories.isEmpty()) {
+                const NewDirectory directory = newDirectories.dequeue();
+
+                readDirectory(directory.path, directory.device, directory.buildTime, true);
+                continue;
+            }
+
+            break;
+        }
+
+        return !searchResults.isEmpty();
+    }
+
+    QString fileName() const override
+    {
+        return currentFileInfo.fileName();
+    }
+
+    DUrl fileUrl() const override
+    {
+        return DUrl::fromLocalFile(currentFileInfo.filePath());
+    }
+
+    const DAbstractFileInfoPointer fileInfo() const override
+    {
+        return DAbstractFileInfoPointer(new DFileInfo(currentFileInfo));
+    }
+
+    DUrl url() const override
+    {
+        return DUrl::fromLocalFile(directory);
+    }
+
+private:
+    struct Source {
+        QSharedPointer<Data> data;
+        SearchCursor cursor;
+        QList<QByteArray> createdFiles;
+        QSet<QByteArray> createdDirectories;
+        QSet<QByteArray> removedPaths;
+        QList<QByteArray> changedDirectories;
+    };
+
+    struct NewDirectory {
+        QByteArray path;
+        dev_t device;
+        qint64 buildTime;
+    };
+
+    bool isHidden(const QByteArray &path) const
+    {
+        return !showHidden && isHiddenPath(path.mid(directoryPrefix.size()));
+    }
+
+    bool inSearchDirectory(const QByteArray &path) const
+    {
+        return (path + '/').startsWith(directoryPrefix) && !isHidden(path);
+    }
+
+    // recursive 为 false 时只进入索引建立后新建或移动到此处的子目录，其它子目录中的文件都在索引中
+    void readDirectory(const QByteArray &path, dev_t device, qint64 buildTime, bool recursive) const
+    {
+        DIR *dir = opendir(path.constData());
+
+        if (!dir)
+            return;
+
+        const QByteArray &prefix = path.endsWith('/') ? path : path + '/';
+
+        while (const dirent *entry = readdir(dir)) {
+            const char *name = entry->d_name;
+
+            if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+                continue;
+
+            const QByteArray &file_path = prefix + name;
+            const int length = static_cast<int>(strlen(name));
+
+            if (matcher.match(toLowerName(name, length).constData(), name))
+                appendResult(file_path);
+
+            if (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN)
+                continue;
+
+            struct stat st;
+
+            // 同索引一样不进入其它文件系统，挂载在搜索目录中的设备有各自的索引
+            if (fstatat(dirfd(dir), name, &st, AT_SYMLINK_NOFOLLOW) != 0 || !S_ISDIR(st.st_mode) || st.st_dev != device)
+                continue;
+
+            // 重命名或移动目录时会更新其 ctime
+            if ((recursive || toMSecsSinceEpoch(st.st_ctim) >= buildTime) && !isHidden(file_path))
+                newDirectories.enqueue({file_path, device, buildTime});
+        }
+
+        closedir(dir);
+    }
+
+    void appendResult(const QByteArray &path) const
+    {
+        if (isHidden(path))
+            return;
+
+        if (reportedFiles.contains(path))
+            return;
+
+        struct stat st;
+
+        // 没有收到删除事件的文件（如在没有被监视的目录中）
+        if (lstat(path.constData(), &st) != 0)
+            return;
+
+        reportedFiles << path;
+        searchResults << path;
+    }
+
+    Matcher matcher;
+    QString directory;
+    QByteArray directoryPrefix;
+    bool showHidden;
+
+    mutable QList<Source> sources;
+    mutable int currentSource = 0;
+    mutable QQueue<NewDirectory> newDirectories;
+    mutable QQueue<QByteArray> searchResults;
+    mutable QSet<QByteArray> reportedFiles;
+
+    QFileInfo currentFileInfo;
+};
+
+} // namespace FileNameIndex
+
+using namespace FileNameIndex;
+
+class DFileNameIndexPrivate
+{
+public:
+    struct MountIndex {
+        QSharedPointer<Data> data;
+        bool loaded = false;
+        bool building = false;
+        Changes changes;
+        // 正在建立的索引可能没有包含建立期间的变化，建立完成后作为新索引的变化
+        Changes changesSinceBuild;
+    };
+
+    static QString indexFilePath(const QByteArray &rootPath);
+    // 返回挂载点的索引，索引不存在或已过期时在后台开始建立，调用时需要持有 mutex
+    MountIndex &mountIndex(const QByteArray &rootPath);
+    void startBuild(const QByteArray &rootPath, MountIndex &index);
+    // 将变化记录到文件所在挂载点的索引中
+    void recordChange(const QString &filePath, const std::function<void(Changes &, const QByteArray &)> &func);
+
+    QMutex mutex;
+    QHash<QByteArray, MountIndex> indexes;
+    // 同一时间只建立一个索引，避免占用过多的io
+    QThreadPool buildPool;
+    QAtomicInt stopped;
+};
+
+QString DFileNameIndexPrivate::indexFilePath(const QByteArray &rootPath)
+{
+    return DFMStandardPaths::location(DFMStandardPaths::CachePath) + "/filename-index/"
+            + QCryptographicHash::hash(rootPath, QCryptographicHash::Md5).toHex() + ".index";
+}
+
+DFileNameIndexPrivate::MountIndex &DFileNameIndexPrivate::mountIndex(const QByteArray &rootPath)
+{
+    MountIndex &index = indexes[rootPath];
+
+    if (!index.loaded) {
+        index.loaded = true;
+        index.data = Data::load(rootPath, indexFilePath(rootPath));
+    }
+
+    if (!index.building && (!index.data || QDateTime::currentMSecsSinceEpoch() - index.data->header->buildTime > rebuildInterval))
+        startBuild(rootPath, index);
+
+    return index;
+}
+
+void DFileNameIndexPrivate::startBuild(const QByteArray &rootPath, MountIndex &index)
+{
+    const QString &index_file_path = indexFilePath(rootPath);
+
+    index.building = true;
+    index.changesSinceBuild = Changes();
+
+    QtConcurrent::run(&buildPool, [this, rootPath, index_file_path] {
+        QThread::currentThread()->setPriority(QThread::IdlePriority);
+
+        QSharedPointer<Data> data;
+
+        if (build(rootPath, index_file_path, stopped)) {
+            data = Data::load(rootPath, index_file_path);
+        } else if (!stopped.loadAcquire()) {
+            qWarning() << "Failed on build the file name index for:" << rootPath;
+        }
+
+        QMutexLocker locker(&mutex);
+        MountIndex &index = indexes[rootPath];
+
+        index.building = false;
+
+        if (data) {
+            index.data = data;
+            index.changes = index.changesSinceBuild;
+        }
+
+        index.changesSinceBuild = Changes();
+    });
+}
+
+void DFileNameIndexPrivate::recordChange(const QString &filePath, const std::function<void(Changes &, const QByteArray &)> &func)
+{
+    const QByteArray &path = filePath.toLocal8Bit();
+    QMutexLocker locker(&mutex);
+    auto found = indexes.end();
+
+    // 文件只属于离它最近的挂载点
+    for (auto it = indexes.begin(); it != indexes.end(); ++it) {
+        if ((!it->data && !it->building) || !path.startsWith(it.key()))
+            continue;
+
+        if (it.key() != "/" && (path.size() <= it.key().size() || path.at(it.key().size()) != '/'))
+            continue;
+
+        if (found == indexes.end() || it.key().size() > found.key().size())
+            found = it;
+    }
+
+    if (found == indexes.end())
+        return;
+
+    func(found->changes, path);
+
+    if (found->building) {
+        func(found->changesSinceBuild, path);
+    } else if (found->changes.size() >= maxChangeCount) {
+        // 变化过多时搜索需要读取的目录也会变多，重建索引
+        startBuild(found.key(), *found);
+    }
+}
+
+Q_GLOBAL_STATIC(DFileNameIndex, globalFileNameIndex)
+
+DFileNameIndex *DFileNameIndex::instance()
+{
+    return globalFileNameIndex;
+}
+
+bool DFileNameIndex::isEnabled()
+{
+    return DFMApplication::genericAttribute(DFMApplication::GA_IndexFileName).toBool();
+}
+
+DFileNameIndex::DFileNameIndex()
+    : d_ptr(new DFileNameIndexPrivate())
+{
+    d_ptr->buildPool.setMaxThreadCount(1);
+}
+
+DFileNameIndex::~DFileNameIndex()
+{
+    Q_D(DFileNameIndex);
+
+    d->stopped.storeRelease(1);
+    d->buildPool.waitForDone();
+}
+
+DDirIterator *DFileNameIndex::createDirIterator(const QString &directory, const QString &keyword, QDir::Filters filters)
+{
+    Q_D(DFileNameIndex);
+
+    // 索引中记录的都是真实路径
+    const QString &real_directory = QFileInfo(directory).canonicalFilePath();
+    DMountTable::MountPoint mount_point;
+
+    if (real_directory.isEmpty() || !DMountTable::instance()->mountPoint(real_directory, &mount_point))
+        return nullptr;
+
+    static const QSet<QByteArray> virtual_file_systems {"proc", "sysfs", "devtmpfs", "tmpfs", "cgroup", "cgroup2", "debugfs"};
+
+    if (!mount_point.isLocalDevice() || virtual_file_systems.contains(mount_point.fileSystemType))
+        return nullptr;
+
+    QList<DMountTable::MountPoint> mount_points {mount_point};
+    QStringList skipped_mount_points;
+    const QString &directory_prefix = real_directory.endsWith('/') ? real_directory : real_directory + '/';
+
+    // 上级挂载点总是排在下级的前面
+    for (const DMountTable::MountPoint &mp : DMountTable::instance()->childMountPoints(real_directory)) {
+        const QString &mp_prefix = mp.rootPath + '/';
+
+        const bool in_skipped_mount_point = std::any_of(skipped_mount_points.constBegin(), skipped_mount_points.constEnd(),
+                                                        [&mp_prefix] (const QString &path) {
+            return mp_prefix.startsWith(path);
+        });
+
+        if (in_skipped_mount_point)
+            continue;
+
+        // 不搜索虚拟文件系统及挂载在其中的设备，不显示隐藏文件时也不搜索挂载在隐藏目录中的设备
+        if (virtual_file_systems.contains(mp.fileSystemType)
+                || (!filters.testFlag(QDir::Hidden) && isHiddenPath(mp_prefix.mid(directory_prefix.size()).toLocal8Bit()))) {
+            skipped_mount_points << mp_prefix;
+            continue;
+        }
+
+        // 其它设备没有索引，改为遍历目录
+        if (!mp.isLocalDevice())
+            return nullptr;
+
+        mount_points << mp;
+    }
+
+    QList<DirIterator::Snapshot> snapshots;
+    bool ready = true;
+    QMutexLocker locker(&d->mutex);
+
+    for (const DMountTable::MountPoint &mp : mount_points) {
+        // 依次为每个没有索引的挂载点开始建立索引
+        const DFileNameIndexPrivate::MountIndex &index = d->mountIndex(mp.rootPath.toLocal8Bit());
+
+        if (!index.data) {
+            ready = false;
+            continue;
+        }
+
+        snapshots << DirIterator::Snapshot {index.data, index.changes};
+    }
+
+    if (!ready)
+        return nullptr;
+
+    return new DirIterator(snapshots, directory, real_directory, keyword, filters);
+}
+
+void DFileNameIndex::fileCreated(const QString &filePath, bool isDirectory)
+{
+    Q_D(DFileNameIndex);
+
+    d->recordChange(filePath, [isDirectory] (Changes &changes, const QByteArray &path) {
+        changes.fileCreated(path, isDirectory);
+    });
+}
+
+void DFileNameIndex::fileRemoved(const QString &filePath)
+{
+    Q_D(DFileNameIndex);
+
+    d->recordChange(filePath, [] (Changes &changes, const QByteArray &path) {
+        changes.fileRemoved(path);
+    });
+}
+
+void DFileNameIndex::directoryChanged(const QString &directoryPath)
+{
+    Q_D(DFileNameIndex);
+
+    d->recordChange(directoryPath, [] (Changes &changes, const QByteArray &path) {
+        changes.directoryChanged(path);
+    });
+}
+
+DFM_END_NAMESPACE
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DFILENAMEINDEX_H
+#define DFILENAMEINDEX_H
+
+#include <dfmglobal.h>
+
+#include <QString>
+#include <QDir>
+
+class DDirIterator;
+
+DFM_BEGIN_NAMESPACE
+
+class DFileNameIndexPrivate;
+class DFileNameIndex
+{
+    Q_DECLARE_PRIVATE(DFileNameIndex)
+
+public:
+    static DFileNameIndex *instance();
+    static bool isEnabled();
+
+    DFileNameIndex();
+    ~DFileNameIndex();
+
+    // 目录及挂载在其中的本地设备的索引都可用时返回按文件名搜索的迭代器，否则在后台开始建立索引并返回nullptr。
+    // filters 中没有 QDir::Hidden 时不返回隐藏目录中的文件
+    DDirIterator *createDirIterator(const QString &directory, const QString &keyword, QDir::Filters filters = QDir::NoFilter);
+
+    // 以下由文件监视器调用，记录索引建立后的变化，搜索时和索引中的结果合并
+    void fileCreated(const QString &filePath, bool isDirectory);
+    void fileRemoved(const QString &filePath);
+    // 目录中有没有逐个记录的变化时（如事件风暴期间），搜索时重新读取此目录
+    void directoryChanged(const QString &directoryPath);
+
+private:
+    QScopedPointer<DFileNameIndexPrivate> d_ptr;
+};
+
+DFM_END_NAMESPACE
+
+#endif // DFILENAMEINDEX_H
@@ -0,0 +1,416 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "dfilesizecache.h"
+#include "dfmstandardpaths.h"
+
+#include <QHash>
+#include <QVector>
+#include <QMutex>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QDebug>
+
+#include <algorithm>
+
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+DFM_BEGIN_NAMESPACE
+
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
+// 缓存文件的格式变化时需要修改版本号
+static const quint32 cacheMagic = 0x44465343;
+static const quint32 cacheVersion = 1;
+// 缓存占用的内存上限，超出时移除最久没有使用的目录
+static const qint64 maxCacheCost = 64 * 1024 * 1024;
+
+typedef QPair<quint64, quint64> InodeKey;
+
+class DFileSizeCachePrivate
+{
+public:
+    struct CacheData {
+        qint64 mtime;
+        DFileSizeCache::DirectoryInfo info;
+        // 估计占用的内存
+        qint64 cost = 0;
+        // 最近一次使用的序号
+        quint64 lastUsed = 0;
+    };
+
+    void load();
+    // 调用时需要持有 mutex
+    void insert(const InodeKey &key, const CacheData &data);
+    void remove(QHash<InodeKey, CacheData>::iterator it);
+    void evict();
+    static qint64 costOf(const DFileSizeCache::DirectoryInfo &info);
+    static bool scan(int fd, DFileSizeCache::DirectoryInfo *info);
+
+    static qint64 mtimeOf(const struct stat &st)
+    {
+        return st.st_mtim.tv_sec * Q_INT64_C(1000000000) + st.st_mtim.tv_nsec;
+    }
+
+    QMutex mutex;
+    // 保证同一时间只有一个线程写入缓存文件
+    QMutex saveMutex;
+    bool loaded = false;
+    bool dirty = false;
+    QString cacheFilePath;
+    QHash<InodeKey, CacheData> cache;
+    qint64 totalCost = 0;
+    quint64 useCounter = 0;
+};
+
+void DFileSizeCachePrivate::load()
+{
+    if (loaded) {
+        return;
+    }
+
+    loaded = true;
+    cacheFilePath = DFMStandardPaths::location(DFMStandardPaths::CachePath) + "/directory-size.cache";
+
+    QFile file(cacheFilePath);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+
+    stream >> magic >> version >> count;
+
+    if (magic != cacheMagic || version != cacheVersion) {
+        qWarning() << "Ignore the directory size cache of unknown version:" << version;
+
+        return;
+    }
+
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        InodeKey key;
+        CacheData data;
+
+        stream >> key.first >> key.second >> data.mtime
+               >> data.info.size >> data.info.filesCount >> data.info.hardLinks
+               >> data.info.directories >> data.info.symlinks;
+
+        insert(key, data);
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        qWarning() << "The directory size cache is damaged:" << cacheFilePath;
+
+        cache.clear();
+        totalCost = 0;
+    }
+}
+
+void DFileSizeCachePrivate::insert(const InodeKey &key, const CacheData &data)
+{
+    auto it = cache.find(key);
+
+    if (it != cache.end()) {
+        remove(it);
+    }
+
+    it = cache.insert(key, data);
+    it->cost = costOf(it->info);
+    it->lastUsed = ++useCounter;
+    totalCost += it->cost;
+
+    if (totalCost > maxCacheCost) {
+        evict();
+    }
+}
+
+void DFileSizeCachePrivate::remove(QHash<InodeKey, CacheData>::iterator it)
+{
+    totalCost -= it->cost;
+    cache.erase(it);
+}
+
+void DFileSizeCachePrivate::evict()
+{
+    // 按最近使用的顺序一次移除到上限的3/4以下，避免每次插入都需要排序
+    QVector<QPair<quint64, InodeKey>> entries;
+
+    entries.reserve(cache.size());
+
+    for (auto it = cache.constBegin(); it != cache.constEnd(); ++it) {
+        entries << qMakePair(it->lastUsed, it.key());
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    for (const QPair<quint64, InodeKey> &entry : entries) {
+        if (totalCost <= maxCacheCost / 4 * 3) {
+            break;
+        }
+
+        remove(cache.find(entry.second));
+    }
+}
+
+qint64 DFileSizeCachePrivate::costOf(const DFileSizeCache::DirectoryInfo &info)
+{
+    // 哈希表的节点、QByteArray 的数据头等按估计值计算
+    static const qint64 node_cost = 32;
+    qint64 cost = static_cast<qint64>(sizeof(InodeKey) + sizeof(CacheData)) + node_cost;
+
+    for (const QByteArray &name : info.directories) {
+        cost += name.size() + node_cost;
+    }
+
+    for (const QByteArray &name : info.symlinks) {
+        cost += name.size() + node_cost;
+    }
+
+    cost += info.hardLinks.size() * (static_cast<qint64>(sizeof(info.hardLinks.first())) + node_cost);
+
+    return cost;
+}
+
+bool DFileSizeCachePrivate::scan(int fd, DFileSizeCache::DirectoryInfo *info)
+{
+    char buffer[32 * 1024];
+
+    Q_FOREVER {
+        long size = syscall(SYS_getdents64, fd, buffer, sizeof(buffer));
+
+        if (size < 0) {
+            return false;
+        }
+
+        if (size == 0) {
+            break;
+        }
+
+        for (long offset = 0; offset < size;) {
+            const linux_dirent64 *entry = reinterpret_cast<const linux_dirent64 *>(buffer + offset);
+            const char *name = entry->d_name;
+
+            offset += entry->d_reclen;
+
+            if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0))) {
+                continue;
+            }
+
+            // 目录和符号链接不需要获取文件信息
+            if (entry->d_type == DT_DIR) {
+                info->directories << QByteArray(name);
+                continue;
+            }
+
+            if (entry->d_type == DT_LNK) {
+                info->symlinks << QByteArray(name);
+                continue;
+            }
+
+            struct stat st;
+
+            if (fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+                continue;
+            }
+
+            if (S_ISDIR(st.st_mode)) {
+                info->directories << QByteArray(name);
+            } else if (S_ISLNK(st.st_mode)) {
+                info->symlinks << QByteArray(name);
+            } else {
+                ++info->filesCount;
+
+                if (!S_ISREG(st.st_mode)) {
+                    continue;
+                }
+
+                if (st.st_nlink > 1) {
+                    info->hardLinks << qMakePair(InodeKey(st.st_dev, st.st_ino), static_cast<qint64>(st.st_size));
+                } else {
+                    info->size += st.st_size;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+Q_GLOBAL_STATIC(DFileSizeCache, globalFileSizeCache)
+
+DFileSizeCache *DFileSizeCache::instance()
+{
+    return globalFileSizeCache;
+}
+
+DFileSizeCache::DFileSizeCache()
+    : d_ptr(new DFileSizeCachePrivate())
+{
+
+}
+
+DFileSizeCache::~DFileSizeCache()
+{
+
+}
+
+DFileSizeCache::DirectoryInfo DFileSizeCache::directoryInfo(int fd, const struct stat &st, const QByteArray &path)
+{
+    Q_D(DFileSizeCache);
+
+    const InodeKey key(st.st_dev, st.st_ino);
+    const qint64 mtime = DFileSizeCachePrivate::mtimeOf(st);
+
+    {
+        QMutexLocker locker(&d->mutex);
+
+        d->load();
+
+        auto it = d->cache.find(key);
+
+        if (it != d->cache.end() && it->mtime == mtime) {
+            it->lastUsed = ++d->useCounter;
+
+            return it->info;
+        }
+    }
+
+    DirectoryInfo info;
+
+    if (!DFileSizeCachePrivate::scan(fd, &info)) {
+        qWarning() << "Failed on read the directory:" << path << strerror(errno);
+
+        return info;
+    }
+
+    // 虚拟文件系统中的数据随时都在变化
+    if (path == "/proc" || path.startsWith("/proc/") || path.startsWith("/sys/") || path.startsWith("/dev/")) {
+        return info;
+    }
+
+    // 文件系统的时间精度可能只有1秒，刚刚修改过的目录可能在同一秒内再次被修改而不改变修改时间
+    if (st.st_mtim.tv_sec >= time(nullptr) - 1) {
+        return info;
+    }
+
+    QMutexLocker locker(&d->mutex);
+    DFileSizeCachePrivate::CacheData data;
+
+    data.mtime = mtime;
+    data.info = info;
+    d->insert(key, data);
+    d->dirty = true;
+
+    return info;
+}
+
+void DFileSizeCache::invalidate(const QString &directoryPath)
+{
+    Q_D(DFileSizeCache);
+
+    QMutexLocker locker(&d->mutex);
+
+    // 未加载的缓存在使用时会通过修改时间校验
+    if (d->cache.isEmpty()) {
+        return;
+    }
+
+    struct stat st;
+
+    if (::stat(directoryPath.toLocal8Bit().constData(), &st) != 0) {
+        return;
+    }
+
+    auto it = d->cache.find(InodeKey(st.st_dev, st.st_ino));
+
+    if (it != d->cache.end()) {
+        d->remove(it);
+        d->dirty = true;
+    }
+}
+
+void DFileSizeCache::save()
+{
+    Q_D(DFileSizeCache);
+
+    QMutexLocker save_locker(&d->saveMutex);
+    QHash<InodeKey, DFileSizeCachePrivate::CacheData> cache;
+    QString cache_file_path;
+
+    {
+        QMutexLocker locker(&d->mutex);
+
+        if (!d->dirty || d->cacheFilePath.isEmpty()) {
+            return;
+        }
+
+        // 只复制引用，写入文件期间其它线程修改缓存时才会分离数据，不会因为写文件而阻塞 invalidate
+        cache = d->cache;
+        cache_file_path = d->cacheFilePath;
+        d->dirty = false;
+    }
+
+    QSaveFile file(cache_file_path);
+
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Failed on save the directory size cache:" << file.errorString();
+
+        QMutexLocker locker(&d->mutex);
+        d->dirty = true;
+
+        return;
+    }
+
+    QDataStream stream(&file);
+
+    stream << cacheMagic << cacheVersion << static_cast<quint32>(cache.size());
+
+    for (auto it = cache.constBegin(); it != cache.constEnd(); ++it) {
+        const DirectoryInfo &info = it->info;
+
+        stream << it.key().first << it.key().second << it->mtime
+               << info.size << info.filesCount << info.hardLinks
+               << info.directories << info.symlinks;
+    }
+
+    if (!file.commit()) {
+        qWarning() << "Failed on save the directory size cache:" << file.errorString();
+
+        QMutexLocker locker(&d->mutex);
+        d->dirty = true;
+    }
+}
+
+DFM_END_NAMESPACE
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DFILESIZECACHE_H
+#define DFILESIZECACHE_H
+
+#include <dfmglobal.h>
+
+#include <QByteArrayList>
+
+#include <sys/stat.h>
+
+DFM_BEGIN_NAMESPACE
+
+class DFileSizeCachePrivate;
+class DFileSizeCache
+{
+    Q_DECLARE_PRIVATE(DFileSizeCache)
+
+public:
+    // 只记录目录中直接包含的文件，子目录的数据需要再次查询
+    struct DirectoryInfo {
+        // 硬链接数为1的普通文件的总大小
+        qint64 size = 0;
+        // 不包括目录和符号链接
+        int filesCount = 0;
+        // 硬链接数大于1的普通文件，由调用者决定是否去重
+        QList<QPair<QPair<quint64, quint64>, qint64>> hardLinks;
+        QByteArrayList directories;
+        QByteArrayList symlinks;
+    };
+
+    static DFileSizeCache *instance();
+
+    DFileSizeCache();
+    ~DFileSizeCache();
+
+    // fd 为已打开的目录，st 为此目录的信息，目录的修改时间和缓存一致时直接返回缓存的数据
+    DirectoryInfo directoryInfo(int fd, const struct stat &st, const QByteArray &path);
+
+    void invalidate(const QString &directoryPath);
+    // 在使用缓存的任务结束时调用，缓存不会在程序退出时自动保存
+    void save();
+
+private:
+    QScopedPointer<DFileSizeCachePrivate> d_ptr;
+};
+
+DFM_END_NAMESPACE
+
+#endif // DFILESIZECACHE_H
@@ -22,14 +22,37 @@
 #include "dfileservices.h"
 #include "dabstractfileinfo.h"
 #include "dstorageinfo.h"
+#include "dfilesizecache.h"
 
 #include <QMutex>
 #include <QQueue>
 #include <QTimer>
 #include <QWaitCondition>
+#include <QMetaMethod>
+#include <QSet>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/vfs.h>
+#include <sys/syscall.h>
 
 DFM_BEGIN_NAMESPACE
 
+#ifndef PROC_SUPER_MAGIC
+#define PROC_SUPER_MAGIC 0x9fa0
+#endif
+
+struct linux_dirent64 {
+    ino64_t d_ino;
+    off64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+
 class DFileStatisticsJobPrivate
 {
 public:
@@ -42,6 +65,15 @@ public:
 
     void processFile(const DUrl &url, QQueue<DUrl> &directoryQueue);
 
+    // 对本地目录直接使用系统调用统计，不为每个文件创建 DAbstractFileInfo
+    void processLocalDirectories(const QList<QByteArray> &directoryList);
+    void localWorker();
+    bool processLocalDirectory(const QByteArray &path, char *buffer, int bufferSize);
+    void processLocalFile(int directoryFd, dev_t directoryDevice, const QByteArray &path, const char *name);
+    bool markAsVisited(const struct stat &st);
+    bool markAsVisited(const QPair<quint64, quint64> &key);
+    void enqueueLocalDirectory(const QByteArray &path);
+
     DFileStatisticsJob *q_ptr;
     QTimer *notifyDataTimer;
 
@@ -54,6 +86,23 @@ public:
     QAtomicInteger<qint64> totalSize = 0;
     QAtomicInt filesCount = 0;
     QAtomicInt directoryCount = 0;
+
+    bool notifyFileFound = false;
+    bool notifyDirectoryFound = false;
+    bool notifySizeChanged = false;
+    // 不需要逐个通知文件时可以直接使用缓存的目录大小
+    bool useSizeCache = false;
+
+    QMutex localQueueMutex;
+    QWaitCondition localQueueCondition;
+    QQueue<QByteArray> localDirectoryQueue;
+    // 正在处理目录的线程数
+    int busyWorkers = 0;
+    bool aborted = false;
+
+    QMutex visitedMutex;
+    // 用于对硬链接去重，以及跟随符号链接时避免循环
+    QSet<QPair<quint64, quint64>> visitedInodes;
 };
 
 DFileStatisticsJobPrivate::DFileStatisticsJobPrivate(DFileStatisticsJob *qq)
@@ -209,6 +258,292 @@ void DFileStatisticsJobPrivate::processFile(const DUrl &url, QQueue<DUrl> &direc
     }
 }
 
+void DFileStatisticsJobPrivate::processLocalDirectories(const QList<QByteArray> &directoryList)
+{
+    localDirectoryQueue.clear();
+    busyWorkers = 0;
+    aborted = false;
+
+    for (const QByteArray &path : directoryList) {
+        if (fileHints.testFlag(DFileStatisticsJob::FollowSymlink)) {
+            struct stat st;
+
+            if (::stat(path.constData(), &st) == 0 && !markAsVisited(st)) {
+                continue;
+            }
+        }
+
+        localDirectoryQueue << path;
+    }
+
+    // 目录遍历主要是在等待io，线程数可以适当多于cpu数
+    const int worker_count = qBound(1, QThread::idealThreadCount(), 4);
+    QThreadPool pool;
+
+    pool.setMaxThreadCount(worker_count - 1);
+
+    for (int i = 1; i < worker_count; ++i) {
+        QtConcurrent::run(&pool, [this] {
+            localWorker();
+        });
+    }
+
+    localWorker();
+    pool.waitForDone();
+}
+
+void DFileStatisticsJobPrivate::localWorker()
+{
+    const int buffer_size = 32 * 1024;
+    QByteArray buffer(buffer_size, Qt::Uninitialized);
+
+    Q_FOREVER {
+        localQueueMutex.lock();
+
+        while (localDirectoryQueue.isEmpty() && busyWorkers > 0 && !aborted) {
+            localQueueCondition.wait(&localQueueMutex);
+        }
+
+        if (aborted || localDirectoryQueue.isEmpty()) {
+            localQueueMutex.unlock();
+
+            return;
+        }
+
+        const QByteArray path = localDirectoryQueue.dequeue();
+
+        ++busyWorkers;
+        localQueueMutex.unlock();
+
+        bool ok = processLocalDirectory(path, buffer.data(), buffer_size);
+
+        localQueueMutex.lock();
+        --busyWorkers;
+
+        if (!ok) {
+            aborted = true;
+        }
+
+        if (aborted || (busyWorkers == 0 && localDirectoryQueue.isEmpty())) {
+            localQueueCondition.wakeAll();
+        }
+
+        localQueueMutex.unlock();
+    }
+}
+
+bool DFileStatisticsJobPrivate::processLocalDirectory(const QByteArray &path, char *buffer, int bufferSize)
+{
+    int fd = ::open(path.constData(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    if (fd < 0) {
+        qWarning() << "Failed on open the directory:" << path << strerror(errno);
+
+        return true;
+    }
+
+    struct stat directory_st;
+
+    if (fstat(fd, &directory_st) != 0) {
+        ::close(fd);
+
+        return true;
+    }
+
+    if (useSizeCache && path != "/proc" && !path.startsWith("/proc/")) {
+        const DFileSizeCache::DirectoryInfo &info = DFileSizeCache::instance()->directoryInfo(fd, directory_st, path);
+        qint64 size = info.size;
+
+        for (const auto &hard_link : info.hardLinks) {
+            if (markAsVisited(hard_link.first)) {
+                size += hard_link.second;
+            }
+        }
+
+        filesCount += info.filesCount;
+
+        if (size > 0) {
+            qint64 total_size = totalSize.fetchAndAddRelaxed(size) + size;
+
+            if (notifySizeChanged) {
+                Q_EMIT q_ptr->sizeChanged(total_size);
+            }
+        }
+
+        // 子目录和符号链接仍需逐个处理，以便检查挂载点和跟随链接
+        for (const QByteArray &name : info.directories) {
+            processLocalFile(fd, directory_st.st_dev, path, name.constData());
+        }
+
+        for (const QByteArray &name : info.symlinks) {
+            processLocalFile(fd, directory_st.st_dev, path, name.constData());
+        }
+
+        ::close(fd);
+
+        return stateCheck();
+    }
+
+    Q_FOREVER {
+        long size = syscall(SYS_getdents64, fd, buffer, bufferSize);
+
+        if (size <= 0) {
+            break;
+        }
+
+        for (long offset = 0; offset < size;) {
+            const linux_dirent64 *entry = reinterpret_cast<const linux_dirent64 *>(buffer + offset);
+
+            offset += entry->d_reclen;
+
+            if (entry->d_name[0] == '.' && (entry->d_name[1] == 0 || (entry->d_name[1] == '.' && entry->d_name[2] == 0))) {
+                continue;
+            }
+
+            processLocalFile(fd, directory_st.st_dev, path, entry->d_name);
+        }
+
+        if (!stateCheck()) {
+            ::close(fd);
+
+            return false;
+        }
+    }
+
+    ::close(fd);
+
+    return true;
+}
+
+void DFileStatisticsJobPrivate::processLocalFile(int directoryFd, dev_t directoryDevice, const QByteArray &directoryPath, const char *name)
+{
+    QByteArray path = directoryPath;
+
+    if (!path.endsWith('/')) {
+        path.append('/');
+    }
+
+    path.append(name);
+
+    struct stat st;
+
+    if (fstatat(directoryFd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+        return;
+    }
+
+    bool is_symlink = S_ISLNK(st.st_mode);
+
+    if (is_symlink) {
+        struct stat target_st;
+
+        // 和 DAbstractFileInfo::isFile 一致，指向文件的符号链接按目标文件计算大小
+        if (fstatat(directoryFd, name, &target_st, 0) != 0) {
+            ++filesCount;
+
+            if (notifyFileFound) {
+                Q_EMIT q_ptr->fileFound(DUrl::fromLocalFile(QString::fromLocal8Bit(path)));
+            }
+
+            return;
+        }
+
+        if (S_ISDIR(target_st.st_mode) && !fileHints.testFlag(DFileStatisticsJob::FollowSymlink)) {
+            ++filesCount;
+
+            if (notifyFileFound) {
+                Q_EMIT q_ptr->fileFound(DUrl::fromLocalFile(QString::fromLocal8Bit(path)));
+            }
+
+            return;
+        }
+
+        st = target_st;
+    }
+
+    if (S_ISDIR(st.st_mode)) {
+        ++directoryCount;
+
+        bool skip = fileHints.testFlag(DFileStatisticsJob::SingleDepth);
+
+        // 在挂载点上检查是否需要跳过 proc 和 avfsd 文件系统
+        if (!skip && st.st_dev != directoryDevice) {
+            struct statfs fs;
+
+            if (statfs(path.constData(), &fs) == 0 && fs.f_type == PROC_SUPER_MAGIC) {
+                skip = !fileHints.testFlag(DFileStatisticsJob::DontSkipPROCStorage);
+            } else if (!fileHints.testFlag(DFileStatisticsJob::DontSkipAVFSDStorage)) {
+                DStorageInfo si(QString::fromLocal8Bit(path));
+
+                skip = si.rootPath() == QString::fromLocal8Bit(path) && si.device() == "avfsd";
+            }
+        }
+
+        if (!skip && (!is_symlink || markAsVisited(st))) {
+            enqueueLocalDirectory(path);
+        }
+
+        if (notifyDirectoryFound) {
+            Q_EMIT q_ptr->directoryFound(DUrl::fromLocalFile(QString::fromLocal8Bit(path)));
+        }
+
+        return;
+    }
+
+    ++filesCount;
+
+    qint64 size = 0;
+
+    if (S_ISREG(st.st_mode)) {
+        // ###(zccrs): skip the file
+        if (path != "/proc/kcore" && (st.st_nlink <= 1 || markAsVisited(st))) {
+            size = st.st_size;
+        }
+    } else if ((S_ISCHR(st.st_mode) && fileHints.testFlag(DFileStatisticsJob::DontSkipCharDeviceFile))
+               || (S_ISBLK(st.st_mode) && fileHints.testFlag(DFileStatisticsJob::DontSkipBlockDeviceFile))
+               || (S_ISFIFO(st.st_mode) && fileHints.testFlag(DFileStatisticsJob::DontSkipFIFOFile))
+               || (S_ISSOCK(st.st_mode) && fileHints.testFlag(DFileStatisticsJob::DontSkipSocketFile))) {
+        size = st.st_size;
+    }
+
+    if (notifyFileFound) {
+        Q_EMIT q_ptr->fileFound(DUrl::fromLocalFile(QString::fromLocal8Bit(path)));
+    }
+
+    if (size > 0) {
+        qint64 total_size = totalSize.fetchAndAddRelaxed(size) + size;
+
+        if (notifySizeChanged) {
+            Q_EMIT q_ptr->sizeChanged(total_size);
+        }
+    }
+}
+
+bool DFileStatisticsJobPrivate::markAsVisited(const struct stat &st)
+{
+    return markAsVisited(QPair<quint64, quint64>(st.st_dev, st.st_ino));
+}
+
+bool DFileStatisticsJobPrivate::markAsVisited(const QPair<quint64, quint64> &key)
+{
+    QMutexLocker locker(&visitedMutex);
+
+    if (visitedInodes.contains(key)) {
+        return false;
+    }
+
+    visitedInodes.insert(key);
+
+    return true;
+}
+
+void DFileStatisticsJobPrivate::enqueueLocalDirectory(const QByteArray &path)
+{
+    QMutexLocker locker(&localQueueMutex);
+
+    localDirectoryQueue.enqueue(path);
+    localQueueCondition.wakeOne();
+}
+
 DFileStatisticsJob::DFileStatisticsJob(QObject *parent)
     : QThread(parent)
     , d_ptr(new DFileStatisticsJobPrivate(this))
@@ -321,6 +656,13 @@ void DFileStatisticsJob::run()
 
     Q_EMIT dataNotify(0, 0, 0);
 
+    d->notifyFileFound = isSignalConnected(QMetaMethod::fromSignal(&DFileStatisticsJob::fileFound));
+    d->notifyDirectoryFound = isSignalConnected(QMetaMethod::fromSignal(&DFileStatisticsJob::directoryFound));
+    d->notifySizeChanged = isSignalConnected(QMetaMethod::fromSignal(&DFileStatisticsJob::sizeChanged));
+    d->useSizeCache = !d->notifyFileFound && !d->notifyDirectoryFound
+                      && !(d->fileHints & (DontSkipCharDeviceFile | DontSkipBlockDeviceFile | DontSkipFIFOFile | DontSkipSocketFile));
+    d->visitedInodes.clear();
+
     QQueue<DUrl> directory_queue;
 
     if (d->fileHints.testFlag(ExcludeSourceFile)) {
@@ -370,8 +712,42 @@ void DFileStatisticsJob::run()
         }
     }
 
+    QList<QByteArray> local_directory_list;
+
+    for (auto it = directory_queue.begin(); it != directory_queue.end();) {
+        if (it->isLocalFile()) {
+            local_directory_list << it->toLocalFile().toLocal8Bit();
+            it = directory_queue.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (!local_directory_list.isEmpty()) {
+        d->processLocalDirectories(local_directory_list);
+
+        if (!d->stateCheck()) {
+            d->setState(StoppedState);
+
+            return;
+        }
+    }
+
     while (!directory_queue.isEmpty()) {
-        const DUrl &directory_url = directory_queue.dequeue();
+        const DUrl directory_url = directory_queue.dequeue();
+
+        // 非本地目录中也可能包含本地目录，如标记和最近使用的文件
+        if (directory_url.isLocalFile()) {
+            d->processLocalDirectories({directory_url.toLocalFile().toLocal8Bit()});
+
+            if (!d->stateCheck()) {
+                d->setState(StoppedState);
+
+                return;
+            }
+
+            continue;
+        }
         const DDirIteratorPointer &iterator = DFileService::instance()->createDirIterator(nullptr, directory_url, QStringList(),
                                               QDir::AllEntries | QDir::Hidden | QDir::System | QDir::NoDotAndDotDot, 0, true);
 
@@ -391,6 +767,10 @@ void DFileStatisticsJob::run()
         }
     }
 
+    if (d->useSizeCache) {
+        DFileSizeCache::instance()->save();
+    }
+
     d->setState(StoppedState);
 }
 
@@ -0,0 +1,732 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "dfulltextindex.h"
+#include "dfmstandardpaths.h"
+#include "dfmapplication.h"
+
+#include <QHash>
+#include <QSet>
+#include <QQueue>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+#include <QThreadPool>
+#include <QtConcurrent>
+#include <QFile>
+#include <QFileInfo>
+#include <QDir>
+#include <QDirIterator>
+#include <QRegExp>
+#include <QMimeDatabase>
+#include <QTextCodec>
+#include <QStandardPaths>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QDebug>
+
+#include <poppler-document.h>
+#include <poppler-page.h>
+
+#include <algorithm>
+
+#include <math.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+DFM_BEGIN_NAMESPACE
+
+namespace FullTextIndex {
+
+// 数据库结构变化时需要修改版本号
+static const int databaseVersion = 1;
+// 单个文件最多提取的文本长度
+static const int maxTextLength = 4 * 1024 * 1024;
+static const qint64 maxTextFileSize = 16 * 1024 * 1024;
+static const qint64 maxPdfFileSize = 64 * 1024 * 1024;
+static const int maxPdfPageCount = 500;
+static const int maxTermLength = 64;
+// 每处理这么多文件提交一次事务
+static const int filesPerTransaction = 50;
+
+static QString databasePath()
+{
+    return DFMStandardPaths::location(DFMStandardPaths::CachePath) + "/fulltext-index.db";
+}
+
+static QString upperBound(const QString &prefix)
+{
+    static const uint max_ucs4 = 0x10ffff;
+
+    return prefix + QString::fromUcs4(&max_ucs4, 1);
+}
+
+static QSqlDatabase openDatabase(const QString &connectionName, bool readOnly)
+{
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+
+    db.setDatabaseName(databasePath());
+
+    if (readOnly) {
+        if (!QFile::exists(db.databaseName()))
+            return db;
+
+        db.setConnectOptions("QSQLITE_OPEN_READONLY;QSQLITE_BUSY_TIMEOUT=1000");
+    } else {
+        QDir().mkpath(QFileInfo(db.databaseName()).absolutePath());
+    }
+
+    if (!db.open()) {
+        qWarning() << "Failed on open the full-text index:" << db.lastError().text();
+
+        return db;
+    }
+
+    if (readOnly)
+        return db;
+
+    QSqlQuery query(db);
+
+    // WAL 模式下搜索不会被正在写入的索引阻塞
+    query.exec("PRAGMA journal_mode=WAL");
+    query.exec("PRAGMA synchronous=NORMAL");
+
+    if (query.exec("PRAGMA user_version") && query.next() && query.value(0).toInt() != databaseVersion) {
+        query.exec("DROP TABLE IF EXISTS postings");
+        query.exec("DROP TABLE IF EXISTS terms");
+        query.exec("DROP TABLE IF EXISTS files");
+        query.exec(QString("PRAGMA user_version=%1").arg(databaseVersion));
+    }
+
+    // length 为文件中词的总数，用于计算相关度
+    query.exec("CREATE TABLE IF NOT EXISTS files (id INTEGER PRIMARY KEY, path TEXT UNIQUE NOT NULL, "
+               "mtime INTEGER NOT NULL, size INTEGER NOT NULL, length INTEGER NOT NULL)");
+    query.exec("CREATE TABLE IF NOT EXISTS terms (id INTEGER PRIMARY KEY, term TEXT UNIQUE NOT NULL)");
+    query.exec("CREATE TABLE IF NOT EXISTS postings (term_id INTEGER NOT NULL, file_id INTEGER NOT NULL, "
+               "tf INTEGER NOT NULL, PRIMARY KEY (term_id, file_id)) WITHOUT ROWID");
+    query.exec("CREATE INDEX IF NOT EXISTS postings_file ON postings (file_id)");
+
+    return db;
+}
+
+// 英文等按单词切分，汉字按单字切分，全部转为小写
+template<typename Function>
+static void tokenize(const QString &text, Function function)
+{
+    QString word;
+
+    auto flush_word = [&] {
+        if (word.size() > 1 && word.size() <= maxTermLength)
+            function(word);
+
+        word.clear();
+    };
+
+    for (const QChar &ch : text) {
+        if (ch.script() == QChar::Script_Han) {
+            flush_word();
+            function(QString(ch));
+        } else if (ch.isLetterOrNumber()) {
+            word.append(ch.toLower());
+        } else {
+            flush_word();
+        }
+    }
+
+    flush_word();
+}
+
+static bool isPdfFile(const QMimeType &mimeType)
+{
+    return mimeType.name() == "application/pdf";
+}
+
+static bool isIndexable(const QFileInfo &info)
+{
+    static QMimeDatabase mime_database;
+    const QMimeType &mime_type = mime_database.mimeTypeForFile(info, QMimeDatabase::MatchExtension);
+
+    if (isPdfFile(mime_type))
+        return info.size() <= maxPdfFileSize;
+
+    return mime_type.inherits("text/plain") && info.size() <= maxTextFileSize;
+}
+
+static QString extractText(const QString &filePath)
+{
+    static QMimeDatabase mime_database;
+
+    if (isPdfFile(mime_database.mimeTypeForFile(filePath, QMimeDatabase::MatchExtension))) {
+        QScopedPointer<poppler::document> doc(poppler::document::load_from_file(filePath.toStdString()));
+
+        if (!doc || doc->is_locked())
+            return QString();
+
+        QString text;
+        const int page_count = qMin(doc->pages(), maxPdfPageCount);
+
+        for (int i = 0; i < page_count && text.size() < maxTextLength; ++i) {
+            QScopedPointer<poppler::page> page(doc->create_page(i));
+
+            if (!page)
+                continue;
+
+            const poppler::byte_array &utf8 = page->text().to_utf8();
+
+            text.append(QString::fromUtf8(utf8.data(), static_cast<int>(utf8.size())));
+            text.append('\n');
+        }
+
+        return text;
+    }
+
+    QFile file(filePath);
+
+    if (!file.open(QIODevice::ReadOnly))
+        return QString();
+
+    const QByteArray &data = file.read(maxTextLength);
+
+    // 扩展名是文本但内容是二进制的文件
+    if (data.left(4096).contains('\0'))
+        return QString();
+
+    return QTextCodec::codecForUtfText(data, QTextCodec::codecForLocale())->toUnicode(data);
+}
+
+// 在一个线程中持有数据库连接并更新索引
+class Writer
+{
+public:
+    explicit Writer(const QSqlDatabase &db)
+        : db(db)
+        , insertFile(db)
+        , deleteFile(db)
+        , deletePostings(db)
+        , insertTerm(db)
+        , selectTerm(db)
+        , insertPosting(db)
+    {
+        insertFile.prepare("INSERT OR REPLACE INTO files (path, mtime, size, length) VALUES (?, ?, ?, ?)");
+        deleteFile.prepare("DELETE FROM files WHERE path = ?");
+        deletePostings.prepare("DELETE FROM postings WHERE file_id = (SELECT id FROM files WHERE path = ?)");
+        insertTerm.prepare("INSERT OR IGNORE INTO terms (term) VALUES (?)");
+        selectTerm.prepare("SELECT id FROM terms WHERE term = ?");
+        insertPosting.prepare("INSERT INTO postings (term_id, file_id, tf) VALUES (?, ?, ?)");
+    }
+
+    ~Writer()
+    {
+        commit();
+    }
+
+    void indexFile(const QFileInfo &info)
+    {
+        const QString &file_path = info.absoluteFilePath();
+        QHash<QString, int> term_frequencies;
+        int length = 0;
+
+        tokenize(extractText(file_path), [&] (const QString &term) {
+            ++term_frequencies[term];
+            ++length;
+        });
+
+        begin();
+        removePostings(file_path);
+
+        // 无法提取内容的文件也要记录，避免每次启动时重复处理
+        insertFile.addBindValue(file_path);
+        insertFile.addBindValue(info.lastModified().toMSecsSinceEpoch());
+        insertFile.addBindValue(info.size());
+        insertFile.addBindValue(length);
+
+        if (!insertFile.exec()) {
+            qWarning() << "Failed on update the full-text index:" << insertFile.lastError().text();
+            finishFile();
+
+            return;
+        }
+
+        const qint64 file_id = insertFile.lastInsertId().toLongLong();
+
+        for (auto it = term_frequencies.constBegin(); it != term_frequencies.constEnd(); ++it) {
+            insertPosting.addBindValue(termId(it.key()));
+            insertPosting.addBindValue(file_id);
+            insertPosting.addBindValue(it.value());
+            insertPosting.exec();
+        }
+
+        finishFile();
+    }
+
+    void removeFile(const QString &filePath)
+    {
+        begin();
+        removePostings(filePath);
+        deleteFile.addBindValue(filePath);
+        deleteFile.exec();
+        finishFile();
+    }
+
+    void commit()
+    {
+        if (pendingFileCount > 0) {
+            db.commit();
+            pendingFileCount = 0;
+        }
+    }
+
+private:
+    void begin()
+    {
+        if (pendingFileCount == 0)
+            db.transaction();
+    }
+
+    void finishFile()
+    {
+        if (++pendingFileCount >= filesPerTransaction)
+            commit();
+    }
+
+    void removePostings(const QString &filePath)
+    {
+        deletePostings.addBindValue(filePath);
+        deletePostings.exec();
+    }
+
+    qint64 termId(const QString &term)
+    {
+        qint64 id = termIdCache.value(term, -1);
+
+        if (id >= 0)
+            return id;
+
+        insertTerm.addBindValue(term);
+        insertTerm.exec();
+        selectTerm.addBindValue(term);
+
+        if (selectTerm.exec() && selectTerm.next())
+            id = selectTerm.value(0).toLongLong();
+
+        selectTerm.finish();
+
+        // 限制缓存占用的内存
+        if (termIdCache.size() > 200000)
+            termIdCache.clear();
+
+        termIdCache[term] = id;
+
+        return id;
+    }
+
+    QSqlDatabase db;
+    QSqlQuery insertFile;
+    QSqlQuery deleteFile;
+    QSqlQuery deletePostings;
+    QSqlQuery insertTerm;
+    QSqlQuery selectTerm;
+    QSqlQuery insertPosting;
+    QHash<QString, qint64> termIdCache;
+    int pendingFileCount = 0;
+};
+
+} // namespace FullTextIndex
+
+using namespace FullTextIndex;
+
+class DFullTextIndexPrivate
+{
+public:
+    void worker();
+    bool scanDirectories(Writer &writer, const QSqlDatabase &db);
+    bool isIndexedPath(const QString &filePath) const;
+
+    QStringList directories;
+
+    QMutex mutex;
+    QWaitCondition condition;
+    // 等待处理的文件变化，值为 false 时表示文件已被删除
+    QQueue<QString> pendingFiles;
+    QHash<QString, bool> pendingFileStates;
+
+    QAtomicInt running;
+    QAtomicInt stopped;
+    QThreadPool pool;
+};
+
+bool DFullTextIndexPrivate::isIndexedPath(const QString &filePath) const
+{
+    for (const QString &directory : directories) {
+        if (filePath.size() > directory.size() && filePath.startsWith(directory) && filePath.at(directory.size()) == '/') {
+            // 不索引隐藏目录中的文件
+            return !filePath.midRef(directory.size()).contains("/.");
+        }
+    }
+
+    return false;
+}
+
+bool DFullTextIndexPrivate::scanDirectories(Writer &writer, const QSqlDatabase &db)
+{
+    QHash<QString, QPair<qint64, qint64>> indexed_files;
+    QSqlQuery query(db);
+
+    if (query.exec("SELECT path, mtime, size FROM files")) {
+        while (query.next()) {
+            indexed_files[query.value(0).toString()] = qMakePair(query.value(1).toLongLong(), query.value(2).toLongLong());
+        }
+    }
+
+    query.finish();
+
+    for (const QString &directory : directories) {
+        QDirIterator iterator(directory, QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+
+        while (iterator.hasNext()) {
+            if (stopped.loadAcquire())
+                return false;
+
+            iterator.next();
+
+            const QFileInfo &info = iterator.fileInfo();
+
+            if (info.isSymLink() || !isIndexable(info))
+                continue;
+
+            const QPair<qint64, qint64> &state = indexed_files.take(info.absoluteFilePath());
+
+            // 只处理新增或修改过的文件
+            if (state.first == info.lastModified().toMSecsSinceEpoch() && state.second == info.size())
+                continue;
+
+            writer.indexFile(info);
+        }
+    }
+
+    // 剩下的是已经不存在的文件
+    for (auto it = indexed_files.constBegin(); it != indexed_files.constEnd(); ++it) {
+        if (stopped.loadAcquire())
+            return false;
+
+        writer.removeFile(it.key());
+    }
+
+    writer.commit();
+
+    return true;
+}
+
+void DFullTextIndexPrivate::worker()
+{
+    // 使用空闲的io和cpu优先级，避免影响前台操作
+    static const int ioprio_who_process = 1;
+    static const int ioprio_class_idle = 3;
+    static const int ioprio_class_shift = 13;
+
+    syscall(SYS_ioprio_set, ioprio_who_process, 0, ioprio_class_idle << ioprio_class_shift);
+    QThread::currentThread()->setPriority(QThread::IdlePriority);
+
+    const QString connection_name = QStringLiteral("dfm_fulltext_index_writer");
+
+    {
+        QSqlDatabase db = openDatabase(connection_name, false);
+
+        if (db.isOpen()) {
+            Writer writer(db);
+
+            if (scanDirectories(writer, db)) {
+                Q_FOREVER {
+                    QString file_path;
+                    bool exists = false;
+
+                    {
+                        QMutexLocker locker(&mutex);
+
+                        while (pendingFiles.isEmpty() && !stopped.loadAcquire()) {
+                            writer.commit();
+                            condition.wait(&mutex);
+                        }
+
+                        if (stopped.loadAcquire())
+                            break;
+
+                        file_path = pendingFiles.dequeue();
+                        exists = pendingFileStates.take(file_path);
+                    }
+
+                    const QFileInfo info(file_path);
+
+                    if (exists && info.exists() && !info.isSymLink() && isIndexable(info))
+                        writer.indexFile(info);
+                    else
+                        writer.removeFile(file_path);
+                }
+            }
+        }
+    }
+
+    QSqlDatabase::removeDatabase(connection_name);
+    running.storeRelease(0);
+}
+
+Q_GLOBAL_STATIC(DFullTextIndex, globalFullTextIndex)
+
+DFullTextIndex *DFullTextIndex::instance()
+{
+    return globalFullTextIndex;
+}
+
+bool DFullTextIndex::isEnabled()
+{
+    return DFMApplication::genericAttribute(DFMApplication::GA_IndexFullTextSearch).toBool();
+}
+
+DFullTextIndex::DFullTextIndex()
+    : d_ptr(new DFullTextIndexPrivate())
+{
+    Q_D(DFullTextIndex);
+
+    d->pool.setMaxThreadCount(1);
+    d->pool.setExpiryTimeout(-1);
+    d->directories << QStandardPaths::writableLocation(QStandardPaths::HomeLocation);
+}
+
+DFullTextIndex::~DFullTextIndex()
+{
+    stop();
+}
+
+void DFullTextIndex::start()
+{
+    Q_D(DFullTextIndex);
+
+    if (!d->running.testAndSetOrdered(0, 1))
+        return;
+
+    d->stopped.storeRelease(0);
+    QtConcurrent::run(&d->pool, d, &DFullTextIndexPrivate::worker);
+}
+
+void DFullTextIndex::stop()
+{
+    Q_D(DFullTextIndex);
+
+    {
+        QMutexLocker locker(&d->mutex);
+
+        d->stopped.storeRelease(1);
+        d->pendingFiles.clear();
+        d->pendingFileStates.clear();
+        d->condition.wakeAll();
+    }
+
+    d->pool.waitForDone();
+}
+
+bool DFullTextIndex::isRunning() const
+{
+    Q_D(const DFullTextIndex);
+
+    return d->running.loadAcquire();
+}
+
+QStringList DFullTextIndex::search(const QString &directory, const QString &keyword, const QStringList &nameFilters,
+                                   QDir::Filters filters, int maxCount) const
+{
+    Q_D(const DFullTextIndex);
+
+    QStringList terms;
+
+    tokenize(keyword, [&terms] (const QString &term) {
+        if (!terms.contains(term))
+            terms << term;
+    });
+
+    // 单个英文字母也作为前缀参与搜索
+    if (terms.isEmpty() && keyword.trimmed().size() == 1 && keyword.trimmed().at(0).isLetterOrNumber())
+        terms << keyword.trimmed().toLower();
+
+    if (terms.isEmpty())
+        return QStringList();
+
+    const QString directory_prefix = directory.endsWith('/') ? directory : directory + '/';
+    const Qt::CaseSensitivity name_case = filters.testFlag(QDir::CaseSensitive) ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    QList<QRegExp> name_filters;
+
+    for (const QString &filter : nameFilters) {
+        name_filters << QRegExp(filter, name_case, QRegExp::Wildcard);
+    }
+
+    // 和 QDirIterator 相同的过滤规则，文件名搜索的结果也是按此过滤的
+    auto accepted = [&] (const QString &path) {
+        if (!filters.testFlag(QDir::Hidden) && path.midRef(directory_prefix.size() - 1).contains("/."))
+            return false;
+
+        if (name_filters.isEmpty())
+            return true;
+
+        const QString &name = path.mid(path.lastIndexOf('/') + 1);
+
+        return std::any_of(name_filters.constBegin(), name_filters.constEnd(), [&name] (const QRegExp &filter) {
+            return filter.exactMatch(name);
+        });
+    };
+
+    static QAtomicInt connection_id;
+    const QString connection_name = QString("dfm_fulltext_index_reader_%1").arg(connection_id.fetchAndAddRelaxed(1));
+    QList<QPair<double, QString>> results;
+
+    {
+        QSqlDatabase db = openDatabase(connection_name, true);
+
+        if (db.isOpen()) {
+            QSqlQuery query(db);
+            double file_count = 0;
+            double average_length = 1;
+
+            if (query.exec("SELECT COUNT(*), AVG(length) FROM files WHERE length > 0") && query.next()) {
+                file_count = query.value(0).toDouble();
+                average_length = qMax(1.0, query.value(1).toDouble());
+            }
+
+            // 每个词按前缀匹配，结果为同时包含所有词的文件。只查询搜索目录中的文件，
+            // 文件路径和相关度一起返回，不再逐个查询
+            QHash<qint64, double> scores;
+            QHash<qint64, QString> paths;
+
+            query.prepare("SELECT p.file_id, SUM(p.tf), f.length, f.path FROM terms t "
+                          "JOIN postings p ON p.term_id = t.id JOIN files f ON f.id = p.file_id "
+                          "WHERE t.term >= ? AND t.term < ? AND f.path >= ? AND f.path < ? GROUP BY p.file_id");
+
+            for (int i = 0; i < terms.size(); ++i) {
+                const QString &term = terms.at(i);
+                QHash<qint64, QPair<int, int>> matched_files;
+
+                query.addBindValue(term);
+                query.addBindValue(upperBound(term));
+                query.addBindValue(directory_prefix);
+                query.addBindValue(upperBound(directory_prefix));
+
+                if (!query.exec())
+                    break;
+
+                while (query.next()) {
+                    const qint64 file_id = query.value(0).toLongLong();
+
+                    if (i > 0 && !scores.contains(file_id))
+                        continue;
+
+                    if (i == 0) {
+                        const QString &path = query.value(3).toString();
+
+                        if (!accepted(path))
+                            continue;
+
+                        paths[file_id] = path;
+                    }
+
+                    matched_files[file_id] = qMakePair(query.value(1).toInt(), query.value(2).toInt());
+                }
+
+                // BM25
+                static const double k1 = 1.2;
+                static const double b = 0.75;
+                const double df = matched_files.size();
+                const double idf = log(1 + (file_count - df + 0.5) / (df + 0.5));
+                QHash<qint64, double> new_scores;
+
+                for (auto it = matched_files.constBegin(); it != matched_files.constEnd(); ++it) {
+                    const double tf = it.value().first;
+                    const double length = it.value().second;
+
+                    new_scores[it.key()] = scores.value(it.key()) + idf * tf * (k1 + 1) / (tf + k1 * (1 - b + b * length / average_length));
+                }
+
+                scores = new_scores;
+
+                if (scores.isEmpty())
+                    break;
+            }
+
+            for (auto it = scores.constBegin(); it != scores.constEnd(); ++it) {
+                results << qMakePair(it.value(), paths.value(it.key()));
+            }
+        }
+    }
+
+    QSqlDatabase::removeDatabase(connection_name);
+
+    std::sort(results.begin(), results.end(), [] (const QPair<double, QString> &r1, const QPair<double, QString> &r2) {
+        return r1.first > r2.first;
+    });
+
+    QStringList file_list;
+    DFullTextIndexPrivate *dd = const_cast<DFullTextIndexPrivate*>(d);
+    QMutexLocker locker(&dd->mutex);
+
+    for (const auto &result : results) {
+        if (file_list.size() >= maxCount)
+            break;
+
+        // 已收到删除事件但索引还未处理的文件
+        if (!dd->pendingFileStates.value(result.second, true))
+            continue;
+
+        file_list << result.second;
+    }
+
+    return file_list;
+}
+
+void DFullTextIndex::fileChanged(const QString &filePath)
+{
+    Q_D(DFullTextIndex);
+
+    if (!d->running.loadAcquire() || !d->isIndexedPath(filePath))
+        return;
+
+    QMutexLocker locker(&d->mutex);
+
+    if (!d->pendingFileStates.contains(filePath))
+        d->pendingFiles.enqueue(filePath);
+
+    d->pendingFileStates[filePath] = true;
+    d->condition.wakeAll();
+}
+
+void DFullTextIndex::fileRemoved(const QString &filePath)
+{
+    Q_D(DFullTextIndex);
+
+    if (!d->running.loadAcquire() || !d->isIndexedPath(filePath))
+        return;
+
+    QMutexLocker locker(&d->mutex);
+
+    if (!d->pendingFileStates.contains(filePath))
+        d->pendingFiles.enqueue(filePath);
+
+    d->pendingFileStates[filePath] = false;
+    d->condition.wakeAll();
+}
+
+DFM_END_NAMESPACE
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DFULLTEXTINDEX_H
+#define DFULLTEXTINDEX_H
+
+#include <dfmglobal.h>
+
+#include <QStringList>
+#include <QDir>
+
+DFM_BEGIN_NAMESPACE
+
+class DFullTextIndexPrivate;
+class DFullTextIndex
+{
+    Q_DECLARE_PRIVATE(DFullTextIndex)
+
+public:
+    static DFullTextIndex *instance();
+    // 是否开启了全文搜索
+    static bool isEnabled();
+
+    DFullTextIndex();
+    ~DFullTextIndex();
+
+    // 在后台扫描需要索引的目录并开始处理文件变化
+    void start();
+    void stop();
+    bool isRunning() const;
+
+    // 返回 directory 下内容匹配 keyword 的文件，按相关度从高到低排列。
+    // 结果按 nameFilters 及 filters 中的 QDir::Hidden 和 QDir::CaseSensitive 过滤
+    QStringList search(const QString &directory, const QString &keyword, const QStringList &nameFilters = QStringList(),
+                       QDir::Filters filters = QDir::NoFilter, int maxCount = 1000) const;
+
+    // 由文件监视器调用
+    void fileChanged(const QString &filePath);
+    void fileRemoved(const QString &filePath);
+
+private:
+    QScopedPointer<DFullTextIndexPrivate> d_ptr;
+};
+
+DFM_END_NAMESPACE
+
+#endif // DFULLTEXTINDEX_H
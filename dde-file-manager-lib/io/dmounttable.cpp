@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "dmounttable.h"
+#include "dpathtrie.h"
+
+#include <QCoreApplication>
+#include <QSocketNotifier>
+#include <QSharedPointer>
+#include <QMutex>
+#include <QThread>
+#include <QFile>
+#include <QDebug>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+DFM_BEGIN_NAMESPACE
+
+typedef DPathTrie<DMountTable::MountPoint> MountPointTrie;
+
+class DMountTablePrivate
+{
+public:
+    ~DMountTablePrivate();
+
+    bool tableChanged() const;
+    QSharedPointer<const MountPointTrie> table();
+    static QSharedPointer<const MountPointTrie> load(int fd);
+    static QString unescape(const QByteArray &field);
+
+    int fd = -1;
+    QSocketNotifier *notifier = nullptr;
+    QAtomicInt dirty = 1;
+
+    QMutex mutex;
+    QSharedPointer<const MountPointTrie> mountPoints;
+};
+
+DMountTablePrivate::~DMountTablePrivate()
+{
+    if (notifier) {
+        notifier->deleteLater();
+    }
+
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+bool DMountTablePrivate::tableChanged() const
+{
+    if (dirty.load()) {
+        return true;
+    }
+
+    // 没有事件循环时无法收到通知，直接检查挂载表是否有变化
+    if (!notifier && fd >= 0) {
+        pollfd pfd = {fd, POLLPRI, 0};
+
+        return poll(&pfd, 1, 0) > 0 && (pfd.revents & (POLLPRI | POLLERR));
+    }
+
+    return false;
+}
+
+QSharedPointer<const MountPointTrie> DMountTablePrivate::table()
+{
+    QMutexLocker locker(&mutex);
+
+    if (!mountPoints || tableChanged()) {
+        // 先清除标记，读取期间再有变化时下次查询会重新读取
+        dirty.store(0);
+        mountPoints = load(fd);
+    }
+
+    return mountPoints;
+}
+
+QSharedPointer<const MountPointTrie> DMountTablePrivate::load(int fd)
+{
+    QSharedPointer<MountPointTrie> trie(new MountPointTrie());
+    QByteArray data;
+
+    if (fd >= 0) {
+        char buffer[4096];
+        off_t offset = 0;
+        ssize_t size;
+
+        while ((size = pread(fd, buffer, sizeof(buffer), offset)) > 0) {
+            data.append(buffer, size);
+            offset += size;
+        }
+    } else {
+        QFile file("/proc/self/mountinfo");
+
+        if (file.open(QIODevice::ReadOnly)) {
+            data = file.readAll();
+        }
+    }
+
+    // 格式：id parent major:minor root mount-point options [optional...] - fstype source super-options
+    for (const QByteArray &line : data.split('\n')) {
+        const QList<QByteArray> &fields = line.split(' ');
+        const int separator = fields.indexOf("-");
+
+        if (fields.size() < 6 || separator < 6 || separator + 2 >= fields.size()) {
+            continue;
+        }
+
+        DMountTable::MountPoint mp;
+
+        mp.rootPath = unescape(fields.at(4));
+        mp.fileSystemType = fields.at(separator + 1);
+        mp.device = unescape(fields.at(separator + 2)).toLocal8Bit();
+        mp.readOnly = fields.at(5).split(',').contains("ro");
+
+        // 后挂载的会覆盖先前挂载在同一位置的文件系统
+        trie->insert(mp.rootPath, mp);
+    }
+
+    return trie;
+}
+
+QString DMountTablePrivate::unescape(const QByteArray &field)
+{
+    if (!field.contains('\\')) {
+        return QFile::decodeName(field);
+    }
+
+    QByteArray result;
+
+    result.reserve(field.size());
+
+    for (int i = 0; i < field.size(); ++i) {
+        // 空格、制表符、换行和反斜杠被转义为三位八进制数
+        if (field.at(i) == '\\' && i + 3 < field.size()) {
+            bool ok = false;
+            const char c = static_cast<char>(field.mid(i + 1, 3).toInt(&ok, 8));
+
+            if (ok) {
+                result.append(c);
+                i += 3;
+                continue;
+            }
+        }
+
+        result.append(field.at(i));
+    }
+
+    return QFile::decodeName(result);
+}
+
+bool DMountTable::MountPoint::isLocalDevice() const
+{
+    return device.startsWith("/dev/");
+}
+
+bool DMountTable::MountPoint::isLowSpeedDevice() const
+{
+    return device.startsWith("mtp://")
+            || device.startsWith("gphoto://")
+            || device.startsWith("gphoto2://")
+            || device.startsWith("smb-share://")
+            || device.startsWith("smb://");
+}
+
+Q_GLOBAL_STATIC(DMountTable, globalMountTable)
+
+DMountTable *DMountTable::instance()
+{
+    return globalMountTable;
+}
+
+DMountTable::DMountTable()
+    : d_ptr(new DMountTablePrivate())
+{
+    Q_D(DMountTable);
+
+    d->fd = open("/proc/self/mountinfo", O_RDONLY | O_CLOEXEC);
+
+    if (d->fd < 0) {
+        qWarning() << "Failed to open /proc/self/mountinfo";
+
+        return;
+    }
+
+    if (!QCoreApplication::instance()) {
+        return;
+    }
+
+    // 挂载表变化时内核会对此文件发出 POLLPRI，在主线程中监听
+    d->notifier = new QSocketNotifier(d->fd, QSocketNotifier::Exception);
+    d->notifier->setEnabled(false);
+    d->notifier->moveToThread(QCoreApplication::instance()->thread());
+
+    QAtomicInt *dirty = &d->dirty;
+    QObject::connect(d->notifier, &QSocketNotifier::activated, d->notifier, [dirty] {
+        dirty->store(1);
+    });
+    QMetaObject::invokeMethod(d->notifier, "setEnabled", Qt::QueuedConnection, Q_ARG(bool, true));
+}
+
+DMountTable::~DMountTable()
+{
+
+}
+
+bool DMountTable::mountPoint(const QString &path, DMountTable::MountPoint *mountPoint) const
+{
+    if (!path.startsWith('/')) {
+        return false;
+    }
+
+    const QSharedPointer<const MountPointTrie> &table = const_cast<DMountTablePrivate *>(d_func())->table();
+    const MountPoint *mp = table->longestPrefixValue(path);
+
+    if (!mp) {
+        return false;
+    }
+
+    if (mountPoint) {
+        *mountPoint = *mp;
+    }
+
+    return true;
+}
+
+QList<DMountTable::MountPoint> DMountTable::childMountPoints(const QString &path) const
+{
+    if (!path.startsWith('/')) {
+        return QList<MountPoint>();
+    }
+
+    return const_cast<DMountTablePrivate *>(d_func())->table()->descendantValues(path);
+}
+
+void DMountTable::refresh()
+{
+    Q_D(DMountTable);
+
+    d->dirty.store(1);
+}
+
+DFM_END_NAMESPACE
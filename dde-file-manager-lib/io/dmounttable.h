@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DMOUNTTABLE_H
+#define DMOUNTTABLE_H
+
+#include <dfmglobal.h>
+
+#include <QByteArray>
+#include <QList>
+
+DFM_BEGIN_NAMESPACE
+
+class DMountTablePrivate;
+class DMountTable
+{
+    Q_DECLARE_PRIVATE(DMountTable)
+
+public:
+    struct MountPoint {
+        QString rootPath;
+        QByteArray device;
+        QByteArray fileSystemType;
+        bool readOnly = false;
+
+        bool isLocalDevice() const;
+        bool isLowSpeedDevice() const;
+    };
+
+    static DMountTable *instance();
+
+    DMountTable();
+    ~DMountTable();
+
+    // 按 /proc/self/mountinfo 查找绝对路径 path 所在的挂载点，不会访问文件系统，
+    // 因此不解析路径中的符号链接。挂载表在内核通知变化后才会重新读取。
+    // 只有 path 不是绝对路径或无法读取挂载表时返回false
+    bool mountPoint(const QString &path, MountPoint *mountPoint) const;
+    // 返回挂载在 path 之下（不包括 path 自身）的所有挂载点
+    QList<MountPoint> childMountPoints(const QString &path) const;
+
+    void refresh();
+
+private:
+    QScopedPointer<DMountTablePrivate> d_ptr;
+};
+
+DFM_END_NAMESPACE
+
+#endif // DMOUNTTABLE_H
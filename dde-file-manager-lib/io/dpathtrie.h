@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DPATHTRIE_H
+#define DPATHTRIE_H
+
+#include <dfmglobal.h>
+
+#include <QHash>
+#include <QVector>
+#include <QStringList>
+
+DFM_BEGIN_NAMESPACE
+
+// 以路径中的每一级目录为节点的前缀树，用于按最长前缀查找路径所在的挂载点等
+template <typename T>
+class DPathTrie
+{
+public:
+    DPathTrie()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        nodes.clear();
+        nodes.append(Node());
+    }
+
+    // 返回path对应的值，不存在时会插入一个默认值
+    T &operator[](const QString &path)
+    {
+        int node = 0;
+
+        for (const QStringRef &name : path.splitRef('/', QString::SkipEmptyParts)) {
+            const QString &key = name.toString();
+            int child = nodes.at(node).children.value(key, -1);
+
+            if (child < 0) {
+                child = nodes.size();
+                nodes.append(Node());
+                nodes[node].children.insert(key, child);
+            }
+
+            node = child;
+        }
+
+        nodes[node].hasValue = true;
+
+        return nodes[node].value;
+    }
+
+    void insert(const QString &path, const T &value)
+    {
+        (*this)[path] = value;
+    }
+
+    // 只返回和path完全相同的路径的值
+    const T *value(const QString &path) const
+    {
+        int node = 0;
+
+        for (const QStringRef &name : path.splitRef('/', QString::SkipEmptyParts)) {
+            node = nodes.at(node).children.value(name.toString(), -1);
+
+            if (node < 0) {
+                return nullptr;
+            }
+        }
+
+        return nodes.at(node).hasValue ? &nodes.at(node).value : nullptr;
+    }
+
+    // 返回path或离它最近的上级路径的值，includeSelf为false时不包括path自身
+    const T *longestPrefixValue(const QString &path, bool includeSelf = true) const
+    {
+        const QVector<QStringRef> &names = path.splitRef('/', QString::SkipEmptyParts);
+        const T *found = nullptr;
+        int node = 0;
+
+        if (nodes.first().hasValue && (includeSelf || !names.isEmpty())) {
+            found = &nodes.first().value;
+        }
+
+        for (int i = 0; i < names.size(); ++i) {
+            node = nodes.at(node).children.value(names.at(i).toString(), -1);
+
+            if (node < 0) {
+                break;
+            }
+
+            if (nodes.at(node).hasValue && (includeSelf || i + 1 < names.size())) {
+                found = &nodes.at(node).value;
+            }
+        }
+
+        return found;
+    }
+
+    // 按从上到下的顺序返回path及其所有上级路径的值
+    QList<T> prefixValues(const QString &path) const
+    {
+        QList<T> list;
+        int node = 0;
+
+        if (nodes.first().hasValue) {
+            list << nodes.first().value;
+        }
+
+        for (const QStringRef &name : path.splitRef('/', QString::SkipEmptyParts)) {
+            node = nodes.at(node).children.value(name.toString(), -1);
+
+            if (node < 0) {
+                break;
+            }
+
+            if (nodes.at(node).hasValue) {
+                list << nodes.at(node).value;
+            }
+        }
+
+        return list;
+    }
+
+    // 返回path下所有下级路径的值，不包括path自身
+    QList<T> descendantValues(const QString &path) const
+    {
+        QList<T> list;
+        int node = 0;
+
+        for (const QStringRef &name : path.splitRef('/', QString::SkipEmptyParts)) {
+            node = nodes.at(node).children.value(name.toString(), -1);
+
+            if (node < 0) {
+                return list;
+            }
+        }
+
+        QVector<int> stack {node};
+
+        while (!stack.isEmpty()) {
+            for (int child : nodes.at(stack.takeLast()).children) {
+                if (nodes.at(child).hasValue) {
+                    list << nodes.at(child).value;
+                }
+
+                stack << child;
+            }
+        }
+
+        return list;
+    }
+
+private:
+    struct Node {
+        QHash<QString, int> children;
+        bool hasValue = false;
+        T value = T();
+    };
+
+    QVector<Node> nodes;
+};
+
+DFM_END_NAMESPACE
+
+#endif // DPATHTRIE_H
@@ -21,6 +21,7 @@
 #include <gio/gio.h>
 
 #include "dstorageinfo.h"
+#include "dmounttable.h"
 
 #include <QRegularExpression>
 
@@ -311,7 +312,10 @@ bool DStorageInfo::isLocalDevice(const QString &path)
     if (regExp.match(path, 0, QRegularExpression::NormalMatch, QRegularExpression::DontCheckSubjectStringMatchOption).hasMatch())
         return false;
 
-    return DStorageInfo(path).device().startsWith("/dev/");
+    DMountTable::MountPoint mountPoint;
+
+    // 从缓存的挂载表中查找，避免每次都statfs。挂载表中总有根目录，任何绝对路径都能找到挂载点
+    return DMountTable::instance()->mountPoint(path, &mountPoint) && mountPoint.isLocalDevice();
 }
 
 bool DStorageInfo::isLowSpeedDevice(const QString &path)
@@ -330,6 +334,13 @@ bool DStorageInfo::isLowSpeedDevice(const QString &path)
         return (scheme == "mtp" || scheme == "gphoto" || scheme == "gphoto2" || scheme == "smb-share");
     }
 
+    DMountTable::MountPoint mountPoint;
+
+    // gvfs的设备需要通过gio获取挂载的uri，其它的直接使用缓存的挂载表
+    if (DMountTable::instance()->mountPoint(path, &mountPoint) && !mountPoint.fileSystemType.contains("gvfsd-fuse")) {
+        return mountPoint.isLowSpeedDevice();
+    }
+
     return DStorageInfo(path).isLowSpeedDevice();
 }
 
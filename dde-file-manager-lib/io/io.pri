@@ -9,7 +9,12 @@ HEADERS += \
     $$PWD/dlocalfilehandler.h \
     $$PWD/dfilestatisticsjob.h \
     $$PWD/dstorageinfo.h \
-    $$PWD/dgiofiledevice.h
+    $$PWD/dgiofiledevice.h \
+    $$PWD/dfilesizecache.h \
+    $$PWD/dfilenameindex.h \
+    $$PWD/dfulltextindex.h \
+    $$PWD/dpathtrie.h \
+    $$PWD/dmounttable.h
 
 SOURCES += \
     $$PWD/dlocalfiledevice.cpp \
@@ -20,6 +25,10 @@ SOURCES += \
     $$PWD/dlocalfilehandler.cpp \
     $$PWD/dfilestatisticsjob.cpp \
     $$PWD/dstorageinfo.cpp \
-    $$PWD/dgiofiledevice.cpp
+    $$PWD/dgiofiledevice.cpp \
+    $$PWD/dfilesizecache.cpp \
+    $$PWD/dfilenameindex.cpp \
+    $$PWD/dfulltextindex.cpp \
+    $$PWD/dmounttable.cpp
 
 include(private/private.pri)
@@ -27,13 +27,25 @@
 #include <QWaitCondition>
 #include <QPointer>
 #include <QStack>
+#include <QQueue>
+#include <QSharedPointer>
+#include <QMutex>
+#include <QAtomicInteger>
 #include <QElapsedTimer>
+#include <QDateTime>
+
+#include <functional>
 
 typedef QExplicitlySharedDataPointer<DAbstractFileInfo> DAbstractFileInfoPointer;
 
+QT_BEGIN_NAMESPACE
+class QThreadPool;
+QT_END_NAMESPACE
+
 DFM_BEGIN_NAMESPACE
 
 class DFileHandler;
+class DFileDevice;
 class DFileStatisticsJob;
 class ElapsedTimer;
 class DFileCopyMoveJobPrivate
@@ -52,16 +64,69 @@ public:
         QPair<DUrl, DUrl> targetUrl;
     };
 
+    enum KernelCopyResult {
+        KernelCopyUnsupported, // 不支持内核复制，需要回退到缓冲区读写的方式
+        KernelCopyFinished,
+        KernelCopyCloned, // 通过reflink共享了数据块，数据没有被复制，不需要校验
+        KernelCopySkipped,
+        KernelCopyFailed
+    };
+
     struct DirectoryInfo {
         DStorageInfo sourceStorageInfo;
         DStorageInfo targetStorageInfo;
+        // 分区所在的磁盘，不是块设备时为文件系统的设备名
+        QByteArray sourceDisk;
+        QByteArray targetDisk;
         QPair<DUrl, DUrl> url;
     };
 
+    struct ParallelCopyInfo {
+        DUrl from;
+        // 跟随符号链接时与from不同
+        DUrl source;
+        DUrl target;
+        DUrl targetDirectory;
+        QDateTime lastRead;
+        QDateTime lastModified;
+        QFileDevice::Permissions permissions;
+        qint64 size = 0;
+
+        // 以下数据由复制线程写入
+        QAtomicInt finished = 0;
+        bool ok = false;
+        qint64 copiedSize = 0;
+
+        // 不为空时表示这是一个需要等待前面的文件复制完成后才能执行的操作
+        std::function<void()> deferred;
+    };
+
+    typedef QSharedPointer<ParallelCopyInfo> ParallelCopyInfoPointer;
+
+    struct IntegrityCheckInfo {
+        DUrl source;
+        DUrl target;
+        DFileCopyMoveJob::ChecksumType checksumType;
+        quint32 sourceChecksum;
+        // 数据没有经过任务线程时（内核复制、并行复制），需要重新读取源文件计算校验值
+        bool readSource = false;
+        // 复制时计入进度的数据大小，重新复制前需要从进度中减去
+        qint64 size = 0;
+
+        // 以下数据由校验线程写入
+        QAtomicInt finished = 0;
+        bool ok = false;
+        QString errorString;
+    };
+
+    typedef QSharedPointer<IntegrityCheckInfo> IntegrityCheckInfoPointer;
+
     DFileCopyMoveJobPrivate(DFileCopyMoveJob *qq);
     ~DFileCopyMoveJobPrivate();
 
     static QString errorToString(DFileCopyMoveJob::Error error);
+    static quint32 checksumInit(DFileCopyMoveJob::ChecksumType type);
+    static quint32 checksumUpdate(DFileCopyMoveJob::ChecksumType type, quint32 checksum, const char *data, qint64 size);
     // 返回当前线程已经往block设备写入的数据，返回的是本次和上次间隔时间内写入的大小
     static qint64 getWriteBytes(long tid);
     qint64 getWriteBytes() const;
@@ -87,10 +152,46 @@ public:
     bool doProcess(const DUrl &from, DAbstractFileInfoPointer source_info, const DAbstractFileInfo *target_info);
     bool mergeDirectory(DFileHandler *handler, const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo);
     bool doCopyFile(const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo, int blockSize = 1048576);
+    // 将数据完整写入到设备中，返回 NoAction 表示写入成功
+    DFileCopyMoveJob::Action writeData(DFileDevice *toDevice, const char *data, qint64 size,
+                                       const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo);
+    bool canUsePipelineCopy(DFileDevice *fromDevice) const;
+    static QByteArray diskOfDevice(const QByteArray &device);
+    // 在预读线程中读取数据，同时在当前线程中写入
+    DFileCopyMoveJob::Action doPipelineCopy(DFileDevice *fromDevice, DFileDevice *toDevice,
+                                            const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo,
+                                            quint32 *checksum);
+    // 缓冲区在每个任务中只分配一次
+    char *ensureCopyBuffer(int size);
+    char *ensurePipelineBuffer();
+    void releaseCopyBuffers();
+    // 在内核中完成数据复制，数据不经过用户空间
+    KernelCopyResult doKernelCopyFile(DFileDevice *fromDevice, DFileDevice *toDevice,
+                                      const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo, int blockSize);
     bool doRemoveFile(DFileHandler *handler, const DAbstractFileInfo *fileInfo);
     bool doRenameFile(DFileHandler *handler, const DAbstractFileInfo *oldInfo, const DAbstractFileInfo *newInfo);
     bool doLinkFile(DFileHandler *handler, const DAbstractFileInfo *fileInfo, const QString &linkPath);
 
+    void initParallelCopy();
+    bool canCopyInParallel(const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo) const;
+    void enqueueParallelCopy(const DUrl &from, const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo,
+                             const DAbstractFileInfo *targetDirectory);
+    // 在复制线程中执行
+    void doParallelCopyFile(ParallelCopyInfo *info);
+    bool parallelCopyStateCheck();
+    // 按照派发的顺序处理已完成的并行复制任务，waitForAll为true时等待所有任务完成
+    bool processParallelCopyQueue(bool waitForAll);
+    // 如果还有未完成的并行复制任务，则将操作推迟到这些任务完成后执行，否则立即执行
+    void runAfterParallelCopy(std::function<void()> fun);
+    void finishParallelCopy();
+
+    void enqueueIntegrityCheck(const DUrl &source, const DUrl &target, qint64 size, quint32 sourceChecksum, bool readSource = false);
+    // 在校验线程中执行
+    static void doIntegrityCheck(IntegrityCheckInfo *info);
+    // 处理已完成的异步校验，校验失败时通过 handleError 询问如何处理，waitForAll为true时等待所有校验完成
+    bool processIntegrityCheckQueue(bool waitForAll);
+    void finishIntegrityCheck();
+
     bool process(const DUrl &from, const DAbstractFileInfo *target_info);
     bool process(const DUrl &from, const DAbstractFileInfoPointer &source_info, const DAbstractFileInfo *target_info);
     bool copyFile(const DAbstractFileInfo *fromInfo, const DAbstractFileInfo *toInfo, int blockSize = 1048576);
@@ -116,6 +217,7 @@ public:
     DFileCopyMoveJob::Mode mode = DFileCopyMoveJob::CopyMode;
     DFileCopyMoveJob::Error error = DFileCopyMoveJob::NoError;
     DFileCopyMoveJob::FileHints fileHints = 0;
+    DFileCopyMoveJob::ChecksumType checksumType = DFileCopyMoveJob::Adler32Checksum;
     QString errorString;
     QAtomicInt state = DFileCopyMoveJob::StoppedState;
     DFileCopyMoveJob::Action lastErrorHandleAction = DFileCopyMoveJob::NoAction;
@@ -157,6 +259,34 @@ public:
     // 线程id
     long tid = -1;
 
+    int parallelCopyCount = 0;
+    QThreadPool *parallelCopyPool = nullptr;
+    QQueue<ParallelCopyInfoPointer> parallelCopyQueue;
+    QMutex parallelCopyMutex;
+    QWaitCondition parallelCopyCondition;
+    // 复制线程已写入但还未计入completedDataSize的数据大小
+    QAtomicInteger<qint64> parallelCopiedDataSize;
+    // 为true时表示正在以普通的方式重新处理并行复制失败的文件
+    bool parallelCopyFallback = false;
+
+    static const int pipelineBlockCount = 4;
+    static const int minPipelineBlockSize = 256 * 1024;
+    static const int maxPipelineBlockSize = 4 * 1024 * 1024;
+
+    char *copyBuffer = nullptr;
+    int copyBufferSize = 0;
+    char *pipelineBuffer = nullptr;
+    // 根据读写速度自动调整
+    int pipelineBlockSize = 1048576;
+    // 在 handleError 中等待处理错误的累计时间（毫秒），计算读写速度时需要排除
+    qint64 errorHandleTime = 0;
+    QThreadPool *readAheadPool = nullptr;
+
+    QThreadPool *integrityCheckPool = nullptr;
+    QQueue<IntegrityCheckInfoPointer> integrityCheckQueue;
+    QMutex integrityCheckMutex;
+    QWaitCondition integrityCheckCondition;
+
     Q_DECLARE_PUBLIC(DFileCopyMoveJob)
 };
 
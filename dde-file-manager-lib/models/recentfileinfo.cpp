@@ -42,6 +42,15 @@ RecentFileInfo::RecentFileInfo(const DUrl &url)
     updateInfo();
 }
 
+RecentFileInfo::RecentFileInfo(const DUrl &url, const QString &readTime)
+    : DAbstractFileInfo(url)
+{
+    if (url.path() != "/") {
+        setProxy(DFileService::instance()->createFileInfo(nullptr, DUrl::fromLocalFile(url.path())));
+    }
+    setReadDateTime(readTime);
+}
+
 bool RecentFileInfo::makeAbsolute()
 {
     return true;
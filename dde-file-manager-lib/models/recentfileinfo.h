@@ -29,6 +29,8 @@ class RecentFileInfo : public DAbstractFileInfo
 {
 public:
     explicit RecentFileInfo(const DUrl &url);
+    // 已知访问时间时使用，不需要再解析 recently-used.xbel
+    RecentFileInfo(const DUrl &url, const QString &readTime);
 
     bool makeAbsolute() override;
     bool exists() const override;
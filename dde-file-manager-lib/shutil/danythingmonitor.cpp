@@ -1,6 +1,7 @@
 
 #include "danythingmonitor.h"
 #include "tag/tagmanager.h"
+#include "tag/tagchangebatcher.h"
 #include "dfileinfo.h"
 
 
@@ -96,6 +97,9 @@ void DAnythingMonitor::doWork()
         std::deque<std::pair<QString, QString>>::const_iterator cbeg{ m_changedFiles.cbegin() };
         std::deque<std::pair<QString, QString>>::const_iterator cend{ m_changedFiles.cend() };
 
+        ///###: send all changes which were read by workSignal() as few requests.
+        TagChangeBatcher batcher{};
+        batcher.setWindow(0);
 
         for (; cbeg != cend; ++cbeg) {
 
@@ -104,7 +108,7 @@ void DAnythingMonitor::doWork()
 #ifdef QT_DEBUG
                 qDebug() << cbeg->second;
 #endif
-                TagManager::instance()->deleteFiles({DUrl::fromLocalFile(cbeg->second)});
+                batcher.fileDeleted(cbeg->second.toLocal8Bit());
 
                 continue;
             }
@@ -115,9 +119,10 @@ void DAnythingMonitor::doWork()
             qDebug() << oldAndNewFileName;
 #endif
 
-            TagManager::instance()->changeFilesName({ oldAndNewFileName });
+            batcher.fileRenamed(oldAndNewFileName.first, oldAndNewFileName.second);
         }
 
+        batcher.flush();
         m_changedFiles.clear();
     }
 }
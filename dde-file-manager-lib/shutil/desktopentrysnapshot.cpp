@@ -0,0 +1,430 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "desktopentrysnapshot.h"
+
+#include <QDataStream>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QLocale>
+#include <QDateTime>
+#include <QDebug>
+
+#include <algorithm>
+#include <climits>
+
+// 缓存文件的格式变化时需要修改版本号
+static const quint32 snapshotMagic = 0x44455353;
+static const quint32 snapshotVersion = 2;
+
+DesktopEntrySnapshot::DesktopEntrySnapshot(const QString &cacheFilePath)
+    : m_cacheFilePath(cacheFilePath)
+{
+
+}
+
+DesktopEntrySnapshot::~DesktopEntrySnapshot()
+{
+    if (m_data) {
+        m_cacheFile.unmap(m_data);
+    }
+}
+
+bool DesktopEntrySnapshot::load()
+{
+    QMutexLocker locker(&m_mutex);
+
+    unmap();
+    m_cacheFile.setFileName(m_cacheFilePath);
+
+    if (!m_cacheFile.open(QIODevice::ReadOnly) || m_cacheFile.size() <= 0 || m_cacheFile.size() > INT_MAX) {
+        m_cacheFile.close();
+
+        return false;
+    }
+
+    m_data = m_cacheFile.map(0, m_cacheFile.size());
+
+    if (!m_data) {
+        m_cacheFile.close();
+
+        return false;
+    }
+
+    // 直接从映射的内存中读取，不复制文件内容
+    const QByteArray content = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data), static_cast<int>(m_cacheFile.size()));
+    QDataStream stream(content);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString locale;
+
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream >> magic >> version >> locale;
+
+    // 本地化的名称依赖当前的语言
+    if (magic != snapshotMagic || version != snapshotVersion || locale != QLocale::system().name()) {
+        unmap();
+
+        return false;
+    }
+
+    QStringList folders;
+    QHash<QString, qint64> directories;
+    QHash<QString, qint64> dependencies;
+    QMap<QString, QStringList> newMimeApps;
+    QStringList newAudioApps;
+    QStringList newImageApps;
+    QStringList newTextApps;
+    QStringList newVideoApps;
+    QStringList filePaths;
+    QHash<QString, CachedEntry> entries;
+    quint32 count = 0;
+
+    stream >> folders >> directories >> dependencies
+           >> newMimeApps >> newAudioApps >> newImageApps >> newTextApps >> newVideoApps >> count;
+
+    entries.reserve(static_cast<int>(qMin<quint32>(count, 65536)));
+
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString path;
+        CachedEntry entry;
+
+        stream >> path >> entry.lastModified >> entry.size >> entry.created >> entry.length;
+
+        if (entry.length > static_cast<quint32>(content.size())) {
+            stream.setStatus(QDataStream::ReadCorruptData);
+            break;
+        }
+
+        // desktop文件的数据在第一次访问时才从映射中读取
+        entry.offset = stream.device()->pos();
+
+        if (stream.skipRawData(static_cast<int>(entry.length)) != static_cast<int>(entry.length)) {
+            stream.setStatus(QDataStream::ReadPastEnd);
+            break;
+        }
+
+        filePaths << path;
+        entries.insert(path, entry);
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        qWarning() << "invalid desktop entry snapshot:" << m_cacheFilePath;
+        unmap();
+
+        return false;
+    }
+
+    m_folders = folders;
+    m_directories = directories;
+    m_dependencies = dependencies;
+    m_filePaths = filePaths;
+    m_entries = entries;
+    mimeApps = newMimeApps;
+    audioApps = newAudioApps;
+    imageApps = newImageApps;
+    textApps = newTextApps;
+    videoApps = newVideoApps;
+    m_associationsValid = true;
+
+    return true;
+}
+
+bool DesktopEntrySnapshot::save() const
+{
+    QMutexLocker locker(&m_mutex);
+    QSaveFile file(m_cacheFilePath);
+
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "failed to save desktop entry snapshot:" << file.errorString();
+
+        return false;
+    }
+
+    QDataStream stream(&file);
+
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream << snapshotMagic << snapshotVersion << QLocale::system().name();
+    stream << m_folders << m_directories << m_dependencies
+           << mimeApps << audioApps << imageApps << textApps << videoApps
+           << static_cast<quint32>(m_filePaths.size());
+
+    for (const QString &path : m_filePaths) {
+        const CachedEntry &entry = *m_entries.constFind(path);
+
+        stream << path << entry.lastModified << entry.size << entry.created;
+
+        // 未访问过的文件直接写入原来的数据，不需要再解析一次
+        if (entry.offset >= 0) {
+            stream << QByteArray::fromRawData(reinterpret_cast<const char *>(m_data) + entry.offset, static_cast<int>(entry.length));
+        } else {
+            QByteArray data;
+            QDataStream entryStream(&data, QIODevice::WriteOnly);
+
+            entryStream.setVersion(QDataStream::Qt_5_6);
+            entryStream << entry.desktopFile;
+            stream << data;
+        }
+    }
+
+    // QSaveFile 会替换原文件，已映射的内容不受影响
+    return file.commit();
+}
+
+bool DesktopEntrySnapshot::update(const QStringList &folders, const QStringList &dependencies)
+{
+    QMutexLocker locker(&m_mutex);
+    bool changed = !m_associationsValid;
+    bool directoriesChanged = false;
+
+    m_entriesChanged = false;
+
+    QHash<QString, qint64> newDependencies;
+
+    for (const QString &path : dependencies) {
+        newDependencies.insert(path, lastModified(path));
+    }
+
+    if (newDependencies != m_dependencies) {
+        m_dependencies = newDependencies;
+        changed = true;
+    }
+
+    if (folders != m_folders) {
+        // 应用目录变化时重新列出所有目录，修改时间和大小未变化的文件仍使用原来的数据
+        m_folders = folders;
+        m_directories.clear();
+        directoriesChanged = true;
+
+        for (const QString &folder : folders) {
+            listDirectory(QDir::cleanPath(folder), true);
+        }
+    } else {
+        // 文件的增删和替换都会改变所在目录的修改时间，不需要逐个检查文件
+        QStringList changedDirectories;
+
+        for (auto it = m_directories.constBegin(); it != m_directories.constEnd(); ++it) {
+            if (lastModified(it.key()) != it.value()) {
+                changedDirectories << it.key();
+            }
+        }
+
+        for (const QString &directory : changedDirectories) {
+            // 已作为被删除目录的子目录移除
+            if (!m_directories.contains(directory)) {
+                continue;
+            }
+
+            directoriesChanged = true;
+
+            if (QFileInfo(directory).isDir()) {
+                listDirectory(directory, false);
+            } else {
+                removeDirectory(directory);
+            }
+        }
+    }
+
+    // 移除所在目录已被删除的文件
+    if (directoriesChanged) {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (!m_directories.contains(directoryOf(it.key()))) {
+                it = m_entries.erase(it);
+                m_entriesChanged = true;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    for (const QString &path : m_changedFiles) {
+        if (m_entries.contains(path)) {
+            updateFile(path);
+        }
+    }
+
+    m_changedFiles.clear();
+
+    if (m_entriesChanged) {
+        m_filePaths = m_entries.keys();
+        std::sort(m_filePaths.begin(), m_filePaths.end());
+        changed = true;
+    }
+
+    m_associationsValid = !changed;
+
+    return changed;
+}
+
+void DesktopEntrySnapshot::fileChanged(const QString &path)
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_changedFiles << path;
+}
+
+void DesktopEntrySnapshot::setAssociationsUpdated()
+{
+    QMutexLocker locker(&m_mutex);
+
+    m_associationsValid = true;
+}
+
+QStringList DesktopEntrySnapshot::filePaths() const
+{
+    QMutexLocker locker(&m_mutex);
+
+    return m_filePaths;
+}
+
+DesktopEntrySnapshot::Entry DesktopEntrySnapshot::entry(const QString &path) const
+{
+    QMutexLocker locker(&m_mutex);
+
+    return m_entries.value(path);
+}
+
+DesktopFile DesktopEntrySnapshot::desktopFile(const QString &path) const
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = m_entries.find(path);
+
+    if (it == m_entries.end()) {
+        return DesktopFile();
+    }
+
+    if (it->offset >= 0) {
+        readDesktopFile(*it);
+    }
+
+    return it->desktopFile;
+}
+
+qint64 DesktopEntrySnapshot::lastModified(const QString &path)
+{
+    const QFileInfo info(path);
+
+    return info.exists() ? info.lastModified().toMSecsSinceEpoch() : -1;
+}
+
+QString DesktopEntrySnapshot::directoryOf(const QString &filePath)
+{
+    return filePath.left(filePath.lastIndexOf('/'));
+}
+
+void DesktopEntrySnapshot::readDesktopFile(CachedEntry &entry) const
+{
+    const QByteArray data = QByteArray::fromRawData(reinterpret_cast<const char *>(m_data) + entry.offset, static_cast<int>(entry.length));
+    QDataStream stream(data);
+
+    stream.setVersion(QDataStream::Qt_5_6);
+    stream >> entry.desktopFile;
+    entry.offset = -1;
+
+    if (stream.status() != QDataStream::Ok) {
+        qWarning() << "invalid desktop entry in snapshot:" << m_cacheFilePath;
+    }
+}
+
+void DesktopEntrySnapshot::unmap()
+{
+    if (!m_data) {
+        return;
+    }
+
+    // 取消映射后无法再读取，先读取所有还未访问过的文件
+    for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+        if (it->offset >= 0) {
+            readDesktopFile(*it);
+        }
+    }
+
+    m_cacheFile.unmap(m_data);
+    m_cacheFile.close();
+    m_data = nullptr;
+}
+
+void DesktopEntrySnapshot::updateFile(const QString &path)
+{
+    const QFileInfo info(path);
+    const qint64 modified = info.lastModified().toMSecsSinceEpoch();
+    auto old = m_entries.constFind(path);
+
+    if (old != m_entries.constEnd() && old->lastModified == modified && old->size == info.size()) {
+        return;
+    }
+
+    CachedEntry entry;
+
+    entry.lastModified = modified;
+    entry.size = info.size();
+    entry.created = info.created().toMSecsSinceEpoch();
+    entry.desktopFile = DesktopFile(path);
+    m_entries.insert(path, entry);
+    m_entriesChanged = true;
+}
+
+void DesktopEntrySnapshot::listDirectory(const QString &directory, bool recursive)
+{
+    m_directories.insert(directory, lastModified(directory));
+
+    QSet<QString> files;
+    QDirIterator it(directory, QStringList("*.desktop"), QDir::Files | QDir::AllDirs | QDir::NoDotAndDotDot);
+
+    while (it.hasNext()) {
+        it.next();
+
+        const QFileInfo &info = it.fileInfo();
+
+        if (info.isDir()) {
+            // 和 QDirIterator::Subdirectories 一样不进入链接的目录；未变化的子目录由其自身的修改时间判断
+            if (!info.isSymLink() && (recursive || !m_directories.contains(it.filePath()))) {
+                listDirectory(it.filePath(), true);
+            }
+        } else {
+            files << it.filePath();
+            updateFile(it.filePath());
+        }
+    }
+
+    // 移除此目录中已被删除的文件
+    for (auto entry = m_entries.begin(); entry != m_entries.end();) {
+        if (!files.contains(entry.key()) && directoryOf(entry.key()) == directory) {
+            entry = m_entries.erase(entry);
+            m_entriesChanged = true;
+        } else {
+            ++entry;
+        }
+    }
+}
+
+void DesktopEntrySnapshot::removeDirectory(const QString &directory)
+{
+    const QString &prefix = directory + QDir::separator();
+
+    for (auto it = m_directories.begin(); it != m_directories.end();) {
+        if (it.key() == directory || it.key().startsWith(prefix)) {
+            it = m_directories.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
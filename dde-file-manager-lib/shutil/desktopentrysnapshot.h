@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef DESKTOPENTRYSNAPSHOT_H
+#define DESKTOPENTRYSNAPSHOT_H
+
+#include "desktopfile.h"
+
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QFile>
+#include <QMutex>
+#include <QStringList>
+
+// 解析后的desktop文件及由其生成的mime类型到应用的关联，保存到缓存文件中以便下次启动时直接加载。
+// 缓存文件被映射到内存中，加载时只读取文件列表和关联数据，desktop文件在第一次访问时才从映射中读取
+class DesktopEntrySnapshot
+{
+public:
+    struct Entry {
+        qint64 lastModified = 0;
+        qint64 size = 0;
+        qint64 created = 0;
+    };
+
+    explicit DesktopEntrySnapshot(const QString &cacheFilePath);
+    ~DesktopEntrySnapshot();
+
+    bool load();
+    bool save() const;
+
+    // 重新扫描folders，只检查目录的修改时间，只有目录的修改时间变化时才重新列出其中的文件，
+    // 并重新解析其中修改时间或大小变化的文件。dependencies为生成关联数据时用到的其它文件。
+    // 返回值为true时关联数据需要重新生成
+    bool update(const QStringList &folders, const QStringList &dependencies);
+    // 文件被直接修改时所在目录的修改时间不会变化，需要通知快照在下次更新时重新检查此文件
+    void fileChanged(const QString &path);
+
+    // 调用者重新生成关联数据后调用
+    void setAssociationsUpdated();
+
+    QStringList filePaths() const;
+    Entry entry(const QString &path) const;
+    DesktopFile desktopFile(const QString &path) const;
+
+    QMap<QString, QStringList> mimeApps;
+    QStringList audioApps;
+    QStringList imageApps;
+    QStringList textApps;
+    QStringList videoApps;
+
+private:
+    struct CachedEntry : public Entry {
+        // 在缓存文件中的位置，为-1时表示已经解析到desktopFile中
+        qint64 offset = -1;
+        quint32 length = 0;
+        DesktopFile desktopFile;
+    };
+
+    static qint64 lastModified(const QString &path);
+    static QString directoryOf(const QString &filePath);
+
+    void readDesktopFile(CachedEntry &entry) const;
+    void unmap();
+    void updateFile(const QString &path);
+    void listDirectory(const QString &directory, bool recursive);
+    void removeDirectory(const QString &directory);
+
+    QString m_cacheFilePath;
+    QFile m_cacheFile;
+    uchar *m_data = nullptr;
+    mutable QMutex m_mutex;
+    QStringList m_folders;
+    QHash<QString, qint64> m_directories;
+    QHash<QString, qint64> m_dependencies;
+    QStringList m_filePaths;
+    mutable QHash<QString, CachedEntry> m_entries;
+    QSet<QString> m_changedFiles;
+    bool m_entriesChanged = false;
+    bool m_associationsValid = false;
+};
+
+#endif // DESKTOPENTRYSNAPSHOT_H
@@ -25,7 +25,8 @@
 #include "desktopfile.h"
 #include "properties.h"
 #include <QFile>
-#include <QSettings>
+#include <QDataStream>
+#include <QLocale>
 #include <QDebug>
 
 /**
@@ -42,19 +43,18 @@ DesktopFile::DesktopFile(const QString &fileName) {
         return;
     }
 
-    QSettings settings(fileName, QSettings::IniFormat);
-    settings.beginGroup("Desktop Entry");
     // Loads .desktop file (read from 'Desktop Entry' group)
+    // 以前用QSettings再解析一次作为后备，但它读的是同一个组，Properties中没有的key它也没有
     Properties desktop(fileName, "Desktop Entry");
-    m_name = desktop.value("Name", settings.value("Name")).toString();
-    m_genericName = desktop.value("GenericName", settings.value("GenericName")).toString();
+    m_name = desktop.value("Name").toString();
+    m_genericName = desktop.value("GenericName").toString();
 
     if(desktop.contains("X-Deepin-AppID")){
-        m_deepinId = desktop.value("X-Deepin-AppID", settings.value("X-Deepin-AppID")).toString();
+        m_deepinId = desktop.value("X-Deepin-AppID").toString();
     }
 
     if(desktop.contains("X-Deepin-Vendor")){
-        m_deepinVendor = desktop.value("X-Deepin-Vendor", settings.value("X-Deepin-Vendor")).toString();
+        m_deepinVendor = desktop.value("X-Deepin-Vendor").toString();
     }
 
     QString nLocalKey = QString("Name[%1]").arg(QLocale::system().name());
@@ -72,18 +72,18 @@ DesktopFile::DesktopFile(const QString &fileName) {
     }
 
     if(desktop.contains("NoDisplay")){
-        m_noDisplay = desktop.value("NoDisplay", settings.value("NoDisplay").toBool()).toBool();
+        m_noDisplay = desktop.value("NoDisplay").toBool();
     }
     if(desktop.contains("Hidden")){
-        m_hidden = desktop.value("Hidden", settings.value("Hidden").toBool()).toBool();
+        m_hidden = desktop.value("Hidden").toBool();
     }
 
-    m_exec = desktop.value("Exec", settings.value("Exec")).toString();
-    m_icon = desktop.value("Icon", settings.value("Icon")).toString();
-    m_type = desktop.value("Type", settings.value("Type", "Application")).toString();
-    m_categories = desktop.value("Categories", settings.value("Categories").toString()).toString().remove(" ").split(";");
+    m_exec = desktop.value("Exec").toString();
+    m_icon = desktop.value("Icon").toString();
+    m_type = desktop.value("Type", "Application").toString();
+    m_categories = desktop.value("Categories").toString().remove(" ").split(";");
 
-    QString mime_type = desktop.value("MimeType", settings.value("MimeType").toString()).toString().remove(" ");
+    QString mime_type = desktop.value("MimeType").toString().remove(" ");
 
     if (!mime_type.isEmpty())
         m_mimeType = mime_type.split(";");
@@ -161,3 +161,25 @@ QStringList DesktopFile::getMimeType() const {
     return m_mimeType;
 }
 //---------------------------------------------------------------------------
+
+QDataStream &operator<<(QDataStream &stream, const DesktopFile &desktopFile)
+{
+    stream << desktopFile.m_fileName << desktopFile.m_name << desktopFile.m_genericName
+           << desktopFile.m_localName << desktopFile.m_exec << desktopFile.m_icon
+           << desktopFile.m_type << desktopFile.m_categories << desktopFile.m_mimeType
+           << desktopFile.m_deepinId << desktopFile.m_deepinVendor
+           << desktopFile.m_noDisplay << desktopFile.m_hidden;
+
+    return stream;
+}
+
+QDataStream &operator>>(QDataStream &stream, DesktopFile &desktopFile)
+{
+    stream >> desktopFile.m_fileName >> desktopFile.m_name >> desktopFile.m_genericName
+           >> desktopFile.m_localName >> desktopFile.m_exec >> desktopFile.m_icon
+           >> desktopFile.m_type >> desktopFile.m_categories >> desktopFile.m_mimeType
+           >> desktopFile.m_deepinId >> desktopFile.m_deepinVendor
+           >> desktopFile.m_noDisplay >> desktopFile.m_hidden;
+
+    return stream;
+}
@@ -27,6 +27,10 @@
 
 #include <QStringList>
 
+QT_BEGIN_NAMESPACE
+class QDataStream;
+QT_END_NAMESPACE
+
 /**
  * @class DesktopFile
  * @brief Represents a linux desktop file
@@ -49,6 +53,9 @@ public:
   bool getNoShow() const;
   QStringList getCategories() const;
   QStringList getMimeType() const;
+
+  friend QDataStream &operator<<(QDataStream &stream, const DesktopFile &desktopFile);
+  friend QDataStream &operator>>(QDataStream &stream, DesktopFile &desktopFile);
 private:
   QString m_fileName;
   QString m_name;
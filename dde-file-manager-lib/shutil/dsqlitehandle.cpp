@@ -1,6 +1,8 @@
 
 
 #include <string>
+#include <deque>
+#include <iterator>
 #include <fstream>
 #include <algorithm>
 #include <functional>
@@ -28,6 +30,8 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QJsonParseError>
+#include <QStorageInfo>
+#include <QRegularExpression>
 
 #ifdef __cplusplus
 extern "C"
@@ -205,11 +209,24 @@ static const std::multimap<DSqliteHandle::SqlType, QString> SqlTypeWithStrs {
         DSqliteHandle::SqlType::ChangeFilesName, "UPDATE tag_with_file SET file_name = \'%1\' "
         "WHERE tag_with_file.file_name = \'%2\'"
     },
+    ///###: the files in the renamed directory: [\'%2\'/, \'%2\'0) is the range of the names which start with \'%2\'/.
+    {
+        DSqliteHandle::SqlType::ChangeFilesName, "UPDATE file_property SET file_name = \'%1\' || substr(file_property.file_name, length(\'%2\') + 1) "
+        "WHERE file_property.file_name >= (\'%2\' || \'/\') AND file_property.file_name < (\'%2\' || \'0\')"
+    },
+    {
+        DSqliteHandle::SqlType::ChangeFilesName, "UPDATE tag_with_file SET file_name = \'%1\' || substr(tag_with_file.file_name, length(\'%2\') + 1) "
+        "WHERE tag_with_file.file_name >= (\'%2\' || \'/\') AND tag_with_file.file_name < (\'%2\' || \'0\')"
+    },
 
     {
         DSqliteHandle::SqlType::ChangeFilesName2, "SELECT tag_with_file.tag_name FROM tag_with_file "
         "WHERE tag_with_file.file_name = \'%1\'"
     },
+    {
+        DSqliteHandle::SqlType::ChangeFilesName2, "SELECT tag_with_file.file_name, tag_with_file.tag_name FROM tag_with_file "
+        "WHERE tag_with_file.file_name >= (\'%1\' || \'/\') AND tag_with_file.file_name < (\'%1\' || \'0\')"
+    },
 
     {
         DSqliteHandle::SqlType::ChangeTagsName, "UPDATE file_property SET tag_1 = \'%1\' "
@@ -234,11 +251,23 @@ static const std::multimap<DSqliteHandle::SqlType, QString> SqlTypeWithStrs {
 
     {DSqliteHandle::SqlType::DeleteFiles, "DELETE FROM tag_with_file WHERE tag_with_file.file_name = \'%1\'"},
     {DSqliteHandle::SqlType::DeleteFiles, "DELETE FROM file_property WHERE file_property.file_name = \'%1\'"},
+    {
+        DSqliteHandle::SqlType::DeleteFiles, "DELETE FROM tag_with_file "
+        "WHERE tag_with_file.file_name >= (\'%1\' || \'/\') AND tag_with_file.file_name < (\'%1\' || \'0\')"
+    },
+    {
+        DSqliteHandle::SqlType::DeleteFiles, "DELETE FROM file_property "
+        "WHERE file_property.file_name >= (\'%1\' || \'/\') AND file_property.file_name < (\'%1\' || \'0\')"
+    },
 
     {
         DSqliteHandle::SqlType::DeleteFiles2, "SELECT tag_with_file.tag_name FROM tag_with_file "
         "WHERE tag_with_file.file_name = \'%1\'"
     },
+    {
+        DSqliteHandle::SqlType::DeleteFiles2, "SELECT tag_with_file.file_name, tag_with_file.tag_name FROM tag_with_file "
+        "WHERE tag_with_file.file_name >= (\'%1\' || \'/\') AND tag_with_file.file_name < (\'%1\' || \'0\')"
+    },
 
     {DSqliteHandle::SqlType::DeleteTags, "DELETE FROM tag_with_file WHERE tag_with_file.tag_name = \'%1\'"},
 
@@ -699,6 +728,7 @@ void DSqliteHandle::connectToSqlite(const QString &mountPoint, const QString &db
 
             if (QSqlDatabase::contains(CONNECTIONNAME))
             {
+                m_preparedSqls.clear();
                 m_sqlDatabasePtr.reset(nullptr);
                 QSqlDatabase::removeDatabase(CONNECTIONNAME);
             }
@@ -843,9 +873,109 @@ void DSqliteHandle::connectToSqlite(const QString &mountPoint, const QString &db
         initDatabasePtr();
     }
 
+    if (code == DSqliteHandle::ReturnCode::Exist || code == DSqliteHandle::ReturnCode::NoExist) {
+        this->initializeDatabase(mountPoint, db_name);
+    }
+
     this->closeSqlDatabase();
 }
 
+void DSqliteHandle::initializeDatabase(const QString &mountPoint, const QString &db_name)
+{
+    QString db_path{ mountPoint + QString{"/"} + db_name };
+
+    if (m_initializedDatabases.find(db_path) != m_initializedDatabases.end()) {
+        return;
+    }
+
+    if (!m_sqlDatabasePtr || !(m_sqlDatabasePtr->isOpen() || m_sqlDatabasePtr->open())) {
+        return;
+    }
+
+    QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
+
+    if (db_name != QString{".__main.db"}) {
+        ///###: covering indexes for getting the tags of a file and getting the files of a tag.
+        ///###: without them every query of tag_with_file is a full table scan.
+        if (!sqlQuery.exec("CREATE INDEX IF NOT EXISTS tag_with_file_file_name ON tag_with_file (file_name, tag_name)")
+                || !sqlQuery.exec("CREATE INDEX IF NOT EXISTS tag_with_file_tag_name ON tag_with_file (tag_name, file_name)")) {
+            qWarning() << sqlQuery.lastError().text();
+
+            return;
+        }
+    }
+
+    ///###: journal_mode=WAL is persistent and leaves the -wal/-shm files beside the database while it is open,
+    ///###: so it is only used for the databases of the system partitions. the databases on the other
+    ///###: partitions(e.g. removable media) may be unplugged or opened by an older version at any time,
+    ///###: they are switched back to the default mode if they were changed to WAL before.
+    ///###: WAL needs shared memory, it may not work on the FUSE file systems(e.g. ntfs-3g).
+    const bool use_wal{ (mountPoint == QString{ ROOTPATH } || mountPoint == QString{"/home"})
+                        && !QStorageInfo{ mountPoint }.fileSystemType().startsWith("fuse") };
+
+    if (!sqlQuery.exec(use_wal ? "PRAGMA journal_mode=WAL" : "PRAGMA journal_mode=DELETE")) {
+        qWarning() << sqlQuery.lastError().text();
+    }
+
+    m_initializedDatabases.insert(db_path);
+}
+
+QSqlQuery *DSqliteHandle::execPreparedSql(const QString &sqlTemplate, const QList<QString> &values)
+{
+    if (!m_sqlDatabasePtr || !m_sqlDatabasePtr->isOpen()) {
+        return nullptr;
+    }
+
+    std::map<QString, PreparedSql>::iterator itr{ m_preparedSqls.find(sqlTemplate) };
+
+    if (itr == m_preparedSqls.end()) {
+        static const QRegularExpression placeholder{ R"foo('%(\d)')foo" };
+        QRegularExpressionMatchIterator match_itr{ placeholder.globalMatch(sqlTemplate) };
+        PreparedSql prepared_sql{};
+        QString sql{};
+        int last_pos{ 0 };
+
+        ///###: '%n' -> ?
+        while (match_itr.hasNext()) {
+            QRegularExpressionMatch match{ match_itr.next() };
+
+            sql += sqlTemplate.midRef(last_pos, match.capturedStart() - last_pos);
+            sql += QChar{'?'};
+            last_pos = match.capturedEnd();
+            prepared_sql.argIndexes.push_back(match.captured(1).toInt() - 1);
+        }
+
+        sql += sqlTemplate.midRef(last_pos);
+        prepared_sql.query.reset(new QSqlQuery{ *m_sqlDatabasePtr });
+
+        if (!prepared_sql.query->prepare(sql)) {
+            qWarning() << prepared_sql.query->lastError().text();
+
+            return nullptr;
+        }
+
+        itr = m_preparedSqls.emplace(sqlTemplate, std::move(prepared_sql)).first;
+    }
+
+    QSqlQuery *query{ itr->second.query.get() };
+    const std::vector<int> &arg_indexes{ itr->second.argIndexes };
+
+    for (std::size_t index = 0; index < arg_indexes.size(); ++index) {
+        QString value{ arg_indexes[index] < values.size() ? values[arg_indexes[index]] : QString{} };
+
+        ///###: keep the same as the old sql strings, an empty value is '' rather than NULL.
+        query->bindValue(static_cast<int>(index), value.isNull() ? QString{""} : value);
+    }
+
+    if (!query->exec()) {
+        qWarning() << query->lastError().text();
+
+        return nullptr;
+    }
+
+    return query;
+}
+
 
 ///###:this is also a auxiliary function. do not need a mutex.
 template<>
@@ -859,20 +989,16 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFiles, QMap<QString,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> itrOfSqlForDeleting{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::TagFiles) };
         std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itr{ itrOfSqlForDeleting.first };
         ++itr; ++itr;
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
 
 
         for (; cbeg != cend; ++cbeg) {
 
             for (const QString &tagName : cbeg.value()) {
-                QString sql{ itr->second.arg(tagName) };
-                sql = sql.arg(cbeg.key());
 
                 if (!m_flag.load(std::memory_order_acquire)) {
 
                     ///###: delete redundant item in tag_with_file.
-                    if (!sqlQuery.exec(sql)) {
-                        qWarning() << sqlQuery.lastError().text();
+                    if (!this->execPreparedSql(itr->second, { tagName, cbeg.key() })) {
                         continue;
                     }
 
@@ -882,8 +1008,7 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFiles, QMap<QString,
 
                     if (code == DSqliteHandle::ReturnCode::Exist) {
 
-                        if (!sqlQuery.exec(sql)) {
-                            qWarning() << sqlQuery.lastError().text();
+                        if (!this->execPreparedSql(itr->second, { tagName, cbeg.key() })) {
                             continue;
                         }
 
@@ -913,19 +1038,15 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFiles2, QMap<QString,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> itrOfSqlForDeleting{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::TagFiles) };
         std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itr{ itrOfSqlForDeleting.first };
         ++itr;
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
 
         for (; cbeg != cend; ++cbeg) {
 
             for (const QString &tagName : cbeg.value()) {
-                QString sql{ itr->second.arg(cbeg.key()) };
-                sql = sql.arg(tagName);
 
                 if (!m_flag.load(std::memory_order_acquire)) {
 
                     ///###: tag files
-                    if (!sqlQuery.exec(sql)) {
-                        qWarning() << sqlQuery.lastError().text();
+                    if (!this->execPreparedSql(itr->second, { cbeg.key(), tagName })) {
                         continue;
                     }
 
@@ -935,8 +1056,7 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFiles2, QMap<QString,
 
                     if (code == DSqliteHandle::ReturnCode::Exist) {
 
-                        if (!sqlQuery.exec(sql)) {
-                            qWarning() << sqlQuery.lastError().text();
+                        if (!this->execPreparedSql(itr->second, { cbeg.key(), tagName })) {
                             continue;
                         }
 
@@ -961,105 +1081,61 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFiles3, QList<QString
         const QString &mountPoint)
 {
     if (!forUpdating.isEmpty() && !mountPoint.isEmpty()) {
-        QList<QString>::const_iterator cbeg{ forUpdating.cbegin() };
-        QList<QString>::const_iterator cend{ forUpdating.cend() };
         std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> itrOfSqlForDeleting{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::TagFiles) };
         std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itr{ itrOfSqlForDeleting.first };
         ++itr; ++itr; ++itr; ++itr;
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
-
-        for (; cbeg != cend; ++cbeg) {
-            QString sqlForGettingTag{ itr->second.arg(*cbeg) };
-            std::vector<QString> leftTags{};
 
-            if (!m_flag.load(std::memory_order_acquire)) {
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForDelRowInFileProperty{ std::prev(itr) };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForUpdating{ std::next(itr) };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForCounterFileInFP{ std::next(itr, 2) };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForInsertRowInFP{ std::next(itr, 3) };
 
-                if (sqlQuery.exec(sqlForGettingTag)) {
+        ///###: the partion may be unmounted when doing this.
+        std::function<bool()> partionIsAvailable{ [&] {
+                return !m_flag.load(std::memory_order_acquire)
+                       || this->checkWhetherHasSqliteInPartion(mountPoint) == DSqliteHandle::ReturnCode::Exist;
+            } };
 
-                    while (sqlQuery.next()) {
-                        QString tagName{ sqlQuery.value("tag_name").toString() };
-                        leftTags.push_back(tagName);
-                    }
-                }
-
-            } else {
-
-                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                if (code == DSqliteHandle::ReturnCode::Exist) {
+        for (const QString &file : forUpdating) {
+            std::vector<QString> leftTags{};
 
-                    if (sqlQuery.exec(sqlForGettingTag)) {
+            if (!partionIsAvailable()) {
+                return false;
+            }
 
-                        while (sqlQuery.next()) {
-                            QString tagName{ sqlQuery.value("tag_name").toString() };
-                            leftTags.push_back(tagName);
-                        }
-                    }
+            if (QSqlQuery *sqlQuery = this->execPreparedSql(itr->second, { file })) {
 
-                } else {
-                    return false;
+                while (sqlQuery->next()) {
+                    QString tagName{ sqlQuery->value("tag_name").toString() };
+                    leftTags.push_back(tagName);
                 }
+
+                sqlQuery->finish();
             }
 
             if (leftTags.empty()) {
-                std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForDelRowInFileProperty{itr};
-                --itrForDelRowInFileProperty;
-                QString sqlForDelRowInFileProperty{ itrForDelRowInFileProperty->second.arg(*cbeg) };
-
-
-                if (!m_flag.load(std::memory_order_acquire)) {
-
-                    if (!sqlQuery.exec(sqlForDelRowInFileProperty)) {
-                        qWarning() << sqlQuery.lastError().text();
-                        continue;
-                    }
-
-                } else {
-
-                    DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
 
-                    if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                        if (!sqlQuery.exec(sqlForDelRowInFileProperty)) {
-                            qWarning() << sqlQuery.lastError().text();
-                            continue;
-                        }
-
-                    } else {
-                        return false;
-                    }
+                if (!partionIsAvailable()) {
+                    return false;
                 }
 
-            } else {
-
-                std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForCounterFileInFP{ itr };
-                ++itrForCounterFileInFP; ++itrForCounterFileInFP;
-                QString sqlOfCountingFileInFP{ itrForCounterFileInFP->second.arg(*cbeg) };
+                this->execPreparedSql(itrForDelRowInFileProperty->second, { file });
 
+            } else {
                 int counter{ 0 };
 
-                if (!m_flag.load(std::memory_order_acquire)) {
+                if (!partionIsAvailable()) {
+                    return false;
+                }
 
-                    if (sqlQuery.exec(sqlOfCountingFileInFP)) {
+                if (QSqlQuery *sqlQuery = this->execPreparedSql(itrForCounterFileInFP->second, { file })) {
 
-                        if (sqlQuery.next()) {
-                            counter =  sqlQuery.value("counter").toInt();
-                        }
+                    if (sqlQuery->next()) {
+                        counter =  sqlQuery->value("counter").toInt();
                     }
 
-                } else {
-                    DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                    if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                        if (sqlQuery.exec(sqlOfCountingFileInFP)) {
-                            counter = sqlQuery.value("counter").toInt();
-                        }
-
-                    } else {
-                        return false;
-                    }
+                    sqlQuery->finish();
                 }
 
                 std::size_t size{ leftTags.size() };
@@ -1072,77 +1148,18 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFiles3, QList<QString
                     }
                 }
 
+                std::size_t sizeOfTags{ leftTags.size() };
 
-                if (counter > 0) {
-                    std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForUpdating{itr};
-                    ++itrForUpdating;
-
-                    std::size_t sizeOfTags{ leftTags.size() };
-
-                    QString sqlForUpdatingFileProperty{itrForUpdating->second.arg(leftTags[sizeOfTags - 3])};
-                    sqlForUpdatingFileProperty = sqlForUpdatingFileProperty.arg(leftTags[sizeOfTags - 2]);
-                    sqlForUpdatingFileProperty = sqlForUpdatingFileProperty.arg(leftTags[sizeOfTags - 1]);
-                    sqlForUpdatingFileProperty = sqlForUpdatingFileProperty.arg(*cbeg);
-
-                    if (!m_flag.load(std::memory_order_acquire)) {
-
-                        if (!sqlQuery.exec(sqlForUpdatingFileProperty)) {
-                            qWarning() << sqlQuery.lastError().text();
-                            continue;
-                        }
-
-                    } else {
-
-                        DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                        if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                            if (!sqlQuery.exec(sqlForUpdatingFileProperty)) {
-                                qWarning() << sqlQuery.lastError().text();
-                                continue;
-                            }
-
-                        } else {
-                            return false;
-                        }
-
-                    }
+                if (!partionIsAvailable()) {
+                    return false;
+                }
 
+                if (counter > 0) {
+                    this->execPreparedSql(itrForUpdating->second, { leftTags[sizeOfTags - 3], leftTags[sizeOfTags - 2],
+                                                                    leftTags[sizeOfTags - 1], file });
                 } else {
-
-                    std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForInsertRowInFP{ itr };
-                    ++itrForInsertRowInFP;
-                    ++itrForInsertRowInFP;
-                    ++itrForInsertRowInFP;
-                    std::size_t sizeOfTags{ leftTags.size() };
-                    QString sqlForInsertRowInFP{ itrForInsertRowInFP->second.arg(*cbeg) };
-                    sqlForInsertRowInFP = sqlForInsertRowInFP.arg(leftTags[sizeOfTags - 3]);
-                    sqlForInsertRowInFP = sqlForInsertRowInFP.arg(leftTags[sizeOfTags - 2]);
-                    sqlForInsertRowInFP = sqlForInsertRowInFP.arg(leftTags[sizeOfTags - 1]);
-
-
-                    if (!m_flag.load(std::memory_order_acquire)) {
-
-                        if (!sqlQuery.exec(sqlForInsertRowInFP)) {
-                            qWarning() << sqlQuery.lastError().text();
-                            continue;
-                        }
-
-                    } else {
-
-                        DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                        if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                            if (!sqlQuery.exec(sqlForInsertRowInFP)) {
-                                qWarning() << sqlQuery.lastError().text();
-                                continue;
-                            }
-
-                        } else {
-                            return false;
-                        }
-                    }
+                    this->execPreparedSql(itrForInsertRowInFP->second, { file, leftTags[sizeOfTags - 3],
+                                                                         leftTags[sizeOfTags - 2], leftTags[sizeOfTags - 1] });
                 }
             }
         }
@@ -1409,35 +1426,20 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFilesThroughColor3, Q
 
 template<>
 bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::UntagSamePartionFiles,
-                                std::list<QString>>(const std::list<QString> &sqlStrs, const QString &mountPoint)
+                                std::list<std::pair<QString, QString>>>(const std::list<std::pair<QString, QString>> &filesAndTags, const QString &mountPoint)
 {
-    if (!m_flag.load(std::memory_order_consume) && !sqlStrs.empty() && !mountPoint.isEmpty()) {
-        std::list<QString>::const_iterator cbeg{ sqlStrs.cbegin() };
-        std::list<QString>::const_iterator cend{ sqlStrs.cend() };
-        QSqlQuery sqlQuery{*m_sqlDatabasePtr};
-
-        for (; cbeg != cend; ++cbeg) {
-
-            if (!m_flag.load(std::memory_order_consume)) {
-
-                if (!sqlQuery.exec(*cbeg)) {
-                    qWarning() << sqlQuery.lastError().text();
-                }
-
-            } else {
-
-                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                if (code == DSqliteHandle::ReturnCode::Exist) {
+    if (!filesAndTags.empty() && !mountPoint.isEmpty() && static_cast<bool>(m_sqlDatabasePtr)) {
+        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
+            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::UntagSamePartionFiles) };
 
-                    if (!sqlQuery.exec(*cbeg)) {
-                        qWarning() << sqlQuery.lastError().text();
-                    }
+        for (const std::pair<QString, QString> &fileAndTag : filesAndTags) {
 
-                } else {
-                    return false;
-                }
+            if (m_flag.load(std::memory_order_consume)
+                    && this->checkWhetherHasSqliteInPartion(mountPoint) != DSqliteHandle::ReturnCode::Exist) {
+                return false;
             }
+
+            this->execPreparedSql(range.first->second, { fileAndTag.first, fileAndTag.second });
         }
 
         return true;
@@ -1452,229 +1454,62 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::UntagSamePartionFiles2,
                                 const QString &mountPoint)
 {
     if (!fileNameAndTagNames.isEmpty() && !mountPoint.isEmpty() && static_cast<bool>(m_sqlDatabasePtr)) {
-        QMap<QString, QList<QString>>::const_iterator cbeg{ fileNameAndTagNames.cbegin() };
-        QMap<QString, QList<QString>>::const_iterator cend{ fileNameAndTagNames.cend() };
         std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::UntagSamePartionFiles2) };
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator countTagNamesInTagWithFile{ range.first };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator sqlForGetingLeftTag{ std::next(range.first) };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator updateRowInFileProperty{ std::next(range.first, 2) };
+        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator deleteRowInFileProperty{ std::next(range.first, 3) };
 
-        for (; cbeg != cend; ++cbeg) {
-            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator rangeBeg{ range.first };
-            QString countTagNamesInTagWithFile{ rangeBeg->second.arg(cbeg.key()) };
-
-
-            if (!m_flag.load(std::memory_order_consume)) {
-
-                if (!sqlQuery.exec(countTagNamesInTagWithFile)) {
-                    qWarning() << sqlQuery.lastError().text();
-                    continue;
-                }
-
-                if (sqlQuery.next()) {
-                    int size{ sqlQuery.value(0).toInt() };
-
-                    if (size == 0) {
-                        std::multimap<DSqliteHandle::SqlType, QString>::const_iterator  rangeEnd{ range.second };
-                        QString deleteRowInFileProperty{ (--rangeEnd)->second.arg(cbeg.key()) };
-
-                        if (!m_flag.load(std::memory_order_consume)) {
-
-                            if (!sqlQuery.exec(deleteRowInFileProperty)) {
-                                qWarning() << sqlQuery.lastError().text();
-                                continue;
-                            }
-
-                        } else {
-
-                            DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                            if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                                if (!sqlQuery.exec(deleteRowInFileProperty)) {
-                                    qWarning() << sqlQuery.lastError().text();
-                                    continue;
-                                }
-
-                            } else {
-                                return false;
-                            }
-                        }
-
-
-                    } else {
-
-                        QString sqlForGetingLeftTag{ (++rangeBeg)->second.arg(cbeg.key()) };
-
-                        if (!m_flag.load(std::memory_order_consume)) {
+        for (const QString &file : fileNameAndTagNames.keys()) {
 
-                            if (!sqlQuery.exec(sqlForGetingLeftTag)) {
-                                qWarning() << sqlQuery.lastError().text();
-                                continue;
-                            }
-
-                            std::deque<QString> leftTags{};
-
-                            while (sqlQuery.next()) {
-                                leftTags.push_back(sqlQuery.value("tag_name").toString());
-                            }
-
-                            std::size_t sizeOfLeftTags{ leftTags.size() };
-                            std::deque<QString>::const_iterator leftTagsCbeg{ leftTags.cbegin() };
-
-                            if (sizeOfLeftTags >= 3u) {
-                                leftTags.erase(leftTagsCbeg, leftTagsCbeg + (sizeOfLeftTags - 3u));
-
-                            } else {
-
-                                for (; size < 3; ++size) {
-                                    leftTags.push_back(QString{});
-                                }
-                            }
-
-                            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForUpdateRow{ (--range.second) };
-                            leftTagsCbeg = leftTags.cbegin();
-                            QString updateRowInFileProperty{ (--itrForUpdateRow)->second.arg(*leftTagsCbeg) };
-                            updateRowInFileProperty = updateRowInFileProperty.arg(*(++leftTagsCbeg));
-                            updateRowInFileProperty = updateRowInFileProperty.arg(*(++leftTagsCbeg));
-                            updateRowInFileProperty = updateRowInFileProperty.arg(cbeg.key());
-
-                            if (!m_flag.load(std::memory_order_consume)) {
-
-                                if (!sqlQuery.exec(updateRowInFileProperty)) {
-                                    qWarning() << sqlQuery.lastError().text();
-                                    continue;
-                                }
-
-                            } else {
-
-                                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
+            if (m_flag.load(std::memory_order_consume)
+                    && this->checkWhetherHasSqliteInPartion(mountPoint) != DSqliteHandle::ReturnCode::Exist) {
+                return false;
+            }
 
-                                if (code == DSqliteHandle::ReturnCode::Exist) {
+            int size{ 0 };
 
-                                    if (!sqlQuery.exec(updateRowInFileProperty)) {
-                                        qWarning() << sqlQuery.lastError().text();
-                                        continue;
-                                    }
+            if (QSqlQuery *sqlQuery = this->execPreparedSql(countTagNamesInTagWithFile->second, { file })) {
 
-                                } else {
-                                    return false;
-                                }
-
-                            }
-                        }
-                    }
+                if (sqlQuery->next()) {
+                    size = sqlQuery->value(0).toInt();
                 }
 
+                sqlQuery->finish();
             } else {
+                continue;
+            }
 
-                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                    if (sqlQuery.exec(countTagNamesInTagWithFile)) {
-                        qWarning() << sqlQuery.lastError().text();
-                        continue;
-                    }
-
-                    if (sqlQuery.next()) {
-
-                        int size{ sqlQuery.value(0).toInt() };
-
-                        if (size == 0) {
-                            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator  rangeEnd{ range.second };
-                            QString deleteRowInFileProperty{ (--rangeEnd)->second.arg(cbeg.key()) };
-
-                            if (!m_flag.load(std::memory_order_consume)) {
-
-                                if (!sqlQuery.exec(deleteRowInFileProperty)) {
-                                    qWarning() << sqlQuery.lastError().text();
-                                    continue;
-                                }
-
-                            } else {
-
-                                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
-
-                                if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                                    if (!sqlQuery.exec(deleteRowInFileProperty)) {
-                                        qWarning() << sqlQuery.lastError().text();
-                                        continue;
-                                    }
-
-                                } else {
-                                    return false;
-                                }
-                            }
-
-
-                        } else {
-
-                            QString sqlForGetingLeftTag{ (++rangeBeg)->second };
-
-                            if (!m_flag.load(std::memory_order_consume)) {
-
-                                if (!sqlQuery.exec(sqlForGetingLeftTag)) {
-                                    qWarning() << sqlQuery.lastError().text();
-                                    continue;
-                                }
-
-                                std::deque<QString> leftTags{};
-                                int sizeOfTags{ sqlQuery.size() };
-
-                                for (long int index = 0; index < sizeOfTags; ++index) {
-                                    leftTags.push_back(sqlQuery.value(index).toString());
-                                }
-
-                                std::size_t sizeOfLeftTags{ leftTags.size() };
-                                std::deque<QString>::const_iterator leftTagsCbeg{ leftTags.cbegin() };
-
-                                if (sizeOfLeftTags >= 3u) {
-                                    leftTags.erase(leftTagsCbeg, leftTagsCbeg + (sizeOfLeftTags - 3u));
-
-                                } else {
-
-                                    for (; size < 3; ++size) {
-                                        leftTags.push_back(QString{});
-                                    }
-                                }
-
-                                std::multimap<DSqliteHandle::SqlType, QString>::const_iterator itrForUpdateRow{ (--range.second) };
-                                leftTagsCbeg = leftTags.cbegin();
-                                QString updateRowInFileProperty{ (--itrForUpdateRow)->second.arg(*leftTagsCbeg) };
-                                updateRowInFileProperty = updateRowInFileProperty.arg(*(++leftTagsCbeg));
-                                updateRowInFileProperty = updateRowInFileProperty.arg(*(++leftTagsCbeg));
-                                updateRowInFileProperty = updateRowInFileProperty.arg(cbeg.key());
-
-                                if (!m_flag.load(std::memory_order_consume)) {
+            if (size == 0) {
+                this->execPreparedSql(deleteRowInFileProperty->second, { file });
 
-                                    if (!sqlQuery.exec(updateRowInFileProperty)) {
-                                        qWarning() << sqlQuery.lastError().text();
-                                        continue;
-                                    }
-
-                                } else {
+                continue;
+            }
 
-                                    DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPoint) };
+            std::deque<QString> leftTags{};
 
-                                    if (code == DSqliteHandle::ReturnCode::Exist) {
+            if (QSqlQuery *sqlQuery = this->execPreparedSql(sqlForGetingLeftTag->second, { file })) {
 
-                                        if (!sqlQuery.exec(updateRowInFileProperty)) {
-                                            qWarning() << sqlQuery.lastError().text();
-                                            continue;
-                                        }
+                while (sqlQuery->next()) {
+                    leftTags.push_back(sqlQuery->value("tag_name").toString());
+                }
 
-                                    } else {
-                                        return false;
-                                    }
+                sqlQuery->finish();
+            } else {
+                continue;
+            }
 
-                                }
+            ///###: file_property only keeps the last 3 tags.
+            while (leftTags.size() > 3u) {
+                leftTags.pop_front();
+            }
 
-                            }
-                        }
-                    }
-                }
+            while (leftTags.size() < 3u) {
+                leftTags.push_back(QString{});
             }
+
+            this->execPreparedSql(updateRowInFileProperty->second, { leftTags[0], leftTags[1], leftTags[2], file });
         }
 
         return true;
@@ -1688,62 +1523,40 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::DeleteFiles,
                                 std::list<QString>, bool>(const std::list<QString> &files, const QString &mount_point)
 {
 
-    if (!files.empty() && !mount_point.isEmpty()) {
-        std::list<QString>::const_iterator file_itr_beg{ files.cbegin() };
-        std::list<QString>::const_iterator file_itr_end{ files.cend() };
+    if (!files.empty() && !mount_point.isEmpty() && static_cast<bool>(m_sqlDatabasePtr)) {
         std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::DeleteFiles) };
-        QSqlQuery sql_query{ *m_sqlDatabasePtr };
-
-        if (!m_flag.load(std::memory_order_acquire)) {
-
-            for (; file_itr_beg != file_itr_end; ++file_itr_beg) {
-                std::multimap<DSqliteHandle::SqlType, QString>::const_iterator range_beg{ range.first };
-                QString clear_tag_with_file_table{ range_beg->second.arg(*file_itr_beg) };
-                QString clear_file_property_table{ (++range_beg)->second.arg(*file_itr_beg) };
-
-                if (!sql_query.exec(clear_file_property_table)) {
-                    qWarning() << sql_query.lastError().text();
+        const QString &clear_tag_with_file_table{ range.first->second };
+        const QString &clear_file_property_table{ std::next(range.first)->second };
+        const QString &clear_children_in_tag_with_file_table{ std::next(range.first, 2)->second };
+        const QString &clear_children_in_file_property_table{ std::next(range.first, 3)->second };
 
-                    return false;
-                }
+        if (m_flag.load(std::memory_order_acquire)
+                && this->checkWhetherHasSqliteInPartion(mount_point) != DSqliteHandle::ReturnCode::Exist) {
+            return false;
+        }
 
-                if (!sql_query.exec(clear_tag_with_file_table)) {
-                    qWarning() << sql_query.lastError().text();
+        for (const QString &file : files) {
 
-                    return false;
-                }
+            if (!this->execPreparedSql(clear_file_property_table, { file })) {
+                return false;
             }
 
-            return true;
-
-        } else {
-
-            DSqliteHandle::ReturnCode code{this->checkWhetherHasSqliteInPartion(mount_point)};
-
-            if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                for (; file_itr_beg != file_itr_end; ++file_itr_beg) {
-                    std::multimap<DSqliteHandle::SqlType, QString>::const_iterator range_beg{ range.first };
-                    QString clear_tag_with_file_table{ range_beg->second.arg(*file_itr_beg) };
-                    QString clear_file_property_table{ (++range_beg)->second.arg(*file_itr_beg) };
-
-                    if (sql_query.exec(clear_file_property_table)) {
-                        qWarning() << sql_query.lastError().text();
-
-                        return false;
-                    }
+            if (!this->execPreparedSql(clear_tag_with_file_table, { file })) {
+                return false;
+            }
 
-                    if (sql_query.exec(clear_tag_with_file_table)) {
-                        qWarning() << sql_query.lastError().text();
+            ///###: if the file is a directory, the files in it were deleted too.
+            if (!file.isEmpty()) {
 
-                        return false;
-                    }
+                if (!this->execPreparedSql(clear_children_in_file_property_table, { file })
+                        || !this->execPreparedSql(clear_children_in_tag_with_file_table, { file })) {
+                    return false;
                 }
-
-                return true;
             }
         }
+
+        return true;
     }
 
     return false;
@@ -1755,44 +1568,40 @@ QMap<QString, QList<QString>> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType:
 {
     QMap<QString, QList<QString>> file_and_tags{};
 
-    if (!files.empty() && !mount_point.isEmpty()) {
+    if (!files.empty() && !mount_point.isEmpty() && static_cast<bool>(m_sqlDatabasePtr)) {
         std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::DeleteFiles2) };
-        QSqlQuery sql_query{ *m_sqlDatabasePtr };
 
+        if (m_flag.load(std::memory_order_acquire)
+                && this->checkWhetherHasSqliteInPartion(mount_point) != DSqliteHandle::ReturnCode::Exist) {
+            return file_and_tags;
+        }
 
-        if (!m_flag.load(std::memory_order_acquire)) {
-
-            for (const QString &file : files) {
-                QString sql_for_getting_tags{ range.first->second.arg(file) };
+        for (const QString &file : files) {
 
-                if (sql_query.exec(sql_for_getting_tags)) {
+            if (QSqlQuery *sql_query = this->execPreparedSql(range.first->second, { file })) {
 
-                    while (sql_query.next()) {
-                        QString tag_name{ sql_query.value("tag_name").toString() };
-                        file_and_tags[file].push_back(tag_name);
-                    }
+                while (sql_query->next()) {
+                    QString tag_name{ sql_query->value("tag_name").toString() };
+                    file_and_tags[file].push_back(tag_name);
                 }
-            }
 
-        } else {
-
-            DSqliteHandle::ReturnCode code{this->checkWhetherHasSqliteInPartion(mount_point)};
-
-            if (code == DSqliteHandle::ReturnCode::Exist) {
+                sql_query->finish();
+            }
 
-                for (const QString &file : files) {
-                    QString sql_for_getting_tags{ range.first->second.arg(file) };
+            if (file.isEmpty()) {
+                continue;
+            }
 
-                    if (sql_query.exec(sql_for_getting_tags)) {
+            if (QSqlQuery *sql_query = this->execPreparedSql(std::next(range.first)->second, { file })) {
 
-                        while (sql_query.next()) {
-                            QString tag_name{ sql_query.value("tag_name").toString() };
-                            file_and_tags[file].push_back(tag_name);
-                        }
-                    }
+                while (sql_query->next()) {
+                    QString file_name{ sql_query->value("file_name").toString() };
+                    QString tag_name{ sql_query->value("tag_name").toString() };
+                    file_and_tags[file_name].push_back(tag_name);
                 }
 
+                sql_query->finish();
             }
         }
     }
@@ -2048,45 +1857,36 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::DeleteTags3, QList<QStri
 
 
 template<>
-bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::ChangeFilesName, std::map<QString, QString>>(const std::map<QString, QString> &sqlStrs, const QString &mountPoint)
+bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::ChangeFilesName, std::map<QString, QString>>(const std::map<QString, QString> &oldAndNewNames, const QString &mountPoint)
 {
-    if (!sqlStrs.empty() && !mountPoint.isEmpty()) {
-        std::map<QString, QString>::const_iterator sqlCBeg{ sqlStrs.cbegin() };
-        std::map<QString, QString>::const_iterator sqlCEnd{ sqlStrs.cend() };
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
-
-        for (; sqlCBeg != sqlCEnd; ++sqlCBeg) {
-
-            if (!m_flag.load(std::memory_order_consume)) {
-
-                if (!sqlQuery.exec(sqlCBeg->first)) {
-                    qWarning() << sqlQuery.lastError().text();
-                }
-
-                if (!sqlQuery.exec(sqlCBeg->second)) {
-                    qWarning() << sqlQuery.lastError().text();
-                }
-
-            } else {
-                DSqliteHandle::ReturnCode code{this->checkWhetherHasSqliteInPartion(mountPoint)};
+    if (!oldAndNewNames.empty() && !mountPoint.isEmpty() && static_cast<bool>(m_sqlDatabasePtr)) {
+        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
+            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::ChangeFilesName) };
+        const QString &updateFileProperty{ range.first->second };
+        const QString &updateTagWithFile{ std::next(range.first)->second };
+        const QString &updateChildrenInFileProperty{ std::next(range.first, 2)->second };
+        const QString &updateChildrenInTagWithFile{ std::next(range.first, 3)->second };
 
-                if (code == DSqliteHandle::ReturnCode::Exist) {
+        for (const std::pair<QString, QString> &oldAndNewName : oldAndNewNames) {
 
-                    if (!sqlQuery.exec(sqlCBeg->first)) {
-                        qWarning() << sqlQuery.lastError().text();
-                    }
+            if (m_flag.load(std::memory_order_consume)
+                    && this->checkWhetherHasSqliteInPartion(mountPoint) != DSqliteHandle::ReturnCode::Exist) {
+                return false;
+            }
 
-                    if (!sqlQuery.exec(sqlCBeg->second)) {
-                        qWarning() << sqlQuery.lastError().text();
-                    }
+            this->execPreparedSql(updateFileProperty, { oldAndNewName.second, oldAndNewName.first });
+            this->execPreparedSql(updateTagWithFile, { oldAndNewName.second, oldAndNewName.first });
 
-                } else {
-                    return false;
-                }
+            ///###: a renamed directory moves all files in it by one statement rather than one statement per file.
+            if (!oldAndNewName.first.isEmpty()) {
+                this->execPreparedSql(updateChildrenInFileProperty, { oldAndNewName.second, oldAndNewName.first });
+                this->execPreparedSql(updateChildrenInTagWithFile, { oldAndNewName.second, oldAndNewName.first });
             }
         }
+
         return true;
     }
+
     return false;
 }
 
@@ -2096,43 +1896,40 @@ QMap<QString, QList<QString>> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType:
 {
     QMap<QString, QList<QString>> file_with_tags{};
 
-    if (!files.empty()) {
+    if (!files.empty() && static_cast<bool>(m_sqlDatabasePtr)) {
         std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
             std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(SqlType::ChangeFilesName2) };
-        std::map<QString, QString>::const_iterator file_beg{ files.cbegin() };
-        std::map<QString, QString>::const_iterator file_end{ files.cend() };
-        QSqlQuery sql_query{ *m_sqlDatabasePtr };
 
+        if (m_flag.load(std::memory_order_consume)
+                && this->checkWhetherHasSqliteInPartion(mount_point) != DSqliteHandle::ReturnCode::Exist) {
+            return file_with_tags;
+        }
 
-        if (!m_flag.load(std::memory_order_consume)) {
-
-            for (; file_beg != file_end; ++file_beg) {
+        for (const std::pair<QString, QString> &file : files) {
 
-                if (sql_query.exec(range.first->second.arg(file_beg->first))) {
+            if (QSqlQuery *sql_query = this->execPreparedSql(range.first->second, { file.first })) {
 
-                    while (sql_query.next()) {
-                        QString tag_name{ sql_query.value("tag_name").toString() };
-                        file_with_tags[file_beg->first].push_back(tag_name);
-                    }
+                while (sql_query->next()) {
+                    QString tag_name{ sql_query->value("tag_name").toString() };
+                    file_with_tags[file.first].push_back(tag_name);
                 }
-            }
-
-        } else {
 
-            DSqliteHandle::ReturnCode code{this->checkWhetherHasSqliteInPartion(mount_point)};
-
-            if (code == DSqliteHandle::ReturnCode::Exist) {
+                sql_query->finish();
+            }
 
-                for (; file_beg != file_end; ++file_beg) {
+            if (file.first.isEmpty()) {
+                continue;
+            }
 
-                    if (sql_query.exec(range.first->second.arg(file_beg->first))) {
+            if (QSqlQuery *sql_query = this->execPreparedSql(std::next(range.first)->second, { file.first })) {
 
-                        while (sql_query.next()) {
-                            QString tag_name{ sql_query.value("tag_name").toString() };
-                            file_with_tags[file_beg->first].push_back(tag_name);
-                        }
-                    }
+                while (sql_query->next()) {
+                    QString file_name{ sql_query->value("file_name").toString() };
+                    QString tag_name{ sql_query->value("tag_name").toString() };
+                    file_with_tags[file_name].push_back(tag_name);
                 }
+
+                sql_query->finish();
             }
         }
     }
@@ -2236,39 +2033,28 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::ChangeTagsName2, QMap<QS
 
 template<>
 QList<QString> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::GetTagsThroughFile, QString,
-        QList<QString>>(const QString &sqlStr, const QString &mountPoint)
+        QList<QString>>(const QString &file, const QString &mountPoint)
 {
     QList<QString> tagNames{};
 
-    if (!sqlStr.isEmpty() && !mountPoint.isEmpty()) {
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
+    if (!file.isEmpty() && !mountPoint.isEmpty()) {
 
-        if (!m_flag.load(std::memory_order_consume)) {
+        if (m_flag.load(std::memory_order_consume)
+                && this->checkWhetherHasSqliteInPartion(mountPoint) != DSqliteHandle::ReturnCode::Exist) {
+            return tagNames;
+        }
 
-            if (!sqlQuery.exec(sqlStr)) {
-                qWarning() << sqlQuery.lastError().text();
-            }
+        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
+            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::GetTagsThroughFile) };
+
+        if (QSqlQuery *sqlQuery = this->execPreparedSql(range.first->second, { file })) {
 
-            while (sqlQuery.next()) {
-                QString tagName{ sqlQuery.value("tag_name").toString() };
+            while (sqlQuery->next()) {
+                QString tagName{ sqlQuery->value("tag_name").toString() };
                 tagNames.push_back(tagName);
             }
 
-        } else {
-
-            DSqliteHandle::ReturnCode code{this->checkWhetherHasSqliteInPartion(mountPoint)};
-
-            if (code == DSqliteHandle::ReturnCode::Exist) {
-
-                if (!sqlQuery.exec(sqlStr)) {
-                    qWarning() << sqlQuery.lastError().text();
-                }
-
-                while (sqlQuery.next()) {
-                    QString tagName{ sqlQuery.value("tag_name").toString() };
-                    tagNames.push_back(tagName);
-                }
-            }
+            sqlQuery->finish();
         }
     }
 
@@ -2278,40 +2064,31 @@ QList<QString> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::GetTagsThrough
 
 template<>
 QList<QString> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::GetFilesThroughTag,
-        QString, QList<QString>>(const QString &sqlStr, const QString &mountPoint)
+        QString, QList<QString>>(const QString &tagName, const QString &mountPoint)
 {
     QList<QString> files{};
 
-    if (!sqlStr.isEmpty() && !mountPoint.isEmpty()) {
-        QSqlQuery sqlQuery{ *m_sqlDatabasePtr };
-
-        if (!m_flag.load(std::memory_order_consume)) {
-
-            if (sqlQuery.exec(sqlStr)) {
+    if (!tagName.isEmpty() && !mountPoint.isEmpty()) {
 
-                while (sqlQuery.next()) {
-                    QString fileName{ sqlQuery.value("file_name").toString() };
-                    files.push_back(m_current_mount_point + fileName);
-                }
-            }
-
-        } else {
-
-            DSqliteHandle::ReturnCode code{this->checkWhetherHasSqliteInPartion(mountPoint)};
-
-            if (code == DSqliteHandle::ReturnCode::Exist) {
+        if (m_flag.load(std::memory_order_consume)
+                && this->checkWhetherHasSqliteInPartion(mountPoint) != DSqliteHandle::ReturnCode::Exist) {
+            return files;
+        }
 
-                if (sqlQuery.exec(sqlStr)) {
+        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
+            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::GetFilesThroughTag) };
 
-                    while (sqlQuery.next()) {
-                        QString fileName{ sqlQuery.value("file_name").toString() };
-                        files.push_back(m_current_mount_point + fileName);
-                    }
-                }
+        if (QSqlQuery *sqlQuery = this->execPreparedSql(range.first->second, { tagName })) {
 
+            while (sqlQuery->next()) {
+                QString fileName{ sqlQuery->value("file_name").toString() };
+                files.push_back(m_current_mount_point + fileName);
             }
+
+            sqlQuery->finish();
         }
     }
+
     return files;
 }
 
@@ -2776,28 +2553,22 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::UntagSamePartionFiles, bo
 
                 if (range.first != range.second) {
 
-                    ///###: [sql].
-                    std::list<QString> sqlForDeletingRowOfTagWithFile{};
+                    ///###: [<file, tag>].
+                    std::list<std::pair<QString, QString>> fileAndTagForDeletingRowOfTagWithFile{};
                     cbeg = file_with_tags.cbegin(); //###:!!!!!!!!
                     cend = file_with_tags.cend();//###:!!!!!!!!!
 
                     for (; cbeg != cend; ++cbeg) {
-                        std::multimap<SqlType, QString>::const_iterator rangeCBeg{ range.first };
-                        QString fileLocalName{ cbeg.key() };
-                        QList<QString>::const_iterator cTagBeg{ cbeg.value().cbegin() };
-                        QList<QString>::const_iterator cTagEnd{ cbeg.value().cend() };
-
-                        for (; cTagBeg != cTagEnd; ++cTagBeg) {
-                            QString deletingRowOfTagWithFile{ rangeCBeg->second.arg(fileLocalName) };
-                            deletingRowOfTagWithFile = deletingRowOfTagWithFile.arg(*cTagBeg);
-                            sqlForDeletingRowOfTagWithFile.push_back(deletingRowOfTagWithFile);
+
+                        for (const QString &tagName : cbeg.value()) {
+                            fileAndTagForDeletingRowOfTagWithFile.emplace_back(cbeg.key(), tagName);
                         }
                     }
 
-                    if (!sqlForDeletingRowOfTagWithFile.empty() && m_sqlDatabasePtr->open()
+                    if (!fileAndTagForDeletingRowOfTagWithFile.empty() && m_sqlDatabasePtr->open()
                             && m_sqlDatabasePtr->transaction()) {
                         bool resultOfDeleteRowInTagWithFile{ this->helpExecSql<DSqliteHandle::SqlType::UntagSamePartionFiles,
-                                                             std::list<QString>, bool>(sqlForDeletingRowOfTagWithFile, unixDeviceAndMountPoint.second) };
+                                                             std::list<std::pair<QString, QString>>, bool>(fileAndTagForDeletingRowOfTagWithFile, unixDeviceAndMountPoint.second) };
                         bool resultOfUpdateFileProperty{ false };
 
                         if (resultOfDeleteRowInTagWithFile) {
@@ -2925,7 +2696,8 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::DeleteFiles, bool>(const
 
         std::map<QString, std::list<QString>>::const_iterator itr_partion_and_files{ filesOfPartions.cbegin() };
         std::map<QString, std::list<QString>>::const_iterator itr_partion_and_files_end{ filesOfPartions.cend() };
-        QMap<QString, QList<QString>> file_and_tags{};
+        ///###: <mount-point, <file, [tags]>>, the files in the deleted directories are included.
+        std::map<QString, QMap<QString, QList<QString>>> file_and_tags{};
 
         for (; itr_partion_and_files != itr_partion_and_files_end; ++itr_partion_and_files) {
             DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(itr_partion_and_files->first) };
@@ -2940,12 +2712,7 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::DeleteFiles, bool>(const
                     };
 
                     if (!file_and_tags_partion.isEmpty()) {
-                        QMap<QString, QList<QString>>::const_iterator itr_beg{ file_and_tags_partion.cbegin() };
-                        QMap<QString, QList<QString>>::const_iterator itr_end{ file_and_tags_partion.cend() };
-
-                        for (; itr_beg != itr_end; ++itr_beg) {
-                            file_and_tags[itr_beg.key()] = itr_beg.value();
-                        }
+                        file_and_tags[itr_partion_and_files->first] = file_and_tags_partion;
                     }
                 }
             }
@@ -2953,7 +2720,7 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::DeleteFiles, bool>(const
 
         this->closeSqlDatabase();
 
-        if (file_and_tags.isEmpty()) {
+        if (file_and_tags.empty()) {
             return false;
         }
 
@@ -2982,8 +2749,12 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::DeleteFiles, bool>(const
 
                     if (result) {
 
-                        for (const QString &file : itr_partion_and_files->second) {
-                            result_of_emit[itr_partion_and_files->first + file] = QVariant{ file_and_tags[file] };
+                        const QMap<QString, QList<QString>> &file_and_tags_partion{ file_and_tags[itr_partion_and_files->first] };
+                        QMap<QString, QList<QString>>::const_iterator itr_beg{ file_and_tags_partion.cbegin() };
+                        QMap<QString, QList<QString>>::const_iterator itr_end{ file_and_tags_partion.cend() };
+
+                        for (; itr_beg != itr_end; ++itr_beg) {
+                            result_of_emit[itr_partion_and_files->first + itr_beg.key()] = QVariant{ itr_beg.value() };
                         }
 
                         emit untagFiles(result_of_emit);
@@ -3121,9 +2892,6 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::ChangeFilesName, bool>(co
     if (!filesAndTags.isEmpty()) {
         QMap<QString, QList<QString>>::const_iterator cbeg{ filesAndTags.cbegin() };
         QMap<QString, QList<QString>>::const_iterator cend{ filesAndTags.cend() };
-        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
-            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::ChangeFilesName) };
-
         std::map<QString, std::map<QString, QString>> partionsAndFileNames{};
 
         for (; cbeg != cend; ++cbeg) {
@@ -3165,110 +2933,95 @@ bool DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::ChangeFilesName, bool>(co
         }
 
 
-        std::map<QString, std::map<QString, QString>> sqlForChangingFilesName{};
         std::map<QString, std::map<QString, QString>> partionsAndFileNames_backup{ partionsAndFileNames };
 
         if (!partionsAndFileNames.empty()) {
-            std::map<QString, std::map<QString, QString>>::const_iterator partionBeg{ partionsAndFileNames.cbegin() };
-            std::map<QString, std::map<QString, QString>>::const_iterator partionEnd{ partionsAndFileNames.cend() };
-
-            for (; partionBeg != partionEnd; ++partionBeg) {
-
-                for (const std::pair<QString, QString> &oldAndNewName : partionBeg->second) {
-                    std::map<DSqliteHandle::SqlType, QString>::const_iterator rangeBeg{ range.first };
-                    QString updateFileProperty{ rangeBeg->second.arg(oldAndNewName.second)};
-                    updateFileProperty = updateFileProperty.arg(oldAndNewName.first);
-
-                    QString updateTagWithFile{ (++rangeBeg)->second.arg(oldAndNewName.second) };
-                    updateTagWithFile = updateTagWithFile.arg(oldAndNewName.first);
-                    sqlForChangingFilesName[partionBeg->first].emplace(updateFileProperty, updateTagWithFile);
-                }
-            }
-
-            if (!sqlForChangingFilesName.empty()) {
-                bool result{ true };
+            bool result{ true };
 
-                for (const std::pair<QString, std::map<QString, QString>> &mountPointAndSqls : sqlForChangingFilesName) {
-                    DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPointAndSqls.first) };
+            for (const std::pair<QString, std::map<QString, QString>> &mountPointAndNames : partionsAndFileNames) {
+                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPointAndNames.first) };
 
-                    if (code == DSqliteHandle::ReturnCode::NoExist || code == DSqliteHandle::ReturnCode::Exist) {
-                        this->connectToSqlite(mountPointAndSqls.first);
+                if (code == DSqliteHandle::ReturnCode::NoExist || code == DSqliteHandle::ReturnCode::Exist) {
+                    this->connectToSqlite(mountPointAndNames.first);
 
-                        if (m_sqlDatabasePtr && m_sqlDatabasePtr->open() && m_sqlDatabasePtr->transaction()) {
-                            bool resultOfExecSql{ this->helpExecSql<DSqliteHandle::SqlType::ChangeFilesName,
-                                                  std::map<QString, QString>, bool>(mountPointAndSqls.second, mountPointAndSqls.first) };
+                    if (m_sqlDatabasePtr && m_sqlDatabasePtr->open() && m_sqlDatabasePtr->transaction()) {
+                        bool resultOfExecSql{ this->helpExecSql<DSqliteHandle::SqlType::ChangeFilesName,
+                                              std::map<QString, QString>, bool>(mountPointAndNames.second, mountPointAndNames.first) };
 
-                            if (!(resultOfExecSql && m_sqlDatabasePtr->commit())) {
-                                m_sqlDatabasePtr->rollback();
-                                result = false;
+                        if (!(resultOfExecSql && m_sqlDatabasePtr->commit())) {
+                            m_sqlDatabasePtr->rollback();
+                            result = false;
 
-                                partionsAndFileNames_backup.erase(mountPointAndSqls.first);
-                                file_with_tags_in_partion.remove(mountPointAndSqls.first);
-                            }
+                            partionsAndFileNames_backup.erase(mountPointAndNames.first);
+                            file_with_tags_in_partion.remove(mountPointAndNames.first);
                         }
                     }
                 }
+            }
 
-                this->closeSqlDatabase();
+            this->closeSqlDatabase();
 
-                QMap<QString, QList<QString>> file_with_tags_new{};
+            QMap<QString, QList<QString>> file_with_tags_new{};
 
-                for (const std::pair<QString, std::map<QString, QString>> &mount_point_and_file_names : partionsAndFileNames_backup) {
-                    std::map<QString, QString> new_and_old_names{};
+            for (const std::pair<QString, std::map<QString, QString>> &mount_point_and_file_names : partionsAndFileNames_backup) {
+                std::map<QString, QString> new_and_old_names{};
 
-                    for (const std::pair<QString, QString> &old_and_new_name : mount_point_and_file_names.second) {
-                        new_and_old_names[old_and_new_name.second] = old_and_new_name.first;
-                    }
+                for (const std::pair<QString, QString> &old_and_new_name : mount_point_and_file_names.second) {
+                    new_and_old_names[old_and_new_name.second] = old_and_new_name.first;
+                }
 
-                    DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mount_point_and_file_names.first) };
+                DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mount_point_and_file_names.first) };
 
-                    if (code == DSqliteHandle::ReturnCode::NoExist || code == DSqliteHandle::ReturnCode::Exist) {
-                        this->connectToSqlite(mount_point_and_file_names.first);
+                if (code == DSqliteHandle::ReturnCode::NoExist || code == DSqliteHandle::ReturnCode::Exist) {
+                    this->connectToSqlite(mount_point_and_file_names.first);
 
-                        if (m_sqlDatabasePtr && m_sqlDatabasePtr->open()) {
-                            QMap<QString, QList<QString>> file_with_tags{
-                                this->helpExecSql<DSqliteHandle::SqlType::ChangeFilesName2, std::map<QString, QString>,
-                                QMap<QString, QList<QString>>>(new_and_old_names, mount_point_and_file_names.first)
-                            };
+                    if (m_sqlDatabasePtr && m_sqlDatabasePtr->open()) {
+                        QMap<QString, QList<QString>> file_with_tags{
+                            this->helpExecSql<DSqliteHandle::SqlType::ChangeFilesName2, std::map<QString, QString>,
+                            QMap<QString, QList<QString>>>(new_and_old_names, mount_point_and_file_names.first)
+                        };
 
-                            using namespace impl;
-                            file_with_tags_new += file_with_tags;
+                        ///###: the names in sqlite do not contain the mount point.
+                        for (auto itr = file_with_tags.cbegin(); itr != file_with_tags.cend(); ++itr) {
+                            file_with_tags_new[mount_point_and_file_names.first + itr.key()] = itr.value();
                         }
                     }
                 }
+            }
 
-                QMap<QString, QList<QString>> file_with_tags_old{};
-                QMap<QString, QMap<QString, QList<QString>>>::const_iterator itr_beg{ file_with_tags_in_partion.cbegin() };
-                QMap<QString, QMap<QString, QList<QString>>>::const_iterator itr_end{ file_with_tags_in_partion.cend() };
-
-                for (; itr_beg != itr_end; ++itr_beg) {
-                    using namespace impl;
-                    file_with_tags_old += itr_beg.value();
-                }
+            QMap<QString, QList<QString>> file_with_tags_old{};
+            QMap<QString, QMap<QString, QList<QString>>>::const_iterator itr_beg{ file_with_tags_in_partion.cbegin() };
+            QMap<QString, QMap<QString, QList<QString>>>::const_iterator itr_end{ file_with_tags_in_partion.cend() };
 
-                QMap<QString, QVariant> file_with_tags_var{};
-                QMap<QString, QList<QString>>::iterator file_with_tags_beg{ file_with_tags_old.begin() };
-                QMap<QString, QList<QString>>::iterator file_with_tags_end{ file_with_tags_old.end() };
+            for (; itr_beg != itr_end; ++itr_beg) {
 
-                for (; file_with_tags_beg != file_with_tags_end; ++file_with_tags_beg) {
-                    file_with_tags_var[file_with_tags_beg.key()] = QVariant{ file_with_tags_beg.value() };
+                for (auto itr = itr_beg.value().cbegin(); itr != itr_beg.value().cend(); ++itr) {
+                    file_with_tags_old[itr_beg.key() + itr.key()] = itr.value();
                 }
+            }
 
-                emit untagFiles(file_with_tags_var);
+            QMap<QString, QVariant> file_with_tags_var{};
+            QMap<QString, QList<QString>>::iterator file_with_tags_beg{ file_with_tags_old.begin() };
+            QMap<QString, QList<QString>>::iterator file_with_tags_end{ file_with_tags_old.end() };
 
-                file_with_tags_var.clear();
-                file_with_tags_beg = file_with_tags_new.begin();
-                file_with_tags_end = file_with_tags_new.end();
+            for (; file_with_tags_beg != file_with_tags_end; ++file_with_tags_beg) {
+                file_with_tags_var[file_with_tags_beg.key()] = QVariant{ file_with_tags_beg.value() };
+            }
 
-                for (; file_with_tags_beg != file_with_tags_end; ++file_with_tags_beg) {
-                    file_with_tags_var[file_with_tags_beg.key()] = QVariant{ file_with_tags_beg.value() };
-                }
+            emit untagFiles(file_with_tags_var);
 
-                emit filesWereTagged(file_with_tags_var);
-                this->closeSqlDatabase();
+            file_with_tags_var.clear();
+            file_with_tags_beg = file_with_tags_new.begin();
+            file_with_tags_end = file_with_tags_new.end();
 
-                return result;
+            for (; file_with_tags_beg != file_with_tags_end; ++file_with_tags_beg) {
+                file_with_tags_var[file_with_tags_beg.key()] = QVariant{ file_with_tags_beg.value() };
             }
+
+            emit filesWereTagged(file_with_tags_var);
+            this->closeSqlDatabase();
+
+            return result;
         }
     }
 
@@ -3395,9 +3148,6 @@ QList<QString> DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::GetTagsThroughF
     if (!filesAndTags.isEmpty()) {
         QMap<QString, QList<QString>>::const_iterator cbeg{ filesAndTags.cbegin() };
         QPair<QString, QString> partionAndMountPoint{ DSqliteHandle::getMountPointOfFile(DUrl::fromLocalFile(cbeg.key()), m_partionsOfDevices) };
-        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
-            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::GetTagsThroughFile) };
-
 
         if (partionAndMountPoint.second.isEmpty() || partionAndMountPoint.second.isNull()) {
             return tags;
@@ -3408,13 +3158,12 @@ QList<QString> DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::GetTagsThroughF
         if (code == DSqliteHandle::ReturnCode::NoExist || code == DSqliteHandle::ReturnCode::Exist) {
             QString file{ cbeg.key() };
             file = this->remove_mount_point(file, partionAndMountPoint.second);
-            QString sqlForGetTagsThroughFile{range.first->second.arg(file)};
             this->connectToSqlite(partionAndMountPoint.second);
 
             ///###: no transaction.
             if (m_sqlDatabasePtr->open()) {
                 tags = this->helpExecSql<DSqliteHandle::SqlType::GetTagsThroughFile,
-                QString, QList<QString>>(sqlForGetTagsThroughFile, partionAndMountPoint.second);
+                QString, QList<QString>>(file, partionAndMountPoint.second);
             }
         }
     }
@@ -3436,9 +3185,6 @@ QList<QString> DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::GetFilesThrough
 
     if (!filesAndTags.isEmpty()) {
         QMap<QString, QList<QString>>::const_iterator cbeg{ filesAndTags.cbegin() };
-        std::pair<std::multimap<DSqliteHandle::SqlType, QString>::const_iterator,
-            std::multimap<DSqliteHandle::SqlType, QString>::const_iterator> range{ SqlTypeWithStrs.equal_range(DSqliteHandle::SqlType::GetFilesThroughTag) };
-        QString sqlForGetFilesThroughTag{ range.first->second.arg(cbeg.key()) };
 
         if (m_partionsOfDevices && !m_partionsOfDevices->empty()) {
             std::map<QString, std::multimap<QString, QString>>::const_iterator deviceItr{ m_partionsOfDevices->cbegin() };
@@ -3460,7 +3206,7 @@ QList<QString> DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::GetFilesThrough
                             if (m_sqlDatabasePtr && m_sqlDatabasePtr->open()) {
 
                                 QList<QString> filesOfPartion{ this->helpExecSql<DSqliteHandle::SqlType::GetFilesThroughTag,
-                                                               QString, QList<QString>>(sqlForGetFilesThroughTag, mountPointItr->second) };
+                                                               QString, QList<QString>>(cbeg.key(), mountPointItr->second) };
 
                                 if (!filesOfPartion.isEmpty()) {
                                     files += filesOfPartion;
@@ -3494,15 +3240,44 @@ QList<QString> DSqliteHandle::execSqlstr<DSqliteHandle::SqlType::GetSameTagsOfDi
         QMap<QString, QList<QString>>::const_iterator cbeg{ filesAndTags.cbegin() };
         QMap<QString, QList<QString>>::const_iterator cend{ filesAndTags.cend() };
 
+        ///###: <mount point, files>. connect to the database of every partion only once.
+        std::map<QString, std::list<QString>> filesOfMountPoints{};
+
         for (; cbeg != cend; ++cbeg) {
-            QMap<QString, QList<QString>> file{};
-            file.insert(cbeg.key(), cbeg.value());
+            QPair<QString, QString> partionAndMountPoint{ DSqliteHandle::getMountPointOfFile(DUrl::fromLocalFile(cbeg.key()), m_partionsOfDevices) };
 
-            QList<QString> tagsNames{ this->execSqlstr<DSqliteHandle::SqlType::GetTagsThroughFile, QList<QString>>(file) };
-            for (const QString &tagName : tagsNames) {
-                ++countForTags[tagName];
+            if (!partionAndMountPoint.second.isEmpty()) {
+                filesOfMountPoints[partionAndMountPoint.second].push_back(this->remove_mount_point(cbeg.key(), partionAndMountPoint.second));
             }
         }
+
+        for (const std::pair<const QString, std::list<QString>> &mountPointAndFiles : filesOfMountPoints) {
+            DSqliteHandle::ReturnCode code{ this->checkWhetherHasSqliteInPartion(mountPointAndFiles.first) };
+
+            if (code != DSqliteHandle::ReturnCode::NoExist && code != DSqliteHandle::ReturnCode::Exist) {
+                continue;
+            }
+
+            this->connectToSqlite(mountPointAndFiles.first);
+
+            if (m_sqlDatabasePtr && m_sqlDatabasePtr->open()) {
+
+                for (const QString &file : mountPointAndFiles.second) {
+                    std::set<QString> tagsNames{};
+
+                    for (const QString &tagName : this->helpExecSql<DSqliteHandle::SqlType::GetTagsThroughFile,
+                            QString, QList<QString>>(file, mountPointAndFiles.first)) {
+                        tagsNames.insert(Tag::restore_escaped_en_skim(tagName));
+                    }
+
+                    for (const QString &tagName : tagsNames) {
+                        ++countForTags[tagName];
+                    }
+                }
+            }
+
+            this->closeSqlDatabase();
+        }
     }
 
     int size{ filesAndTags.size() };
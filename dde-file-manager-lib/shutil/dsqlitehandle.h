@@ -6,9 +6,12 @@
 #include "deviceinfo/udisklistener.h"
 #include "deviceinfo/udiskdeviceinfo.h"
 
+#include <map>
+#include <set>
 #include <mutex>
 #include <regex>
 #include <memory>
+#include <vector>
 #include <unordered_map>
 
 #include <QDir>
@@ -126,6 +129,9 @@ private:
 
     inline void closeSqlDatabase()noexcept
     {
+        ///###: the prepared statements must be released before closing the connection.
+        m_preparedSqls.clear();
+
         if(m_sqlDatabasePtr && m_sqlDatabasePtr->isOpen()){
             m_sqlDatabasePtr->close();
         }
@@ -161,12 +167,29 @@ private:
         return;
     }
 
+    ///###: exec a statement of SqlTypeWithStrs. the '%n' in it will be bound as a parameter rather than be
+    ///###: replaced by QString::arg, and the statement is compiled once per connection. so it is cheap to call
+    ///###: this in a loop of a batch operation. return nullptr if failed.
+    QSqlQuery* execPreparedSql(const QString& sqlTemplate, const QList<QString>& values);
+
+    ///###: create the indexes of tag_with_file and set the journal mode(WAL only on the system partitions) of the opened database.
+    void initializeDatabase(const QString& mountPoint, const QString& db_name);
+
     ReturnCode checkWhetherHasSqliteInPartion(const QString& mountPoint, const QString& db_name = QString{".__deepin.db"});
     void initializeConnect();
     void connectToSqlite(const QString& mountPoint, const QString& db_name = QString{".__deepin.db"});
 
     std::unique_ptr<std::map<QString, std::multimap<QString, QString>>> m_partionsOfDevices{ nullptr };
     std::unique_ptr<QSqlDatabase> m_sqlDatabasePtr{ nullptr };
+
+    struct PreparedSql
+    {
+        std::unique_ptr<QSqlQuery> query{ nullptr };
+        std::vector<int> argIndexes{};
+    };
+
+    std::map<QString, PreparedSql> m_preparedSqls{};
+    std::set<QString> m_initializedDatabases{};
     std::atomic<bool> m_flag{ false };
     std::mutex m_mutex{};
 
@@ -254,8 +277,8 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::TagFilesThroughColor3, Q
 
 ///###: untag files in same/diff partion.
 template<>
-bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::UntagSamePartionFiles, std::list<QString>, bool>(
-                                                    const std::list<QString>& sqlStrs, const QString& mountPoint);
+bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::UntagSamePartionFiles, std::list<std::pair<QString, QString>>, bool>(
+                                                    const std::list<std::pair<QString, QString>>& filesAndTags, const QString& mountPoint);
 template<>
 bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::UntagSamePartionFiles2, QMap<QString, QList<QString>>, bool>(const QMap<QString, QList<QString>>& fileNameAndTagNames,
                                                                                                                      const QString& mountPoint);
@@ -309,13 +332,13 @@ bool DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::ChangeTagsName2, QMap<QS
 ///###: get tags through file.
 template<>
 QList<QString> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::GetTagsThroughFile,
-                                QString, QList<QString>>(const QString& sqlStr, const QString& mountPoint);
+                                QString, QList<QString>>(const QString& file, const QString& mountPoint);
 
 
 ///###: get files which was tagged by appointed tag.
 template<>
 QList<QString> DSqliteHandle::helpExecSql<DSqliteHandle::SqlType::GetFilesThroughTag,
-                                          QString, QList<QString>>(const QString& sqlStr, const QString& mountPoint);
+                                          QString, QList<QString>>(const QString& tagName, const QString& mountPoint);
 
 
 
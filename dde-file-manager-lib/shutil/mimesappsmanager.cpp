@@ -29,6 +29,7 @@
 
 #include "singleton.h"
 #include "desktopfile.h"
+#include "desktopentrysnapshot.h"
 #include "interfaces/dfmstandardpaths.h"
 #include "interfaces/dfmglobal.h"
 #include "mimetypedisplaymanager.h"
@@ -70,7 +71,15 @@ QMap<QString, DesktopFile> MimesAppsManager::ImageMimeApps = {};
 QMap<QString, DesktopFile> MimesAppsManager::TextMimeApps = {};
 QMap<QString, DesktopFile> MimesAppsManager::AudioMimeApps = {};
 
-QMap<QString, DesktopFile> MimesAppsManager::DesktopObjs = {};
+// 常驻内存，再次更新时只会重新解析有变化的文件
+static DesktopEntrySnapshot *desktopEntrySnapshot()
+{
+    static DesktopEntrySnapshot snapshot(MimesAppsManager::getDesktopEntriesCacheFile());
+    static bool snapshotLoaded = snapshot.load();
+    Q_UNUSED(snapshotLoaded)
+
+    return &snapshot;
+}
 
 MimeAppsWorker::MimeAppsWorker(QObject *parent): QObject(parent)
 {
@@ -164,7 +173,8 @@ void MimeAppsWorker::handleDirectoryChanged(const QString &filePath)
 
 void MimeAppsWorker::handleFileChanged(const QString &filePath)
 {
-    Q_UNUSED(filePath)
+    // 直接修改文件时目录的修改时间不变，需要通知快照重新解析此文件
+    desktopEntrySnapshot()->fileChanged(filePath);
 //    updateCache();
     m_updateCacheTimer->start();
     //for 1.4
@@ -446,8 +456,8 @@ QStringList MimesAppsManager::getRecommendedAppsByQio(const QMimeType &mimeType)
                     bool app_exist = false;
 
                     for (const QString &other : recommendApps) {
-                        const DesktopFile &app_desktop = mimeAppsManager->DesktopObjs.value(app);
-                        const DesktopFile &other_desktop = mimeAppsManager->DesktopObjs.value(other);
+                        const DesktopFile &app_desktop = mimeAppsManager->getDesktopObj(app);
+                        const DesktopFile &other_desktop = mimeAppsManager->getDesktopObj(other);
 
                         if (app_desktop.getExec() == other_desktop.getExec() && app_desktop.getLocalName() == other_desktop.getLocalName()) {
                             app_exist = true;
@@ -572,6 +582,11 @@ QString MimesAppsManager::getDesktopFilesCacheFile()
     return QString("%1/%2").arg(DFMStandardPaths::location(DFMStandardPaths::CachePath), "DesktopFiles.json");
 }
 
+QString MimesAppsManager::getDesktopEntriesCacheFile()
+{
+    return QString("%1/%2").arg(DFMStandardPaths::location(DFMStandardPaths::CachePath), "DesktopEntries.cache");
+}
+
 QString MimesAppsManager::getDesktopIconsCacheFile()
 {
     return QString("%1/%2").arg(DFMStandardPaths::location(DFMStandardPaths::CachePath), "DesktopIcons.json");
@@ -607,140 +622,135 @@ QMap<QString, DesktopFile> MimesAppsManager::getDesktopObjs()
     return desktopObjs;
 }
 
+DesktopFile MimesAppsManager::getDesktopObj(const QString &filePath)
+{
+    return desktopEntrySnapshot()->desktopFile(filePath);
+}
+
 void MimesAppsManager::initMimeTypeApps()
 {
     qDebug() << "getMimeTypeApps in" << QThread::currentThread() << qApp->thread();
-    DesktopFiles.clear();
-    DesktopObjs.clear();
-    DDE_MimeTypes.clear();
 
-    QMap<QString, QSet<QString>> mimeAppsSet;
+    DesktopEntrySnapshot &snapshot = *desktopEntrySnapshot();
+
+    DDE_MimeTypes.clear();
     loadDDEMimeTypes();
-    foreach (QString desktopFolder, getApplicationsFolders()) {
-        QDirIterator it(desktopFolder, QStringList("*.desktop"),
-                        QDir::Files | QDir::NoDotAndDotDot,
-                        QDirIterator::Subdirectories);
-        while (it.hasNext()) {
-          it.next();
-          QString filePath = it.filePath();
-          DesktopFile desktopFile(filePath);
-          DesktopFiles.append(filePath);
-          DesktopObjs.insert(filePath, desktopFile);
-          QStringList mimeTypes = desktopFile.getMimeType();
-          QString fileName = QFileInfo(filePath).fileName();
-          if (DDE_MimeTypes.contains(fileName)){
-              mimeTypes.append(DDE_MimeTypes.value(fileName));
-          }
 
-          foreach (QString mimeType, mimeTypes) {
-              if (!mimeType.isEmpty()){
-                  QSet<QString> apps;
-                  if (mimeAppsSet.contains(mimeType)){
-                      apps = mimeAppsSet.value(mimeType);
-                      apps.insert(filePath);
-                  }else{
-                      apps.insert(filePath);
-                  }
-                  mimeAppsSet.insert(mimeType, apps);
-              }
-          }
+    const bool changed = snapshot.update(getApplicationsFolders(), {getDDEMimeTypeFile(), getMimeInfoCacheFilePath()});
+
+    DesktopFiles = snapshot.filePaths();
+
+    // 关联数据没有变化时不需要访问各个desktop文件，它们在使用时才从缓存文件中读取
+    if (changed) {
+        snapshot.mimeApps.clear();
+
+        QHash<QString, QSet<QString>> mimeAppsSet;
+        QHash<QString, qint64> createdTimes;
+
+        for (const QString &filePath : DesktopFiles) {
+            QStringList mimeTypes = snapshot.desktopFile(filePath).getMimeType();
+            const QString &fileName = QFileInfo(filePath).fileName();
+
+            if (DDE_MimeTypes.contains(fileName)) {
+                mimeTypes.append(DDE_MimeTypes.value(fileName));
+            }
+
+            for (const QString &mimeType : mimeTypes) {
+                if (!mimeType.isEmpty()) {
+                    mimeAppsSet[mimeType].insert(filePath);
+                }
+            }
+
+            createdTimes.insert(filePath, snapshot.entry(filePath).created);
         }
-    }
 
-    foreach (QString key, mimeAppsSet.keys()) {
-        QSet<QString> apps = mimeAppsSet.value(key);
-        QStringList orderApps;
-        if (apps.count() > 1){
-            QFileInfoList fileInfos;
-            foreach (QString app, apps) {
-                QFileInfo info(app);
-                fileInfos.append(info);
+        for (auto it = mimeAppsSet.constBegin(); it != mimeAppsSet.constEnd(); ++it) {
+            QStringList orderApps = it->toList();
+
+            if (orderApps.count() > 1) {
+                // 按创建时间排序，时间保存在快照中，不需要再次获取文件信息
+                std::sort(orderApps.begin(), orderApps.end(), [&createdTimes] (const QString &f1, const QString &f2) {
+                    return createdTimes.value(f1) < createdTimes.value(f2);
+                });
             }
 
-            std::sort(fileInfos.begin(), fileInfos.end(), MimesAppsManager::lessByDateTime);
+            snapshot.mimeApps.insert(it.key(), orderApps);
+        }
 
-            foreach (QFileInfo info, fileInfos) {
-                orderApps.append(info.absoluteFilePath());
+        //check mime apps from cache
+        QSet<QString> audioDesktopList;
+        QSet<QString> imageDeksopList;
+        QSet<QString> textDekstopList;
+        QSet<QString> videoDesktopList;
+        QFile f(getMimeInfoCacheFilePath());
+
+        if (f.open(QIODevice::ReadOnly)) {
+            while (!f.atEnd()) {
+                const QString &data = QString::fromUtf8(f.readLine()).trimmed();
+                const int index = data.indexOf('=');
+                const QString &mimeType = data.left(index);
+                const QStringList &desktops = data.mid(index + 1).split(";", QString::SkipEmptyParts);
+
+                for (const QString &desktop : desktops) {
+                    if (audioDesktopList.contains(desktop))
+                        continue;
+
+                    if (mimeType.startsWith("audio")) {
+                        audioDesktopList << desktop;
+                    } else if (mimeType.startsWith("image")) {
+                        imageDeksopList << desktop;
+                    } else if (mimeType.startsWith("text")) {
+                        textDekstopList << desktop;
+                    } else if (mimeType.startsWith("video")) {
+                        videoDesktopList << desktop;
+                    }
+                }
             }
-        }else{
-            orderApps.append(apps.toList());
+        } else {
+            qDebug () << "failed to read mime info cache file:" << f.errorString();
         }
-        MimeApps.insert(key, orderApps);
-    }
 
-    //check mime apps from cache
-    QFile f(getMimeInfoCacheFilePath());
-    if(!f.open(QIODevice::ReadOnly)){
-        qDebug () << "failed to read mime info cache file:" << f.errorString();
-        return;
-    }
+        const QString mimeInfoCacheRootPath = getMimeInfoCacheFileRootPath();
+        auto toPaths = [&mimeInfoCacheRootPath] (const QSet<QString> &desktops) {
+            QStringList paths;
 
-    QStringList audioDesktopList;
-    QStringList imageDeksopList;
-    QStringList textDekstopList;
-    QStringList videoDesktopList;
-
-    while (!f.atEnd()) {
-        QString data = f.readLine();
-        QString _desktops = data.split("=").last();
-        QString mimeType = data.split("=").first();
-        QStringList desktops = _desktops.split(";");
-
-        foreach (const QString desktop, desktops) {
-            if(desktop.isEmpty() || audioDesktopList.contains(desktop))
-                continue;
-
-            if(mimeType.startsWith("audio")){
-                if(!audioDesktopList.contains(desktop))
-                    audioDesktopList << desktop;
-            } else if(mimeType.startsWith("image")){
-                if(!imageDeksopList.contains(desktop))
-                    imageDeksopList << desktop;
-            } else if(mimeType.startsWith("text")){
-                if(!textDekstopList.contains(desktop))
-                    textDekstopList << desktop;
-            } else if(mimeType.startsWith("video")){
-                if(!videoDesktopList.contains(desktop))
-                    videoDesktopList << desktop;
+            for (const QString &desktop : desktops) {
+                const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath, desktop);
+
+                if (QFile::exists(path))
+                    paths << path;
             }
-        }
-    }
-    f.close();
 
-    const QString mimeInfoCacheRootPath = getMimeInfoCacheFileRootPath();
-    foreach (QString desktop, audioDesktopList) {
-        const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath,desktop);
-        if(!QFile::exists(path))
-            continue;
-        DesktopFile df(path);
-        AudioMimeApps.insert(path, df);
-    }
+            return paths;
+        };
 
-    foreach (QString desktop, imageDeksopList) {
-        const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath,desktop);
-        if(!QFile::exists(path))
-            continue;
-        DesktopFile df(path);
-        ImageMimeApps.insert(path, df);
+        snapshot.audioApps = toPaths(audioDesktopList);
+        snapshot.imageApps = toPaths(imageDeksopList);
+        snapshot.textApps = toPaths(textDekstopList);
+        snapshot.videoApps = toPaths(videoDesktopList);
+        snapshot.setAssociationsUpdated();
+        snapshot.save();
     }
 
-    foreach (QString desktop, textDekstopList) {
-        const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath,desktop);
-        if(!QFile::exists(path))
-            continue;
-        DesktopFile df(path);
-        TextMimeApps.insert(path, df);
-    }
+    MimeApps = snapshot.mimeApps;
 
-    foreach (QString desktop, videoDesktopList) {
-        const QString path = QString("%1/%2").arg(mimeInfoCacheRootPath,desktop);
-        if(!QFile::exists(path))
-            continue;
-        DesktopFile df(path);
-        VideoMimeApps.insert(path, df);
-    }
+    // 这些应用都在 /usr/share/applications 中，一般已经解析过了
+    auto toDesktopFiles = [&snapshot] (const QStringList &paths) {
+        QMap<QString, DesktopFile> desktopFiles;
+
+        for (const QString &path : paths) {
+            const DesktopFile &desktopFile = snapshot.desktopFile(path);
+
+            desktopFiles.insert(path, desktopFile.getFileName().isEmpty() ? DesktopFile(path) : desktopFile);
+        }
+
+        return desktopFiles;
+    };
 
-    return;
+    AudioMimeApps = toDesktopFiles(snapshot.audioApps);
+    ImageMimeApps = toDesktopFiles(snapshot.imageApps);
+    TextMimeApps = toDesktopFiles(snapshot.textApps);
+    VideoMimeApps = toDesktopFiles(snapshot.videoApps);
 }
 
 void MimesAppsManager::loadDDEMimeTypes()
@@ -79,7 +79,6 @@ public:
     static QMap<QString, DesktopFile> ImageMimeApps;
     static QMap<QString, DesktopFile> TextMimeApps;
     static QMap<QString, DesktopFile> AudioMimeApps;
-    static QMap<QString, DesktopFile> DesktopObjs;
 
     static QMimeType getMimeType(const QString& fileName);
     static QString getMimeTypeByFileName(const QString& fileName);
@@ -104,10 +103,13 @@ public:
     static QString getMimeInfoCacheFilePath();
     static QString getMimeInfoCacheFileRootPath();
     static QString getDesktopFilesCacheFile();
+    static QString getDesktopEntriesCacheFile();
     static QString getDesktopIconsCacheFile();
     static QStringList getDesktopFiles();
     static QString getDDEMimeTypeFile();
     static QMap<QString, DesktopFile> getDesktopObjs();
+    // 应用目录中的desktop文件，不在应用目录中时返回空的DesktopFile
+    static DesktopFile getDesktopObj(const QString &filePath);
     static void initMimeTypeApps();
     static void loadDDEMimeTypes();
     static bool lessByDateTime(const QFileInfo& f1,  const QFileInfo& f2);
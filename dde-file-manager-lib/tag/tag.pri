@@ -4,8 +4,12 @@ QT += sql
 
 HEADERS += \
     $$PWD/tagmanager.h \
-    $$PWD/tagutil.h
+    $$PWD/tagutil.h \
+    $$PWD/tagchangebatcher.h \
+    $$PWD/tagcache.h
 
 SOURCES += \
     $$PWD/tagmanager.cpp \
-    $$PWD/tagutil.cpp
+    $$PWD/tagutil.cpp \
+    $$PWD/tagchangebatcher.cpp \
+    $$PWD/tagcache.cpp
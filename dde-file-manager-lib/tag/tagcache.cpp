@@ -0,0 +1,366 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tagcache.h"
+#include "tagmanager.h"
+#include "tagutil.h"
+
+#include <QtConcurrent>
+
+Q_GLOBAL_STATIC(TagCache, globalTagCache)
+
+TagCache *TagCache::instance()
+{
+    return globalTagCache;
+}
+
+quint64 TagCache::hashOfFile(const QString &file)
+{
+    ///###: FNV-1a, 64 bits is enough to avoid collision of the paths.
+    quint64 hash{ 14695981039346656037ull };
+
+    for (const QChar &ch : file) {
+        hash ^= ch.unicode();
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+bool TagCache::getTagsThroughFile(const QString &file, QList<QString> *tags, QList<QColor> *colors) const
+{
+    QReadLocker locker{ &m_lock };
+
+    if (!m_loaded) {
+        return false;
+    }
+
+    TagBits bits{ m_filesTags.value(hashOfFile(file), 0) };
+
+    for (int id = 0; bits != 0; ++id, bits >>= 1) {
+
+        if ((bits & 1) == 0) {
+            continue;
+        }
+
+        if (tags) {
+            tags->push_back(m_tagNames[id]);
+        }
+
+        if (colors) {
+            colors->push_back(m_tagColors[id]);
+        }
+    }
+
+    return true;
+}
+
+void TagCache::reload()
+{
+    int generation{ ++m_generation };
+
+    {
+        QWriteLocker locker{ &m_lock };
+        m_loaded = false;
+        m_loading = true;
+
+        ///###: the newer loading reads the tags after these updates.
+        m_pendingUpdates.clear();
+    }
+
+    QtConcurrent::run([this, generation] {
+        doReload(generation);
+    });
+}
+
+void TagCache::doReload(int generation)
+{
+    const QMap<QString, QString> &tag_and_color{ TagManager::instance()->getAllTags() };
+
+    if (tag_and_color.size() > MaxTagCount) {
+        ///###: too many tags for a bitset, always ask TagManagerDaemon.
+        QWriteLocker locker{ &m_lock };
+
+        if (generation == m_generation) {
+            m_loading = false;
+            m_pendingUpdates.clear();
+        }
+
+        return;
+    }
+
+    QVector<QString> tag_names{};
+    QVector<QColor> tag_colors{};
+    QHash<QString, int> tag_ids{};
+    QHash<quint64, TagBits> files_tags{};
+
+    for (auto itr = tag_and_color.cbegin(); itr != tag_and_color.cend(); ++itr) {
+        int id{ tag_names.size() };
+
+        tag_names.push_back(itr.key());
+        tag_colors.push_back(Tag::NamesWithColors.value(itr.value()));
+        tag_ids[itr.key()] = id;
+
+        for (const QString &file : TagManager::instance()->getFilesThroughTag(itr.key())) {
+            files_tags[hashOfFile(file)] |= TagBits{ 1 } << id;
+        }
+
+        if (generation != m_generation) {
+            return;
+        }
+    }
+
+    QWriteLocker locker{ &m_lock };
+
+    ///###: the tags were changed while loading, the newer loading will fill the cache.
+    if (generation != m_generation) {
+        return;
+    }
+
+    m_tagNames.swap(tag_names);
+    m_tagColors.swap(tag_colors);
+    m_tagIds.swap(tag_ids);
+    m_filesTags.swap(files_tags);
+
+    ///###: the updates may have been read from TagManagerDaemon already, applying them again does not change the result.
+    bool need_reload{ false };
+
+    for (const std::function<bool()> &update : m_pendingUpdates) {
+        if (!update()) {
+            need_reload = true;
+            break;
+        }
+    }
+
+    m_pendingUpdates.clear();
+
+    if (need_reload) {
+        locker.unlock();
+        reload();
+
+        return;
+    }
+
+    m_loaded = true;
+    m_loading = false;
+}
+
+int TagCache::tagId(const QString &tag) const
+{
+    return m_tagIds.value(tag, -1);
+}
+
+void TagCache::filesWereTagged(const QMap<QString, QList<QString>> &files_were_tagged)
+{
+    QWriteLocker locker{ &m_lock };
+
+    if (!m_loaded) {
+        if (m_loading) {
+            m_pendingUpdates.push_back([this, files_were_tagged] {
+                return applyFilesWereTagged(files_were_tagged);
+            });
+        }
+
+        return;
+    }
+
+    if (!applyFilesWereTagged(files_were_tagged)) {
+        locker.unlock();
+        reload();
+    }
+}
+
+bool TagCache::applyFilesWereTagged(const QMap<QString, QList<QString>> &files_were_tagged)
+{
+    for (auto itr = files_were_tagged.cbegin(); itr != files_were_tagged.cend(); ++itr) {
+        TagBits &bits = m_filesTags[hashOfFile(itr.key())];
+
+        for (const QString &tag : itr.value()) {
+            int id{ tagId(tag) };
+
+            ///###: a new tag, the color of it is unknown.
+            if (id < 0) {
+                return false;
+            }
+
+            bits |= TagBits{ 1 } << id;
+        }
+    }
+
+    return true;
+}
+
+void TagCache::untagFiles(const QMap<QString, QList<QString>> &tag_be_removed_files)
+{
+    QWriteLocker locker{ &m_lock };
+
+    if (!m_loaded) {
+        if (m_loading) {
+            m_pendingUpdates.push_back([this, tag_be_removed_files] {
+                applyUntagFiles(tag_be_removed_files);
+
+                return true;
+            });
+        }
+
+        return;
+    }
+
+    applyUntagFiles(tag_be_removed_files);
+}
+
+void TagCache::applyUntagFiles(const QMap<QString, QList<QString>> &tag_be_removed_files)
+{
+    for (auto itr = tag_be_removed_files.cbegin(); itr != tag_be_removed_files.cend(); ++itr) {
+        QHash<quint64, TagBits>::iterator bits{ m_filesTags.find(hashOfFile(itr.key())) };
+
+        if (bits == m_filesTags.end()) {
+            continue;
+        }
+
+        for (const QString &tag : itr.value()) {
+            int id{ tagId(tag) };
+
+            if (id >= 0) {
+                bits.value() &= ~(TagBits{ 1 } << id);
+            }
+        }
+
+        if (bits.value() == 0) {
+            m_filesTags.erase(bits);
+        }
+    }
+}
+
+void TagCache::changeTagName(const QMap<QString, QString> &old_and_new_name)
+{
+    QWriteLocker locker{ &m_lock };
+
+    if (!m_loaded) {
+        if (m_loading) {
+            m_pendingUpdates.push_back([this, old_and_new_name] {
+                applyChangeTagName(old_and_new_name);
+
+                return true;
+            });
+        }
+
+        return;
+    }
+
+    applyChangeTagName(old_and_new_name);
+}
+
+void TagCache::applyChangeTagName(const QMap<QString, QString> &old_and_new_name)
+{
+    for (auto itr = old_and_new_name.cbegin(); itr != old_and_new_name.cend(); ++itr) {
+        int id{ tagId(itr.key()) };
+
+        if (id < 0) {
+            continue;
+        }
+
+        m_tagIds.remove(itr.key());
+        m_tagIds[itr.value()] = id;
+        m_tagNames[id] = itr.value();
+    }
+}
+
+void TagCache::changeTagColor(const QMap<QString, QString> &tag_and_new_color)
+{
+    QWriteLocker locker{ &m_lock };
+
+    if (!m_loaded) {
+        if (m_loading) {
+            m_pendingUpdates.push_back([this, tag_and_new_color] {
+                applyChangeTagColor(tag_and_new_color);
+
+                return true;
+            });
+        }
+
+        return;
+    }
+
+    applyChangeTagColor(tag_and_new_color);
+}
+
+void TagCache::applyChangeTagColor(const QMap<QString, QString> &tag_and_new_color)
+{
+    for (auto itr = tag_and_new_color.cbegin(); itr != tag_and_new_color.cend(); ++itr) {
+        int id{ tagId(itr.key()) };
+
+        if (id >= 0) {
+            m_tagColors[id] = Tag::NamesWithColors.value(itr.value());
+        }
+    }
+}
+
+void TagCache::deleteTags(const QList<QString> &tags)
+{
+    QWriteLocker locker{ &m_lock };
+
+    if (!m_loaded) {
+        if (m_loading) {
+            m_pendingUpdates.push_back([this, tags] {
+                applyDeleteTags(tags);
+
+                return true;
+            });
+        }
+
+        return;
+    }
+
+    applyDeleteTags(tags);
+}
+
+void TagCache::applyDeleteTags(const QList<QString> &tags)
+{
+    TagBits mask{ 0 };
+
+    for (const QString &tag : tags) {
+        int id{ tagId(tag) };
+
+        if (id >= 0) {
+            mask |= TagBits{ 1 } << id;
+        }
+    }
+
+    if (mask == 0) {
+        return;
+    }
+
+    for (QHash<quint64, TagBits>::iterator itr = m_filesTags.begin(); itr != m_filesTags.end();) {
+        itr.value() &= ~mask;
+
+        if (itr.value() == 0) {
+            itr = m_filesTags.erase(itr);
+        } else {
+            ++itr;
+        }
+    }
+
+    ///###: the ids of the deleted tags are not reused before reloading, so only the names are removed.
+    for (const QString &tag : tags) {
+        m_tagIds.remove(tag);
+    }
+}
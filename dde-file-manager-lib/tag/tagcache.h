@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAGCACHE_H
+#define TAGCACHE_H
+
+#include <QMap>
+#include <QHash>
+#include <QList>
+#include <QColor>
+#include <QVector>
+#include <QString>
+#include <QReadWriteLock>
+
+#include <atomic>
+#include <functional>
+
+
+///###: the tags of all files in memory, so that the views can get the tags of a file without DBus.
+///###: <the hash of file path, the bitset of tag ids>, the id of a tag is the index of it in m_tagNames.
+///###: it is loaded from TagManagerDaemon in a thread, and is updated by the signals of TagManagerDaemon.
+class TagCache final
+{
+public:
+    TagCache() = default;
+    ~TagCache() = default;
+
+    TagCache(const TagCache &other) = delete;
+    TagCache &operator=(const TagCache &other) = delete;
+
+    static TagCache *instance();
+
+    ///###: return false if the cache is not available(e.g. it is being loaded),
+    ///###: the caller should ask TagManagerDaemon in this case.
+    bool getTagsThroughFile(const QString &file, QList<QString> *tags, QList<QColor> *colors = nullptr) const;
+
+    void reload();
+
+    void filesWereTagged(const QMap<QString, QList<QString>> &files_were_tagged);
+    void untagFiles(const QMap<QString, QList<QString>> &tag_be_removed_files);
+    void changeTagName(const QMap<QString, QString> &old_and_new_name);
+    void changeTagColor(const QMap<QString, QString> &tag_and_new_color);
+    void deleteTags(const QList<QString> &tags);
+
+private:
+    using TagBits = quint64;
+
+    static quint64 hashOfFile(const QString &file);
+    static constexpr int MaxTagCount{ 64 };
+
+    int tagId(const QString &tag) const;
+
+    void doReload(int generation);
+
+    ///###: the following functions must be called with m_lock locked for writing.
+    ///###: return false if the cache has to be reloaded.
+    bool applyFilesWereTagged(const QMap<QString, QList<QString>> &files_were_tagged);
+    void applyUntagFiles(const QMap<QString, QList<QString>> &tag_be_removed_files);
+    void applyChangeTagName(const QMap<QString, QString> &old_and_new_name);
+    void applyChangeTagColor(const QMap<QString, QString> &tag_and_new_color);
+    void applyDeleteTags(const QList<QString> &tags);
+
+    mutable QReadWriteLock m_lock{};
+    bool m_loaded{ false };
+    bool m_loading{ false };
+    std::atomic<int> m_generation{ 0 };
+
+    ///###: the updates received while loading, they are applied after the loaded data is swapped in.
+    QList<std::function<bool()>> m_pendingUpdates{};
+
+    QVector<QString> m_tagNames{};
+    QVector<QColor> m_tagColors{};
+    QHash<QString, int> m_tagIds{};
+    QHash<quint64, TagBits> m_filesTags{};
+};
+
+#endif // TAGCACHE_H
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tagchangebatcher.h"
+#include "tagmanager.h"
+#include "durl.h"
+
+#include <QSet>
+#include <QList>
+#include <QPair>
+
+#include <algorithm>
+
+
+///###: the count of pending changes which will be sent immediately.
+static constexpr const std::size_t MaxPendingChanges{ 20000 };
+static constexpr const int DefaultWindow{ 200 };
+
+template<typename Func>
+static void forEachAncestor(const QByteArray &file, Func func)
+{
+    int index{ file.lastIndexOf('/') };
+
+    while (index > 0) {
+        func(file.left(index));
+        index = file.lastIndexOf('/', index - 1);
+    }
+}
+
+TagChangeBatcher::TagChangeBatcher(QObject *const parent)
+    : QObject{ parent }
+{
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(DefaultWindow);
+
+    QObject::connect(&m_timer, &QTimer::timeout, this, &TagChangeBatcher::flush);
+}
+
+TagChangeBatcher::~TagChangeBatcher()
+{
+    flush();
+}
+
+void TagChangeBatcher::setWindow(int msec)
+{
+    m_timer.setInterval(std::max(msec, 0));
+
+    if (msec <= 0) {
+        m_timer.stop();
+    }
+}
+
+void TagChangeBatcher::fileDeleted(const QByteArray &file)
+{
+    int index{ m_renameTargets.value(file, -1) };
+
+    if (index >= 0) {
+        m_renameTargets.remove(file);
+        Change &change = m_changes[static_cast<std::size_t>(index)];
+
+        ///###: a -> b, delete b: delete a, delete b.
+        ///###: b may be an existing file which had tags before the renaming,
+        ///###: so the deleting of b is still sent after the deleting of a.
+        if (!touchedAfter(change.origin, index) && !touchedAfter(file, index)) {
+            change.type = ChangeType::Delete;
+            change.target.clear();
+        }
+    }
+
+    m_changes.push_back(Change{ ChangeType::Delete, file, QByteArray{}, true });
+    touch(file, static_cast<int>(m_changes.size()) - 1);
+    schedule();
+}
+
+void TagChangeBatcher::fileRenamed(const QByteArray &oldName, const QByteArray &newName)
+{
+    if (oldName == newName) {
+        return;
+    }
+
+    int index{ m_renameTargets.value(oldName, -1) };
+
+    if (index >= 0) {
+        m_renameTargets.remove(oldName);
+        Change &change = m_changes[static_cast<std::size_t>(index)];
+
+        ///###: a -> b, b -> c: a -> c.
+        if (!touchedAfter(change.origin, index) && !touchedAfter(oldName, index)
+                && !touchedAfter(newName, index)) {
+
+            if (change.origin == newName) {
+                change.valid = false;
+            } else {
+                change.target = newName;
+                setRenameTarget(newName, index);
+                touch(newName, index);
+            }
+
+            return;
+        }
+    }
+
+    m_changes.push_back(Change{ ChangeType::Rename, oldName, newName, true });
+    index = static_cast<int>(m_changes.size()) - 1;
+    setRenameTarget(newName, index);
+    touch(oldName, index);
+    touch(newName, index);
+    schedule();
+}
+
+void TagChangeBatcher::flush()
+{
+    m_timer.stop();
+
+    if (m_changes.empty()) {
+        return;
+    }
+
+    std::vector<Change> changes{};
+    changes.swap(m_changes);
+    m_renameTargets.clear();
+    m_lastTouch.clear();
+    m_lastTouchBelow.clear();
+
+    QList<DUrl> deletedFiles{};
+    QList<QPair<QByteArray, QByteArray>> renamedFiles{};
+
+    ///###: the files and their parents in renamedFiles.
+    QSet<QByteArray> renamedPaths{};
+    QSet<QByteArray> renamedParents{};
+
+    auto sendDeletedFiles = [&] {
+        if (!deletedFiles.isEmpty()) {
+            TagManager::deleteFiles(deletedFiles);
+            deletedFiles.clear();
+        }
+    };
+
+    auto sendRenamedFiles = [&] {
+        if (!renamedFiles.isEmpty()) {
+            TagManager::changeFilesName(renamedFiles);
+            renamedFiles.clear();
+            renamedPaths.clear();
+            renamedParents.clear();
+        }
+    };
+
+    ///###: the renames in one request are executed in any order. so the rename which relies on
+    ///###: a previous rename(the same file, or the file in a renamed directory) must be in a new request.
+    auto overlapWithRenamedFiles = [&](const QByteArray & file) {
+        if (renamedPaths.contains(file) || renamedParents.contains(file)) {
+            return true;
+        }
+
+        bool overlap{ false };
+
+        forEachAncestor(file, [&](const QByteArray & parent) {
+            overlap = overlap || renamedPaths.contains(parent);
+        });
+
+        return overlap;
+    };
+
+    auto addToRenamedPaths = [&](const QByteArray & file) {
+        renamedPaths.insert(file);
+        forEachAncestor(file, [&](const QByteArray & parent) {
+            renamedParents.insert(parent);
+        });
+    };
+
+    for (const Change &change : changes) {
+
+        if (!change.valid) {
+            continue;
+        }
+
+        if (change.type == ChangeType::Delete) {
+            sendRenamedFiles();
+            deletedFiles.push_back(DUrl::fromLocalFile(QString::fromLocal8Bit(change.origin)));
+
+            continue;
+        }
+
+        sendDeletedFiles();
+
+        if (overlapWithRenamedFiles(change.origin) || overlapWithRenamedFiles(change.target)) {
+            sendRenamedFiles();
+        }
+
+        renamedFiles.push_back({ change.origin, change.target });
+        addToRenamedPaths(change.origin);
+        addToRenamedPaths(change.target);
+    }
+
+    sendDeletedFiles();
+    sendRenamedFiles();
+}
+
+void TagChangeBatcher::setRenameTarget(const QByteArray &target, int index)
+{
+    ///###: the target was changed by a previous change (a -> b, x -> b, delete b),
+    ///###: collapsing the deleting into this rename would lose the effect on the target,
+    ///###: so the deleting will be sent as a separate change.
+    if (touchedAfter(target, -1)) {
+        m_renameTargets.remove(target);
+    } else {
+        m_renameTargets[target] = index;
+    }
+}
+
+void TagChangeBatcher::touch(const QByteArray &file, int index)
+{
+    int &lastTouch = m_lastTouch[file];
+    lastTouch = std::max(lastTouch, index);
+
+    forEachAncestor(file, [this, index](const QByteArray & parent) {
+        int &lastTouchBelow = m_lastTouchBelow[parent];
+        lastTouchBelow = std::max(lastTouchBelow, index);
+    });
+}
+
+bool TagChangeBatcher::touchedAfter(const QByteArray &file, int index) const
+{
+    if (m_lastTouch.value(file, -1) > index || m_lastTouchBelow.value(file, -1) > index) {
+        return true;
+    }
+
+    bool touched{ false };
+
+    forEachAncestor(file, [&](const QByteArray & parent) {
+        touched = touched || m_lastTouch.value(parent, -1) > index;
+    });
+
+    return touched;
+}
+
+void TagChangeBatcher::schedule()
+{
+    if (m_changes.size() >= MaxPendingChanges) {
+        flush();
+    } else if (m_timer.interval() > 0 && !m_timer.isActive()) {
+        m_timer.start();
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2017 ~ 2018 Deepin Technology Co., Ltd.
+ *
+ * Author:     agent <agent@local>
+ *
+ * Maintainer: agent <agent@local>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TAGCHANGEBATCHER_H
+#define TAGCHANGEBATCHER_H
+
+#include <QHash>
+#include <QTimer>
+#include <QObject>
+#include <QByteArray>
+
+#include <vector>
+
+
+///###: collect the deleting/renaming of files and send them to TagManagerDaemon in batches.
+///###: the changes are collapsed before sending:
+///###: a rename chain (a -> b -> c) becomes one rename (a -> c),
+///###: a renamed file which was deleted later (a -> b, delete b) becomes the deleting of both files,
+///###: so the deletes are sent in one request. the rename is kept if the target was changed by a previous change.
+///###: the changes which depend on each other are sent in order, otherwise they are sent by one request.
+class TagChangeBatcher final : public QObject
+{
+    Q_OBJECT
+public:
+    explicit TagChangeBatcher(QObject *const parent = nullptr);
+    virtual ~TagChangeBatcher();
+
+    TagChangeBatcher(const TagChangeBatcher &other) = delete;
+    TagChangeBatcher &operator=(const TagChangeBatcher &other) = delete;
+
+    ///###: the changes will be sent after msec since the first pending change.
+    ///###: 0 means that the changes are only sent by flush().
+    void setWindow(int msec);
+
+    void fileDeleted(const QByteArray &file);
+    void fileRenamed(const QByteArray &oldName, const QByteArray &newName);
+
+    void flush();
+
+private:
+    enum class ChangeType : int {
+        Delete,
+        Rename
+    };
+
+    struct Change {
+        ChangeType type;
+        QByteArray origin;
+        QByteArray target;
+        bool valid;
+    };
+
+    void setRenameTarget(const QByteArray &target, int index);
+    void touch(const QByteArray &file, int index);
+    bool touchedAfter(const QByteArray &file, int index) const;
+    void schedule();
+
+    std::vector<Change> m_changes{};
+
+    ///###: <the target of a pending rename, the index of it in m_changes>.
+    QHash<QByteArray, int> m_renameTargets{};
+
+    ///###: the index of the last change which touched the file/the files in the directory.
+    QHash<QByteArray, int> m_lastTouch{};
+    QHash<QByteArray, int> m_lastTouchBelow{};
+
+    QTimer m_timer{};
+};
+
+#endif // TAGCHANGEBATCHER_H
@@ -7,10 +7,13 @@
 #include "tagmanager.h"
 #ifndef DDE_ANYTHINGMONITOR
 #include "singleton.h"
+#include "app/define.h"
 #include "tag/tagutil.h"
+#include "tag/tagcache.h"
 #include "shutil/dsqlitehandle.h"
 #include "app/filesignalmanager.h"
 #include "controllers/appcontroller.h"
+#include "deviceinfo/udisklistener.h"
 #endif
 #include "controllers/tagmanagerdaemoncontroller.h"
 
@@ -76,6 +79,11 @@ QList<QString> TagManager::getTagsThroughFiles(const QList<DUrl> &files)
     QMap<QString, QVariant> string_var{};
 
     if (!files.isEmpty()) {
+        QList<QString> tags{};
+
+        if (files.size() == 1 && TagCache::instance()->getTagsThroughFile(files.first().toLocalFile(), &tags)) {
+            return tags;
+        }
 
         for (const DUrl &url : files) {
             string_var[url.toLocalFile()] = QVariant{ QList<QString>{} };
@@ -382,6 +390,7 @@ void TagManager::init_connect()noexcept
 
     QObject::connect(TagManagerDaemonController::instance(), &TagManagerDaemonController::deleteTags, [this](const QVariant & be_deleted_tags) {
 
+        TagCache::instance()->deleteTags(be_deleted_tags.toStringList());
         emit this->deleteTag(be_deleted_tags.toStringList());
     });
 
@@ -395,6 +404,7 @@ void TagManager::init_connect()noexcept
             old_and_new[c_beg.key()] = c_beg.value().toString();
         }
 
+        TagCache::instance()->changeTagColor(old_and_new);
         emit this->changeTagColor(old_and_new);
     });
 
@@ -407,6 +417,7 @@ void TagManager::init_connect()noexcept
             old_and_new[c_beg.key()] = c_beg.value().toString();
         }
 
+        TagCache::instance()->changeTagName(old_and_new);
         emit this->changeTagName(old_and_new);
     });
 
@@ -419,6 +430,7 @@ void TagManager::init_connect()noexcept
             file_and_tags[the_beg.key()] = the_beg.value().toStringList();
         }
 
+        TagCache::instance()->filesWereTagged(file_and_tags);
         emit this->filesWereTagged(file_and_tags);
     });
 
@@ -431,8 +443,20 @@ void TagManager::init_connect()noexcept
             file_and_tags[the_beg.key()] = the_beg.value().toStringList();
         }
 
+        TagCache::instance()->untagFiles(file_and_tags);
         emit this->untagFiles(file_and_tags);
     });
+
+    ///###: the tags are saved in the partitions, the cache is out of date after mounting/unmounting a partition.
+    QObject::connect(deviceListener, &UDiskListener::mountAdded, this, [] {
+        TagCache::instance()->reload();
+    });
+
+    QObject::connect(deviceListener, &UDiskListener::mountRemoved, this, [] {
+        TagCache::instance()->reload();
+    });
+
+    TagCache::instance()->reload();
 }
 
 
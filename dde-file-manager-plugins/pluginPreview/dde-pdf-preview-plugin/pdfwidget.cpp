@@ -43,6 +43,7 @@
 #include <QTimer>
 #include <QButtonGroup>
 #include <QPushButton>
+#include <QSet>
 
 class PdfWidgetPrivate{
 public:
@@ -63,7 +64,8 @@ public:
     QSharedPointer<poppler::document> doc;
 
     PdfInitWorker* pdfInitWorker = NULL;
-    QMap<int, QImage> pageMap;
+    // 当前已创建显示控件的页面
+    QSet<int> loadedPages;
 
     PdfWidget* q_ptr = NULL;
     Q_DECLARE_PUBLIC(PdfWidget)
@@ -114,7 +116,7 @@ void PdfWidget::initDoc(const QString& file)
         d->isBadDoc = true;
     }
 
-    d->pdfInitWorker = new PdfInitWorker(d->doc);
+    d->pdfInitWorker = new PdfInitWorker(d->doc, this);
 }
 
 void PdfWidget::initUI()
@@ -169,8 +171,8 @@ void PdfWidget::initUI()
 
     initEmptyPages();
 
-    loadThumbSync(0);
-    loadPageSync(0);
+    loadThumbSync(0, DISPLAY_THUMB_NUM - 1);
+    loadPageSync(0, DISPLAT_PAGE_NUM - 1);
 }
 
 void PdfWidget::initConnections()
@@ -244,34 +246,43 @@ void PdfWidget::onThumbAdded(int index, QImage img)
     }
 }
 
-void PdfWidget::onpageAdded(int index, QImage img)
+void PdfWidget::onpageAdded(int index, int width, QImage img)
 {
     Q_D(PdfWidget);
 
-    d->pageMap.insert(index, img);
-
     QListWidgetItem* item = d->pageListWidget->item(index);
-    QWidget* w = d->pageListWidget->itemWidget(item);
 
-    if(!w){
-        img = img.scaled(d->pageListWidget->width(), img.height(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-        QImage page(d->pageListWidget->width(), img.height() + 4, QImage::Format_ARGB32_Premultiplied);
-        page.fill(Qt::white);
-        QPainter p(&page);
-        p.drawImage((page.width() - img.width())/2, 2, img);
-        if(index < (d->doc->pages() - 1)){
-            QPen pen(QColor(0, 0, 0 , 20));
-            p.setPen(pen);
-            p.drawLine(0, page.height() - 1, page.width(), page.height() - 1);
-        }
+    if(!item){
+        return;
+    }
 
-        QLabel* pageLabel = new QLabel(this);
-        pageLabel->setPixmap(QPixmap::fromImage(page));
+    // 渲染完成前控件大小已经改变，先缩放显示，等待按新的大小重新渲染
+    if(img.width() > pageWidth()){
+        img = img.scaled(pageWidth(), img.height(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    QImage page(pageWidth(), img.height() + 4, QImage::Format_ARGB32_Premultiplied);
+    page.fill(Qt::white);
+    QPainter p(&page);
+    p.drawImage((page.width() - img.width())/2, 2, img);
+    if(index < (d->doc->pages() - 1)){
+        QPen pen(QColor(0, 0, 0 , 20));
+        p.setPen(pen);
+        p.drawLine(0, page.height() - 1, page.width(), page.height() - 1);
+    }
 
+    QLabel* pageLabel = qobject_cast<QLabel*>(d->pageListWidget->itemWidget(item));
+
+    if(!pageLabel){
+        pageLabel = new QLabel(this);
         d->pageListWidget->setItemWidget(item, pageLabel);
-        item->setSizeHint(page.size());
+        d->loadedPages << index;
     }
 
+    pageLabel->setPixmap(QPixmap::fromImage(page));
+    pageLabel->setProperty("pageWidth", width);
+    item->setSizeHint(page.size());
+
     if(d->pageScrollBar->maximum() == 0){
         d->pageScrollBar->hide();
     } else {
@@ -297,8 +308,6 @@ void PdfWidget::onPageScrollBarvalueChanged(const int &val)
     d->pageWorkTimer->stop();
     d->pageWorkTimer->start();
 
-    resizeCurrentPage();
-
     QListWidgetItem* item = d->pageListWidget->itemAt(d->pageListWidget->width() /2 , 20);
     if(!item){
         return;
@@ -322,7 +331,7 @@ void PdfWidget::onPageScrollBarvalueChanged(const int &val)
 
 void PdfWidget::startLoadCurrentPages()
 {
-    Q_D(const PdfWidget);
+    Q_D(PdfWidget);
     QListWidgetItem* item = d->pageListWidget->itemAt(d->pageListWidget->width() / 2, 0);
     if(!item){
         item = d->pageListWidget->itemAt(d->pageListWidget->width() / 2, d->pageListWidget->spacing() * 2 + 1);
@@ -330,7 +339,19 @@ void PdfWidget::startLoadCurrentPages()
     if(item)
     {
         int row = d->pageListWidget->row(item);
-        loadPageSync(row);
+        int lastRow = row;
+        QListWidgetItem* lastItem = d->pageListWidget->itemAt(d->pageListWidget->width() / 2, d->pageListWidget->height() - 1);
+
+        if(lastItem){
+            lastRow = qMax(row, d->pageListWidget->row(lastItem));
+        }
+
+        int first = qMax(0, row - PRELOAD_PAGE_NUM);
+        int last = qMin(d->doc->pages() - 1, lastRow + PRELOAD_PAGE_NUM);
+
+        // 远离可见区域的页面不再保留显示控件，避免所有页面的图像常驻内存
+        releasePages(first - PRELOAD_PAGE_NUM, last + PRELOAD_PAGE_NUM);
+        loadPageSync(first, last);
     }
 }
 
@@ -346,7 +367,7 @@ void PdfWidget::startLoadCurrentThumbs()
     if(item)
     {
         int row = d->thumbListWidget->row(item);
-        loadThumbSync(row);
+        loadThumbSync(row, row + DISPLAY_THUMB_NUM - 1);
     }
 }
 
@@ -377,9 +398,10 @@ void PdfWidget::resizeEvent(QResizeEvent *event)
 
     d->pageScrollBar->setFixedSize(d->pageScrollBar->sizeHint().width(), event->size().height() - 30);
     d->pageScrollBar->move(event->size().width() - d->pageScrollBar->width(), 30);
-    d->pageListWidget->setFixedWidth(width() - d->thumbListWidget->width());
+    d->pageListWidget->setFixedWidth(pageWidth());
 
-    resizeCurrentPage();
+    // 按新的宽度重新渲染可见页面
+    d->pageWorkTimer->start();
 }
 
 void PdfWidget::renderBorder(QImage &img)
@@ -408,94 +430,84 @@ void PdfWidget::emptyBorder(QImage &img)
     painter.drawRect(0, 0, img.width() - 2, img.height() - 2);
 }
 
-void PdfWidget::loadPageSync(const int &index)
+int PdfWidget::pageWidth() const
 {
-    Q_D(PdfWidget);
+    Q_D(const PdfWidget);
 
-    QtConcurrent::run([=]{
-       d->pdfInitWorker->startGetPageImage(index);
-    });
+    return width() - d->thumbListWidget->width();
 }
 
-void PdfWidget::loadThumbSync(const int &index)
+void PdfWidget::loadPageSync(int first, int last)
 {
     Q_D(PdfWidget);
 
-    QtConcurrent::run([=]{
-        d->pdfInitWorker->startGetPageThumb(index);
-    });
-}
+    const int width = pageWidth();
+    QList<int> indexes;
 
-void PdfWidget::initEmptyPages()
-{
-    Q_D(PdfWidget);
+    last = qMin(last, d->doc->pages() - 1);
 
-    for(int i = 0; i < d->doc->pages(); i ++ ){
-        QListWidgetItem* pageItem = new QListWidgetItem;
-        pageItem->setSizeHint(DEFAULT_PAGE_SIZE);
+    for(int i = qMax(0, first); i <= last; i ++){
+        QWidget* w = d->pageListWidget->itemWidget(d->pageListWidget->item(i));
 
-        QListWidgetItem* thumbItem = new QListWidgetItem;
-        thumbItem->setSizeHint(DEFAULT_THUMB_SIZE);
+        //Skip for pages already rendered at current width
+        if(w && w->property("pageWidth").toInt() == width){
+            continue;
+        }
 
-        d->pageListWidget->addItem(pageItem);
-        d->thumbListWidget->addItem(thumbItem);
+        indexes << i;
     }
+
+    d->pdfInitWorker->requestPages(indexes, width);
 }
 
-void PdfWidget::resizeCurrentPage()
+void PdfWidget::loadThumbSync(int first, int last)
 {
     Q_D(PdfWidget);
 
-    QListWidgetItem* currentItem = d->pageListWidget->itemAt(d->pageListWidget->width() / 2, d->pageListWidget->height() / 2);
+    QList<int> indexes;
 
-    if(!currentItem)
-        return;
+    last = qMin(last, d->doc->pages() - 1);
 
-    int currentRow = d->pageListWidget->row(currentItem);
-    int index = currentRow - DISPLAT_PAGE_NUM/2;
-    if(index < 0){
-        index = 0;
-    }
-    int counter = 0;
-    while(counter < DISPLAT_PAGE_NUM){
-        counter ++;
+    for(int i = qMax(0, first); i <= last; i ++){
+        //Skip for indexed thumb we got
+        if(d->thumbListWidget->itemWidget(d->thumbListWidget->item(i))){
+            continue;
+        }
 
-        if(d->pageMap.contains(index)){
+        indexes << i;
+    }
 
-            QListWidgetItem* item = d->pageListWidget->item(index);
-            if(!item){
-                continue;
-            }
+    d->pdfInitWorker->requestThumbs(indexes);
+}
 
-            QWidget* w = d->pageListWidget->itemWidget(item);
-            if(!w){
-                continue;
-            }
+void PdfWidget::releasePages(int first, int last)
+{
+    Q_D(PdfWidget);
 
-            QLabel* label = qobject_cast<QLabel*>(w);
+    for(int index : d->loadedPages.toList()){
+        if(index >= first && index <= last){
+            continue;
+        }
 
-            QImage img = d->pageMap.value(index);
-            img = img.scaled(d->pageListWidget->width(), img.height(), Qt::KeepAspectRatio, Qt::SmoothTransformation);
-            QImage page(d->pageListWidget->width(), img.height() + 4, QImage::Format_ARGB32_Premultiplied);
-            page.fill(Qt::white);
+        // 保留占位大小，避免滚动条跳动
+        d->pageListWidget->removeItemWidget(d->pageListWidget->item(index));
+        d->loadedPages.remove(index);
+    }
+}
 
-            QPainter p(&page);
-            p.drawImage((page.width() - img.width()) / 2, 2, img);
+void PdfWidget::initEmptyPages()
+{
+    Q_D(PdfWidget);
 
-            if(index < (d->doc->pages() - 1)){
-                QPen pen(QColor(0, 0, 0 , 20));
-                p.setPen(pen);
-                p.drawLine(0, page.height() - 1, page.width(), page.height() - 1);
-            }
+    for(int i = 0; i < d->doc->pages(); i ++ ){
+        QListWidgetItem* pageItem = new QListWidgetItem;
+        pageItem->setSizeHint(DEFAULT_PAGE_SIZE);
 
-            label->setPixmap(QPixmap::fromImage(page));
-            item->setSizeHint(page.size());
+        QListWidgetItem* thumbItem = new QListWidgetItem;
+        thumbItem->setSizeHint(DEFAULT_THUMB_SIZE);
 
-            index ++;
-        } else {
-            index ++;
-            continue;
-        }
+        d->pageListWidget->addItem(pageItem);
+        d->thumbListWidget->addItem(thumbItem);
     }
 }
 
@@ -503,66 +515,74 @@ PdfInitWorker::PdfInitWorker(QSharedPointer<poppler::document> doc, QObject *par
     QObject(parent),
     m_doc(doc)
 {
+    // poppler::document 不支持多个线程同时渲染，因此只使用一个渲染线程
+    m_pool.setMaxThreadCount(1);
+    m_pageCache.setMaxCost(PAGE_CACHE_SIZE);
 
+    connect(this, &PdfInitWorker::pageRendered, this, &PdfInitWorker::onPageRendered, Qt::QueuedConnection);
 }
 
-void PdfInitWorker::startGetPageThumb(int index)
+PdfInitWorker::~PdfInitWorker()
 {
-    int counter = 0;
-    while(counter < DISPLAY_THUMB_NUM){
-        counter++;
+    m_pageGeneration.ref();
+    m_thumbGeneration.ref();
+    m_pool.clear();
+    m_pool.waitForDone();
+}
 
-        //Skip for indexed thumb we got
-        if(m_gotThumbIndexes.contains(index)){
-            index ++;
+void PdfInitWorker::requestPages(const QList<int> &indexes, int width)
+{
+    const int generation = m_pageGeneration.fetchAndAddOrdered(1) + 1;
+
+    for(int index : indexes){
+        if(const QImage* img = m_pageCache.object(qMakePair(index, width))){
+            emit pageAdded(index, width, *img);
             continue;
         }
 
-        QImage img = getRenderedPageImage(index);
+        QtConcurrent::run(&m_pool, [this, index, width, generation]{
+            //Skip for pages scrolled away before rendering
+            if(m_pageGeneration.load() != generation){
+                return;
+            }
 
-        if(img.isNull()){
-            break;
-        } else{
-            QImage thumb = getPageThumb(img);
-            emit thumbAdded(index, thumb);
-            m_gotThumbIndexes << index;
-            index ++;
-        }
+            QImage img = getRenderedPageImage(index, QSize(width, 0));
 
+            if(!img.isNull()){
+                emit pageRendered(index, width, img);
+            }
+        });
     }
 }
 
-void PdfInitWorker::startGetPageImage(int index)
+void PdfInitWorker::requestThumbs(const QList<int> &indexes)
 {
-    int counter = 0;
-    while(counter < DISPLAT_PAGE_NUM){
-        counter++;
+    const int generation = m_thumbGeneration.fetchAndAddOrdered(1) + 1;
 
-        //Skip for indexed page we got
-        if(m_gotPageIndexes.contains(index)){
-            index ++;
-            continue;
-        }
+    for(int index : indexes){
+        QtConcurrent::run(&m_pool, [this, index, generation]{
+            if(m_thumbGeneration.load() != generation){
+                return;
+            }
 
-        QImage img = getRenderedPageImage(index);
+            // 直接按缩略图大小渲染，不再先渲染原始大小的页面
+            QImage thumb = getRenderedPageImage(index, DEFAULT_THUMB_SIZE);
 
-        if(img.isNull()){
-            break;
-        } else {
-            emit pageAdded(index, img);
-            m_gotPageIndexes << index;
-            index ++;
-        }
+            if(!thumb.isNull()){
+                emit thumbAdded(index, thumb);
+            }
+        });
     }
 }
 
-QImage PdfInitWorker::getPageThumb(const QImage &img) const
+void PdfInitWorker::onPageRendered(const int &index, const int &width, const QImage &img)
 {
-    QImage newImg = img;
-    return newImg.scaled(DEFAULT_THUMB_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    m_pageCache.insert(qMakePair(index, width), new QImage(img), img.bytesPerLine() * img.height() / 1024);
+
+    emit pageAdded(index, width, img);
 }
 
-QImage PdfInitWorker::getRenderedPageImage(const int &index) const
+QImage PdfInitWorker::getRenderedPageImage(const int &index, const QSize &size) const
 {
     QImage img;
 
@@ -586,7 +606,23 @@ QImage PdfInitWorker::getRenderedPageImage(const int &index) const
         return img;
     }
 
-    poppler::image imageData = pr.render_page(page.data());
+    // poppler 默认以 72 DPI 渲染，即1点对应1像素；按显示大小换算分辨率。
+    // 未指定高度时只按宽度缩小，不放大页面
+    const poppler::rectf rect = page->page_rect();
+
+    if(rect.width() <= 0 || rect.height() <= 0){
+        return img;
+    }
+
+    qreal scale = size.width() / rect.width();
+
+    if(size.height() > 0){
+        scale = qMin(scale, size.height() / rect.height());
+    } else {
+        scale = qMin(scale, 1.0);
+    }
+
+    poppler::image imageData = pr.render_page(page.data(), 72.0 * scale, 72.0 * scale);
 
     if (!imageData.is_valid()) {
         qDebug () << "Render error";
@@ -599,33 +635,19 @@ QImage PdfInitWorker::getRenderedPageImage(const int &index) const
     case poppler::image::format_invalid:
         qDebug ()  << "Image format is invalid";
         return img;
+    //Note that the image data is released with imageData, so it must be copied
     case poppler::image::format_mono:
-        img = QImage((uchar*)imageData.data(), imageData.width(), imageData.height(), QImage::Format_Mono);
+        img = QImage((uchar*)imageData.data(), imageData.width(), imageData.height(),
+                     imageData.bytes_per_row(), QImage::Format_Mono).copy();
         break;
     case poppler::image::format_rgb24:
-        img = QImage((uchar*)imageData.data(),imageData.width(),imageData.height(),QImage::Format_ARGB6666_Premultiplied);
+        img = QImage((uchar*)imageData.data(), imageData.width(), imageData.height(),
+                     imageData.bytes_per_row(), QImage::Format_ARGB6666_Premultiplied).copy();
         break;
     case poppler::image::format_argb32:
     {
-        //Note that this format has problem that QImage cannot parse it normally
-        img = QImage(imageData.width(), imageData.height(), QImage::Format_ARGB32_Premultiplied);
-        img.fill(Qt::white);
-        int w = imageData.width();
-        int h = imageData.height();
-        int offset = imageData.bytes_per_row() / imageData.width();
-
-        char* pdata = imageData.data();
-
-        for(int y = 0; y < h; y ++){
-            for(int x = 0; x < w; x++){
-                uchar b = (uchar)pdata[(x * offset) + (y * w * offset)];
-                uchar g = (uchar)pdata[(x * offset) + (y * w * offset) + 1];
-                uchar r = (uchar)pdata[(x * offset) + (y * w * offset) + 2];
-                uchar a = (uchar)pdata[(x * offset) + (y * w * offset) + 3];
-
-                img.setPixelColor(x, y, QColor((int)r, (int)g, (int)b, (int)a));
-            }
-        }
+        img = QImage((uchar*)imageData.data(), imageData.width(), imageData.height(),
+                     imageData.bytes_per_row(), QImage::Format_ARGB32).convertToFormat(QImage::Format_ARGB32_Premultiplied);
         break;
     }
     default:
@@ -29,6 +29,9 @@
 #include <QSharedPointer>
 #include <QListWidget>
 #include <QLabel>
+#include <QThreadPool>
+#include <QCache>
+#include <QAtomicInt>
 
 #include "poppler-document.h"
 #include "poppler-page.h"
@@ -39,6 +42,10 @@
 #define DEFAULT_PAGE_SIZE QSize(800, 1200)
 #define DISPLAY_THUMB_NUM 10
 #define DISPLAT_PAGE_NUM 5
+// 可见区域前后额外渲染的页数
+#define PRELOAD_PAGE_NUM 2
+// 已渲染页面缓存的上限，单位KB
+#define PAGE_CACHE_SIZE (32 * 1024)
 
 class PdfWidgetPrivate;
 class PdfInitWorker;
@@ -58,7 +65,7 @@ public:
 
 public slots:
     void onThumbAdded(int index, QImage img);
-    void onpageAdded(int index, QImage img);
+    void onpageAdded(int index, int width, QImage img);
     void onThumbScrollBarValueChanged(const int& val);
     void onPageScrollBarvalueChanged(const int& val);
     void startLoadCurrentPages();
@@ -72,12 +79,12 @@ private:
     void renderBorder(QImage& img);
     void emptyBorder(QImage& img);
 
-    void loadPageSync(const int& index);
-    void loadThumbSync(const int& index);
+    int pageWidth() const;
+    void loadPageSync(int first, int last);
+    void loadThumbSync(int first, int last);
+    void releasePages(int first, int last);
     void initEmptyPages();
 
-    void resizeCurrentPage();
-
     QSharedPointer<PdfWidgetPrivate> d_ptr;
     Q_DECLARE_PRIVATE_D(qGetPtrHelper(d_ptr), PdfWidget)
 };
@@ -86,20 +93,26 @@ class PdfInitWorker: public QObject{
     Q_OBJECT
 public:
     explicit PdfInitWorker(QSharedPointer<poppler::document> doc, QObject* parent = 0);
+    ~PdfInitWorker();
 
-    void startGetPageThumb(int index);
-    void startGetPageImage(int index);
+    // 每次请求都会取消上一次请求中还未开始渲染的页面
+    void requestPages(const QList<int>& indexes, int width);
+    void requestThumbs(const QList<int>& indexes);
 
 signals:
-    void pageAdded(const int& index, const QImage& img);
+    void pageAdded(const int& index, const int& width, const QImage& img);
     void thumbAdded(const int& index, const QImage& img);
+    // 在渲染线程中发出，仅用于将结果转到主线程放入缓存
+    void pageRendered(const int& index, const int& width, const QImage& img);
 
 private:
-    QImage getPageThumb(const QImage& img) const;
-    QImage getRenderedPageImage(const int& index) const;
+    void onPageRendered(const int& index, const int& width, const QImage& img);
+    QImage getRenderedPageImage(const int& index, const QSize& size) const;
 
-    QList<int> m_gotThumbIndexes;
-    QList<int> m_gotPageIndexes;
+    QThreadPool m_pool;
+    QAtomicInt m_pageGeneration;
+    QAtomicInt m_thumbGeneration;
+    QCache<QPair<int, int>, QImage> m_pageCache;
 
     QSharedPointer<poppler::document> m_doc;
 };
@@ -63,6 +63,7 @@ DEFINES += QT_DEPRECATED_WARNINGS DDE_ANYTHINGMONITOR DFM_NO_FILE_WATCHER
 
 SOURCES += \
     $$DDE_FILE_MANAGER_LIB_DIR/tag/tagmanager.cpp \
+    $$DDE_FILE_MANAGER_LIB_DIR/tag/tagchangebatcher.cpp \
     $$DDE_FILE_MANAGER_LIB_DIR/shutil/danythingmonitorfilter.cpp \
     $$DDE_FILE_MANAGER_LIB_DIR/controllers/tagmanagerdaemoncontroller.cpp \
     $$DDE_FILE_MANAGER_LIB_DIR/controllers/interface/tagmanagerdaemon_interface.cpp \
@@ -77,6 +78,7 @@ SOURCES += \
 HEADERS += \
     $$DDE_FILE_MANAGER_DIR/utils/singleton.h \
     $$DDE_FILE_MANAGER_LIB_DIR/tag/tagmanager.h \
+    $$DDE_FILE_MANAGER_LIB_DIR/tag/tagchangebatcher.h \
     $$DDE_FILE_MANAGER_LIB_DIR/shutil/danythingmonitorfilter.h \
     $$DDE_FILE_MANAGER_LIB_DIR/controllers/tagmanagerdaemoncontroller.h \
     $$DDE_FILE_MANAGER_LIB_DIR/controllers/interface/tagmanagerdaemon_interface.h \
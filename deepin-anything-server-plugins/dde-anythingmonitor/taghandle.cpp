@@ -37,19 +37,14 @@ void TagHandle::onFileCreate(const QByteArrayList &files)
 void TagHandle::onFileDelete(const QByteArrayList &files)
 {
     if (!files.isEmpty()) {
-        QList<DUrl> url_list{};
 
         for (const QByteArray &byte_array : files) {
             bool result{ DAnythingMonitorFilter::instance()->whetherFilterCurrentPath(byte_array) };
 
             if (result) {
-                DUrl url{ DUrl::fromLocalFile(byte_array) };
-                url_list.push_back(url);
+                m_batcher.fileDeleted(byte_array);
             }
-
         }
-
-        TagManager::deleteFiles(url_list);
     }
 }
 
@@ -62,7 +57,7 @@ void TagHandle::onFileRename(const QList<QPair<QByteArray, QByteArray>> &files)
             bool result{ DAnythingMonitorFilter::instance()->whetherFilterCurrentPath(names.second) };
 
             if (result) {
-                TagManager::changeFilesName({ names });
+                m_batcher.fileRenamed(names.first, names.second);
             }
         }
     }
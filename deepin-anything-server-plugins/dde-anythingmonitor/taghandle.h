@@ -23,6 +23,8 @@
 
 #include <dasinterface.h>
 
+#include "tag/tagchangebatcher.h"
+
 
 using namespace DAS_NAMESPACE;
 
@@ -42,6 +44,9 @@ public:
     virtual void onFileCreate(const QByteArrayList &files) override;
     virtual void onFileDelete(const QByteArrayList &files) override;
     virtual void onFileRename(const QList<QPair<QByteArray, QByteArray>> &files) override;
+
+private:
+    TagChangeBatcher m_batcher{};
 };
 
 #endif // TAGHANDLE_H
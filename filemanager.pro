@@ -25,9 +25,15 @@ isEqual(BUILD_MINIMUM, YES){
     SUBDIRS += deepin-anything-server-plugins
 }
 
+# 性能测试程序，不会被安装
+CONFIG(ENABLE_BENCHMARKS) {
+    SUBDIRS += benchmarks
+}
+
 dde-file-manager.depends = dde-file-manager-lib
 dde-dock-plugins.depends = dde-file-manager-lib
 dde-desktop.depends = dde-file-manager-lib
 dde-file-manager-daemon.depends = dde-file-manager-lib
 deepin-anything-server-plugins.depends = dde-file-manager-lib
+benchmarks.depends = dde-file-manager-lib
 #dde-sharefiles.depends = dde-file-manager-lib